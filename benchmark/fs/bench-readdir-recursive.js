@@ -0,0 +1,51 @@
+// Compare fs.readdir() with `recursive: true` against walking the same tree
+// with one fs.readdir() call per directory.
+'use strict';
+
+const common = require('../common');
+const fs = require('fs');
+const path = require('path');
+
+const bench = common.createBenchmark(main, {
+  n: [10],
+  dir: ['lib', 'test', 'deps'],
+  method: ['recursive', 'walk'],
+  withFileTypes: ['true', 'false'],
+});
+
+function walk(root, withFileTypes, callback) {
+  const result = [];
+  let pending = 1;
+  (function read(dir) {
+    fs.readdir(path.join(root, dir), { withFileTypes: true }, (err, ents) => {
+      if (err) throw err;
+      for (const ent of ents) {
+        const name = path.join(dir, ent.name);
+        result.push(withFileTypes ? ent : name);
+        if (ent.isDirectory()) {
+          pending++;
+          read(name);
+        }
+      }
+      if (--pending === 0) callback(result);
+    });
+  })('');
+}
+
+function main({ n, dir, method, withFileTypes }) {
+  withFileTypes = withFileTypes === 'true';
+  const fullPath = path.resolve(__dirname, '../../', dir);
+  bench.start();
+  (function r(cntr) {
+    if (cntr-- <= 0)
+      return bench.end(n);
+    if (method === 'recursive') {
+      fs.readdir(fullPath, { recursive: true, withFileTypes }, (err) => {
+        if (err) throw err;
+        r(cntr);
+      });
+    } else {
+      walk(fullPath, withFileTypes, () => r(cntr));
+    }
+  }(n));
+}
@@ -0,0 +1,31 @@
+'use strict';
+
+const common = require('../common');
+const fs = require('fs');
+
+const bench = common.createBenchmark(main, {
+  n: [1e5],
+  method: ['stat', 'statMany'],
+});
+
+function main({ n, method }) {
+  const paths = new Array(n).fill(__filename);
+
+  if (method === 'statMany') {
+    bench.start();
+    fs.statMany(paths, (err) => {
+      if (err) throw err;
+      bench.end(n);
+    });
+    return;
+  }
+
+  let pending = n;
+  bench.start();
+  for (const path of paths) {
+    fs.stat(path, (err) => {
+      if (err) throw err;
+      if (--pending === 0) bench.end(n);
+    });
+  }
+}
@@ -0,0 +1,44 @@
+// Compare serving a file with response.sendFile() against piping an
+// fs.ReadStream into the response.
+'use strict';
+
+const common = require('../common.js');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../../test/common/tmpdir');
+
+const bench = common.createBenchmark(main, {
+  len: [64 * 1024, 1024 * 1024, 16 * 1024 * 1024],
+  method: ['sendFile', 'stream'],
+  c: [50],
+  duration: 5,
+});
+
+function main({ len, method, c, duration }) {
+  const http = require('http');
+  tmpdir.refresh();
+  const file = path.join(tmpdir.path, `.sendfile-${process.pid}`);
+  fs.writeFileSync(file, Buffer.alloc(len, 'x'));
+  const fd = fs.openSync(file, 'r');
+
+  const server = http.createServer((req, res) => {
+    if (method === 'sendFile') {
+      res.sendFile(fd, { length: len });
+    } else {
+      res.setHeader('Content-Length', len);
+      fs.createReadStream(null, { fd, start: 0, autoClose: false }).pipe(res);
+    }
+  });
+
+  server.listen(0, () => {
+    bench.http({
+      connections: c,
+      duration,
+      port: server.address().port,
+    }, () => {
+      server.close();
+      fs.closeSync(fd);
+      tmpdir.refresh();
+    });
+  });
+}
@@ -0,0 +1,17 @@
+'use strict';
+
+// Echo server for net-echo-latency.js, run in a child process so that its
+// event loop can be configured independently of the client's.
+const net = require('net');
+
+const server = net.createServer((socket) => {
+  socket.setNoDelay(true);
+  socket.on('data', (data) => socket.write(data));
+  socket.on('end', () => server.close());
+});
+
+server.listen(0, '127.0.0.1', () => {
+  process.send({ port: server.address().port });
+});
+
+process.on('disconnect', () => server.close());
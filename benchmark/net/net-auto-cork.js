@@ -0,0 +1,47 @@
+// Test the speed of making many small writes to a socket in one turn of the
+// event loop, with and without auto-corking.
+'use strict';
+
+const common = require('../common.js');
+const net = require('net');
+const PORT = common.PORT;
+
+const bench = common.createBenchmark(main, {
+  autoCork: [0, 1],
+  writes: [1, 4, 16],
+  len: [64, 1024],
+  dur: [5],
+});
+
+function main({ dur, len, writes, autoCork }) {
+  const chunk = Buffer.alloc(len, 'x');
+  let received = 0;
+
+  const server = net.createServer((socket) => {
+    socket.on('data', (data) => received += data.length);
+  });
+
+  server.listen(PORT, () => {
+    const socket = net.connect({ port: PORT, autoCork: autoCork === 1 });
+    socket.on('connect', () => {
+      bench.start();
+
+      socket.on('drain', send);
+      send();
+
+      setTimeout(() => {
+        const gbits = (received * 8) / (1024 * 1024 * 1024);
+        bench.end(gbits);
+        process.exit(0);
+      }, dur * 1000);
+
+      function send() {
+        let more = true;
+        for (let i = 0; i < writes; i++)
+          more = socket.write(chunk);
+        if (more)
+          setImmediate(send);
+      }
+    });
+  });
+}
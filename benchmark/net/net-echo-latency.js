@@ -0,0 +1,70 @@
+// Measure the round trip latency of small messages to an echo server in
+// another process, with and without event loop busy polling. One message is
+// in flight at a time, so both event loops go idle between round trips.
+//
+// The result is 1e9 divided by the `percentile` latency in nanoseconds, so that
+// higher is better like everywhere else: 1e6 / result is the latency in
+// microseconds. Pass --event-loop-busy-poll in NODE_BENCHMARK_FLAGS to busy
+// poll on the client side too.
+'use strict';
+
+const common = require('../common.js');
+const net = require('net');
+const { fork } = require('child_process');
+
+const bench = common.createBenchmark(main, {
+  busyPoll: [0, 50],
+  percentile: [50, 99],
+  len: [64, 4096],
+  n: [2e4],
+}, {
+  test: { busyPoll: 0, percentile: 99, n: 10 },
+});
+
+function main({ busyPoll, percentile, len, n }) {
+  const execArgv = busyPoll > 0 ? [`--event-loop-busy-poll=${busyPoll}`] : [];
+  const server = fork(`${__dirname}/_echo-server.js`, { execArgv });
+  const chunk = Buffer.alloc(len, 'x');
+  const latencies = new Float64Array(n);
+
+  server.on('message', ({ port }) => {
+    const socket = net.connect(port, '127.0.0.1');
+    socket.setNoDelay(true);
+
+    // Warm up before measuring.
+    let warmup = Math.min(n, 1000);
+    let i = 0;
+    let received = 0;
+    let sentAt;
+    let elapsed = 0n;
+
+    socket.on('connect', send);
+    socket.on('data', (data) => {
+      received += data.length;
+      if (received < len)
+        return;
+      received = 0;
+      if (warmup > 0) {
+        warmup--;
+      } else {
+        const latency = process.hrtime.bigint() - sentAt;
+        latencies[i++] = Number(latency);
+        elapsed += latency;
+      }
+      if (i < n) {
+        send();
+        return;
+      }
+      socket.end();
+      server.disconnect();
+      latencies.sort();
+      const index = Math.max(0, Math.ceil(n * percentile / 100) - 1);
+      bench.report(1e9 / latencies[index], elapsed);
+    });
+
+    function send() {
+      sentAt = process.hrtime.bigint();
+      socket.write(chunk);
+    }
+  });
+}
@@ -0,0 +1,92 @@
+// Test the speed of writing a string header and a large string body with one
+// writev() call, as HTTP responses do.
+'use strict';
+
+const common = require('../common.js');
+const net = require('net');
+const PORT = common.PORT;
+
+const bench = common.createBenchmark(main, {
+  // Strings that Buffer#toString() creates from more than about 1 MB of data
+  // are stored outside of the V8 heap, and can be written without copying.
+  type: ['external', 'flat', 'buf'],
+  encoding: ['latin1', 'utf8'],
+  len: [1 << 20, 4 << 20],
+  dur: [5],
+});
+
+function main({ dur, len, type, encoding }) {
+  const header = 'HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\n\r\n';
+  let body;
+  switch (type) {
+    case 'external':
+      body = Buffer.alloc(len, 'x').toString('latin1');
+      break;
+    case 'flat':
+      // Flattened into a sequential string in the V8 heap.
+      body = 'x'.repeat(len);
+      body.charCodeAt(0);
+      break;
+    case 'buf':
+      body = Buffer.alloc(len, 'x');
+      break;
+    default:
+      throw new Error(`invalid type: ${type}`);
+  }
+
+  const writer = new Writer();
+
+  // The actual benchmark.
+  const server = net.createServer((socket) => {
+    socket.pipe(writer);
+  });
+
+  server.listen(PORT, () => {
+    const socket = net.connect(PORT);
+    socket.on('connect', () => {
+      bench.start();
+
+      socket.on('drain', send);
+      send();
+
+      setTimeout(() => {
+        const bytes = writer.received;
+        const gbits = (bytes * 8) / (1024 * 1024 * 1024);
+        bench.end(gbits);
+        process.exit(0);
+      }, dur * 1000);
+
+      function send() {
+        let more;
+        do {
+          socket.cork();
+          socket.write(header, encoding);
+          more = socket.write(body, encoding);
+          socket.uncork();
+        } while (more);
+      }
+    });
+  });
+}
+
+function Writer() {
+  this.received = 0;
+  this.writable = true;
+}
+
+Writer.prototype.write = function(chunk, encoding, cb) {
+  this.received += chunk.length;
+
+  if (typeof encoding === 'function')
+    encoding();
+  else if (typeof cb === 'function')
+    cb();
+
+  return true;
+};
+
+// Doesn't matter, never emits anything.
+Writer.prototype.on = function() {};
+Writer.prototype.once = function() {};
+Writer.prototype.emit = function() {};
+Writer.prototype.prependListener = function() {};
@@ -0,0 +1,90 @@
+'use strict';
+
+// Saturate the libuv threadpool from several event loops at once. Every
+// worker thread keeps `concurrency` requests of the given `type` in flight
+// until it has completed `n` of them.
+
+const common = require('../common.js');
+const { Worker, parentPort, workerData } = require('worker_threads');
+
+if (process.argv[2] === 'pool child') {
+  return runChild(workerData);
+}
+
+const bench = common.createBenchmark(main, {
+  workers: [1, 4, 8],
+  type: ['fs', 'crypto', 'zlib', 'mixed'],
+  concurrency: [16],
+  n: [2e4],
+});
+
+function main({ n, workers, type, concurrency }) {
+  const perWorker = Math.ceil(n / workers);
+  let ready = 0;
+  let done = 0;
+  const children = [];
+
+  for (let i = 0; i < workers; i++) {
+    const worker = new Worker(__filename, {
+      argv: ['pool child'],
+      workerData: { n: perWorker, type, concurrency },
+    });
+    worker.on('message', onMessage);
+    children.push(worker);
+  }
+
+  function onMessage(msg) {
+    if (msg === 'ready') {
+      if (++ready === workers) {
+        bench.start();
+        for (const child of children)
+          child.postMessage('go');
+      }
+    } else if (++done === workers) {
+      bench.end(perWorker * workers);
+    }
+  }
+}
+
+function runChild({ n, type, concurrency }) {
+  const fs = require('fs');
+  const crypto = require('crypto');
+  const zlib = require('zlib');
+
+  const input = Buffer.alloc(16 * 1024, 'abcdefghij');
+  const kinds = type === 'mixed' ? ['fs', 'crypto', 'zlib'] : [type];
+  let started = 0;
+  let completed = 0;
+
+  function submit() {
+    const kind = kinds[started++ % kinds.length];
+    switch (kind) {
+      case 'fs':
+        fs.stat(__filename, onDone);
+        break;
+      case 'crypto':
+        crypto.pbkdf2('secret', 'salt', 1, 32, 'sha256', onDone);
+        break;
+      case 'zlib':
+        zlib.deflate(input, onDone);
+        break;
+      default:
+        throw new Error(`Unsupported type ${kind}`);
+    }
+  }
+
+  function onDone(err) {
+    if (err)
+      throw err;
+    if (++completed === n)
+      return parentPort.postMessage('done');
+    if (started < n)
+      submit();
+  }
+
+  parentPort.once('message', () => {
+    for (let i = 0; i < concurrency && started < n; i++)
+      submit();
+  });
+  parentPort.postMessage('ready');
+}
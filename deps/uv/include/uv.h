@@ -252,9 +252,23 @@ typedef struct uv_statfs_s uv_statfs_t;
 
 typedef enum {
   UV_LOOP_BLOCK_SIGNAL = 0,
-  UV_METRICS_IDLE_TIME
+  UV_METRICS_IDLE_TIME,
+  UV_METRICS_PHASE_TIME,
+  UV_LOOP_TIMER_WHEEL,
+  UV_METRICS_WORK_TIME,
+  UV_LOOP_BUSY_POLL
 } uv_loop_option;
 
+typedef enum {
+  UV_LOOP_PHASE_TIMERS = 0,
+  UV_LOOP_PHASE_PENDING,
+  UV_LOOP_PHASE_IDLE,
+  UV_LOOP_PHASE_PREPARE,
+  UV_LOOP_PHASE_POLL,
+  UV_LOOP_PHASE_CHECK,
+  UV_LOOP_PHASE_CLOSING
+} uv_loop_phase;
+
 typedef enum {
   UV_RUN_DEFAULT = 0,
   UV_RUN_ONCE,
@@ -329,6 +343,10 @@ typedef void (*uv_check_cb)(uv_check_t* handle);
 typedef void (*uv_idle_cb)(uv_idle_t* handle);
 typedef void (*uv_exit_cb)(uv_process_t*, int64_t exit_status, int term_signal);
 typedef void (*uv_walk_cb)(uv_handle_t* handle, void* arg);
+typedef void (*uv_loop_phase_cb)(uv_loop_t* loop,
+                                 uv_loop_phase phase,
+                                 uint64_t duration,
+                                 void* arg);
 typedef void (*uv_fs_cb)(uv_fs_t* req);
 typedef void (*uv_work_cb)(uv_work_t* req);
 typedef void (*uv_after_work_cb)(uv_work_t* req, int status);
@@ -575,7 +593,10 @@ UV_EXTERN int uv_tcp_simultaneous_accepts(uv_tcp_t* handle, int enable);
 
 enum uv_tcp_flags {
   /* Used with uv_tcp_bind, when an IPv6 address is used. */
-  UV_TCP_IPV6ONLY = 1
+  UV_TCP_IPV6ONLY = 1,
+  /* Used with uv_tcp_bind, lets several sockets listen on the same address
+   * and port, with the kernel distributing incoming connections. */
+  UV_TCP_REUSEPORT = 2
 };
 
 UV_EXTERN int uv_tcp_bind(uv_tcp_t* handle,
@@ -1278,6 +1299,9 @@ UV_EXTERN int uv_os_gethostname(char* buffer, size_t* size);
 UV_EXTERN int uv_os_uname(uv_utsname_t* buffer);
 
 UV_EXTERN uint64_t uv_metrics_idle_time(uv_loop_t* loop);
+UV_EXTERN int uv_metrics_work_time(const uv_req_t* req,
+                                   uint64_t* queue_time,
+                                   uint64_t* run_time);
 
 typedef enum {
   UV_FS_UNKNOWN = -1,
@@ -29,16 +29,33 @@
 
 #define MAX_THREADPOOL_SIZE 1024
 
+/* Every worker owns a run queue. Submitters push to one of them and idle
+ * workers steal from their siblings, so the common case only ever touches a
+ * per-worker lock instead of a single global one.
+ */
+struct uv__run_queue {
+  uv_mutex_t mutex;
+  QUEUE wq;
+};
+
+struct uv__worker_arg {
+  uv_sem_t* sem;
+  unsigned int index;
+};
+
 static uv_once_t once = UV_ONCE_INIT;
 static uv_cond_t cond;
 static uv_mutex_t mutex;
 static unsigned int idle_threads;
 static unsigned int slow_io_work_running;
+static unsigned int slow_io_scheduled;
+static unsigned int slow_io_parked;
+static unsigned int stopping;
 static unsigned int nthreads;
 static uv_thread_t* threads;
 static uv_thread_t default_threads[4];
-static QUEUE exit_message;
-static QUEUE wq;
+static struct uv__run_queue* run_queues;
+static struct uv__run_queue default_run_queues[4];
 static QUEUE run_slow_work_message;
 static QUEUE slow_io_pending_wq;
 
@@ -51,112 +68,394 @@ static void uv__cancelled(struct uv__work* w) {
 }
 
 
+/* Loops spread their submissions over the run queues round-robin, using a
+ * counter of their own so that no state is shared between submitters.
+ * Consecutive requests from one loop thus land in different queues and
+ * a worker that starts late still finds the oldest request in its own queue
+ * first. Workers re-post the slow I/O token with a hash of its address; the
+ * multiplier is Knuth's golden ratio constant.
+ */
+static unsigned int run_queue_index(QUEUE* q) {
+  return (unsigned int) (((uintptr_t) q >> 4) * 2654435761u >> 8) % nthreads;
+}
+
+
+/* Loops with UV_METRICS_WORK_TIME keep the timestamps of their requests in
+ * an open-addressed table keyed by the address of the request, so that
+ * struct uv__work, which is embedded in public request types, keeps its
+ * size. The loop thread adds and removes entries and workers fill in the run
+ * times, all with the loop's `wq_mutex` held. The table is at most half
+ * full, so probes always end at a free slot.
+ */
+static unsigned int work_time_slot(const uv__loop_internal_fields_t* lfields,
+                                   const struct uv__work* w) {
+  return (unsigned int) (((uintptr_t) w >> 4) * 2654435761u) &
+         (lfields->work_times_size - 1);
+}
+
+
+static struct uv__work_time* work_time_find(
+    uv__loop_internal_fields_t* lfields, const struct uv__work* w) {
+  struct uv__work_time* e;
+  unsigned int i;
+
+  if (lfields->work_times == NULL)
+    return NULL;
+
+  i = work_time_slot(lfields, w);
+  for (;;) {
+    e = &lfields->work_times[i];
+    if (e->w == w)
+      return e;
+    if (e->w == NULL)
+      return NULL;
+    i = (i + 1) & (lfields->work_times_size - 1);
+  }
+}
+
+
+static int work_time_grow(uv__loop_internal_fields_t* lfields) {
+  struct uv__work_time* old_times;
+  unsigned int old_size;
+  unsigned int i;
+  unsigned int j;
+
+  old_times = lfields->work_times;
+  old_size = lfields->work_times_size;
+  lfields->work_times_size = old_size == 0 ? 64 : 2 * old_size;
+  lfields->work_times = uv__calloc(lfields->work_times_size,
+                                   sizeof(lfields->work_times[0]));
+  if (lfields->work_times == NULL) {
+    lfields->work_times = old_times;
+    lfields->work_times_size = old_size;
+    return UV_ENOMEM;
+  }
+
+  for (i = 0; i < old_size; i++) {
+    if (old_times[i].w == NULL)
+      continue;
+    j = work_time_slot(lfields, old_times[i].w);
+    while (lfields->work_times[j].w != NULL)
+      j = (j + 1) & (lfields->work_times_size - 1);
+    lfields->work_times[j] = old_times[i];
+  }
+
+  uv__free(old_times);
+  return 0;
+}
+
+
+static void work_time_add(uv_loop_t* loop, const struct uv__work* w) {
+  uv__loop_internal_fields_t* lfields;
+  struct uv__work_time* e;
+  uint64_t now;
+  unsigned int i;
+
+  lfields = uv__get_internal_fields(loop);
+  now = uv_hrtime();
+
+  uv_mutex_lock(&loop->wq_mutex);
+  if (2 * (lfields->work_times_count + 1) > lfields->work_times_size)
+    if (work_time_grow(lfields))
+      goto out;  /* Not timed. */
+
+  i = work_time_slot(lfields, w);
+  while (lfields->work_times[i].w != NULL && lfields->work_times[i].w != w)
+    i = (i + 1) & (lfields->work_times_size - 1);
+
+  e = &lfields->work_times[i];
+
+  if (e->w == NULL)
+    lfields->work_times_count++;
+  e->w = w;
+  e->submit_time = now;
+  e->start_time = 0;
+  e->end_time = 0;
+
+out:
+  uv_mutex_unlock(&loop->wq_mutex);
+}
+
+
+/* Backward shift deletion: move later entries of the probe sequence up so
+ * that no lookup stops early at the freed slot.
+ */
+static void work_time_remove(uv__loop_internal_fields_t* lfields,
+                             struct uv__work_time* e) {
+  unsigned int mask;
+  unsigned int i;
+  unsigned int j;
+  unsigned int k;
+
+  mask = lfields->work_times_size - 1;
+  i = e - lfields->work_times;
+  j = i;
+  for (;;) {
+    j = (j + 1) & mask;
+    if (lfields->work_times[j].w == NULL)
+      break;
+    /* The entry stays put if its home slot lies cyclically in (i, j]. */
+    k = work_time_slot(lfields, lfields->work_times[j].w);
+    if (((j - k) & mask) < ((j - i) & mask))
+      continue;
+    lfields->work_times[i] = lfields->work_times[j];
+    i = j;
+  }
+
+  lfields->work_times[i].w = NULL;
+  lfields->work_times_count--;
+}
+
+
+void uv__work_time_free(uv_loop_t* loop) {
+  uv__loop_internal_fields_t* lfields;
+
+  lfields = uv__get_internal_fields(loop);
+  uv__free(lfields->work_times);
+  lfields->work_times = NULL;
+  lfields->work_times_size = 0;
+  lfields->work_times_count = 0;
+}
+
+
+static void push(QUEUE* q, unsigned int index) {
+  struct uv__run_queue* rq;
+  unsigned int wake;
+
+  rq = &run_queues[index];
+  uv_mutex_lock(&rq->mutex);
+  QUEUE_INSERT_TAIL(&rq->wq, q);
+  /* Read `idle_threads` while holding the run queue lock: a worker bumps it
+   * before re-checking every run queue under that queue's lock, so either it
+   * sees this item or we see it going idle. */
+  wake = idle_threads > 0;
+  uv_mutex_unlock(&rq->mutex);
+
+  if (wake) {
+    uv_mutex_lock(&mutex);
+    uv_cond_signal(&cond);
+    uv_mutex_unlock(&mutex);
+  }
+}
+
+
+static QUEUE* pop(struct uv__run_queue* rq) {
+  QUEUE* q;
+
+  if (QUEUE_EMPTY(&rq->wq))
+    return NULL;
+
+  q = QUEUE_HEAD(&rq->wq);
+  QUEUE_REMOVE(q);
+  QUEUE_INIT(q);  /* Signal uv_cancel() that the work req is executing. */
+  return q;
+}
+
+
+/* Look for work in the worker's own queue first, then try to steal from the
+ * others. Stealing uses trylock so that a busy sibling is skipped rather
+ * than waited on; the caller falls back to a locked sweep before sleeping.
+ */
+static QUEUE* find_work(unsigned int self) {
+  struct uv__run_queue* rq;
+  unsigned int i;
+  QUEUE* q;
+
+  rq = &run_queues[self];
+  uv_mutex_lock(&rq->mutex);
+  q = pop(rq);
+  uv_mutex_unlock(&rq->mutex);
+  if (q != NULL)
+    return q;
+
+  for (i = 1; i < nthreads; i++) {
+    rq = &run_queues[(self + i) % nthreads];
+    if (uv_mutex_trylock(&rq->mutex))
+      continue;
+    q = pop(rq);
+    uv_mutex_unlock(&rq->mutex);
+    if (q != NULL)
+      return q;
+  }
+
+  return NULL;
+}
+
+
+/* Like find_work() but blocks on every run queue lock. `mutex` must be held
+ * and `idle_threads` must already account for the caller.
+ */
+static QUEUE* find_work_locked(unsigned int self) {
+  struct uv__run_queue* rq;
+  unsigned int i;
+  QUEUE* q;
+
+  for (i = 0; i < nthreads; i++) {
+    rq = &run_queues[(self + i) % nthreads];
+    uv_mutex_lock(&rq->mutex);
+    q = pop(rq);
+    uv_mutex_unlock(&rq->mutex);
+    if (q != NULL)
+      return q;
+  }
+
+  return NULL;
+}
+
+
+/* Turn the run_slow_work_message token into a slow I/O request, or park the
+ * token when we're at the slow I/O threshold. A parked token is re-posted by
+ * the next worker that finishes slow I/O work.
+ */
+static QUEUE* claim_slow_work(void) {
+  QUEUE* q;
+  int repost;
+
+  uv_mutex_lock(&mutex);
+  if (slow_io_work_running >= slow_work_thread_threshold()) {
+    slow_io_parked = 1;
+    uv_mutex_unlock(&mutex);
+    return NULL;
+  }
+
+  /* If we encountered a request to run slow I/O work but there is none
+     to run, that means it's cancelled => Start over. */
+  if (QUEUE_EMPTY(&slow_io_pending_wq)) {
+    slow_io_scheduled = 0;
+    uv_mutex_unlock(&mutex);
+    return NULL;
+  }
+
+  slow_io_work_running++;
+
+  q = QUEUE_HEAD(&slow_io_pending_wq);
+  QUEUE_REMOVE(q);
+  QUEUE_INIT(q);
+
+  /* If there is more slow I/O work, schedule it to be run as well. */
+  repost = !QUEUE_EMPTY(&slow_io_pending_wq);
+  if (!repost)
+    slow_io_scheduled = 0;
+  uv_mutex_unlock(&mutex);
+
+  if (repost)
+    push(&run_slow_work_message, run_queue_index(&run_slow_work_message));
+
+  return q;
+}
+
+
+static void finish_slow_work(void) {
+  int repost;
+
+  uv_mutex_lock(&mutex);
+  slow_io_work_running--;
+  repost = 0;
+  if (slow_io_parked) {
+    slow_io_parked = 0;
+    repost = !QUEUE_EMPTY(&slow_io_pending_wq);
+    if (!repost)
+      slow_io_scheduled = 0;
+  }
+  uv_mutex_unlock(&mutex);
+
+  if (repost)
+    push(&run_slow_work_message, run_queue_index(&run_slow_work_message));
+}
+
+
 /* To avoid deadlock with uv_cancel() it's crucial that the worker
  * never holds the global mutex and the loop-local mutex at the same time.
+ * Lock order is `mutex`, then run queue locks in index order, then the
+ * loop's `wq_mutex`.
  */
 static void worker(void* arg) {
+  struct uv__work_time* e;
   struct uv__work* w;
+  uint64_t start_time;
+  uint64_t end_time;
+  unsigned int self;
   QUEUE* q;
   int is_slow_work;
 
-  uv_sem_post((uv_sem_t*) arg);
+  self = ((struct uv__worker_arg*) arg)->index;
+  uv_sem_post(((struct uv__worker_arg*) arg)->sem);
   arg = NULL;
 
-  uv_mutex_lock(&mutex);
   for (;;) {
-    /* `mutex` should always be locked at this point. */
-
-    /* Keep waiting while either no work is present or only slow I/O
-       and we're at the threshold for that. */
-    while (QUEUE_EMPTY(&wq) ||
-           (QUEUE_HEAD(&wq) == &run_slow_work_message &&
-            QUEUE_NEXT(&run_slow_work_message) == &wq &&
-            slow_io_work_running >= slow_work_thread_threshold())) {
-      idle_threads += 1;
-      uv_cond_wait(&cond, &mutex);
-      idle_threads -= 1;
-    }
-
-    q = QUEUE_HEAD(&wq);
-    if (q == &exit_message) {
-      uv_cond_signal(&cond);
+    q = find_work(self);
+
+    if (q == NULL) {
+      uv_mutex_lock(&mutex);
+      for (;;) {
+        idle_threads += 1;
+        q = find_work_locked(self);
+        if (q != NULL || stopping) {
+          idle_threads -= 1;
+          break;
+        }
+        uv_cond_wait(&cond, &mutex);
+        idle_threads -= 1;
+      }
       uv_mutex_unlock(&mutex);
-      break;
-    }
 
-    QUEUE_REMOVE(q);
-    QUEUE_INIT(q);  /* Signal uv_cancel() that the work req is executing. */
+      if (q == NULL) {
+        /* Pass the exit request on to the next worker. */
+        uv_mutex_lock(&mutex);
+        uv_cond_signal(&cond);
+        uv_mutex_unlock(&mutex);
+        break;
+      }
+    }
 
     is_slow_work = 0;
     if (q == &run_slow_work_message) {
-      /* If we're at the slow I/O threshold, re-schedule until after all
-         other work in the queue is done. */
-      if (slow_io_work_running >= slow_work_thread_threshold()) {
-        QUEUE_INSERT_TAIL(&wq, q);
-        continue;
-      }
-
-      /* If we encountered a request to run slow I/O work but there is none
-         to run, that means it's cancelled => Start over. */
-      if (QUEUE_EMPTY(&slow_io_pending_wq))
+      q = claim_slow_work();
+      if (q == NULL)
         continue;
-
       is_slow_work = 1;
-      slow_io_work_running++;
-
-      q = QUEUE_HEAD(&slow_io_pending_wq);
-      QUEUE_REMOVE(q);
-      QUEUE_INIT(q);
-
-      /* If there is more slow I/O work, schedule it to be run as well. */
-      if (!QUEUE_EMPTY(&slow_io_pending_wq)) {
-        QUEUE_INSERT_TAIL(&wq, &run_slow_work_message);
-        if (idle_threads > 0)
-          uv_cond_signal(&cond);
-      }
     }
 
-    uv_mutex_unlock(&mutex);
-
     w = QUEUE_DATA(q, struct uv__work, wq);
+    start_time = uv_hrtime();
     w->work(w);
+    end_time = uv_hrtime();
 
     uv_mutex_lock(&w->loop->wq_mutex);
+    e = work_time_find(uv__get_internal_fields(w->loop), w);
+    if (e != NULL) {
+      e->start_time = start_time;
+      e->end_time = end_time;
+    }
     w->work = NULL;  /* Signal uv_cancel() that the work req is done
                         executing. */
     QUEUE_INSERT_TAIL(&w->loop->wq, &w->wq);
     uv_async_send(&w->loop->wq_async);
     uv_mutex_unlock(&w->loop->wq_mutex);
 
-    /* Lock `mutex` since that is expected at the start of the next
-     * iteration. */
-    uv_mutex_lock(&mutex);
-    if (is_slow_work) {
-      /* `slow_io_work_running` is protected by `mutex`. */
-      slow_io_work_running--;
-    }
+    if (is_slow_work)
+      finish_slow_work();
   }
 }
 
 
-static void post(QUEUE* q, enum uv__work_kind kind) {
-  uv_mutex_lock(&mutex);
+static void post(QUEUE* q, enum uv__work_kind kind, unsigned int index) {
   if (kind == UV__WORK_SLOW_IO) {
+    uv_mutex_lock(&mutex);
     /* Insert into a separate queue. */
     QUEUE_INSERT_TAIL(&slow_io_pending_wq, q);
-    if (!QUEUE_EMPTY(&run_slow_work_message)) {
+    if (slow_io_scheduled) {
       /* Running slow I/O tasks is already scheduled => Nothing to do here.
          The worker that runs said other task will schedule this one as well. */
       uv_mutex_unlock(&mutex);
       return;
     }
+    slow_io_scheduled = 1;
+    uv_mutex_unlock(&mutex);
     q = &run_slow_work_message;
   }
 
-  QUEUE_INSERT_TAIL(&wq, q);
-  if (idle_threads > 0)
-    uv_cond_signal(&cond);
-  uv_mutex_unlock(&mutex);
+  push(q, index);
 }
 
 
@@ -172,25 +471,36 @@ void uv__threadpool_cleanup(void) {
 
 #ifndef __MVS__
   /* TODO(gabylb) - zos: revisit when Woz compiler is available. */
-  post(&exit_message, UV__WORK_CPU);
+  uv_mutex_lock(&mutex);
+  stopping = 1;
+  uv_cond_signal(&cond);
+  uv_mutex_unlock(&mutex);
 #endif
 
   for (i = 0; i < nthreads; i++)
     if (uv_thread_join(threads + i))
       abort();
 
+  for (i = 0; i < nthreads; i++)
+    uv_mutex_destroy(&run_queues[i].mutex);
+
   if (threads != default_threads)
     uv__free(threads);
 
+  if (run_queues != default_run_queues)
+    uv__free(run_queues);
+
   uv_mutex_destroy(&mutex);
   uv_cond_destroy(&cond);
 
   threads = NULL;
+  run_queues = NULL;
   nthreads = 0;
 }
 
 
 static void init_threads(void) {
+  struct uv__worker_arg arg;
   unsigned int i;
   const char* val;
   uv_sem_t sem;
@@ -205,11 +515,16 @@ static void init_threads(void) {
     nthreads = MAX_THREADPOOL_SIZE;
 
   threads = default_threads;
+  run_queues = default_run_queues;
   if (nthreads > ARRAY_SIZE(default_threads)) {
     threads = uv__malloc(nthreads * sizeof(threads[0]));
-    if (threads == NULL) {
+    run_queues = uv__malloc(nthreads * sizeof(run_queues[0]));
+    if (threads == NULL || run_queues == NULL) {
+      uv__free(threads);
+      uv__free(run_queues);
       nthreads = ARRAY_SIZE(default_threads);
       threads = default_threads;
+      run_queues = default_run_queues;
     }
   }
 
@@ -219,19 +534,32 @@ static void init_threads(void) {
   if (uv_mutex_init(&mutex))
     abort();
 
-  QUEUE_INIT(&wq);
+  for (i = 0; i < nthreads; i++) {
+    if (uv_mutex_init(&run_queues[i].mutex))
+      abort();
+    QUEUE_INIT(&run_queues[i].wq);
+  }
+
   QUEUE_INIT(&slow_io_pending_wq);
   QUEUE_INIT(&run_slow_work_message);
+  idle_threads = 0;
+  slow_io_work_running = 0;
+  slow_io_scheduled = 0;
+  slow_io_parked = 0;
+  stopping = 0;
 
   if (uv_sem_init(&sem, 0))
     abort();
 
-  for (i = 0; i < nthreads; i++)
-    if (uv_thread_create(threads + i, worker, &sem))
+  /* Workers copy their index out of `arg` before posting `sem`, so it can be
+   * reused for the next thread once the wait returns. */
+  arg.sem = &sem;
+  for (i = 0; i < nthreads; i++) {
+    arg.index = i;
+    if (uv_thread_create(threads + i, worker, &arg))
       abort();
-
-  for (i = 0; i < nthreads; i++)
     uv_sem_wait(&sem);
+  }
 
   uv_sem_destroy(&sem);
 }
@@ -249,7 +577,7 @@ static void init_once(void) {
 #ifndef _WIN32
   /* Re-initialize the threadpool after fork.
    * Note that this discards the global mutex and condition as well
-   * as the work queue.
+   * as the run queues.
    */
   if (pthread_atfork(NULL, NULL, &reset_once))
     abort();
@@ -267,14 +595,23 @@ void uv__work_submit(uv_loop_t* loop,
   w->loop = loop;
   w->work = work;
   w->done = done;
-  post(&w->wq, kind);
+  if (uv__get_internal_fields(loop)->flags & UV_METRICS_WORK_TIME)
+    work_time_add(loop, w);
+  post(&w->wq,
+       kind,
+       uv__get_internal_fields(loop)->next_run_queue++ % nthreads);
 }
 
 
 static int uv__work_cancel(uv_loop_t* loop, uv_req_t* req, struct uv__work* w) {
+  unsigned int i;
   int cancelled;
 
+  /* The request can sit in any of the run queues or in the slow I/O queue,
+   * so take every lock that guards `w->wq`. */
   uv_mutex_lock(&mutex);
+  for (i = 0; i < nthreads; i++)
+    uv_mutex_lock(&run_queues[i].mutex);
   uv_mutex_lock(&w->loop->wq_mutex);
 
   cancelled = !QUEUE_EMPTY(&w->wq) && w->work != NULL;
@@ -282,6 +619,8 @@ static int uv__work_cancel(uv_loop_t* loop, uv_req_t* req, struct uv__work* w) {
     QUEUE_REMOVE(&w->wq);
 
   uv_mutex_unlock(&w->loop->wq_mutex);
+  for (i = nthreads; i > 0; i--)
+    uv_mutex_unlock(&run_queues[i - 1].mutex);
   uv_mutex_unlock(&mutex);
 
   if (!cancelled)
@@ -298,6 +637,8 @@ static int uv__work_cancel(uv_loop_t* loop, uv_req_t* req, struct uv__work* w) {
 
 
 void uv__work_done(uv_async_t* handle) {
+  uv__loop_internal_fields_t* lfields;
+  struct uv__work_time* e;
   struct uv__work* w;
   uv_loop_t* loop;
   QUEUE* q;
@@ -305,6 +646,7 @@ void uv__work_done(uv_async_t* handle) {
   int err;
 
   loop = container_of(handle, uv_loop_t, wq_async);
+  lfields = uv__get_internal_fields(loop);
   uv_mutex_lock(&loop->wq_mutex);
   QUEUE_MOVE(&loop->wq, &wq);
   uv_mutex_unlock(&loop->wq_mutex);
@@ -315,7 +657,23 @@ void uv__work_done(uv_async_t* handle) {
 
     w = container_of(q, struct uv__work, wq);
     err = (w->work == uv__cancelled) ? UV_ECANCELED : 0;
+
+    /* The entry goes before `done` runs since that may free the request and
+     * reuse its address. uv_metrics_work_time() reads the copy.
+     */
+    if (lfields->work_times != NULL) {
+      uv_mutex_lock(&loop->wq_mutex);
+      e = work_time_find(lfields, w);
+      if (e != NULL) {
+        if (e->start_time != 0)
+          lfields->work_time_done = *e;
+        work_time_remove(lfields, e);
+      }
+      uv_mutex_unlock(&loop->wq_mutex);
+    }
+
     w->done(w, err);
+    lfields->work_time_done.w = NULL;
   }
 }
 
@@ -391,3 +749,52 @@ int uv_cancel(uv_req_t* req) {
 
   return uv__work_cancel(loop, req, wreq);
 }
+
+
+int uv_metrics_work_time(const uv_req_t* req,
+                         uint64_t* queue_time,
+                         uint64_t* run_time) {
+  const struct uv__work_time* done;
+  const struct uv__work* wreq;
+  uv_loop_t* loop;
+
+  switch (req->type) {
+  case UV_FS:
+    loop = ((const uv_fs_t*) req)->loop;
+    wreq = &((const uv_fs_t*) req)->work_req;
+    break;
+  case UV_GETADDRINFO:
+    loop = ((const uv_getaddrinfo_t*) req)->loop;
+    wreq = &((const uv_getaddrinfo_t*) req)->work_req;
+    break;
+  case UV_GETNAMEINFO:
+    loop = ((const uv_getnameinfo_t*) req)->loop;
+    wreq = &((const uv_getnameinfo_t*) req)->work_req;
+    break;
+  case UV_RANDOM:
+    loop = ((const uv_random_t*) req)->loop;
+    wreq = &((const uv_random_t*) req)->work_req;
+    break;
+  case UV_WORK:
+    loop = ((const uv_work_t*) req)->loop;
+    wreq = &((const uv_work_t*) req)->work_req;
+    break;
+  default:
+    return UV_EINVAL;
+  }
+
+  /* Synchronous fs requests have no loop. Only the request whose completion
+   * callback is running has its times in `work_time_done`; cancelled ones
+   * never ran and aren't copied there.
+   */
+  if (loop == NULL)
+    return UV_EINVAL;
+
+  done = &uv__get_internal_fields(loop)->work_time_done;
+  if (done->w != wreq)
+    return UV_EINVAL;
+
+  *queue_time = done->start_time - done->submit_time;
+  *run_time = done->end_time - done->start_time;
+  return 0;
+}
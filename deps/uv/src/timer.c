@@ -25,6 +25,32 @@
 #include <assert.h>
 #include <limits.h>
 
+/* Hierarchical timing wheel, used instead of the binary heap when the loop
+ * is configured with UV_LOOP_TIMER_WHEEL.
+ *
+ * Every level has 64 slots; a slot in level n covers 8^n milliseconds. A
+ * timer is filed in the lowest level that can hold its timeout and its expiry
+ * is rounded up to that level's granularity. Timers are never moved between
+ * levels, so a timer that is due in d milliseconds may fire up to d/8
+ * milliseconds late, in exchange for O(1) start and stop.
+ *
+ * Slots are circular lists threaded through the handle's heap_node field:
+ * heap_node[0..1] is the QUEUE link and heap_node[2] points to the slot head.
+ * A per-level bitmap of non-empty slots keeps uv__next_timeout() cheap.
+ */
+#define UV__WHEEL_LEVELS 8
+#define UV__WHEEL_SLOTS 64
+#define UV__WHEEL_LEVEL_SHIFT 3  /* Each level is 8 times coarser. */
+
+#define UV__WHEEL_SHIFT(lvl) ((lvl) * UV__WHEEL_LEVEL_SHIFT)
+#define UV__WHEEL_GRAN(lvl) ((uint64_t) 1 << UV__WHEEL_SHIFT(lvl))
+
+struct uv__timer_wheel {
+  uint64_t clk;  /* All slots before this point in time have been run. */
+  uint64_t pending[UV__WHEEL_LEVELS];
+  QUEUE slots[UV__WHEEL_LEVELS * UV__WHEEL_SLOTS];
+};
+
 
 static struct heap *timer_heap(const uv_loop_t* loop) {
 #ifdef _WIN32
@@ -55,6 +81,203 @@ static int timer_less_than(const struct heap_node* ha,
 }
 
 
+static struct uv__timer_wheel* timer_wheel(const uv_loop_t* loop) {
+  return uv__get_internal_fields(loop)->timer_wheel;
+}
+
+
+int uv__timer_wheel_init(uv_loop_t* loop) {
+  struct uv__timer_wheel* wheel;
+  unsigned int i;
+
+  if (timer_wheel(loop) != NULL)
+    return 0;
+
+  /* Timers that are already on the heap can't be migrated. */
+  if (heap_min(timer_heap(loop)) != NULL)
+    return UV_EBUSY;
+
+  wheel = uv__malloc(sizeof(*wheel));
+  if (wheel == NULL)
+    return UV_ENOMEM;
+
+  wheel->clk = loop->time;
+  for (i = 0; i < UV__WHEEL_LEVELS; i++)
+    wheel->pending[i] = 0;
+  for (i = 0; i < ARRAY_SIZE(wheel->slots); i++)
+    QUEUE_INIT(&wheel->slots[i]);
+
+  uv__get_internal_fields(loop)->timer_wheel = wheel;
+  return 0;
+}
+
+
+void uv__timer_wheel_free(uv_loop_t* loop) {
+  uv__free(timer_wheel(loop));
+  uv__get_internal_fields(loop)->timer_wheel = NULL;
+}
+
+
+/* Returns the point in time at which the next non-empty slot comes up, or
+ * UINT64_MAX if the wheel is empty.
+ */
+static uint64_t timer_wheel_next(const struct uv__timer_wheel* wheel) {
+  uint64_t next;
+  uint64_t bits;
+  uint64_t pos;
+  unsigned int lvl;
+  unsigned int idx;
+  unsigned int n;
+
+  next = (uint64_t) -1;
+  for (lvl = 0; lvl < UV__WHEEL_LEVELS; lvl++) {
+    bits = wheel->pending[lvl];
+    if (bits == 0)
+      continue;
+
+    /* First slot of this level that isn't in the past. */
+    pos = (wheel->clk + UV__WHEEL_GRAN(lvl) - 1) >> UV__WHEEL_SHIFT(lvl);
+    idx = pos & (UV__WHEEL_SLOTS - 1);
+    if (idx != 0)
+      bits = (bits >> idx) | (bits << (UV__WHEEL_SLOTS - idx));
+
+    for (n = 0; !(bits & 1); n++)
+      bits >>= 1;
+
+    pos = (pos + n) << UV__WHEEL_SHIFT(lvl);
+    if (pos < next)
+      next = pos;
+  }
+
+  return next;
+}
+
+
+static void timer_wheel_insert(struct uv__timer_wheel* wheel,
+                               uv_timer_t* handle) {
+  uint64_t expires;
+  uint64_t delta;
+  unsigned int lvl;
+  unsigned int idx;
+  QUEUE* slot;
+
+  /* The wheel's clock only moves in uv__run_timers(). Catch up with the
+   * loop first, or a short timeout that is started after a long poll would
+   * land in a needlessly coarse level.
+   */
+  if (wheel->clk < handle->loop->time) {
+    wheel->clk = timer_wheel_next(wheel);
+    if (wheel->clk > handle->loop->time)
+      wheel->clk = handle->loop->time;
+  }
+
+  expires = handle->timeout;
+  if (expires < wheel->clk)
+    expires = wheel->clk;
+
+  /* Level 0 is exact. Level n holds timers that are due within 63 of its
+   * slots, leaving room to round the expiry up without wrapping around.
+   */
+  delta = expires - wheel->clk;
+  if (delta < UV__WHEEL_SLOTS) {
+    lvl = 0;
+  } else {
+    for (lvl = 1; lvl < UV__WHEEL_LEVELS - 1; lvl++)
+      if (delta < (UV__WHEEL_SLOTS - 1) * UV__WHEEL_GRAN(lvl))
+        break;
+
+    /* Timeouts beyond the last level are parked in its farthest slot and
+     * filed again when that slot comes up.
+     */
+    if (delta >= (UV__WHEEL_SLOTS - 1) * UV__WHEEL_GRAN(lvl))
+      expires = wheel->clk + (UV__WHEEL_SLOTS - 1) * UV__WHEEL_GRAN(lvl) - 1;
+
+    expires += UV__WHEEL_GRAN(lvl) - 1;
+  }
+
+  idx = (expires >> UV__WHEEL_SHIFT(lvl)) & (UV__WHEEL_SLOTS - 1);
+  slot = &wheel->slots[lvl * UV__WHEEL_SLOTS + idx];
+
+  QUEUE_INSERT_TAIL(slot, (QUEUE*) &handle->heap_node);
+  handle->heap_node[2] = slot;
+  wheel->pending[lvl] |= (uint64_t) 1 << idx;
+}
+
+
+static void timer_wheel_remove(struct uv__timer_wheel* wheel,
+                               uv_timer_t* handle) {
+  QUEUE* slot;
+  unsigned int n;
+
+  slot = handle->heap_node[2];
+  QUEUE_REMOVE((QUEUE*) &handle->heap_node);
+
+  /* The handle may have been detached from its slot by timer_wheel_run()
+   * already, in which case the slot is empty or holds newer timers.
+   */
+  if (QUEUE_EMPTY(slot)) {
+    n = slot - wheel->slots;
+    wheel->pending[n / UV__WHEEL_SLOTS] &=
+        ~((uint64_t) 1 << (n % UV__WHEEL_SLOTS));
+  }
+}
+
+
+static void timer_wheel_run(uv_loop_t* loop, struct uv__timer_wheel* wheel) {
+  uv_timer_t* handle;
+  unsigned int lvl;
+  unsigned int idx;
+  uint64_t now;
+  QUEUE ready;
+  QUEUE* slot;
+  QUEUE* q;
+
+  for (;;) {
+    now = timer_wheel_next(wheel);
+    if (now > loop->time) {
+      if (wheel->clk <= loop->time)
+        wheel->clk = loop->time + 1;
+      break;
+    }
+
+    /* Collect the slot of every level that comes up at `now`. */
+    QUEUE_INIT(&ready);
+    for (lvl = 0; lvl < UV__WHEEL_LEVELS; lvl++) {
+      if (now & (UV__WHEEL_GRAN(lvl) - 1))
+        break;
+
+      idx = (now >> UV__WHEEL_SHIFT(lvl)) & (UV__WHEEL_SLOTS - 1);
+      slot = &wheel->slots[lvl * UV__WHEEL_SLOTS + idx];
+      if (QUEUE_EMPTY(slot))
+        continue;
+
+      QUEUE_ADD(&ready, slot);
+      QUEUE_INIT(slot);
+      wheel->pending[lvl] &= ~((uint64_t) 1 << idx);
+    }
+
+    /* Timers started from the callbacks below go into later slots. */
+    wheel->clk = now + 1;
+
+    while (!QUEUE_EMPTY(&ready)) {
+      q = QUEUE_HEAD(&ready);
+      handle = QUEUE_DATA(q, uv_timer_t, heap_node);
+
+      if (handle->timeout > loop->time) {
+        /* Parked beyond the range of the wheel, see timer_wheel_insert(). */
+        QUEUE_REMOVE(q);
+        timer_wheel_insert(wheel, handle);
+        continue;
+      }
+
+      uv_timer_stop(handle);
+      uv_timer_again(handle);
+      handle->timer_cb(handle);
+    }
+  }
+}
+
+
 int uv_timer_init(uv_loop_t* loop, uv_timer_t* handle) {
   uv__handle_init(loop, (uv_handle_t*)handle, UV_TIMER);
   handle->timer_cb = NULL;
@@ -86,9 +309,12 @@ int uv_timer_start(uv_timer_t* handle,
   /* start_id is the second index to be compared in timer_less_than() */
   handle->start_id = handle->loop->timer_counter++;
 
-  heap_insert(timer_heap(handle->loop),
-              (struct heap_node*) &handle->heap_node,
-              timer_less_than);
+  if (timer_wheel(handle->loop) != NULL)
+    timer_wheel_insert(timer_wheel(handle->loop), handle);
+  else
+    heap_insert(timer_heap(handle->loop),
+                (struct heap_node*) &handle->heap_node,
+                timer_less_than);
   uv__handle_start(handle);
 
   return 0;
@@ -99,9 +325,12 @@ int uv_timer_stop(uv_timer_t* handle) {
   if (!uv__is_active(handle))
     return 0;
 
-  heap_remove(timer_heap(handle->loop),
-              (struct heap_node*) &handle->heap_node,
-              timer_less_than);
+  if (timer_wheel(handle->loop) != NULL)
+    timer_wheel_remove(timer_wheel(handle->loop), handle);
+  else
+    heap_remove(timer_heap(handle->loop),
+                (struct heap_node*) &handle->heap_node,
+                timer_less_than);
   uv__handle_stop(handle);
 
   return 0;
@@ -142,17 +371,26 @@ uint64_t uv_timer_get_due_in(const uv_timer_t* handle) {
 int uv__next_timeout(const uv_loop_t* loop) {
   const struct heap_node* heap_node;
   const uv_timer_t* handle;
+  uint64_t timeout;
   uint64_t diff;
 
-  heap_node = heap_min(timer_heap(loop));
-  if (heap_node == NULL)
-    return -1; /* block indefinitely */
+  if (timer_wheel(loop) != NULL) {
+    timeout = timer_wheel_next(timer_wheel(loop));
+    if (timeout == (uint64_t) -1)
+      return -1; /* block indefinitely */
+  } else {
+    heap_node = heap_min(timer_heap(loop));
+    if (heap_node == NULL)
+      return -1; /* block indefinitely */
 
-  handle = container_of(heap_node, uv_timer_t, heap_node);
-  if (handle->timeout <= loop->time)
+    handle = container_of(heap_node, uv_timer_t, heap_node);
+    timeout = handle->timeout;
+  }
+
+  if (timeout <= loop->time)
     return 0;
 
-  diff = handle->timeout - loop->time;
+  diff = timeout - loop->time;
   if (diff > INT_MAX)
     diff = INT_MAX;
 
@@ -164,6 +402,11 @@ void uv__run_timers(uv_loop_t* loop) {
   struct heap_node* heap_node;
   uv_timer_t* handle;
 
+  if (timer_wheel(loop) != NULL) {
+    timer_wheel_run(loop, timer_wheel(loop));
+    return;
+  }
+
   for (;;) {
     heap_node = heap_min(timer_heap(loop));
     if (heap_node == NULL)
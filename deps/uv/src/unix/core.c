@@ -390,14 +390,19 @@ int uv_run(uv_loop_t* loop, uv_run_mode mode) {
 
   while (r != 0 && loop->stop_flag == 0) {
     uv__update_time(loop);
+    uv__metrics_phase_start(loop);
     uv__run_timers(loop);
+    uv__metrics_phase_end(loop, UV_LOOP_PHASE_TIMERS);
 
     can_sleep =
         QUEUE_EMPTY(&loop->pending_queue) && QUEUE_EMPTY(&loop->idle_handles);
 
     uv__run_pending(loop);
+    uv__metrics_phase_end(loop, UV_LOOP_PHASE_PENDING);
     uv__run_idle(loop);
+    uv__metrics_phase_end(loop, UV_LOOP_PHASE_IDLE);
     uv__run_prepare(loop);
+    uv__metrics_phase_end(loop, UV_LOOP_PHASE_PREPARE);
 
     timeout = 0;
     if ((mode == UV_RUN_ONCE && can_sleep) || mode == UV_RUN_DEFAULT)
@@ -416,9 +421,12 @@ int uv_run(uv_loop_t* loop, uv_run_mode mode) {
      * the timeout == 0) or was already updated b/c an event was received.
      */
     uv__metrics_update_idle_time(loop);
+    uv__metrics_phase_end(loop, UV_LOOP_PHASE_POLL);
 
     uv__run_check(loop);
+    uv__metrics_phase_end(loop, UV_LOOP_PHASE_CHECK);
     uv__run_closing_handles(loop);
+    uv__metrics_phase_end(loop, UV_LOOP_PHASE_CLOSING);
 
     if (mode == UV_RUN_ONCE) {
       /* UV_RUN_ONCE implies forward progress: at least one callback must have
@@ -430,7 +438,9 @@ int uv_run(uv_loop_t* loop, uv_run_mode mode) {
        * the check.
        */
       uv__update_time(loop);
+      uv__metrics_phase_start(loop);
       uv__run_timers(loop);
+      uv__metrics_phase_end(loop, UV_LOOP_PHASE_TIMERS);
     }
 
     r = uv__loop_alive(loop);
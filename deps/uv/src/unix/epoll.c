@@ -112,9 +112,12 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
   static const int max_safe_timeout = 1789569;
   static int no_epoll_pwait_cached;
   static int no_epoll_wait_cached;
+  static int no_epoll_pwait2_cached;
   int no_epoll_pwait;
   int no_epoll_wait;
+  int no_epoll_pwait2;
   struct epoll_event events[1024];
+  struct timespec ts;
   struct epoll_event* pe;
   struct epoll_event e;
   int real_timeout;
@@ -123,6 +126,11 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
   sigset_t sigset;
   uint64_t sigmask;
   uint64_t base;
+  uint64_t spin_end;
+  uint64_t deadline;
+  uint64_t now;
+  int busy_poll;
+  int poll_timeout;
   int have_signals;
   int nevents;
   int count;
@@ -187,7 +195,26 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
   count = 48; /* Benchmarks suggest this gives the best throughput. */
   real_timeout = timeout;
 
-  if (uv__get_internal_fields(loop)->flags & UV_METRICS_IDLE_TIME) {
+  /* In busy-poll mode, poll without blocking until the spin window is over,
+   * then block with epoll_pwait2() until the exact nanosecond the next timer
+   * is due. With whole milliseconds, the wakeup would be late by up to a
+   * millisecond plus the kernel's rounding.
+   */
+  busy_poll = timeout != 0 && uv__get_internal_fields(loop)->busy_poll_time;
+  spin_end = 0;
+  deadline = 0;
+  if (busy_poll != 0) {
+    now = uv__hrtime(UV_CLOCK_FAST);
+    spin_end = now + uv__get_internal_fields(loop)->busy_poll_time;
+    if (timeout > 0)
+      deadline = (base + timeout) * 1000000;
+    /* Spinning counts as idle time, like blocking does. */
+    uv__metrics_set_provider_entry_time(loop);
+  }
+
+  /* The spin loop already polls without blocking first. */
+  if (busy_poll == 0 &&
+      uv__get_internal_fields(loop)->flags & UV_METRICS_IDLE_TIME) {
     reset_timeout = 1;
     user_timeout = timeout;
     timeout = 0;
@@ -204,12 +231,13 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
    */
   no_epoll_pwait = uv__load_relaxed(&no_epoll_pwait_cached);
   no_epoll_wait = uv__load_relaxed(&no_epoll_wait_cached);
+  no_epoll_pwait2 = uv__load_relaxed(&no_epoll_pwait2_cached);
 
   for (;;) {
     /* Only need to set the provider_entry_time if timeout != 0. The function
      * will return early if the loop isn't configured with UV_METRICS_IDLE_TIME.
      */
-    if (timeout != 0)
+    if (timeout != 0 && busy_poll == 0)
       uv__metrics_set_provider_entry_time(loop);
 
     /* See the comment for max_safe_timeout for an explanation of why
@@ -218,15 +246,51 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
     if (sizeof(int32_t) == sizeof(long) && timeout >= max_safe_timeout)
       timeout = max_safe_timeout;
 
+    /* Hand queued io_uring requests to the kernel before blocking. Don't
+     * block if some of them couldn't be submitted.
+     */
+    if (uv__iou_flush(loop)) {
+      timeout = 0;
+      busy_poll = 0;
+    }
+
+    poll_timeout = timeout;
+    if (busy_poll != 0) {
+      now = uv__hrtime(UV_CLOCK_FAST);
+      if (deadline != 0 && now >= deadline) {
+        uv__update_time(loop);
+        return;
+      }
+
+      if (now < spin_end) {
+        poll_timeout = 0;
+      } else if (deadline != 0) {
+        /* Round up, epoll_wait() must not return before the timer is due. */
+        poll_timeout = (int) ((deadline - now + 999999) / 1000000);
+        ts.tv_sec = (deadline - now) / 1000000000;
+        ts.tv_nsec = (deadline - now) % 1000000000;
+      }
+    }
+
     if (sigmask != 0 && no_epoll_pwait != 0)
       if (pthread_sigmask(SIG_BLOCK, &sigset, NULL))
         abort();
 
-    if (no_epoll_wait != 0 || (sigmask != 0 && no_epoll_pwait == 0)) {
+    if (busy_poll != 0 && poll_timeout > 0 && no_epoll_pwait2 == 0) {
+      nfds = uv__epoll_pwait2(loop->backend_fd,
+                              events,
+                              ARRAY_SIZE(events),
+                              &ts,
+                              sigmask != 0 ? &sigset : NULL);
+      if (nfds == -1 && errno == ENOSYS) {
+        uv__store_relaxed(&no_epoll_pwait2_cached, 1);
+        no_epoll_pwait2 = 1;
+      }
+    } else if (no_epoll_wait != 0 || (sigmask != 0 && no_epoll_pwait == 0)) {
       nfds = epoll_pwait(loop->backend_fd,
                          events,
                          ARRAY_SIZE(events),
-                         timeout,
+                         poll_timeout,
                          &sigset);
       if (nfds == -1 && errno == ENOSYS) {
         uv__store_relaxed(&no_epoll_pwait_cached, 1);
@@ -236,7 +300,7 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
       nfds = epoll_wait(loop->backend_fd,
                         events,
                         ARRAY_SIZE(events),
-                        timeout);
+                        poll_timeout);
       if (nfds == -1 && errno == ENOSYS) {
         uv__store_relaxed(&no_epoll_wait_cached, 1);
         no_epoll_wait = 1;
@@ -254,7 +318,11 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
     SAVE_ERRNO(uv__update_time(loop));
 
     if (nfds == 0) {
-      assert(timeout != -1);
+      assert(poll_timeout != -1);
+
+      /* Keep spinning, or block for what is left until the deadline. */
+      if (busy_poll != 0)
+        continue;
 
       if (reset_timeout != 0) {
         timeout = user_timeout;
@@ -275,7 +343,9 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
 
     if (nfds == -1) {
       if (errno == ENOSYS) {
-        /* epoll_wait() or epoll_pwait() failed, try the other system call. */
+        /* epoll_wait() or epoll_pwait() failed, try the other system call.
+         * epoll_pwait2() failed, fall back to millisecond precision.
+         */
         assert(no_epoll_wait == 0 || no_epoll_pwait == 0);
         continue;
       }
@@ -283,6 +353,9 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
       if (errno != EINTR)
         abort();
 
+      if (busy_poll != 0)
+        continue;
+
       if (reset_timeout != 0) {
         timeout = user_timeout;
         reset_timeout = 0;
@@ -398,11 +471,15 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
       if (nfds == ARRAY_SIZE(events) && --count != 0) {
         /* Poll for more events but don't block this time. */
         timeout = 0;
+        busy_poll = 0;
         continue;
       }
       return;
     }
 
+    if (busy_poll != 0)
+      continue;
+
     if (timeout == 0)
       return;
 
@@ -86,6 +86,7 @@ int uv__platform_loop_init(uv_loop_t* loop) {
   
   loop->inotify_fd = -1;
   loop->inotify_watchers = NULL;
+  uv__get_internal_fields(loop)->iou.ringfd = -1;  /* Set up on first use. */
 
   return uv__epoll_init(loop);
 }
@@ -110,6 +111,7 @@ int uv__io_fork(uv_loop_t* loop) {
 
 
 void uv__platform_loop_delete(uv_loop_t* loop) {
+  uv__iou_delete(loop);
   if (loop->inotify_fd == -1) return;
   uv__io_stop(loop, &loop->inotify_read_watcher, POLLIN);
   uv__close(loop->inotify_fd);
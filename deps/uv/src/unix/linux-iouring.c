@@ -0,0 +1,597 @@
+/* Copyright libuv contributors. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/* Optional io_uring backend for file system requests.
+ *
+ * Requests are queued in the submission ring as they come in and handed to
+ * the kernel in one io_uring_enter() call right before the loop blocks in
+ * epoll_wait(). The ring's file descriptor is watched by the loop's epoll
+ * instance and becomes readable when completions are available.
+ *
+ * The backend is opt-in: set UV_USE_IO_URING=1 in the environment. Anything
+ * the ring can't do (old kernel, unsupported opcode, ring full, seccomp) is
+ * transparently handed to the threadpool instead.
+ */
+
+#include "uv.h"
+#include "internal.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+
+/* Ring size. The completion ring is twice as large and the number of
+ * requests in flight never exceeds the size of the submission ring, so
+ * neither ring can overflow.
+ */
+#define UV__IOU_ENTRIES 256
+
+static void uv__iou_init(uv_loop_t* loop);
+static void uv__iou_io(uv_loop_t* loop, uv__io_t* w, unsigned int events);
+
+
+static int uv__use_io_uring(void) {
+  static int use_io_uring = -1;
+  const char* val;
+  int use;
+
+  use = uv__load_relaxed(&use_io_uring);
+  if (use == -1) {
+    val = getenv("UV_USE_IO_URING");
+    use = val != NULL && atoi(val) > 0;
+    uv__store_relaxed(&use_io_uring, use);
+  }
+
+  return use;
+}
+
+
+static struct uv__iou* uv__iou_get(uv_loop_t* loop) {
+  struct uv__iou* iou;
+
+  iou = &uv__get_internal_fields(loop)->iou;
+  if (iou->ringfd == -1)
+    uv__iou_init(loop);
+
+  if (iou->ringfd < 0)
+    return NULL;
+
+  return iou;
+}
+
+
+static void uv__iou_init(uv_loop_t* loop) {
+  struct uv__io_uring_params params;
+  struct uv__io_uring_probe* probe;
+  struct uv__iou* iou;
+  uint32_t required;
+  uint64_t ops;
+  size_t sqlen;
+  size_t cqlen;
+  size_t maxlen;
+  size_t sqelen;
+  unsigned i;
+  char* sq;
+  char* sqe;
+  int ringfd;
+
+  iou = &uv__get_internal_fields(loop)->iou;
+  iou->ringfd = -2;  /* Unavailable unless everything below works out. */
+
+  if (!uv__use_io_uring())
+    return;
+
+  memset(&params, 0, sizeof(params));
+  params.flags = UV__IORING_SETUP_CQSIZE;
+  params.cq_entries = 2 * UV__IOU_ENTRIES;
+
+  ringfd = uv__io_uring_setup(UV__IOU_ENTRIES, &params);
+  if (ringfd == -1)
+    return;
+
+  /* Single mmap (5.4), no dropped completions (5.5) and reads and writes
+   * at the current file position (5.6). Kernels that have all three also
+   * support IORING_REGISTER_PROBE.
+   */
+  required = UV__IORING_FEAT_SINGLE_MMAP |
+             UV__IORING_FEAT_NODROP |
+             UV__IORING_FEAT_RW_CUR_POS;
+  if ((params.features & required) != required)
+    goto fail;
+
+  sqlen = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  cqlen =
+      params.cq_off.cqes + params.cq_entries * sizeof(struct uv__io_uring_cqe);
+  maxlen = sqlen < cqlen ? cqlen : sqlen;
+  sqelen = params.sq_entries * sizeof(struct uv__io_uring_sqe);
+
+  sq = mmap(0,
+            maxlen,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            ringfd,
+            UV__IORING_OFF_SQ_RING);
+
+  if (sq == MAP_FAILED)
+    goto fail;
+
+  sqe = mmap(0,
+             sqelen,
+             PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE,
+             ringfd,
+             UV__IORING_OFF_SQES);
+
+  if (sqe == MAP_FAILED)
+    goto fail_sq;
+
+  probe = uv__calloc(1, sizeof(*probe));
+  if (probe == NULL)
+    goto fail_sqe;
+
+  ops = 0;
+  if (0 == uv__io_uring_register(ringfd,
+                                 UV__IORING_REGISTER_PROBE,
+                                 probe,
+                                 ARRAY_SIZE(probe->ops))) {
+    for (i = 0; i < probe->ops_len && i < 64; i++)
+      if (probe->ops[i].flags & UV__IO_URING_OP_SUPPORTED)
+        ops |= (uint64_t) 1 << probe->ops[i].op;
+  }
+
+  uv__free(probe);
+
+  if (ops == 0)
+    goto fail_sqe;
+
+  iou->sqhead = (uint32_t*) (sq + params.sq_off.head);
+  iou->sqtail = (uint32_t*) (sq + params.sq_off.tail);
+  iou->sqmask = *(uint32_t*) (sq + params.sq_off.ring_mask);
+  iou->sqarray = (uint32_t*) (sq + params.sq_off.array);
+  iou->cqhead = (uint32_t*) (sq + params.cq_off.head);
+  iou->cqtail = (uint32_t*) (sq + params.cq_off.tail);
+  iou->cqmask = *(uint32_t*) (sq + params.cq_off.ring_mask);
+  iou->sq = sq;
+  iou->cqe = sq + params.cq_off.cqes;
+  iou->sqe = sqe;
+  iou->maxlen = maxlen;
+  iou->sqelen = sqelen;
+  iou->ringfd = ringfd;
+  iou->in_flight = 0;
+  iou->max_in_flight = params.sq_entries;
+  iou->unsubmitted = 0;
+  iou->ops = ops;
+
+  /* The ring becomes readable when there are completions to reap. */
+  uv__io_init(&iou->watcher, uv__iou_io, ringfd);
+  uv__io_start(loop, &iou->watcher, POLLIN);
+
+  return;
+
+fail_sqe:
+  munmap(sqe, sqelen);
+fail_sq:
+  munmap(sq, maxlen);
+fail:
+  uv__close(ringfd);
+}
+
+
+void uv__iou_delete(uv_loop_t* loop) {
+  struct uv__iou* iou;
+
+  iou = &uv__get_internal_fields(loop)->iou;
+  if (iou->ringfd >= 0) {
+    uv__io_stop(loop, &iou->watcher, POLLIN);
+    munmap(iou->sqe, iou->sqelen);
+    munmap(iou->sq, iou->maxlen);
+    uv__close(iou->ringfd);
+  }
+
+  /* Set up the ring again on next use, e.g. after uv_loop_fork(). */
+  iou->ringfd = -1;
+}
+
+
+/* Returns NULL if the ring is unavailable, doesn't support `opcode` or if
+ * there are too many requests in flight. The caller then falls back to the
+ * threadpool.
+ */
+static struct uv__io_uring_sqe* uv__iou_get_sqe(uv_loop_t* loop,
+                                                uv_fs_t* req,
+                                                uint8_t opcode) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__iou* iou;
+  uint32_t slot;
+
+  iou = uv__iou_get(loop);
+  if (iou == NULL)
+    return NULL;
+
+  if (!(iou->ops & ((uint64_t) 1 << opcode)))
+    return NULL;
+
+  if (iou->in_flight >= iou->max_in_flight)
+    return NULL;
+
+  slot = *iou->sqtail & iou->sqmask;
+  iou->sqarray[slot] = slot;
+
+  sqe = iou->sqe;
+  sqe = &sqe[slot];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = opcode;
+  sqe->user_data = (uintptr_t) req;
+
+  /* The request is never on a threadpool queue; make uv_cancel() report
+   * that it is busy rather than try to unlink it.
+   */
+  req->work_req.loop = loop;
+  req->work_req.work = NULL;
+  req->work_req.done = NULL;
+  QUEUE_INIT(&req->work_req.wq);
+
+  uv__req_register(loop, req);
+  iou->in_flight++;
+
+  return sqe;
+}
+
+
+static void uv__iou_submit(struct uv__iou* iou) {
+  /* Publish the new tail to the kernel. The actual io_uring_enter() call is
+   * deferred to uv__iou_flush() so that requests made in the same loop
+   * iteration are submitted with a single system call.
+   */
+  __atomic_store_n(iou->sqtail, *iou->sqtail + 1, __ATOMIC_RELEASE);
+  iou->unsubmitted++;
+}
+
+
+/* Stops using the ring after io_uring_enter() failed for good, e.g. with
+ * ENOMEM or with EPERM from a seccomp filter. Requests already in flight are
+ * still reaped by the watcher; the ones the kernel never took and all new
+ * ones go to the threadpool. Without SQPOLL the kernel only reads the
+ * submission ring in io_uring_enter(), so the tail can be wound back.
+ */
+static void uv__iou_disable(uv_loop_t* loop, struct uv__iou* iou) {
+  struct uv__io_uring_sqe* sqe;
+  uv_fs_t* req;
+  uint32_t tail;
+  uint32_t i;
+
+  iou->ops = 0;
+
+  tail = *iou->sqtail;
+  i = tail - iou->unsubmitted;
+  iou->unsubmitted = 0;
+  __atomic_store_n(iou->sqtail, i, __ATOMIC_RELEASE);
+
+  for (; i != tail; i++) {
+    sqe = iou->sqe;
+    sqe = &sqe[iou->sqarray[i & iou->sqmask]];
+    req = (uv_fs_t*) (uintptr_t) sqe->user_data;
+
+    iou->in_flight--;
+    uv__req_unregister(loop, req);
+
+    if (sqe->opcode == UV__IORING_OP_STATX) {
+      uv__free(req->ptr);
+      req->ptr = NULL;
+    }
+
+    /* A short write that was being resubmitted keeps its partial count in
+     * req->result, which uv__fs_write_all() adds to.
+     */
+    uv__fs_post(loop, req);
+  }
+}
+
+
+/* Returns non-zero if there are submissions left that the kernel did not
+ * accept, in which case the caller must not block.
+ */
+int uv__iou_flush(uv_loop_t* loop) {
+  struct uv__iou* iou;
+  int rc;
+
+  iou = &uv__get_internal_fields(loop)->iou;
+  if (iou->ringfd < 0 || iou->unsubmitted == 0)
+    return 0;
+
+  do
+    rc = uv__io_uring_enter(iou->ringfd, iou->unsubmitted, 0, 0);
+  while (rc == -1 && errno == EINTR);
+
+  if (rc == -1) {
+    /* Transient resource shortage; try again on the next iteration. */
+    if (errno == EAGAIN || errno == EBUSY)
+      return 1;
+    uv__iou_disable(loop, iou);
+    return 0;
+  }
+
+  iou->unsubmitted -= rc;
+  return iou->unsubmitted != 0;
+}
+
+
+int uv__iou_fs_close(uv_loop_t* loop, uv_fs_t* req) {
+  struct uv__io_uring_sqe* sqe;
+
+  sqe = uv__iou_get_sqe(loop, req, UV__IORING_OP_CLOSE);
+  if (sqe == NULL)
+    return 0;
+
+  sqe->fd = req->file;
+
+  uv__iou_submit(&uv__get_internal_fields(loop)->iou);
+  return 1;
+}
+
+
+int uv__iou_fs_fsync_or_fdatasync(uv_loop_t* loop,
+                                  uv_fs_t* req,
+                                  uint32_t fsync_flags) {
+  struct uv__io_uring_sqe* sqe;
+
+  sqe = uv__iou_get_sqe(loop, req, UV__IORING_OP_FSYNC);
+  if (sqe == NULL)
+    return 0;
+
+  sqe->fd = req->file;
+  sqe->rw_flags = fsync_flags;  /* fsync_flags */
+
+  uv__iou_submit(&uv__get_internal_fields(loop)->iou);
+  return 1;
+}
+
+
+int uv__iou_fs_open(uv_loop_t* loop, uv_fs_t* req) {
+  struct uv__io_uring_sqe* sqe;
+
+  sqe = uv__iou_get_sqe(loop, req, UV__IORING_OP_OPENAT);
+  if (sqe == NULL)
+    return 0;
+
+  sqe->fd = AT_FDCWD;
+  sqe->addr = (uintptr_t) req->path;
+  sqe->len = req->mode;
+  sqe->rw_flags = req->flags | O_CLOEXEC;  /* open_flags */
+
+  uv__iou_submit(&uv__get_internal_fields(loop)->iou);
+  return 1;
+}
+
+
+static void uv__iou_prep_rw(struct uv__io_uring_sqe* sqe, uv_fs_t* req) {
+  sqe->fd = req->file;
+  sqe->addr = (uintptr_t) req->bufs;
+  sqe->len = req->nbufs;
+  /* -1 means "at the current file position", like read(2) and write(2). */
+  sqe->off = req->off < 0 ? (uint64_t) -1 : (uint64_t) req->off;
+}
+
+
+int uv__iou_fs_read_or_write(uv_loop_t* loop, uv_fs_t* req, int is_read) {
+  struct uv__io_uring_sqe* sqe;
+
+  /* Same limit the threadpool applies; writes beyond it are split up by
+   * uv__fs_write_all().
+   */
+  if (req->nbufs > (unsigned int) uv__getiovmax())
+    return 0;
+
+  sqe = uv__iou_get_sqe(loop,
+                        req,
+                        is_read ? UV__IORING_OP_READV : UV__IORING_OP_WRITEV);
+  if (sqe == NULL)
+    return 0;
+
+  uv__iou_prep_rw(sqe, req);
+
+  uv__iou_submit(&uv__get_internal_fields(loop)->iou);
+  return 1;
+}
+
+
+int uv__iou_fs_rename(uv_loop_t* loop, uv_fs_t* req) {
+  struct uv__io_uring_sqe* sqe;
+
+  sqe = uv__iou_get_sqe(loop, req, UV__IORING_OP_RENAMEAT);
+  if (sqe == NULL)
+    return 0;
+
+  sqe->fd = AT_FDCWD;
+  sqe->addr = (uintptr_t) req->path;
+  sqe->len = AT_FDCWD;
+  sqe->off = (uintptr_t) req->new_path;  /* addr2 */
+
+  uv__iou_submit(&uv__get_internal_fields(loop)->iou);
+  return 1;
+}
+
+
+int uv__iou_fs_statx(uv_loop_t* loop,
+                     uv_fs_t* req,
+                     int is_fstat,
+                     int is_lstat) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__statx* statxbuf;
+
+  statxbuf = uv__malloc(sizeof(*statxbuf));
+  if (statxbuf == NULL)
+    return 0;
+
+  sqe = uv__iou_get_sqe(loop, req, UV__IORING_OP_STATX);
+  if (sqe == NULL) {
+    uv__free(statxbuf);
+    return 0;
+  }
+
+  req->ptr = statxbuf;
+
+  sqe->fd = AT_FDCWD;
+  sqe->addr = (uintptr_t) req->path;
+  sqe->len = 0xFFF;  /* STATX_BASIC_STATS + STATX_BTIME */
+  sqe->off = (uintptr_t) statxbuf;  /* addr2 */
+
+  if (is_fstat) {
+    sqe->fd = req->file;
+    sqe->addr = (uintptr_t) "";
+    sqe->rw_flags = 0x1000;  /* AT_EMPTY_PATH */
+  }
+
+  if (is_lstat)
+    sqe->rw_flags |= AT_SYMLINK_NOFOLLOW;
+
+  uv__iou_submit(&uv__get_internal_fields(loop)->iou);
+  return 1;
+}
+
+
+/* Returns 1 if the remainder of a short write was resubmitted. */
+static int uv__iou_fs_write_more(uv_loop_t* loop, uv_fs_t* req, size_t n) {
+  struct uv__io_uring_sqe* sqe;
+  unsigned int i;
+
+  for (i = 0; i < req->nbufs && req->bufs[i].len <= n; i++)
+    n -= req->bufs[i].len;
+
+  if (i == req->nbufs)
+    return 0;  /* All done. */
+
+  req->bufs[i].base += n;
+  req->bufs[i].len -= n;
+  req->nbufs -= i;
+  memmove(req->bufs, req->bufs + i, req->nbufs * sizeof(*req->bufs));
+
+  sqe = uv__iou_get_sqe(loop, req, UV__IORING_OP_WRITEV);
+  if (sqe == NULL)
+    return 0;  /* Report the short write. */
+
+  uv__iou_prep_rw(sqe, req);
+  uv__iou_submit(&uv__get_internal_fields(loop)->iou);
+  return 1;
+}
+
+
+static void uv__iou_fs_done(uv_loop_t* loop, uv_fs_t* req, int res) {
+  struct uv__iou* iou;
+
+  switch (req->fs_type) {
+  case UV_FS_READ:
+  case UV_FS_WRITE:
+    if (req->fs_type == UV_FS_WRITE && res > 0) {
+      req->result += res;
+      if (req->off >= 0)
+        req->off += res;
+      if (uv__iou_fs_write_more(loop, req, res))
+        return;
+      res = req->result;
+    } else if (req->fs_type == UV_FS_WRITE && req->result > 0) {
+      res = req->result;  /* Error after a partial write. */
+    }
+
+    if (req->bufs != req->bufsml)
+      uv__free(req->bufs);
+    req->bufs = NULL;
+    req->nbufs = 0;
+    break;
+
+  case UV_FS_STAT:
+  case UV_FS_LSTAT:
+  case UV_FS_FSTAT:
+    /* Same errors that make the threadpool fall back from statx() to stat().
+     * EPERM is what seccomp filters that don't know statx() return.
+     */
+    if (res == UV__ERR(EINVAL) || res == UV__ERR(EPERM) ||
+        res == UV__ERR(ENOSYS) || res == UV__ERR(EOPNOTSUPP)) {
+      iou = &uv__get_internal_fields(loop)->iou;
+      iou->ops &= ~((uint64_t) 1 << UV__IORING_OP_STATX);
+      uv__free(req->ptr);
+      req->ptr = NULL;
+      uv__fs_post(loop, req);
+      return;
+    }
+
+    if (res == 0)
+      uv__statx_to_stat(req->ptr, &req->statbuf);
+    uv__free(req->ptr);
+    req->ptr = NULL;
+    if (res == 0)
+      req->ptr = &req->statbuf;
+    break;
+
+  case UV_FS_CLOSE:
+    /* Same as uv__fs_close(): the descriptor is gone either way. */
+    if (res == UV__ERR(EINTR) || res == UV__ERR(EINPROGRESS))
+      res = 0;
+    break;
+
+  default:
+    break;
+  }
+
+  req->result = res;
+  req->cb(req);
+}
+
+
+static void uv__iou_io(uv_loop_t* loop, uv__io_t* w, unsigned int events) {
+  struct uv__io_uring_cqe* cqe;
+  struct uv__io_uring_cqe* e;
+  struct uv__iou* iou;
+  uv_fs_t* req;
+  uint32_t head;
+  uint32_t tail;
+  uint32_t mask;
+  uint32_t i;
+  int res;
+
+  iou = container_of(w, struct uv__iou, watcher);
+  cqe = iou->cqe;
+  mask = iou->cqmask;
+
+  head = *iou->cqhead;
+  tail = __atomic_load_n(iou->cqtail, __ATOMIC_ACQUIRE);
+
+  for (i = head; i != tail; i++) {
+    e = &cqe[i & mask];
+    req = (uv_fs_t*) (uintptr_t) e->user_data;
+    res = e->res;
+
+    /* Release the slot before running the callback so that it can issue
+     * new requests, and so that a resubmitted short write finds room.
+     */
+    __atomic_store_n(iou->cqhead, i + 1, __ATOMIC_RELEASE);
+    iou->in_flight--;
+    uv__req_unregister(loop, req);
+
+    uv__iou_fs_done(loop, req, res);
+  }
+}
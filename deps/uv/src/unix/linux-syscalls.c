@@ -34,6 +34,56 @@
 # endif
 #endif /* __arm__ */
 
+#if defined(__mips__)
+# if _MIPS_SIM == _MIPS_SIM_ABI32
+#  define UV_MIPS_SYSCALL_BASE 4000
+# elif _MIPS_SIM == _MIPS_SIM_ABI64
+#  define UV_MIPS_SYSCALL_BASE 5000
+# elif _MIPS_SIM == _MIPS_SIM_NABI32
+#  define UV_MIPS_SYSCALL_BASE 6000
+# endif
+#endif /* __mips__ */
+
+#ifndef __NR_io_uring_setup
+# if defined(__alpha__)
+#  define __NR_io_uring_setup 535
+# elif defined(UV_MIPS_SYSCALL_BASE)
+#  define __NR_io_uring_setup (UV_MIPS_SYSCALL_BASE + 425)
+# elif !defined(__mips__)
+#  define __NR_io_uring_setup 425
+# endif
+#endif /* __NR_io_uring_setup */
+
+#ifndef __NR_io_uring_enter
+# if defined(__alpha__)
+#  define __NR_io_uring_enter 536
+# elif defined(UV_MIPS_SYSCALL_BASE)
+#  define __NR_io_uring_enter (UV_MIPS_SYSCALL_BASE + 426)
+# elif !defined(__mips__)
+#  define __NR_io_uring_enter 426
+# endif
+#endif /* __NR_io_uring_enter */
+
+#ifndef __NR_io_uring_register
+# if defined(__alpha__)
+#  define __NR_io_uring_register 537
+# elif defined(UV_MIPS_SYSCALL_BASE)
+#  define __NR_io_uring_register (UV_MIPS_SYSCALL_BASE + 427)
+# elif !defined(__mips__)
+#  define __NR_io_uring_register 427
+# endif
+#endif /* __NR_io_uring_register */
+
+#ifndef __NR_epoll_pwait2
+# if defined(__alpha__)
+#  define __NR_epoll_pwait2 551
+# elif defined(UV_MIPS_SYSCALL_BASE)
+#  define __NR_epoll_pwait2 (UV_MIPS_SYSCALL_BASE + 441)
+# elif !defined(__mips__)
+#  define __NR_epoll_pwait2 441
+# endif
+#endif /* __NR_epoll_pwait2 */
+
 #ifndef __NR_recvmmsg
 # if defined(__x86_64__)
 #  define __NR_recvmmsg 299
@@ -262,3 +312,63 @@ ssize_t uv__getrandom(void* buf, size_t buflen, unsigned flags) {
   return syscall(__NR_getrandom, buf, buflen, flags);
 #endif
 }
+
+
+int uv__io_uring_setup(int entries, struct uv__io_uring_params* params) {
+#if defined(__NR_io_uring_setup)
+  return syscall(__NR_io_uring_setup, entries, params);
+#else
+  return errno = ENOSYS, -1;
+#endif
+}
+
+
+int uv__io_uring_enter(int fd,
+                       unsigned to_submit,
+                       unsigned min_complete,
+                       unsigned flags) {
+  /* io_uring_enter used to take a sigset_t but it's unused
+   * in newer kernels unless IORING_ENTER_EXT_ARG is set,
+   * in which case it takes a struct io_uring_getevents_arg.
+   */
+#if defined(__NR_io_uring_enter)
+  return syscall(__NR_io_uring_enter,
+                 fd,
+                 to_submit,
+                 min_complete,
+                 flags,
+                 NULL,
+                 0L);
+#else
+  return errno = ENOSYS, -1;
+#endif
+}
+
+
+int uv__io_uring_register(int fd, unsigned opcode, void* arg, unsigned nargs) {
+#if defined(__NR_io_uring_register)
+  return syscall(__NR_io_uring_register, fd, opcode, arg, nargs);
+#else
+  return errno = ENOSYS, -1;
+#endif
+}
+
+
+int uv__epoll_pwait2(int epfd,
+                     struct epoll_event* events,
+                     int maxevents,
+                     const struct timespec* timeout,
+                     const sigset_t* sigmask) {
+#if defined(__NR_epoll_pwait2)
+  /* The kernel wants the size of its own sigset_t, not glibc's. */
+  return syscall(__NR_epoll_pwait2,
+                 epfd,
+                 events,
+                 maxevents,
+                 timeout,
+                 sigmask,
+                 (size_t) _NSIG / 8);
+#else
+  return errno = ENOSYS, -1;
+#endif
+}
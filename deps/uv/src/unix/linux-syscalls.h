@@ -28,6 +28,8 @@
 #include <sys/time.h>
 #include <sys/socket.h>
 
+struct epoll_event;
+
 struct uv__statx_timestamp {
   int64_t tv_sec;
   uint32_t tv_nsec;
@@ -58,6 +60,102 @@ struct uv__statx {
   uint64_t unused1[14];
 };
 
+/* io_uring ABI, see <linux/io_uring.h>. Only the bits libuv uses. */
+#define UV__IORING_SETUP_CQSIZE 8u
+
+#define UV__IORING_FEAT_SINGLE_MMAP 1u
+#define UV__IORING_FEAT_NODROP 2u
+#define UV__IORING_FEAT_RW_CUR_POS 8u
+
+#define UV__IORING_OP_READV 1u
+#define UV__IORING_OP_WRITEV 2u
+#define UV__IORING_OP_FSYNC 3u
+#define UV__IORING_OP_OPENAT 18u
+#define UV__IORING_OP_CLOSE 19u
+#define UV__IORING_OP_STATX 21u
+#define UV__IORING_OP_RENAMEAT 35u
+
+#define UV__IORING_FSYNC_DATASYNC 1u
+
+#define UV__IORING_OFF_SQ_RING 0ull
+#define UV__IORING_OFF_SQES 0x10000000ull
+
+#define UV__IORING_REGISTER_PROBE 8u
+#define UV__IO_URING_OP_SUPPORTED 1u
+
+struct uv__io_uring_sqe {
+  uint8_t opcode;
+  uint8_t flags;
+  uint16_t ioprio;
+  int32_t fd;
+  uint64_t off;  /* Also addr2. */
+  uint64_t addr;
+  uint32_t len;
+  uint32_t rw_flags;  /* Also fsync_flags, open_flags, statx_flags, etc. */
+  uint64_t user_data;
+  uint16_t buf_index;
+  uint16_t personality;
+  int32_t splice_fd_in;
+  uint64_t pad[2];
+};
+
+struct uv__io_uring_cqe {
+  uint64_t user_data;
+  int32_t res;
+  uint32_t flags;
+};
+
+struct uv__io_sqring_offsets {
+  uint32_t head;
+  uint32_t tail;
+  uint32_t ring_mask;
+  uint32_t ring_entries;
+  uint32_t flags;
+  uint32_t dropped;
+  uint32_t array;
+  uint32_t reserved0;
+  uint64_t reserved1;
+};
+
+struct uv__io_cqring_offsets {
+  uint32_t head;
+  uint32_t tail;
+  uint32_t ring_mask;
+  uint32_t ring_entries;
+  uint32_t overflow;
+  uint32_t cqes;
+  uint64_t reserved0;
+  uint64_t reserved1;
+};
+
+struct uv__io_uring_params {
+  uint32_t sq_entries;
+  uint32_t cq_entries;
+  uint32_t flags;
+  uint32_t sq_thread_cpu;
+  uint32_t sq_thread_idle;
+  uint32_t features;
+  uint32_t wq_fd;
+  uint32_t reserved[3];
+  struct uv__io_sqring_offsets sq_off;
+  struct uv__io_cqring_offsets cq_off;
+};
+
+struct uv__io_uring_probe_op {
+  uint8_t op;
+  uint8_t reserved0;
+  uint16_t flags;
+  uint32_t reserved1;
+};
+
+struct uv__io_uring_probe {
+  uint8_t last_op;
+  uint8_t ops_len;
+  uint16_t reserved0;
+  uint32_t reserved1[3];
+  struct uv__io_uring_probe_op ops[256];
+};
+
 ssize_t uv__preadv(int fd, const struct iovec *iov, int iovcnt, int64_t offset);
 ssize_t uv__pwritev(int fd, const struct iovec *iov, int iovcnt, int64_t offset);
 int uv__dup3(int oldfd, int newfd, int flags);
@@ -74,5 +172,16 @@ int uv__statx(int dirfd,
               unsigned int mask,
               struct uv__statx* statxbuf);
 ssize_t uv__getrandom(void* buf, size_t buflen, unsigned flags);
+int uv__io_uring_setup(int entries, struct uv__io_uring_params* params);
+int uv__io_uring_enter(int fd,
+                       unsigned to_submit,
+                       unsigned min_complete,
+                       unsigned flags);
+int uv__io_uring_register(int fd, unsigned opcode, void* arg, unsigned nargs);
+int uv__epoll_pwait2(int epfd,
+                     struct epoll_event* events,
+                     int maxevents,
+                     const struct timespec* timeout,
+                     const sigset_t* sigmask);
 
 #endif /* UV_LINUX_SYSCALL_H_ */
@@ -217,6 +217,16 @@ int uv__loop_configure(uv_loop_t* loop, uv_loop_option option, va_list ap) {
     return 0;
   }
 
+  if (option == UV_LOOP_BUSY_POLL) {
+#ifdef __linux__
+    lfields->busy_poll_time = va_arg(ap, unsigned int) * (uint64_t) 1000;
+    lfields->busy_poll_socket = va_arg(ap, unsigned int);
+    return 0;
+#else
+    return UV_ENOSYS;
+#endif
+  }
+
   if (option != UV_LOOP_BLOCK_SIGNAL)
     return UV_ENOSYS;
 
@@ -394,6 +394,9 @@ int uv__stream_open(uv_stream_t* stream, int fd, int flags) {
 #if defined(__APPLE__)
   int enable;
 #endif
+#if defined(__linux__) && defined(SO_BUSY_POLL)
+  int busy_poll;
+#endif
 
   if (!(stream->io_watcher.fd == -1 || stream->io_watcher.fd == fd))
     return UV_EBUSY;
@@ -410,6 +413,16 @@ int uv__stream_open(uv_stream_t* stream, int fd, int flags) {
         uv__tcp_keepalive(fd, 1, 60)) {
       return UV__ERR(errno);
     }
+
+#if defined(__linux__) && defined(SO_BUSY_POLL)
+    /* Best effort: raising SO_BUSY_POLL above net.core.busy_read requires
+     * CAP_NET_ADMIN. The socket works the same without it, only with the
+     * usual interrupt-driven latency.
+     */
+    busy_poll = (int) uv__get_internal_fields(stream->loop)->busy_poll_socket;
+    if (busy_poll != 0)
+      setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll, sizeof(busy_poll));
+#endif
   }
 
 #if defined(__APPLE__)
@@ -760,12 +760,26 @@ void uv__fs_readdir_cleanup(uv_fs_t* req) {
 
 
 int uv_loop_configure(uv_loop_t* loop, uv_loop_option option, ...) {
+  uv__loop_internal_fields_t* lfields;
   va_list ap;
   int err;
 
   va_start(ap, option);
   /* Any platform-agnostic options should be handled here. */
-  err = uv__loop_configure(loop, option, ap);
+  if (option == UV_METRICS_PHASE_TIME) {
+    lfields = uv__get_internal_fields(loop);
+    lfields->phase_cb = va_arg(ap, uv_loop_phase_cb);
+    lfields->phase_arg = va_arg(ap, void*);
+    lfields->phase_start_time = 0;
+    err = 0;
+  } else if (option == UV_LOOP_TIMER_WHEEL) {
+    err = uv__timer_wheel_init(loop);
+  } else if (option == UV_METRICS_WORK_TIME) {
+    uv__get_internal_fields(loop)->flags |= UV_METRICS_WORK_TIME;
+    err = 0;
+  } else {
+    err = uv__loop_configure(loop, option, ap);
+  }
   va_end(ap);
 
   return err;
@@ -820,6 +834,8 @@ int uv_loop_close(uv_loop_t* loop) {
       return UV_EBUSY;
   }
 
+  uv__timer_wheel_free(loop);
+  uv__work_time_free(loop);
   uv__loop_close(loop);
 
 #ifndef NDEBUG
@@ -955,6 +971,46 @@ void uv__metrics_set_provider_entry_time(uv_loop_t* loop) {
 }
 
 
+void uv__metrics_phase_start(uv_loop_t* loop) {
+  uv__loop_internal_fields_t* lfields;
+
+  lfields = uv__get_internal_fields(loop);
+  if (lfields->phase_cb == NULL)
+    return;
+
+  lfields->phase_start_time = uv_hrtime();
+  lfields->phase_start_idle_time = lfields->loop_metrics.provider_idle_time;
+}
+
+
+void uv__metrics_phase_report(uv_loop_t* loop, uv_loop_phase phase) {
+  uv__loop_internal_fields_t* lfields;
+  uint64_t idle_time;
+  uint64_t duration;
+  uint64_t now;
+
+  lfields = uv__get_internal_fields(loop);
+  /* The callback was installed in the middle of an iteration. */
+  if (lfields->phase_start_time == 0)
+    return;
+
+  /* Only the loop thread writes provider_idle_time, no need to lock. Time
+   * spent blocked in the event provider is not part of any phase.
+   */
+  now = uv_hrtime();
+  idle_time = lfields->loop_metrics.provider_idle_time;
+  duration = now - lfields->phase_start_time;
+  if (duration > idle_time - lfields->phase_start_idle_time)
+    duration -= idle_time - lfields->phase_start_idle_time;
+  else
+    duration = 0;
+
+  lfields->phase_start_time = now;
+  lfields->phase_start_idle_time = idle_time;
+  lfields->phase_cb(loop, phase, duration, lfields->phase_arg);
+}
+
+
 uint64_t uv_metrics_idle_time(uv_loop_t* loop) {
   uv__loop_metrics_t* loop_metrics;
   uint64_t entry_time;
@@ -209,6 +209,7 @@ void uv__work_submit(uv_loop_t* loop,
                      void (*done)(struct uv__work *w, int status));
 
 void uv__work_done(uv_async_t* handle);
+void uv__work_time_free(uv_loop_t* loop);
 
 size_t uv__count_bufs(const uv_buf_t bufs[], unsigned int nbufs);
 
@@ -221,6 +222,8 @@ uv_dirent_type_t uv__fs_get_dirent_type(uv__dirent_t* dent);
 int uv__next_timeout(const uv_loop_t* loop);
 void uv__run_timers(uv_loop_t* loop);
 void uv__timer_close(uv_timer_t* handle);
+int uv__timer_wheel_init(uv_loop_t* loop);
+void uv__timer_wheel_free(uv_loop_t* loop);
 
 void uv__process_title_cleanup(void);
 void uv__signal_cleanup(void);
@@ -367,10 +370,67 @@ struct uv__loop_metrics_s {
 
 void uv__metrics_update_idle_time(uv_loop_t* loop);
 void uv__metrics_set_provider_entry_time(uv_loop_t* loop);
+void uv__metrics_phase_start(uv_loop_t* loop);
+void uv__metrics_phase_report(uv_loop_t* loop, uv_loop_phase phase);
+
+/* Marks the end of one loop phase and the start of the next one. Costs a
+ * single branch unless UV_METRICS_PHASE_TIME is configured.
+ */
+#define uv__metrics_phase_end(loop, phase)                                    \
+  do {                                                                        \
+    if (uv__get_internal_fields(loop)->phase_cb != NULL)                      \
+      uv__metrics_phase_report((loop), (phase));                              \
+  }                                                                           \
+  while (0)
+
+#ifdef __linux__
+struct uv__iou {
+  uint32_t* sqhead;
+  uint32_t* sqtail;
+  uint32_t* sqarray;
+  uint32_t sqmask;
+  uint32_t* cqhead;
+  uint32_t* cqtail;
+  uint32_t cqmask;
+  void* sq;   /* pointer to munmap() on event loop teardown */
+  void* cqe;  /* pointer to array of struct uv__io_uring_cqe */
+  void* sqe;  /* pointer to array of struct uv__io_uring_sqe */
+  size_t maxlen;
+  size_t sqelen;
+  int ringfd;  /* -1 if not set up yet, -2 if unavailable. */
+  uint32_t in_flight;
+  uint32_t max_in_flight;
+  uint32_t unsubmitted;
+  uint64_t ops;  /* Supported UV__IORING_OP_* opcodes, as a bitmask. */
+  uv__io_t watcher;
+};
+#endif  /* __linux__ */
+
+struct uv__work_time {
+  const struct uv__work* w;  /* NULL if the slot is free. */
+  uint64_t submit_time;
+  uint64_t start_time;  /* 0 until a worker has run the request. */
+  uint64_t end_time;
+};
 
 struct uv__loop_internal_fields_s {
   unsigned int flags;
   uv__loop_metrics_t loop_metrics;
+  uv_loop_phase_cb phase_cb;
+  void* phase_arg;
+  uint64_t phase_start_time;
+  uint64_t phase_start_idle_time;
+  struct uv__timer_wheel* timer_wheel;  /* NULL unless UV_LOOP_TIMER_WHEEL. */
+  unsigned int next_run_queue;  /* See threadpool.c. */
+  struct uv__work_time* work_times;  /* NULL unless UV_METRICS_WORK_TIME. */
+  unsigned int work_times_size;
+  unsigned int work_times_count;
+  struct uv__work_time work_time_done;
+#ifdef __linux__
+  struct uv__iou iou;
+  uint64_t busy_poll_time;  /* Spin window in nanoseconds, see epoll.c. */
+  unsigned int busy_poll_socket;  /* SO_BUSY_POLL value for TCP sockets. */
+#endif  /* __linux__ */
 };
 
 #endif /* UV_COMMON_H_ */
@@ -600,13 +600,18 @@ int uv_run(uv_loop_t *loop, uv_run_mode mode) {
 
   while (r != 0 && loop->stop_flag == 0) {
     uv_update_time(loop);
+    uv__metrics_phase_start(loop);
     uv__run_timers(loop);
+    uv__metrics_phase_end(loop, UV_LOOP_PHASE_TIMERS);
 
     can_sleep = loop->pending_reqs_tail == NULL && loop->idle_handles == NULL;
 
     uv__process_reqs(loop);
+    uv__metrics_phase_end(loop, UV_LOOP_PHASE_PENDING);
     uv__idle_invoke(loop);
+    uv__metrics_phase_end(loop, UV_LOOP_PHASE_IDLE);
     uv__prepare_invoke(loop);
+    uv__metrics_phase_end(loop, UV_LOOP_PHASE_PREPARE);
 
     timeout = 0;
     if ((mode == UV_RUN_ONCE && can_sleep) || mode == UV_RUN_DEFAULT)
@@ -628,9 +633,12 @@ int uv_run(uv_loop_t *loop, uv_run_mode mode) {
      * the timeout == 0) or was already updated b/c an event was received.
      */
     uv__metrics_update_idle_time(loop);
+    uv__metrics_phase_end(loop, UV_LOOP_PHASE_POLL);
 
     uv__check_invoke(loop);
+    uv__metrics_phase_end(loop, UV_LOOP_PHASE_CHECK);
     uv__process_endgames(loop);
+    uv__metrics_phase_end(loop, UV_LOOP_PHASE_CLOSING);
 
     if (mode == UV_RUN_ONCE) {
       /* UV_RUN_ONCE implies forward progress: at least one callback must have
@@ -642,7 +650,9 @@ int uv_run(uv_loop_t *loop, uv_run_mode mode) {
        * the check.
        */
       uv_update_time(loop);
+      uv__metrics_phase_start(loop);
       uv__run_timers(loop);
+      uv__metrics_phase_end(loop, UV_LOOP_PHASE_TIMERS);
     }
 
     r = uv__loop_alive(loop);
@@ -38,7 +38,7 @@ static void close_cb(uv_handle_t* handle) {
 }
 
 
-BENCHMARK_IMPL(million_timers) {
+static int million_timers(int use_timer_wheel) {
   uv_timer_t* timers;
   uv_loop_t* loop;
   uint64_t before_all;
@@ -52,6 +52,8 @@ BENCHMARK_IMPL(million_timers) {
   ASSERT_NOT_NULL(timers);
 
   loop = uv_default_loop();
+  if (use_timer_wheel)
+    ASSERT(0 == uv_loop_configure(loop, UV_LOOP_TIMER_WHEEL));
   timeout = 0;
 
   before_all = uv_hrtime();
@@ -84,3 +86,13 @@ BENCHMARK_IMPL(million_timers) {
   MAKE_VALGRIND_HAPPY();
   return 0;
 }
+
+
+BENCHMARK_IMPL(million_timers) {
+  return million_timers(0);
+}
+
+
+BENCHMARK_IMPL(million_timers_wheel) {
+  return million_timers(1);
+}
@@ -0,0 +1,161 @@
+/* Copyright libuv project contributors. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "uv.h"
+#include "task.h"
+
+#include <fcntl.h>
+#include <string.h>
+
+/* Runs the requests that have an io_uring fast path through it, on kernels
+ * that have one. Elsewhere this exercises the threadpool fallback, which
+ * must produce the same results.
+ */
+
+#define TEST_FILE "test_file_iou"
+#define TEST_FILE2 "test_file_iou2"
+
+static uv_fs_t req;
+static uv_file fd;
+static char hello[] = "hello ";
+static char world[] = "io_uring";
+static char readbuf[64];
+static int steps;
+
+static void next_step(uv_fs_t* r);
+
+
+static void expect_size(uv_fs_t* r) {
+  ASSERT(r->result == 0);
+  ASSERT(r->ptr == &r->statbuf);
+  ASSERT(r->statbuf.st_size == strlen(hello) + strlen(world));
+}
+
+
+static void next_step(uv_fs_t* r) {
+  uv_buf_t bufs[2];
+  uv_loop_t* loop;
+
+  loop = r->loop;
+  steps++;
+
+  switch (steps) {
+  case 1:  /* open */
+    ASSERT(r->result >= 0);
+    fd = r->result;
+    uv_fs_req_cleanup(r);
+    bufs[0] = uv_buf_init(hello, strlen(hello));
+    bufs[1] = uv_buf_init(world, strlen(world));
+    ASSERT(0 == uv_fs_write(loop, &req, fd, bufs, 2, -1, next_step));
+    break;
+
+  case 2:  /* write */
+    ASSERT(r->result == (ssize_t) (strlen(hello) + strlen(world)));
+    uv_fs_req_cleanup(r);
+    ASSERT(0 == uv_fs_fsync(loop, &req, fd, next_step));
+    break;
+
+  case 3:  /* fsync */
+    ASSERT(r->result == 0);
+    uv_fs_req_cleanup(r);
+    ASSERT(0 == uv_fs_fdatasync(loop, &req, fd, next_step));
+    break;
+
+  case 4:  /* fdatasync */
+    ASSERT(r->result == 0);
+    uv_fs_req_cleanup(r);
+    ASSERT(0 == uv_fs_fstat(loop, &req, fd, next_step));
+    break;
+
+  case 5:  /* fstat */
+    expect_size(r);
+    uv_fs_req_cleanup(r);
+    bufs[0] = uv_buf_init(readbuf, sizeof(readbuf));
+    ASSERT(0 == uv_fs_read(loop, &req, fd, bufs, 1, 0, next_step));
+    break;
+
+  case 6:  /* read */
+    ASSERT(r->result == (ssize_t) (strlen(hello) + strlen(world)));
+    ASSERT(0 == memcmp(readbuf, "hello io_uring", r->result));
+    uv_fs_req_cleanup(r);
+    ASSERT(0 == uv_fs_close(loop, &req, fd, next_step));
+    break;
+
+  case 7:  /* close */
+    ASSERT(r->result == 0);
+    uv_fs_req_cleanup(r);
+    ASSERT(0 == uv_fs_rename(loop, &req, TEST_FILE, TEST_FILE2, next_step));
+    break;
+
+  case 8:  /* rename */
+    ASSERT(r->result == 0);
+    uv_fs_req_cleanup(r);
+    ASSERT(0 == uv_fs_stat(loop, &req, TEST_FILE2, next_step));
+    break;
+
+  case 9:  /* stat */
+    expect_size(r);
+    uv_fs_req_cleanup(r);
+    ASSERT(0 == uv_fs_lstat(loop, &req, TEST_FILE, next_step));
+    break;
+
+  case 10:  /* lstat of the old name */
+    ASSERT(r->result == UV_ENOENT);
+    uv_fs_req_cleanup(r);
+    break;
+
+  default:
+    ASSERT(0 && "unexpected step");
+  }
+}
+
+
+TEST_IMPL(fs_io_uring) {
+  uv_fs_t unlink_req;
+  uv_loop_t* loop;
+
+#ifdef _WIN32
+  _putenv("UV_USE_IO_URING=1");
+#else
+  setenv("UV_USE_IO_URING", "1", 1);
+#endif
+
+  loop = uv_default_loop();
+  uv_fs_unlink(NULL, &unlink_req, TEST_FILE, NULL);
+  uv_fs_req_cleanup(&unlink_req);
+  uv_fs_unlink(NULL, &unlink_req, TEST_FILE2, NULL);
+  uv_fs_req_cleanup(&unlink_req);
+
+  ASSERT(0 == uv_fs_open(loop,
+                         &req,
+                         TEST_FILE,
+                         O_RDWR | O_CREAT | O_TRUNC,
+                         S_IRUSR | S_IWUSR,
+                         next_step));
+  ASSERT(0 == uv_run(loop, UV_RUN_DEFAULT));
+  ASSERT(steps == 10);
+
+  uv_fs_unlink(NULL, &unlink_req, TEST_FILE2, NULL);
+  uv_fs_req_cleanup(&unlink_req);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
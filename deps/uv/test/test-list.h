@@ -32,6 +32,9 @@ TEST_DECLARE   (loop_stop)
 TEST_DECLARE   (loop_update_time)
 TEST_DECLARE   (loop_backend_timeout)
 TEST_DECLARE   (loop_configure)
+TEST_DECLARE   (loop_busy_poll_timer)
+TEST_DECLARE   (loop_busy_poll_async)
+TEST_DECLARE   (loop_busy_poll_tcp)
 TEST_DECLARE   (default_loop_close)
 TEST_DECLARE   (barrier_1)
 TEST_DECLARE   (barrier_2)
@@ -115,6 +118,7 @@ TEST_DECLARE   (tcp_connect_error_after_write)
 TEST_DECLARE   (tcp_shutdown_after_write)
 TEST_DECLARE   (tcp_bind_error_addrinuse_connect)
 TEST_DECLARE   (tcp_bind_error_addrinuse_listen)
+TEST_DECLARE   (tcp_bind_reuseport)
 TEST_DECLARE   (tcp_bind_error_addrnotavail_1)
 TEST_DECLARE   (tcp_bind_error_addrnotavail_2)
 TEST_DECLARE   (tcp_bind_error_fault)
@@ -227,6 +231,10 @@ TEST_DECLARE   (timer_from_check)
 TEST_DECLARE   (timer_is_closing)
 TEST_DECLARE   (timer_null_callback)
 TEST_DECLARE   (timer_early_check)
+TEST_DECLARE   (timer_wheel_configure)
+TEST_DECLARE   (timer_wheel_order)
+TEST_DECLARE   (timer_wheel_coarse)
+TEST_DECLARE   (timer_wheel_stop_in_callback)
 TEST_DECLARE   (idle_starvation)
 TEST_DECLARE   (idle_check)
 TEST_DECLARE   (loop_handles)
@@ -336,6 +344,7 @@ TEST_DECLARE   (fs_file_noent)
 TEST_DECLARE   (fs_file_nametoolong)
 TEST_DECLARE   (fs_file_loop)
 TEST_DECLARE   (fs_file_async)
+TEST_DECLARE   (fs_io_uring)
 TEST_DECLARE   (fs_file_sync)
 TEST_DECLARE   (fs_file_write_null_buffer)
 TEST_DECLARE   (fs_async_dir)
@@ -545,6 +554,8 @@ TEST_DECLARE  (uname)
 TEST_DECLARE  (metrics_idle_time)
 TEST_DECLARE  (metrics_idle_time_thread)
 TEST_DECLARE  (metrics_idle_time_zero)
+TEST_DECLARE  (metrics_phase_time)
+TEST_DECLARE  (metrics_work_time)
 
 TASK_LIST_START
   TEST_ENTRY_CUSTOM (platform_output, 0, 1, 5000)
@@ -560,6 +571,9 @@ TASK_LIST_START
   TEST_ENTRY  (loop_update_time)
   TEST_ENTRY  (loop_backend_timeout)
   TEST_ENTRY  (loop_configure)
+  TEST_ENTRY  (loop_busy_poll_timer)
+  TEST_ENTRY  (loop_busy_poll_async)
+  TEST_ENTRY  (loop_busy_poll_tcp)
   TEST_ENTRY  (default_loop_close)
   TEST_ENTRY  (barrier_1)
   TEST_ENTRY  (barrier_2)
@@ -693,6 +707,7 @@ TASK_LIST_START
    */
   TEST_HELPER (tcp_bind_error_addrinuse_connect, tcp4_echo_server)
   TEST_ENTRY  (tcp_bind_error_addrinuse_listen)
+  TEST_ENTRY  (tcp_bind_reuseport)
   TEST_ENTRY  (tcp_bind_error_addrnotavail_1)
   TEST_ENTRY  (tcp_bind_error_addrnotavail_2)
   TEST_ENTRY  (tcp_bind_error_fault)
@@ -824,6 +839,10 @@ TASK_LIST_START
   TEST_ENTRY  (timer_is_closing)
   TEST_ENTRY  (timer_null_callback)
   TEST_ENTRY  (timer_early_check)
+  TEST_ENTRY  (timer_wheel_configure)
+  TEST_ENTRY  (timer_wheel_order)
+  TEST_ENTRY  (timer_wheel_coarse)
+  TEST_ENTRY  (timer_wheel_stop_in_callback)
 
   TEST_ENTRY  (idle_starvation)
   TEST_ENTRY  (idle_check)
@@ -1007,6 +1026,7 @@ TASK_LIST_START
   TEST_ENTRY  (fs_file_nametoolong)
   TEST_ENTRY  (fs_file_loop)
   TEST_ENTRY  (fs_file_async)
+  TEST_ENTRY  (fs_io_uring)
   TEST_ENTRY  (fs_file_sync)
   TEST_ENTRY  (fs_file_write_null_buffer)
   TEST_ENTRY  (fs_async_dir)
@@ -1167,6 +1187,8 @@ TASK_LIST_START
   TEST_ENTRY  (metrics_idle_time)
   TEST_ENTRY  (metrics_idle_time_thread)
   TEST_ENTRY  (metrics_idle_time_zero)
+  TEST_ENTRY  (metrics_phase_time)
+  TEST_ENTRY  (metrics_work_time)
 
 #if 0
   /* These are for testing the test runner. */
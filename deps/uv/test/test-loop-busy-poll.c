@@ -0,0 +1,206 @@
+/* Copyright libuv contributors. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "uv.h"
+#include "task.h"
+
+#include <string.h>
+
+static uv_loop_t loop;
+static uv_timer_t timer;
+static uv_async_t async;
+static uv_thread_t thread;
+static uv_tcp_t server;
+static uv_tcp_t client;
+static uv_tcp_t peer;
+static uv_connect_t connect_req;
+static uv_write_t write_req;
+static char buf[64];
+static uint64_t start_time;
+static int timer_cb_called;
+static int async_cb_called;
+static int read_cb_called;
+
+
+static int configure_busy_poll(unsigned int spin_usec,
+                               unsigned int socket_usec) {
+  int r;
+
+  r = uv_loop_configure(&loop, UV_LOOP_BUSY_POLL, spin_usec, socket_usec);
+#ifdef __linux__
+  ASSERT(r == 0);
+#else
+  ASSERT(r == UV_ENOSYS);
+#endif
+  return r;
+}
+
+
+static void timer_cb(uv_timer_t* handle) {
+  timer_cb_called++;
+  uv_close((uv_handle_t*) handle, NULL);
+}
+
+
+TEST_IMPL(loop_busy_poll_timer) {
+  uint64_t elapsed;
+
+  ASSERT(0 == uv_loop_init(&loop));
+  if (configure_busy_poll(200 * 1000, 0) != 0) {
+    ASSERT(0 == uv_loop_close(&loop));
+    RETURN_SKIP("UV_LOOP_BUSY_POLL is only implemented on Linux.");
+  }
+
+  /* A spin window that is longer than the timeout must not delay the timer,
+   * nor may the timer run early once the loop stops spinning.
+   */
+  ASSERT(0 == uv_timer_init(&loop, &timer));
+  ASSERT(0 == uv_timer_start(&timer, timer_cb, 20, 0));
+  start_time = uv_hrtime();
+  ASSERT(0 == uv_run(&loop, UV_RUN_DEFAULT));
+  elapsed = uv_hrtime() - start_time;
+
+  ASSERT(timer_cb_called == 1);
+  ASSERT(elapsed >= 19 * 1000 * 1000);
+  ASSERT(elapsed < 150 * 1000 * 1000);
+
+  /* Same when the loop blocks after a short spin. */
+  ASSERT(0 == uv_loop_configure(&loop, UV_LOOP_BUSY_POLL, 100, 0));
+  ASSERT(0 == uv_timer_init(&loop, &timer));
+  ASSERT(0 == uv_timer_start(&timer, timer_cb, 20, 0));
+  start_time = uv_hrtime();
+  ASSERT(0 == uv_run(&loop, UV_RUN_DEFAULT));
+  elapsed = uv_hrtime() - start_time;
+
+  ASSERT(timer_cb_called == 2);
+  ASSERT(elapsed >= 19 * 1000 * 1000);
+
+  ASSERT(0 == uv_loop_close(&loop));
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+static void async_cb(uv_async_t* handle) {
+  async_cb_called++;
+  uv_close((uv_handle_t*) handle, NULL);
+}
+
+
+static void thread_cb(void* arg) {
+  uv_sleep(10);
+  ASSERT(0 == uv_async_send(&async));
+}
+
+
+TEST_IMPL(loop_busy_poll_async) {
+  uint64_t elapsed;
+
+  ASSERT(0 == uv_loop_init(&loop));
+  if (configure_busy_poll(1000 * 1000, 0) != 0) {
+    ASSERT(0 == uv_loop_close(&loop));
+    RETURN_SKIP("UV_LOOP_BUSY_POLL is only implemented on Linux.");
+  }
+
+  /* Events that arrive while the loop is spinning are handled right away. */
+  ASSERT(0 == uv_async_init(&loop, &async, async_cb));
+  start_time = uv_hrtime();
+  ASSERT(0 == uv_thread_create(&thread, thread_cb, NULL));
+  ASSERT(0 == uv_run(&loop, UV_RUN_DEFAULT));
+  elapsed = uv_hrtime() - start_time;
+  ASSERT(0 == uv_thread_join(&thread));
+
+  ASSERT(async_cb_called == 1);
+  ASSERT(elapsed < 500 * 1000 * 1000);
+
+  ASSERT(0 == uv_loop_close(&loop));
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+static void alloc_cb(uv_handle_t* handle, size_t size, uv_buf_t* b) {
+  b->base = buf;
+  b->len = sizeof(buf);
+}
+
+
+static void read_cb(uv_stream_t* stream, ssize_t nread, const uv_buf_t* b) {
+  if (nread == 0)
+    return;
+
+  ASSERT(nread == 4);
+  ASSERT(0 == memcmp(b->base, "PING", 4));
+  read_cb_called++;
+  uv_close((uv_handle_t*) stream, NULL);
+  uv_close((uv_handle_t*) &client, NULL);
+  uv_close((uv_handle_t*) &server, NULL);
+}
+
+
+static void connection_cb(uv_stream_t* handle, int status) {
+  ASSERT(status == 0);
+  ASSERT(0 == uv_tcp_init(&loop, &peer));
+  ASSERT(0 == uv_accept(handle, (uv_stream_t*) &peer));
+  ASSERT(0 == uv_read_start((uv_stream_t*) &peer, alloc_cb, read_cb));
+}
+
+
+static void connect_cb(uv_connect_t* req, int status) {
+  uv_buf_t b;
+
+  ASSERT(status == 0);
+  b = uv_buf_init("PING", 4);
+  ASSERT(0 == uv_write(&write_req, req->handle, &b, 1, NULL));
+}
+
+
+TEST_IMPL(loop_busy_poll_tcp) {
+  struct sockaddr_in addr;
+
+  ASSERT(0 == uv_ip4_addr("127.0.0.1", TEST_PORT, &addr));
+  ASSERT(0 == uv_loop_init(&loop));
+  /* Setting SO_BUSY_POLL may fail for lack of privileges, which is not an
+   * error.
+   */
+  if (configure_busy_poll(50, 50) != 0) {
+    ASSERT(0 == uv_loop_close(&loop));
+    RETURN_SKIP("UV_LOOP_BUSY_POLL is only implemented on Linux.");
+  }
+
+  ASSERT(0 == uv_tcp_init(&loop, &server));
+  ASSERT(0 == uv_tcp_bind(&server, (const struct sockaddr*) &addr, 0));
+  ASSERT(0 == uv_listen((uv_stream_t*) &server, 1, connection_cb));
+  ASSERT(0 == uv_tcp_init(&loop, &client));
+  ASSERT(0 == uv_tcp_connect(&connect_req,
+                             &client,
+                             (const struct sockaddr*) &addr,
+                             connect_cb));
+  ASSERT(0 == uv_run(&loop, UV_RUN_DEFAULT));
+  ASSERT(read_cb_called == 1);
+
+  ASSERT(0 == uv_loop_close(&loop));
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
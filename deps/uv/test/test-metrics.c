@@ -133,3 +133,172 @@ TEST_IMPL(metrics_idle_time_zero) {
   MAKE_VALGRIND_HAPPY();
   return 0;
 }
+
+
+static uint64_t phase_time[UV_LOOP_PHASE_CLOSING + 1];
+static int phase_count[UV_LOOP_PHASE_CLOSING + 1];
+
+
+static void phase_cb(uv_loop_t* loop,
+                     uv_loop_phase phase,
+                     uint64_t duration,
+                     void* arg) {
+  ASSERT_PTR_EQ(loop, uv_default_loop());
+  ASSERT_PTR_EQ(arg, phase_time);
+  ASSERT_LE(phase, UV_LOOP_PHASE_CLOSING);
+  phase_time[phase] += duration;
+  phase_count[phase]++;
+}
+
+
+static void check_spin_cb(uv_check_t* handle) {
+  uint64_t t;
+
+  t = uv_hrtime();
+  while (uv_hrtime() - t < 100 * UV_NS_TO_MS) { }
+  uv_close((uv_handle_t*) handle, NULL);
+}
+
+
+TEST_IMPL(metrics_phase_time) {
+  uv_timer_t timer;
+  uv_check_t check;
+  int count;
+  int cntr;
+  int i;
+
+  cntr = 0;
+  timer.data = &cntr;
+
+  ASSERT_EQ(0, uv_loop_configure(uv_default_loop(), UV_METRICS_IDLE_TIME));
+  ASSERT_EQ(0, uv_loop_configure(uv_default_loop(),
+                                 UV_METRICS_PHASE_TIME,
+                                 phase_cb,
+                                 phase_time));
+  ASSERT_EQ(0, uv_timer_init(uv_default_loop(), &timer));
+  ASSERT_EQ(0, uv_timer_start(&timer, timer_spin_cb, 500, 0));
+  ASSERT_EQ(0, uv_check_init(uv_default_loop(), &check));
+  ASSERT_EQ(0, uv_check_start(&check, check_spin_cb));
+
+  ASSERT_EQ(0, uv_run(uv_default_loop(), UV_RUN_DEFAULT));
+  ASSERT_EQ(1, cntr);
+
+  for (i = 0; i <= UV_LOOP_PHASE_CLOSING; i++)
+    ASSERT_GT(phase_count[i], 0);
+
+  /* The timer spins for 600 ms, the check handle for 100 ms. The 500 ms that
+   * the loop spends waiting for the timer is idle time, not poll time.
+   */
+  ASSERT_GE(phase_time[UV_LOOP_PHASE_TIMERS], 600 * UV_NS_TO_MS);
+  ASSERT_GE(phase_time[UV_LOOP_PHASE_CHECK], 100 * UV_NS_TO_MS);
+  ASSERT_LT(phase_time[UV_LOOP_PHASE_POLL], 250 * UV_NS_TO_MS);
+
+  /* Passing NULL turns the callbacks off again. */
+  ASSERT_EQ(0, uv_loop_configure(uv_default_loop(),
+                                 UV_METRICS_PHASE_TIME,
+                                 NULL,
+                                 NULL));
+  count = phase_count[UV_LOOP_PHASE_TIMERS];
+  ASSERT_EQ(0, uv_timer_start(&timer, timer_noop_cb, 0, 0));
+  ASSERT_EQ(0, uv_run(uv_default_loop(), UV_RUN_DEFAULT));
+  ASSERT_EQ(2, cntr);
+  ASSERT_EQ(count, phase_count[UV_LOOP_PHASE_TIMERS]);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+static int work_cb_called;
+static int after_work_cb_called;
+
+
+static void work_sleep_cb(uv_work_t* req) {
+  uv_sleep(50);
+  work_cb_called++;
+}
+
+
+static void after_work_untimed_cb(uv_work_t* req, int status) {
+  uint64_t queue_time;
+  uint64_t run_time;
+
+  ASSERT_EQ(0, status);
+  ASSERT_EQ(UV_EINVAL, uv_metrics_work_time((uv_req_t*) req,
+                                            &queue_time,
+                                            &run_time));
+  after_work_cb_called++;
+}
+
+
+static void work_noop_cb(uv_work_t* req) {
+  work_cb_called++;
+}
+
+
+static void after_work_many_cb(uv_work_t* req, int status) {
+  uint64_t queue_time;
+  uint64_t run_time;
+
+  ASSERT_EQ(0, status);
+  ASSERT_EQ(0, uv_metrics_work_time((uv_req_t*) req, &queue_time, &run_time));
+  after_work_cb_called++;
+}
+
+
+static void after_work_timed_cb(uv_work_t* req, int status) {
+  uint64_t queue_time;
+  uint64_t run_time;
+
+  ASSERT_EQ(0, status);
+  ASSERT_EQ(0, uv_metrics_work_time((uv_req_t*) req, &queue_time, &run_time));
+  ASSERT_GE(run_time, 50 * UV_NS_TO_MS);
+  ASSERT_LT(queue_time, 1000 * UV_NS_TO_MS);
+  after_work_cb_called++;
+}
+
+
+TEST_IMPL(metrics_work_time) {
+  uv_work_t reqs[300];
+  uv_work_t req;
+  uv_fs_t fs_req;
+  uint64_t queue_time;
+  uint64_t run_time;
+  unsigned int i;
+
+  /* Work submitted before the option is set is not timed. */
+  ASSERT_EQ(0, uv_queue_work(uv_default_loop(),
+                             &req,
+                             work_sleep_cb,
+                             after_work_untimed_cb));
+  ASSERT_EQ(0, uv_run(uv_default_loop(), UV_RUN_DEFAULT));
+
+  ASSERT_EQ(0, uv_loop_configure(uv_default_loop(), UV_METRICS_WORK_TIME));
+  ASSERT_EQ(0, uv_queue_work(uv_default_loop(),
+                             &req,
+                             work_sleep_cb,
+                             after_work_timed_cb));
+  ASSERT_EQ(0, uv_run(uv_default_loop(), UV_RUN_DEFAULT));
+  ASSERT_EQ(2, work_cb_called);
+  ASSERT_EQ(2, after_work_cb_called);
+
+  /* Enough requests in flight to grow the table of timestamps. */
+  for (i = 0; i < ARRAY_SIZE(reqs); i++)
+    ASSERT_EQ(0, uv_queue_work(uv_default_loop(),
+                               &reqs[i],
+                               work_noop_cb,
+                               after_work_many_cb));
+  ASSERT_EQ(0, uv_run(uv_default_loop(), UV_RUN_DEFAULT));
+  ASSERT_EQ(2 + ARRAY_SIZE(reqs), work_cb_called);
+  ASSERT_EQ(2 + ARRAY_SIZE(reqs), after_work_cb_called);
+
+  /* Synchronous requests never go through the threadpool. */
+  ASSERT_EQ(0, uv_fs_stat(NULL, &fs_req, ".", NULL));
+  ASSERT_EQ(UV_EINVAL, uv_metrics_work_time((uv_req_t*) &fs_req,
+                                            &queue_time,
+                                            &run_time));
+  uv_fs_req_cleanup(&fs_req);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
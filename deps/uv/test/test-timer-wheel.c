@@ -0,0 +1,184 @@
+/* Copyright Joyent, Inc. and other Node contributors. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "uv.h"
+#include "task.h"
+
+static uv_loop_t loop;
+static uv_timer_t timers[8];
+static uint64_t start_time;
+static uint64_t last_due;
+static int timer_cb_called;
+static int repeat_cb_called;
+
+
+static void order_cb(uv_timer_t* handle) {
+  uint64_t due;
+
+  due = *(uint64_t*) handle->data;
+  /* Level 0 of the wheel is exact: never early, and in order. */
+  ASSERT(uv_now(handle->loop) >= start_time + due);
+  ASSERT(due >= last_due);
+  last_due = due;
+  timer_cb_called++;
+}
+
+
+static void coarse_cb(uv_timer_t* handle) {
+  uint64_t elapsed;
+
+  elapsed = uv_now(handle->loop) - start_time;
+  ASSERT(elapsed >= 600);
+  /* May fire late by up to 1/8 of the timeout, plus scheduling noise. */
+  ASSERT(elapsed <= 600 + 600 / 8 + 100);
+  timer_cb_called++;
+}
+
+
+static void repeat_cb(uv_timer_t* handle) {
+  if (++repeat_cb_called == 5)
+    uv_timer_stop(handle);
+}
+
+
+static void never_cb(uv_timer_t* handle) {
+  ASSERT(0 && "never_cb should not have been called");
+}
+
+
+static void stop_cb(uv_timer_t* handle) {
+  /* Stopping a timer that is due in the same slot must prevent it from
+   * running.
+   */
+  uv_timer_stop(&timers[1]);
+  timer_cb_called++;
+}
+
+
+TEST_IMPL(timer_wheel_configure) {
+  uv_timer_t timer;
+
+  ASSERT(0 == uv_loop_init(&loop));
+  ASSERT(0 == uv_timer_init(&loop, &timer));
+  ASSERT(0 == uv_timer_start(&timer, never_cb, 1000, 0));
+  ASSERT(UV_EBUSY == uv_loop_configure(&loop, UV_LOOP_TIMER_WHEEL));
+
+  /* Stopped timers don't count. */
+  ASSERT(0 == uv_timer_stop(&timer));
+  ASSERT(0 == uv_loop_configure(&loop, UV_LOOP_TIMER_WHEEL));
+  ASSERT(0 == uv_loop_configure(&loop, UV_LOOP_TIMER_WHEEL));
+
+  ASSERT(0 == uv_timer_start(&timer, never_cb, 1000, 0));
+  ASSERT(1000 == uv_timer_get_due_in(&timer));
+  ASSERT(0 == uv_timer_stop(&timer));
+  ASSERT(0 == uv_run(&loop, UV_RUN_DEFAULT));
+
+  uv_close((uv_handle_t*) &timer, NULL);
+  ASSERT(0 == uv_run(&loop, UV_RUN_DEFAULT));
+  ASSERT(0 == uv_loop_close(&loop));
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+TEST_IMPL(timer_wheel_order) {
+  static uint64_t dues[] = { 30, 5, 17, 5, 0, 62, 1, 40 };
+  unsigned int i;
+
+  ASSERT(0 == uv_loop_init(&loop));
+  ASSERT(0 == uv_loop_configure(&loop, UV_LOOP_TIMER_WHEEL));
+
+  start_time = uv_now(&loop);
+  for (i = 0; i < ARRAY_SIZE(timers); i++) {
+    ASSERT(0 == uv_timer_init(&loop, &timers[i]));
+    timers[i].data = &dues[i];
+    ASSERT(0 == uv_timer_start(&timers[i], order_cb, dues[i], 0));
+  }
+
+  ASSERT(0 == uv_run(&loop, UV_RUN_DEFAULT));
+  ASSERT(timer_cb_called == (int) ARRAY_SIZE(timers));
+  ASSERT(last_due == 62);
+
+  for (i = 0; i < ARRAY_SIZE(timers); i++)
+    uv_close((uv_handle_t*) &timers[i], NULL);
+  ASSERT(0 == uv_run(&loop, UV_RUN_DEFAULT));
+  ASSERT(0 == uv_loop_close(&loop));
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+TEST_IMPL(timer_wheel_coarse) {
+  ASSERT(0 == uv_loop_init(&loop));
+  ASSERT(0 == uv_loop_configure(&loop, UV_LOOP_TIMER_WHEEL));
+
+  start_time = uv_now(&loop);
+  ASSERT(0 == uv_timer_init(&loop, &timers[0]));
+  ASSERT(0 == uv_timer_start(&timers[0], coarse_cb, 600, 0));
+  ASSERT(0 == uv_timer_init(&loop, &timers[1]));
+  ASSERT(0 == uv_timer_start(&timers[1], repeat_cb, 7, 7));
+
+  /* Far beyond the range of the wheel. Must not keep the loop from
+   * reporting the other timers, and must be removable.
+   */
+  ASSERT(0 == uv_timer_init(&loop, &timers[2]));
+  ASSERT(0 == uv_timer_start(&timers[2], never_cb, (uint64_t) -1, 0));
+  uv_unref((uv_handle_t*) &timers[2]);
+
+  ASSERT(0 == uv_run(&loop, UV_RUN_DEFAULT));
+  ASSERT(timer_cb_called == 1);
+  ASSERT(repeat_cb_called == 5);
+  ASSERT(0 == uv_timer_stop(&timers[2]));
+
+  uv_close((uv_handle_t*) &timers[0], NULL);
+  uv_close((uv_handle_t*) &timers[1], NULL);
+  uv_close((uv_handle_t*) &timers[2], NULL);
+  ASSERT(0 == uv_run(&loop, UV_RUN_DEFAULT));
+  ASSERT(0 == uv_loop_close(&loop));
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+TEST_IMPL(timer_wheel_stop_in_callback) {
+  ASSERT(0 == uv_loop_init(&loop));
+  ASSERT(0 == uv_loop_configure(&loop, UV_LOOP_TIMER_WHEEL));
+
+  ASSERT(0 == uv_timer_init(&loop, &timers[0]));
+  ASSERT(0 == uv_timer_init(&loop, &timers[1]));
+  ASSERT(0 == uv_timer_start(&timers[0], stop_cb, 10, 0));
+  ASSERT(0 == uv_timer_start(&timers[1], never_cb, 10, 0));
+
+  ASSERT(0 == uv_run(&loop, UV_RUN_DEFAULT));
+  ASSERT(timer_cb_called == 1);
+  ASSERT(0 == uv_is_active((uv_handle_t*) &timers[1]));
+
+  uv_close((uv_handle_t*) &timers[0], NULL);
+  uv_close((uv_handle_t*) &timers[1], NULL);
+  ASSERT(0 == uv_run(&loop, UV_RUN_DEFAULT));
+  ASSERT(0 == uv_loop_close(&loop));
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
@@ -102,6 +102,9 @@ function Agent(options) {
   if (this.options.noDelay === undefined)
     this.options.noDelay = true;
 
+  if (this.options.autoCork === undefined)
+    this.options.autoCork = true;
+
   // Don't confuse net and make it think that we're connecting to a pipe
   this.options.path = null;
   this.requests = { __proto__: null };
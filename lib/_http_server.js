@@ -24,6 +24,7 @@
 const {
   ArrayIsArray,
   Error,
+  MathMax,
   MathMin,
   ObjectKeys,
   ObjectSetPrototypeOf,
@@ -35,6 +36,7 @@ const {
 
 const net = require('net');
 const EE = require('events');
+const fs = require('fs');
 const assert = require('internal/assert');
 const {
   parsers,
@@ -68,6 +70,7 @@ const {
 const { IncomingMessage } = require('_http_incoming');
 const {
   connResetException,
+  errnoException,
   codes
 } = require('internal/errors');
 const {
@@ -82,10 +85,24 @@ const {
 const {
   validateInteger,
   validateBoolean,
+  validateFunction,
   validateLinkHeaderValue,
   validateObject
 } = require('internal/validators');
+const { getValidatedFd } = require('internal/fs/utils');
+const { kEmptyObject } = require('internal/util');
+const { pipeline } = require('stream');
+const eos = require('internal/streams/end-of-stream');
 const Buffer = require('buffer').Buffer;
+const { FileHandle } = internalBinding('fs');
+const { Pipe } = internalBinding('pipe_wrap');
+const { StreamPipe } = internalBinding('stream_pipe');
+const {
+  kReadBytesOrError,
+  streamBaseState,
+} = internalBinding('stream_wrap');
+const { TCP } = internalBinding('tcp_wrap');
+const { UV_EOF } = internalBinding('uv');
 const { setInterval, clearInterval } = require('timers');
 let debug = require('internal/util/debuglog').debuglog('http', (fn) => {
   debug = fn;
@@ -326,6 +343,117 @@ ServerResponse.prototype.writeEarlyHints = function writeEarlyHints(hints, cb) {
   this._writeRaw(head, 'ascii', cb);
 };
 
+ServerResponse.prototype.sendFile = function sendFile(fd, options, callback) {
+  if (typeof options === 'function') {
+    callback = options;
+    options = undefined;
+  }
+  fd = getValidatedFd(fd);
+  if (options !== undefined)
+    validateObject(options, 'options');
+  const { offset = 0, length } = options ?? kEmptyObject;
+  validateInteger(offset, 'options.offset', 0);
+  if (length !== undefined)
+    validateInteger(length, 'options.length', 0);
+  if (callback !== undefined)
+    validateFunction(callback, 'callback');
+  if (this._header)
+    throw new ERR_HTTP_HEADERS_SENT('set');
+
+  if (length !== undefined) {
+    sendFileRange(this, fd, offset, length, callback);
+    return this;
+  }
+  fs.fstat(fd, (err, stats) => {
+    if (err) {
+      if (callback !== undefined)
+        callback(err);
+      else
+        this.destroy(err);
+      return;
+    }
+    sendFileRange(this, fd, offset, MathMax(stats.size - offset, 0), callback);
+  });
+  return this;
+};
+
+function sendFileRange(res, fd, offset, length, callback) {
+  if (callback !== undefined)
+    eos(res, callback);
+  if (!res._header) {
+    if (!res.hasHeader('content-length'))
+      res.setHeader('Content-Length', length);
+    res._implicitHeader();
+  }
+  if (!res._hasBody || length === 0) {
+    res.end();
+    return;
+  }
+  if (!canPipeFileToSocket(res)) {
+    sendFileStreamed(res, fd, offset, length);
+    return;
+  }
+  // The headers need to be out before the file is sent behind the back of the
+  // socket's Writable.
+  res._send('', 'latin1', (err) => {
+    if (err)
+      return;
+    if (!canPipeFileToSocket(res) || res.socket.writableLength > 0) {
+      sendFileStreamed(res, fd, offset, length);
+      return;
+    }
+    pipeFileToSocket(res, fd, offset, length);
+  });
+}
+
+function sendFileStreamed(res, fd, offset, length) {
+  const stream = fs.createReadStream(null, {
+    fd,
+    start: offset,
+    end: offset + length - 1,
+    autoClose: false,
+  });
+  pipeline(stream, res, (err) => {
+    debug('sendFile pipeline finished', err);
+  });
+}
+
+// On raw sockets, StreamPipe sends the file with sendfile() where the platform
+// supports it, without the data ever passing through JS.
+function canPipeFileToSocket(res) {
+  const { socket } = res;
+  return socket?._httpMessage === res &&
+         !socket.destroyed &&
+         !res.chunkedEncoding &&
+         !res.strictContentLength &&
+         (socket._handle instanceof TCP || socket._handle instanceof Pipe);
+}
+
+function pipeFileToSocket(res, fd, offset, length) {
+  const { socket } = res;
+  const handle = new FileHandle(fd, offset, length);
+  let error = null;
+  handle.onread = () => {
+    const nread = streamBaseState[kReadBytesOrError];
+    if (nread < 0 && nread !== UV_EOF)
+      error = errnoException(nread, 'sendfile');
+  };
+
+  // Keep the socket open for the next response when the file ends.
+  const pipe = new StreamPipe(handle, socket._handle, false);
+  const onSocketClose = () => pipe.unpipe();
+  socket.once('close', onSocketClose);
+  pipe.onunpipe = () => {
+    handle.releaseFD();
+    socket.removeListener('close', onSocketClose);
+    if (error !== null)
+      res.destroy(error);
+    else if (!socket.destroyed)
+      res.end();
+  };
+  pipe.start();
+}
+
 ServerResponse.prototype._implicitHeader = function _implicitHeader() {
   this.writeHead(this.statusCode);
 };
@@ -436,6 +564,9 @@ function storeHTTPOptions(options) {
   if (options.noDelay === undefined)
     options.noDelay = true;
 
+  if (options.autoCork === undefined)
+    options.autoCork = true;
+
   const requestTimeout = options.requestTimeout;
   if (requestTimeout !== undefined) {
     validateInteger(requestTimeout, 'requestTimeout', 0);
@@ -513,6 +644,7 @@ function Server(options, requestListener) {
   net.Server.call(
     this,
     { allowHalfOpen: true, noDelay: options.noDelay,
+      autoCork: options.autoCork,
       keepAlive: options.keepAlive,
       keepAliveInitialDelay: options.keepAliveInitialDelay });
 
@@ -34,7 +34,9 @@ const {
 
 const errors = require('internal/errors');
 const {
+  kSetBatch,
   kStateSymbol,
+  MessageBatch,
   _createSocketHandle,
   newHandle,
 } = require('internal/dgram');
@@ -42,6 +44,7 @@ const { guessHandleType } = internalBinding('util');
 const {
   ERR_BUFFER_OUT_OF_BOUNDS,
   ERR_INVALID_ARG_TYPE,
+  ERR_INVALID_IP_ADDRESS,
   ERR_MISSING_ARGS,
   ERR_SOCKET_ALREADY_BOUND,
   ERR_SOCKET_BAD_BUFFER_SIZE,
@@ -54,12 +57,17 @@ const {
 const {
   isInt32,
   validateAbortSignal,
+  validateArray,
+  validateBoolean,
+  validateFunction,
+  validateObject,
   validateString,
   validateNumber,
   validatePort,
 } = require('internal/validators');
 const { Buffer } = require('buffer');
-const { deprecate } = require('internal/util');
+const { deprecate, kEmptyObject } = require('internal/util');
+const { isIP } = require('internal/net');
 const { isArrayBufferView } = require('internal/util/types');
 const EventEmitter = require('events');
 const {
@@ -104,6 +112,7 @@ function Socket(type, listener) {
   let lookup;
   let recvBufferSize;
   let sendBufferSize;
+  let receiveBatch = false;
 
   let options;
   if (type !== null && typeof type === 'object') {
@@ -112,9 +121,13 @@ function Socket(type, listener) {
     lookup = options.lookup;
     recvBufferSize = options.recvBufferSize;
     sendBufferSize = options.sendBufferSize;
+    if (options.receiveBatch !== undefined) {
+      receiveBatch = options.receiveBatch;
+      validateBoolean(receiveBatch, 'options.receiveBatch');
+    }
   }
 
-  const handle = newHandle(type, lookup);
+  const handle = newHandle(type, lookup, receiveBatch);
   handle[owner_symbol] = this;
 
   this[async_id_symbol] = handle.getAsyncId();
@@ -132,7 +145,9 @@ function Socket(type, listener) {
     reuseAddr: options && options.reuseAddr, // Use UV_UDP_REUSEADDR if true.
     ipv6Only: options && options.ipv6Only,
     recvBufferSize,
-    sendBufferSize
+    sendBufferSize,
+    receiveBatch,
+    batch: null,
   };
 
   if (options?.signal !== undefined) {
@@ -168,6 +183,10 @@ function startListening(socket) {
 
   state.handle.onmessage = onMessage;
   state.handle.onerror = onError;
+  if (state.receiveBatch) {
+    state.handle.onbatch = onBatch;
+    state.batch = new MessageBatch(state.handle.enableRecvBatch());
+  }
   state.handle.recvStart();
   state.receiving = true;
   state.bindState = BIND_STATE_BOUND;
@@ -728,6 +747,121 @@ function afterSend(err, sent) {
   this.callback(err, sent);
 }
 
+Socket.prototype.sendBatch = function(messages, options, callback) {
+  if (typeof options === 'function') {
+    callback = options;
+    options = kEmptyObject;
+  } else if (options === undefined) {
+    options = kEmptyObject;
+  }
+  validateArray(messages, 'messages');
+  validateObject(options, 'options');
+  const { segment = false } = options;
+  validateBoolean(segment, 'options.segment');
+  if (callback !== undefined)
+    validateFunction(callback, 'callback');
+
+  const state = this[kStateSymbol];
+  const connected = state.connectState === CONNECT_STATE_CONNECTED;
+  const list = new Array(messages.length);
+  let ports;
+  let addresses;
+  if (!connected) {
+    ports = new Array(messages.length);
+    addresses = new Array(messages.length);
+  }
+  for (let i = 0; i < messages.length; i++) {
+    const message = messages[i];
+    validateObject(message, `messages[${i}]`);
+    const { msg, port, address } = message;
+    if (typeof msg === 'string') {
+      list[i] = Buffer.from(msg);
+    } else if (isArrayBufferView(msg)) {
+      list[i] = msg;
+    } else {
+      throw new ERR_INVALID_ARG_TYPE(`messages[${i}].msg`,
+                                     ['Buffer',
+                                      'TypedArray',
+                                      'DataView',
+                                      'string'],
+                                     msg);
+    }
+
+    if (connected) {
+      if (port !== undefined || address !== undefined)
+        throw new ERR_SOCKET_DGRAM_IS_CONNECTED();
+      continue;
+    }
+    ports[i] = validatePort(port, `messages[${i}].port`, false);
+    // Addresses are not resolved, as a lookup for each datagram would cost
+    // more than sending them in one batch saves.
+    if (address === undefined) {
+      addresses[i] = this.type === 'udp4' ? '127.0.0.1' : '::1';
+    } else {
+      validateString(address, `messages[${i}].address`);
+      if (isIP(address) === 0)
+        throw new ERR_INVALID_IP_ADDRESS(address);
+      addresses[i] = address;
+    }
+  }
+
+  healthCheck(this);
+
+  if (state.bindState === BIND_STATE_UNBOUND)
+    this.bind({ port: 0, exclusive: true }, null);
+
+  // If the socket hasn't been bound yet, send the batch after binding is
+  // complete, in order with other queued datagrams.
+  if (state.bindState !== BIND_STATE_BOUND) {
+    enqueue(this, () => {
+      defaultTriggerAsyncIdScope(
+        this[async_id_symbol],
+        doSendBatch,
+        this, list, ports, addresses, segment, callback
+      );
+    });
+    return;
+  }
+
+  defaultTriggerAsyncIdScope(
+    this[async_id_symbol],
+    doSendBatch,
+    this, list, ports, addresses, segment, callback
+  );
+};
+
+function doSendBatch(self, list, ports, addresses, segment, callback) {
+  const state = self[kStateSymbol];
+  if (!state.handle)
+    return;
+
+  const req = new SendWrap();
+  req.list = list;  // Keep reference alive.
+  if (callback) {
+    req.callback = callback;
+    req.oncomplete = afterSendBatch;
+  }
+
+  const err = state.handle.sendBatch(req, list, list.length, ports, addresses,
+                                     segment, !!callback);
+
+  if (err >= 1) {
+    // Synchronous finish. The return code is the number of datagrams + 1, as
+    // for send().
+    if (callback)
+      process.nextTick(callback, null, err - 1);
+    return;
+  }
+
+  // `req.sent` is the number of datagrams sent before the one that failed.
+  if (err && callback)
+    process.nextTick(callback, errnoException(err, 'send'), req.sent ?? 0);
+}
+
+function afterSendBatch(err, sent) {
+  this.callback(err ? errnoException(err, 'send') : null, sent);
+}
+
 Socket.prototype.close = function(callback) {
   const state = this[kStateSymbol];
   const queue = state.queue;
@@ -934,6 +1068,21 @@ function onMessage(nread, handle, buf, rinfo) {
 }
 
 
+function onBatch(count, buffer, addresses) {
+  const self = this[owner_symbol];
+  const batch = self[kStateSymbol].batch;
+  batch[kSetBatch](count, buffer, addresses);
+  self.emit('messages', batch);
+  // Buffers and rinfo objects for each datagram are only created if there
+  // are 'message' listeners.
+  const state = self[kStateSymbol];
+  for (let i = 0; i < count && self.listenerCount('message') > 0; i++) {
+    if (state.handle === null) break;
+    self.emit('message', batch.message(i), batch.rinfo(i));
+  }
+}
+
+
 function onError(nread, handle, error) {
   const self = handle[owner_symbol];
   return self.emit('error', error);
@@ -25,12 +25,15 @@
 'use strict';
 
 const {
+  ArrayIsArray,
   ArrayPrototypePush,
   BigIntPrototypeToString,
+  Int32Array,
   MathMax,
   Number,
   ObjectDefineProperties,
   ObjectDefineProperty,
+  ObjectKeys,
   Promise,
   ReflectApply,
   SafeMap,
@@ -74,11 +77,17 @@ const {
   uvException
 } = require('internal/errors');
 
-const { FSReqCallback } = binding;
+const {
+  FSReadFileJob,
+  FSReqCallback,
+  FSStatManyJob,
+  kFsStatsFieldsNumber,
+} = binding;
 const { toPathIfFileURL } = require('internal/url');
 const {
   customPromisifyArgs: kCustomPromisifyArgsSymbol,
   kEmptyObject,
+  normalizeEncoding,
   promisify: {
     custom: kCustomPromisifiedSymbol,
   },
@@ -126,13 +135,16 @@ const {
 const {
   isUint32,
   parseFileMode,
+  validateArray,
   validateBoolean,
   validateBuffer,
   validateEncoding,
   validateFunction,
   validateInteger,
   validateObject,
+  validateOneOf,
   validateString,
+  validateUint32,
 } = require('internal/validators');
 
 let truncateWarn = true;
@@ -286,18 +298,7 @@ function existsSync(path) {
   } catch {
     return false;
   }
-  const ctx = { path };
-  const nPath = pathModule.toNamespacedPath(path);
-  binding.access(nPath, F_OK, undefined, ctx);
-
-  // In case of an invalid symlink, `binding.access()` on win32
-  // will **not** return an error and is therefore not enough.
-  // Double check with `binding.stat()`.
-  if (isWindows && ctx.errno === undefined) {
-    binding.stat(nPath, false, undefined, ctx);
-  }
-
-  return ctx.errno === undefined;
+  return binding.existsSync(pathModule.toNamespacedPath(path));
 }
 
 function readFileAfterOpen(err, fd) {
@@ -371,6 +372,40 @@ function checkAborted(signal, callback) {
 function readFile(path, options, callback) {
   callback = maybeCallback(callback || options);
   options = getOptions(options, { flag: 'r' });
+  // Aborting needs the file to be read in chunks, everything else is read by
+  // a single threadpool job.
+  if (!options.signal) {
+    const { encoding } = options;
+    const utf8 = normalizeEncoding(encoding) === 'utf8';
+    let job;
+    if (isFd(path)) {
+      job = new FSReadFileJob(getValidatedFd(path), undefined, utf8);
+    } else {
+      const flagsNumber = stringToFlags(options.flag, 'options.flag');
+      path = getValidatedPath(path);
+      job = new FSReadFileJob(pathModule.toNamespacedPath(path),
+                              flagsNumber,
+                              utf8);
+    }
+    job.oncomplete = (err, data) => {
+      if (err) {
+        callback(err);
+        return;
+      }
+      if (encoding && !utf8) {
+        try {
+          data = data.toString(encoding);
+        } catch (err) {
+          callback(err);
+          return;
+        }
+      }
+      callback(null, data);
+    };
+    job.run();
+    return;
+  }
+
   const ReadFileContext = require('internal/fs/read_file_context');
   const context = new ReadFileContext(callback, options.encoding);
   context.isUserFd = isFd(path); // File descriptor ownership
@@ -400,43 +435,6 @@ function readFile(path, options, callback) {
                req);
 }
 
-function tryStatSync(fd, isUserFd) {
-  const ctx = {};
-  const stats = binding.fstat(fd, false, undefined, ctx);
-  if (ctx.errno !== undefined && !isUserFd) {
-    fs.closeSync(fd);
-    throw uvException(ctx);
-  }
-  return stats;
-}
-
-function tryCreateBuffer(size, fd, isUserFd) {
-  let threw = true;
-  let buffer;
-  try {
-    if (size > kIoMaxLength) {
-      throw new ERR_FS_FILE_TOO_LARGE(size);
-    }
-    buffer = Buffer.allocUnsafe(size);
-    threw = false;
-  } finally {
-    if (threw && !isUserFd) fs.closeSync(fd);
-  }
-  return buffer;
-}
-
-function tryReadSync(fd, isUserFd, buffer, pos, len) {
-  let threw = true;
-  let bytesRead;
-  try {
-    bytesRead = fs.readSync(fd, buffer, pos, len);
-    threw = false;
-  } finally {
-    if (threw && !isUserFd) fs.closeSync(fd);
-  }
-  return bytesRead;
-}
-
 /**
  * Synchronously reads the entire contents of a file.
  * @param {string | Buffer | URL | number} path
@@ -448,53 +446,72 @@ function tryReadSync(fd, isUserFd, buffer, pos, len) {
  */
 function readFileSync(path, options) {
   options = getOptions(options, { flag: 'r' });
-  const isUserFd = isFd(path); // File descriptor ownership
-  const fd = isUserFd ? path : fs.openSync(path, options.flag, 0o666);
-
-  const stats = tryStatSync(fd, isUserFd);
-  const size = isFileType(stats, S_IFREG) ? stats[8] : 0;
-  let pos = 0;
-  let buffer; // Single buffer with file data
-  let buffers; // List for when size is unknown
-
-  if (size === 0) {
-    buffers = [];
+  const { encoding } = options;
+  const utf8 = normalizeEncoding(encoding) === 'utf8';
+  const ctx = {};
+  let data;
+  if (isFd(path)) {
+    data = binding.readFileSync(getValidatedFd(path), undefined, utf8, ctx);
   } else {
-    buffer = tryCreateBuffer(size, fd, isUserFd);
+    const flagsNumber = stringToFlags(options.flag, 'options.flag');
+    path = getValidatedPath(path);
+    data = binding.readFileSync(pathModule.toNamespacedPath(path),
+                                flagsNumber,
+                                utf8,
+                                ctx);
   }
+  handleErrorFromBinding(ctx);
 
-  let bytesRead;
+  if (encoding && !utf8) data = data.toString(encoding);
+  return data;
+}
 
-  if (size !== 0) {
-    do {
-      bytesRead = tryReadSync(fd, isUserFd, buffer, pos, size - pos);
-      pos += bytesRead;
-    } while (bytesRead !== 0 && pos < size);
-  } else {
-    do {
-      // The kernel lies about many files.
-      // Go ahead and try to read some bytes.
-      buffer = Buffer.allocUnsafe(8192);
-      bytesRead = tryReadSync(fd, isUserFd, buffer, 0, 8192);
-      if (bytesRead !== 0) {
-        ArrayPrototypePush(buffers, buffer.slice(0, bytesRead));
-      }
-      pos += bytesRead;
-    } while (bytesRead !== 0);
-  }
+// Keep in sync with MmapAdvice in src/node_file.cc.
+const kMmapAdvice = {
+  __proto__: null,
+  normal: 0,
+  sequential: 1 << 0,
+  random: 1 << 1,
+  willneed: 1 << 2,
+  hugepage: 1 << 3,
+};
 
-  if (!isUserFd)
-    fs.closeSync(fd);
+/**
+ * Synchronously maps a file into memory.
+ * @param {string | Buffer | URL | number} path
+ * @param {{
+ *   offset?: number;
+ *   length?: number;
+ *   advice?: string | string[];
+ *   }} [options]
+ * @returns {Buffer}
+ */
+function mmapSync(path, options = kEmptyObject) {
+  validateObject(options, 'options');
+  const { offset = 0, length, advice = 'normal' } = options;
+  validateInteger(offset, 'options.offset', 0);
+  if (length !== undefined)
+    validateInteger(length, 'options.length', 0);
 
-  if (size === 0) {
-    // Data was collected into the buffers list.
-    buffer = Buffer.concat(buffers, pos);
-  } else if (pos < size) {
-    buffer = buffer.slice(0, pos);
+  let adviceFlags = 0;
+  const hints = ArrayIsArray(advice) ? advice : [advice];
+  for (let i = 0; i < hints.length; i++) {
+    validateOneOf(hints[i], 'options.advice', ObjectKeys(kMmapAdvice));
+    adviceFlags |= kMmapAdvice[hints[i]];
   }
 
-  if (options.encoding) buffer = buffer.toString(options.encoding);
-  return buffer;
+  const ctx = {};
+  let data;
+  if (isFd(path)) {
+    data = binding.mmapSync(getValidatedFd(path), offset, length ?? -1,
+                            adviceFlags, ctx);
+  } else {
+    path = getValidatedPath(path);
+    data = binding.mmapSync(pathModule.toNamespacedPath(path), offset,
+                            length ?? -1, adviceFlags, ctx);
+  }
+  handleErrorFromBinding(ctx);
+  return data;
 }
 
 function defaultCloseCallback(err) {
@@ -1390,6 +1407,9 @@ function mkdirSync(path, options) {
  * @param {string | {
  *   encoding?: string;
  *   withFileTypes?: boolean;
+ *   recursive?: boolean;
+ *   include?: string[];
+ *   exclude?: string[];
  *   }} [options]
  * @param {(
  *   err?: Error,
@@ -1401,6 +1421,10 @@ function readdir(path, options, callback) {
   callback = makeCallback(typeof options === 'function' ? options : callback);
   options = getOptions(options);
   path = getValidatedPath(path);
+  if (options.recursive) {
+    require('internal/fs/dir').readdirRecursive(path, options, callback);
+    return;
+  }
 
   const req = new FSReqCallback();
   if (!options.withFileTypes) {
@@ -1424,12 +1448,17 @@ function readdir(path, options, callback) {
  * @param {string | {
  *   encoding?: string;
  *   withFileTypes?: boolean;
+ *   recursive?: boolean;
+ *   include?: string[];
+ *   exclude?: string[];
  *   }} [options]
  * @returns {string | Buffer[] | Dirent[]}
  */
 function readdirSync(path, options) {
   options = getOptions(options);
   path = getValidatedPath(path);
+  if (options.recursive)
+    return require('internal/fs/dir').readdirRecursiveSync(path, options);
   const ctx = { path };
   const result = binding.readdir(pathModule.toNamespacedPath(path),
                                  options.encoding, !!options.withFileTypes,
@@ -1509,6 +1538,71 @@ function stat(path, options = { bigint: false }, callback) {
   binding.stat(pathModule.toNamespacedPath(path), options.bigint, req);
 }
 
+/**
+ * Asynchronously runs `stat()`, `lstat()` or `access()` on many paths
+ * as a single threadpool job.
+ * @param {Array<string | Buffer | URL>} paths
+ * @param {{
+ *   bigint?: boolean;
+ *   syscall?: 'stat' | 'lstat' | 'access';
+ *   mode?: number;
+ *   }} [options]
+ * @param {(
+ *   err?: Error,
+ *   errors?: Int32Array,
+ *   stats?: Array<Stats | undefined>
+ *   ) => any} callback
+ * @returns {void}
+ */
+function statMany(paths, options = kEmptyObject, callback) {
+  if (typeof options === 'function') {
+    callback = options;
+    options = kEmptyObject;
+  }
+  validateFunction(callback, 'cb');
+  validateArray(paths, 'paths');
+  validateObject(options, 'options');
+  const { bigint = false, syscall = 'stat' } = options;
+  validateBoolean(bigint, 'options.bigint');
+  validateOneOf(syscall, 'options.syscall', ['stat', 'lstat', 'access']);
+  const mode = syscall === 'access' ? getValidMode(options.mode, 'access') :
+    F_OK;
+
+  const nPaths = [];
+  for (let i = 0; i < paths.length; i++) {
+    const path = getValidatedPath(paths[i], `paths[${i}]`);
+    ArrayPrototypePush(nPaths, pathModule.toNamespacedPath(path));
+  }
+
+  if (nPaths.length === 0) {
+    process.nextTick(callback, null, new Int32Array(0),
+                     syscall === 'access' ? undefined : []);
+    return;
+  }
+
+  const job = new FSStatManyJob(nPaths, syscall, mode, bigint);
+  job.oncomplete = (status, errors, packedStats) => {
+    if (status !== 0) {
+      callback(uvException({ errno: status, syscall }));
+      return;
+    }
+    let stats;
+    if (packedStats !== undefined) {
+      stats = [];
+      for (let i = 0; i < errors.length; i++) {
+        ArrayPrototypePush(stats, errors[i] === 0 ?
+          getStatsFromBinding(packedStats, i * kFsStatsFieldsNumber) :
+          undefined);
+      }
+    }
+    callback(null, errors, stats);
+  };
+  job.run();
+}
+
+ObjectDefineProperty(statMany, kCustomPromisifyArgsSymbol,
+                     { __proto__: null, value: ['errors', 'stats'], enumerable: false });
+
 function hasNoEntryError(ctx) {
   if (ctx.errno) {
     const uvErr = uvErrmapGet(ctx.errno);
@@ -1573,14 +1667,19 @@ function lstatSync(path, options = { bigint: false, throwIfNoEntry: true }) {
  */
 function statSync(path, options = { bigint: false, throwIfNoEntry: true }) {
   path = getValidatedPath(path);
-  const ctx = { path };
-  const stats = binding.stat(pathModule.toNamespacedPath(path),
-                             options.bigint, undefined, ctx);
-  if (options.throwIfNoEntry === false && hasNoEntryError(ctx)) {
-    return undefined;
+  const bigint = options.bigint === true;
+  // Unlike binding.stat(), binding.statSync() returns an error number instead
+  // of filling in a ctx object, which lets V8 call it through the fast API.
+  const errno = binding.statSync(pathModule.toNamespacedPath(path), bigint);
+  if (errno !== 0) {
+    const ctx = { path, errno, syscall: 'stat' };
+    if (options.throwIfNoEntry === false && hasNoEntryError(ctx)) {
+      return undefined;
+    }
+    handleErrorFromBinding(ctx);
   }
-  handleErrorFromBinding(ctx);
-  return getStatsFromBinding(stats);
+  return getStatsFromBinding(
+    bigint ? binding.bigintStatValues : binding.statValues);
 }
 
 /**
@@ -2270,6 +2369,7 @@ function appendFileSync(path, data, options) {
  *   persistent?: boolean;
  *   recursive?: boolean;
  *   encoding?: string;
+ *   coalesceWindow?: number;
  *   signal?: AbortSignal;
  *   }} [options]
  * @param {(
@@ -2289,22 +2389,32 @@ function watch(filename, options, listener) {
 
   if (options.persistent === undefined) options.persistent = true;
   if (options.recursive === undefined) options.recursive = false;
+  if (options.coalesceWindow === undefined) options.coalesceWindow = 0;
+  validateUint32(options.coalesceWindow, 'options.coalesceWindow');
+
+  // Recursive watches on platforms other than macOS and Windows are
+  // implemented in Node.js, which only accepts booleans.
+  if (options.recursive && !isOSX && !isWindows)
+    validateBoolean(options.recursive, 'options.recursive');
 
   let watcher;
   const watchers = require('internal/fs/watchers');
   // TODO(anonrig): Remove non-native watcher when/if libuv supports recursive.
   // As of November 2022, libuv does not support recursive file watch on all platforms,
-  // e.g. Linux due to the limitations of inotify.
-  if (options.recursive && !isOSX && !isWindows) {
+  // e.g. Linux due to the limitations of inotify. On Linux, a recursive watch
+  // is implemented natively on top of inotify instead.
+  if (options.recursive && !isOSX && !isWindows &&
+      !watchers.hasNativeRecursiveWatch()) {
     const nonNativeWatcher = require('internal/fs/recursive_watch');
     watcher = new nonNativeWatcher.FSWatcher(options);
     watcher[watchers.kFSWatchStart](filename);
   } else {
-    watcher = new watchers.FSWatcher();
+    watcher = new watchers.FSWatcher(options.recursive);
     watcher[watchers.kFSWatchStart](filename,
                                     options.persistent,
                                     options.recursive,
-                                    options.encoding);
+                                    options.encoding,
+                                    options.coalesceWindow);
   }
 
   if (listener) {
@@ -2992,6 +3102,7 @@ module.exports = fs = {
   mkdirSync,
   mkdtemp,
   mkdtempSync,
+  mmapSync,
   open,
   openSync,
   readdir,
@@ -3013,6 +3124,7 @@ module.exports = fs = {
   rmdir,
   rmdirSync,
   stat,
+  statMany,
   statSync,
   symlink,
   symlinkSync,
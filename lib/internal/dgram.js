@@ -3,6 +3,7 @@
 const {
   FunctionPrototypeBind,
   Symbol,
+  TypedArrayPrototypeSubarray,
 } = primordials;
 
 const { codes } = require('internal/errors');
@@ -11,6 +12,7 @@ const { guessHandleType } = internalBinding('util');
 const {
   isInt32,
   validateFunction,
+  validateInteger,
 } = require('internal/validators');
 const { UV_EINVAL } = internalBinding('uv');
 const {
@@ -29,7 +31,7 @@ function lookup6(lookup, address, callback) {
   return lookup(address || '::1', 6, callback);
 }
 
-function newHandle(type, lookup) {
+function newHandle(type, lookup, recvmmsg = false) {
   if (lookup === undefined) {
     if (dns === undefined) {
       dns = require('dns');
@@ -41,19 +43,20 @@ function newHandle(type, lookup) {
   }
 
   if (type === 'udp4') {
-    const handle = new UDP();
+    const handle = new UDP(recvmmsg);
 
     handle.lookup = FunctionPrototypeBind(lookup4, handle, lookup);
     return handle;
   }
 
   if (type === 'udp6') {
-    const handle = new UDP();
+    const handle = new UDP(recvmmsg);
 
     handle.lookup = FunctionPrototypeBind(lookup6, handle, lookup);
     handle.bind = handle.bind6;
     handle.connect = handle.connect6;
     handle.send = handle.send6;
+    handle.sendBatch = handle.sendBatch6;
     return handle;
   }
 
@@ -61,6 +64,96 @@ function newHandle(type, lookup) {
 }
 
 
+// Fields of each datagram in the records of a batch. Keep in sync with
+// RecvBatchField in src/udp_wrap.h.
+const kRecvBatchOffset = 0;
+const kRecvBatchLength = 1;
+const kRecvBatchPort = 2;
+const kRecvBatchFamily = 3;
+const kRecvBatchFlags = 4;
+const kRecvBatchAddress = 5;
+const kRecvBatchFieldCount = 6;
+
+const kRecords = Symbol('kRecords');
+const kLength = Symbol('kLength');
+const kBuffer = Symbol('kBuffer');
+const kAddresses = Symbol('kAddresses');
+const kRecordIndex = Symbol('kRecordIndex');
+const kSetBatch = Symbol('kSetBatch');
+
+// The datagrams that a socket received at once, passed to 'messages'
+// listeners. The same object is reused for every batch of a socket.
+class MessageBatch {
+  constructor(records) {
+    this[kRecords] = records;
+    this[kLength] = 0;
+    this[kBuffer] = null;
+    this[kAddresses] = null;
+  }
+
+  [kSetBatch](length, buffer, addresses) {
+    this[kLength] = length;
+    this[kBuffer] = buffer;
+    this[kAddresses] = addresses;
+  }
+
+  [kRecordIndex](index) {
+    validateInteger(index, 'index', 0, this[kLength] - 1);
+    return index * kRecvBatchFieldCount;
+  }
+
+  get length() {
+    return this[kLength];
+  }
+
+  get buffer() {
+    return this[kBuffer];
+  }
+
+  offset(index) {
+    return this[kRecords][this[kRecordIndex](index) + kRecvBatchOffset];
+  }
+
+  size(index) {
+    return this[kRecords][this[kRecordIndex](index) + kRecvBatchLength];
+  }
+
+  message(index) {
+    const record = this[kRecordIndex](index);
+    const offset = this[kRecords][record + kRecvBatchOffset];
+    return TypedArrayPrototypeSubarray(
+      this[kBuffer], offset, offset + this[kRecords][record + kRecvBatchLength]);
+  }
+
+  address(index) {
+    const record = this[kRecordIndex](index);
+    return this[kAddresses][this[kRecords][record + kRecvBatchAddress]];
+  }
+
+  family(index) {
+    const record = this[kRecordIndex](index);
+    return this[kRecords][record + kRecvBatchFamily] === 6 ? 'IPv6' : 'IPv4';
+  }
+
+  port(index) {
+    return this[kRecords][this[kRecordIndex](index) + kRecvBatchPort];
+  }
+
+  truncated(index) {
+    return this[kRecords][this[kRecordIndex](index) + kRecvBatchFlags] !== 0;
+  }
+
+  rinfo(index) {
+    return {
+      address: this.address(index),
+      family: this.family(index),
+      port: this.port(index),
+      size: this.size(index),
+    };
+  }
+}
+
+
 function _createSocketHandle(address, port, addressType, fd, flags) {
   const handle = newHandle(addressType);
   let err;
@@ -86,7 +179,9 @@ function _createSocketHandle(address, port, addressType, fd, flags) {
 
 
 module.exports = {
+  kSetBatch,
   kStateSymbol,
+  MessageBatch,
   _createSocketHandle,
   newHandle
 };
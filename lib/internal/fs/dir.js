@@ -23,15 +23,18 @@ const {
 } = require('internal/errors');
 
 const { FSReqCallback } = binding;
+const { DirWalker } = dirBinding;
 const internalUtil = require('internal/util');
 const {
   getDirent,
+  getDirWalkerEntries,
   getOptions,
   getValidatedPath,
   handleErrorFromBinding
 } = require('internal/fs/utils');
 const {
   validateFunction,
+  validateStringArray,
   validateUint32
 } = require('internal/validators');
 
@@ -278,8 +281,50 @@ function opendirSync(path, options) {
   return new Dir(handle, path, options);
 }
 
+function getDirWalkerFilters(options) {
+  const { include, exclude } = options;
+  if (include !== undefined)
+    validateStringArray(include, 'options.include');
+  if (exclude !== undefined)
+    validateStringArray(exclude, 'options.exclude');
+  return { include, exclude };
+}
+
+// Reads a directory tree natively for readdir() with `recursive: true`.
+// `path` must have been validated, and `callback` is called only once.
+function readdirRecursive(path, options, callback) {
+  const { include, exclude } = getDirWalkerFilters(options);
+  const withFileTypes = !!options.withFileTypes;
+  const result = [];
+  const walker = new DirWalker(pathModule.toNamespacedPath(path),
+                               options.encoding, include, exclude);
+  walker.onbatch = (batch) => {
+    getDirWalkerEntries(path, batch, withFileTypes, result);
+  };
+  walker.oncomplete = (err) => {
+    if (err) {
+      callback(err);
+    } else {
+      callback(null, result);
+    }
+  };
+  walker.start();
+}
+
+function readdirRecursiveSync(path, options) {
+  const { include, exclude } = getDirWalkerFilters(options);
+  const ctx = { path };
+  const batch = dirBinding.walkSync(pathModule.toNamespacedPath(path),
+                                    options.encoding, include, exclude,
+                                    undefined, ctx);
+  handleErrorFromBinding(ctx);
+  return getDirWalkerEntries(path, batch, !!options.withFileTypes, []);
+}
+
 module.exports = {
   Dir,
   opendir,
-  opendirSync
+  opendirSync,
+  readdirRecursive,
+  readdirRecursiveSync,
 };
@@ -0,0 +1,207 @@
+'use strict';
+
+const {
+  ArrayPrototypePush,
+  ArrayPrototypeShift,
+  PromiseReject,
+  PromiseResolve,
+  Symbol,
+} = primordials;
+
+const { fs: constants } = internalBinding('constants');
+const binding = internalBinding('fs');
+const { FileWriter: FileWriterHandle, kUsePromises } = binding;
+const {
+  codes: {
+    ERR_FEATURE_UNAVAILABLE_ON_PLATFORM,
+    ERR_INVALID_ARG_TYPE,
+    ERR_INVALID_ARG_VALUE,
+    ERR_INVALID_STATE,
+  },
+  uvException,
+} = require('internal/errors');
+const { createDeferredPromise, kEmptyObject } = require('internal/util');
+const { isArrayBufferView } = require('internal/util/types');
+const {
+  getValidatedPath,
+  stringToFlags,
+} = require('internal/fs/utils');
+const {
+  parseFileMode,
+  validateBoolean,
+  validateEncoding,
+  validateInteger,
+  validateObject,
+  validateUint32,
+} = require('internal/validators');
+const pathModule = require('path');
+
+const kHandle = Symbol('kHandle');
+const kFd = Symbol('kFd');
+const kSync = Symbol('kSync');
+const kHighWaterMark = Symbol('kHighWaterMark');
+const kBuffered = Symbol('kBuffered');
+const kWritten = Symbol('kWritten');
+const kSynced = Symbol('kSynced');
+const kWaiters = Symbol('kWaiters');
+const kError = Symbol('kError');
+const kClosePromise = Symbol('kClosePromise');
+const kOnFlush = Symbol('kOnFlush');
+
+class FileWriter {
+  constructor(fd, options) {
+    const {
+      start,
+      highWaterMark,
+      flushInterval,
+      blockSize,
+      direct,
+      sync,
+    } = options;
+    this[kFd] = fd;
+    this[kSync] = sync;
+    this[kHighWaterMark] = highWaterMark;
+    this[kBuffered] = 0;
+    this[kWritten] = 0;
+    this[kSynced] = 0;
+    // Pending flush() calls, in the order of the byte counts they wait for.
+    this[kWaiters] = [];
+    this[kError] = null;
+    this[kClosePromise] = null;
+    this[kHandle] = new FileWriterHandle(fd, start ?? -1, highWaterMark,
+                                         flushInterval, blockSize, direct,
+                                         sync);
+    this[kHandle].oncomplete = (err, syscall, written, synced) => {
+      this[kOnFlush](err, syscall, written, synced);
+    };
+  }
+
+  get fd() {
+    return this[kFd];
+  }
+
+  get bytesBuffered() {
+    return this[kBuffered] - this[kWritten];
+  }
+
+  get bytesWritten() {
+    return this[kWritten];
+  }
+
+  get bytesSynced() {
+    return this[kSynced];
+  }
+
+  write(data, encoding = 'utf8') {
+    if (this[kError] !== null) throw this[kError];
+    if (this[kClosePromise] !== null)
+      throw new ERR_INVALID_STATE('The FileWriter is closed');
+    if (typeof data === 'string') {
+      validateEncoding(data, encoding);
+    } else if (!isArrayBufferView(data)) {
+      throw new ERR_INVALID_ARG_TYPE(
+        'data', ['string', 'Buffer', 'TypedArray', 'DataView'], data);
+    }
+    this[kBuffered] = this[kHandle].write(data, encoding);
+    // Nothing limits the buffer, so callers are told when to await flush().
+    return this[kBuffered] - this[kWritten] <= this[kHighWaterMark];
+  }
+
+  flush() {
+    if (this[kError] !== null) return PromiseReject(this[kError]);
+    const target = this[kBuffered];
+    if ((this[kSync] ? this[kSynced] : this[kWritten]) >= target)
+      return PromiseResolve();
+    const { promise, resolve, reject } = createDeferredPromise();
+    ArrayPrototypePush(this[kWaiters], { target, resolve, reject });
+    this[kHandle].flush();
+    return promise;
+  }
+
+  close() {
+    if (this[kClosePromise] === null) {
+      const closeHandle = async () => {
+        try {
+          await this.flush();
+        } finally {
+          this[kHandle].close();
+          await binding.close(this[kFd], kUsePromises);
+        }
+      };
+      this[kClosePromise] = closeHandle();
+    }
+    return this[kClosePromise];
+  }
+
+  [kOnFlush](err, syscall, written, synced) {
+    this[kWritten] = written;
+    this[kSynced] = synced;
+    const waiters = this[kWaiters];
+    if (err !== 0) {
+      this[kError] = uvException({ errno: err, syscall });
+      while (waiters.length > 0)
+        ArrayPrototypeShift(waiters).reject(this[kError]);
+      return;
+    }
+    const durable = this[kSync] ? synced : written;
+    while (waiters.length > 0 && waiters[0].target <= durable)
+      ArrayPrototypeShift(waiters).resolve();
+  }
+}
+
+async function openFileWriter(path, options = kEmptyObject) {
+  path = getValidatedPath(path);
+  validateObject(options, 'options');
+  const {
+    flags = 'w',
+    start,
+    highWaterMark = 64 * 1024,
+    flushInterval = 100,
+    blockSize = 4096,
+    direct = false,
+    sync = false,
+  } = options;
+  let flagsNumber = stringToFlags(flags, 'options.flags');
+  const mode = parseFileMode(options.mode, 'options.mode', 0o666);
+  validateUint32(highWaterMark, 'options.highWaterMark', true);
+  validateUint32(flushInterval, 'options.flushInterval');
+  validateUint32(blockSize, 'options.blockSize', true);
+  if ((blockSize & (blockSize - 1)) !== 0) {
+    throw new ERR_INVALID_ARG_VALUE('options.blockSize', blockSize,
+                                    'must be a power of two');
+  }
+  validateBoolean(direct, 'options.direct');
+  validateBoolean(sync, 'options.sync');
+  if (start !== undefined)
+    validateInteger(start, 'options.start', 0);
+
+  if (direct) {
+    if (constants.O_DIRECT === undefined)
+      throw new ERR_FEATURE_UNAVAILABLE_ON_PLATFORM('options.direct');
+    if ((flagsNumber & constants.O_APPEND) !== 0) {
+      throw new ERR_INVALID_ARG_VALUE('options.flags', flags,
+                                      'cannot append with options.direct');
+    }
+    if ((start ?? 0) % blockSize !== 0) {
+      throw new ERR_INVALID_ARG_VALUE('options.start', start,
+                                      'must be a multiple of options.blockSize');
+    }
+    flagsNumber |= constants.O_DIRECT;
+  }
+
+  const fd = await binding.open(pathModule.toNamespacedPath(path),
+                                flagsNumber, mode, kUsePromises);
+  return new FileWriter(fd, {
+    start: direct ? start ?? 0 : start,
+    highWaterMark,
+    flushInterval,
+    blockSize,
+    direct,
+    sync,
+  });
+}
+
+module.exports = {
+  FileWriter,
+  openFileWriter,
+};
@@ -69,7 +69,8 @@ const {
   validateStringAfterArrayBufferView,
   warnOnNonPortableTemplate,
 } = require('internal/fs/utils');
-const { opendir } = require('internal/fs/dir');
+const { opendir, readdirRecursive } = require('internal/fs/dir');
+const { openFileWriter } = require('internal/fs/file_writer');
 const {
   parseFileMode,
   validateAbortSignal,
@@ -88,7 +89,11 @@ const {
 } = require('internal/util');
 const { EventEmitterMixin } = require('internal/event_target');
 const { StringDecoder } = require('string_decoder');
-const { kFSWatchStart, watch } = require('internal/fs/watchers');
+const {
+  hasNativeRecursiveWatch,
+  kFSWatchStart,
+  watch,
+} = require('internal/fs/watchers');
 const nonNativeWatcher = require('internal/fs/recursive_watch');
 const { isIterable } = require('internal/streams/utils');
 const assert = require('internal/assert');
@@ -727,6 +732,14 @@ async function mkdir(path, options) {
 async function readdir(path, options) {
   options = getOptions(options);
   path = getValidatedPath(path);
+  if (options.recursive) {
+    return new Promise((resolve, reject) => {
+      readdirRecursive(path, options, (err, result) => {
+        if (err) reject(err);
+        else resolve(result);
+      });
+    });
+  }
   const result = await binding.readdir(pathModule.toNamespacedPath(path),
                                        options.encoding,
                                        !!options.withFileTypes,
@@ -924,8 +937,9 @@ async function* _watch(filename, options = kEmptyObject) {
 
     // TODO(anonrig): Remove non-native watcher when/if libuv supports recursive.
     // As of November 2022, libuv does not support recursive file watch on all platforms,
-    // e.g. Linux due to the limitations of inotify.
-    if (options.recursive && !isOSX && !isWindows) {
+    // e.g. Linux due to the limitations of inotify. On Linux, a recursive
+    // watch is implemented natively on top of inotify instead.
+    if (options.recursive && !hasNativeRecursiveWatch()) {
       const watcher = new nonNativeWatcher.FSWatcher(options);
       await watcher[kFSWatchStart](filename);
       yield* watcher;
@@ -943,6 +957,7 @@ module.exports = {
     cp,
     open,
     opendir: promisify(opendir),
+    openFileWriter,
     rename,
     truncate,
     rm,
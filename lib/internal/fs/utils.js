@@ -2,6 +2,7 @@
 
 const {
   ArrayIsArray,
+  ArrayPrototypePush,
   BigInt,
   Date,
   DateNow,
@@ -159,8 +160,11 @@ function assertEncoding(encoding) {
 }
 
 class Dirent {
-  constructor(name, type) {
+  constructor(name, type, path) {
     this.name = name;
+    // Only entries read with `recursive: true` know their directory.
+    if (path !== undefined)
+      this.path = path;
     this[kType] = type;
   }
 
@@ -286,6 +290,36 @@ function getDirents(path, { 0: names, 1: types }, callback) {
   }
 }
 
+// Appends the entries of a batch from the native DirWalker to `result`, as
+// paths relative to `path`, or as Dirents with a `path` property holding the
+// directory that they are in.
+function getDirWalkerEntries(path, batch, withFileTypes, result) {
+  const { 0: dirs, 1: names, 2: types, 3: parents } = batch;
+  if (withFileTypes) {
+    const dirPaths = [];
+    for (let i = 0; i < dirs.length; i++) {
+      ArrayPrototypePush(dirPaths,
+                         dirs[i].length === 0 ? path : join(path, dirs[i]));
+    }
+    for (let i = 0; i < names.length; i++) {
+      ArrayPrototypePush(result,
+                         new Dirent(names[i], types[i], dirPaths[parents[i]]));
+    }
+  } else {
+    for (let i = 0; i < names.length; i++) {
+      const dir = dirs[parents[i]];
+      if (dir.length === 0) {
+        ArrayPrototypePush(result, names[i]);
+      } else if (typeof dir === 'string') {
+        ArrayPrototypePush(result, `${dir}${pathModule.sep}${names[i]}`);
+      } else {
+        ArrayPrototypePush(result, Buffer.concat([dir, bufferSep, names[i]]));
+      }
+    }
+  }
+  return result;
+}
+
 function getDirent(path, name, type, callback) {
   if (typeof callback === 'function') {
     if (type === UV_DIRENT_UNKNOWN) {
@@ -904,6 +938,7 @@ module.exports = {
   emitRecursiveRmdirWarning,
   getDirent,
   getDirents,
+  getDirWalkerEntries,
   getOptions,
   getValidatedFd,
   getValidatedPath,
@@ -1,6 +1,8 @@
 'use strict';
 
 const {
+  ArrayPrototypePush,
+  ArrayPrototypeShift,
   FunctionPrototypeCall,
   ObjectDefineProperty,
   ObjectSetPrototypeOf,
@@ -24,7 +26,9 @@ const {
   StatWatcher: _StatWatcher
 } = internalBinding('fs');
 
-const { FSEvent } = internalBinding('fs_event_wrap');
+// RecursiveFSEvent is only available on Linux, where libuv can't watch
+// directories recursively.
+const { FSEvent, RecursiveFSEvent } = internalBinding('fs_event_wrap');
 const { UV_ENOSPC } = internalBinding('uv');
 const { EventEmitter } = require('events');
 
@@ -59,6 +63,7 @@ const kOldStatus = Symbol('kOldStatus');
 const kUseBigint = Symbol('kUseBigint');
 
 const kFSWatchStart = Symbol('kFSWatchStart');
+const kFilename = Symbol('kFilename');
 const kFSStatWatcherStart = Symbol('kFSStatWatcherStart');
 const KFSStatWatcherRefCount = Symbol('KFSStatWatcherRefCount');
 const KFSStatWatcherMaxRefCount = Symbol('KFSStatWatcherMaxRefCount');
@@ -108,8 +113,6 @@ StatWatcher.prototype[kFSStatWatcherStart] = function(filename,
   this._handle = new _StatWatcher(this[kUseBigint]);
   this._handle[owner_symbol] = this;
   this._handle.onchange = onchange;
-  if (!persistent)
-    this.unref();
 
   // uv_fs_poll is a little more powerful than ev_stat but we curb it for
   // the sake of backwards compatibility.
@@ -127,6 +130,10 @@ StatWatcher.prototype[kFSStatWatcherStart] = function(filename,
     error.filename = filename;
     throw error;
   }
+
+  // The handle can only be unreferenced once it has been started.
+  if (!persistent)
+    this.unref();
 };
 
 // To maximize backward-compatibility for the end user,
@@ -187,9 +194,50 @@ StatWatcher.prototype.unref = function() {
 };
 
 
-function FSWatcher() {
+function isFSEventHandle(handle) {
+  return handle instanceof FSEvent ||
+    (RecursiveFSEvent !== undefined && handle instanceof RecursiveFSEvent);
+}
+
+function hasNativeRecursiveWatch() {
+  return RecursiveFSEvent !== undefined;
+}
+
+function watchError(err, filename) {
+  const error = uvException({
+    errno: err,
+    syscall: 'watch',
+    path: filename,
+    message: err === UV_ENOSPC ?
+      'System limit for number of file watchers reached' : ''
+  });
+  error.filename = filename;
+  return error;
+}
+
+// `recursive` is only needed where a recursive watch uses its own handle type.
+function FSWatcher(recursive = false) {
   FunctionPrototypeCall(EventEmitter, this);
 
+  if (recursive && RecursiveFSEvent !== undefined) {
+    this._handle = new RecursiveFSEvent();
+    this._handle[owner_symbol] = this;
+    this._handle.onbatch = (status, eventTypes, filenames) => {
+      if (status < 0) {
+        this._handle.close();
+        this._handle = null;  // Make the handle garbage collectable.
+        this.emit('error', watchError(status, this[kFilename]));
+        return;
+      }
+      for (let i = 0; i < eventTypes.length; i++) {
+        this.emit('change', eventTypes[i], filenames[i]);
+        // A listener may have closed the watcher.
+        if (this._handle === null) break;
+      }
+    };
+    return;
+  }
+
   this._handle = new FSEvent();
   this._handle[owner_symbol] = this;
 
@@ -228,30 +276,26 @@ ObjectSetPrototypeOf(FSWatcher, EventEmitter);
 FSWatcher.prototype[kFSWatchStart] = function(filename,
                                               persistent,
                                               recursive,
-                                              encoding) {
+                                              encoding,
+                                              coalesceWindow = 0) {
   if (this._handle === null) {  // closed
     return;
   }
-  assert(this._handle instanceof FSEvent, 'handle must be a FSEvent');
+  assert(isFSEventHandle(this._handle), 'handle must be a FSEvent');
   if (this._handle.initialized) {  // already started
     return;
   }
 
   filename = getValidatedPath(filename, 'filename');
+  this[kFilename] = filename;
 
   const err = this._handle.start(toNamespacedPath(filename),
                                  persistent,
                                  recursive,
-                                 encoding);
+                                 encoding,
+                                 coalesceWindow);
   if (err) {
-    const error = uvException({
-      errno: err,
-      syscall: 'watch',
-      path: filename,
-      message: err === UV_ENOSPC ?
-        'System limit for number of file watchers reached' : ''
-    });
-    error.filename = filename;
+    const error = watchError(err, filename);
     throw error;
   }
 };
@@ -268,7 +312,7 @@ FSWatcher.prototype.close = function() {
   if (this._handle === null) {  // closed
     return;
   }
-  assert(this._handle instanceof FSEvent, 'handle must be a FSEvent');
+  assert(isFSEventHandle(this._handle), 'handle must be a FSEvent');
   if (!this._handle.initialized) {  // not started
     return;
   }
@@ -307,11 +351,13 @@ async function* watch(filename, options = kEmptyObject) {
     persistent = true,
     recursive = false,
     encoding = 'utf8',
+    coalesceWindow = 0,
     signal,
   } = options;
 
   validateBoolean(persistent, 'options.persistent');
   validateBoolean(recursive, 'options.recursive');
+  validateUint32(coalesceWindow, 'options.coalesceWindow');
   validateAbortSignal(signal, 'options.signal');
 
   if (encoding && !isEncoding(encoding)) {
@@ -322,7 +368,10 @@ async function* watch(filename, options = kEmptyObject) {
   if (signal?.aborted)
     throw new AbortError(undefined, { cause: signal?.reason });
 
-  const handle = new FSEvent();
+  const batched = recursive && RecursiveFSEvent !== undefined;
+  const handle = batched ? new RecursiveFSEvent() : new FSEvent();
+  // Events of a batch that have not been yielded yet.
+  const queue = [];
   let { promise, resolve, reject } = createDeferredPromise();
   const oncancel = () => {
     handle.close();
@@ -331,39 +380,60 @@ async function* watch(filename, options = kEmptyObject) {
 
   try {
     signal?.addEventListener('abort', oncancel, { once: true });
-    handle.onchange = (status, eventType, filename) => {
-      if (status < 0) {
-        const error = uvException({
-          errno: status,
-          syscall: 'watch',
-          path: filename
-        });
-        error.filename = filename;
-        handle.close();
-        reject(error);
-        return;
-      }
-
-      resolve({ eventType, filename });
-    };
+    if (batched) {
+      handle.onbatch = (status, eventTypes, filenames) => {
+        if (status < 0) {
+          handle.close();
+          reject(watchError(status, filename));
+          return;
+        }
+
+        for (let i = 0; i < eventTypes.length; i++) {
+          ArrayPrototypePush(queue, {
+            eventType: eventTypes[i],
+            filename: filenames[i],
+          });
+        }
+        resolve();
+      };
+    } else {
+      handle.onchange = (status, eventType, filename) => {
+        if (status < 0) {
+          const error = uvException({
+            errno: status,
+            syscall: 'watch',
+            path: filename
+          });
+          error.filename = filename;
+          handle.close();
+          reject(error);
+          return;
+        }
+
+        resolve({ eventType, filename });
+      };
+    }
 
-    const err = handle.start(path, persistent, recursive, encoding);
+    const err = handle.start(path, persistent, recursive, encoding,
+                             coalesceWindow);
     if (err) {
-      const error = uvException({
-        errno: err,
-        syscall: 'watch',
-        path: filename,
-        message: err === UV_ENOSPC ?
-          'System limit for number of file watchers reached' : ''
-      });
-      error.filename = filename;
+      const error = watchError(err, filename);
       handle.close();
       throw error;
     }
 
     while (!signal?.aborted) {
-      yield await promise;
-      ({ promise, resolve, reject } = createDeferredPromise());
+      if (!batched) {
+        yield await promise;
+        ({ promise, resolve, reject } = createDeferredPromise());
+        continue;
+      }
+      if (queue.length === 0) {
+        await promise;
+        ({ promise, resolve, reject } = createDeferredPromise());
+        continue;
+      }
+      yield ArrayPrototypeShift(queue);
     }
     throw new AbortError(undefined, { cause: signal?.reason });
   } finally {
@@ -374,6 +444,7 @@ async function* watch(filename, options = kEmptyObject) {
 
 module.exports = {
   FSWatcher,
+  hasNativeRecursiveWatch,
   StatWatcher,
   kFSWatchStart,
   kFSStatWatcherStart,
@@ -348,28 +348,31 @@ function readPackage(requestPath) {
   const existing = packageJsonCache.get(jsonPath);
   if (existing !== undefined) return existing;
 
-  const result = packageJsonReader.read(jsonPath);
-  const json = result.containsKeys === false ? '{}' : result.string;
-  if (json === undefined) {
+  const result = packageJsonReader.readPackage(jsonPath);
+  if (!result.exists) {
     packageJsonCache.set(jsonPath, false);
     return false;
   }
 
-  try {
-    const filtered = filterOwnProperties(JSONParse(json), [
-      'name',
-      'main',
-      'exports',
-      'imports',
-      'type',
-    ]);
-    packageJsonCache.set(jsonPath, filtered);
-    return filtered;
-  } catch (e) {
-    e.path = jsonPath;
-    e.message = 'Error parsing ' + jsonPath + ': ' + e.message;
-    throw e;
+  let filtered = result.data;
+  if (filtered === undefined) {
+    const json = result.containsKeys ? result.string : '{}';
+    try {
+      filtered = filterOwnProperties(JSONParse(json), [
+        'name',
+        'main',
+        'exports',
+        'imports',
+        'type',
+      ]);
+    } catch (e) {
+      e.path = jsonPath;
+      e.message = 'Error parsing ' + jsonPath + ': ' + e.message;
+      throw e;
+    }
   }
+  packageJsonCache.set(jsonPath, filtered);
+  return filtered;
 }
 
 let _readPackage = readPackage;
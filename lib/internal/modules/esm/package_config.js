@@ -42,8 +42,8 @@ function getPackageConfig(path, specifier, base) {
     return existing;
   }
   const packageJsonReader = require('internal/modules/package_json_reader');
-  const source = packageJsonReader.read(path).string;
-  if (source === undefined) {
+  const result = packageJsonReader.readPackage(path);
+  if (!result.exists) {
     const packageConfig = {
       pjsonPath: path,
       exists: false,
@@ -57,15 +57,17 @@ function getPackageConfig(path, specifier, base) {
     return packageConfig;
   }
 
-  let packageJSON;
-  try {
-    packageJSON = JSONParse(source);
-  } catch (error) {
-    throw new ERR_INVALID_PACKAGE_CONFIG(
-      path,
-      (base ? `"${specifier}" from ` : '') + fileURLToPath(base || specifier),
-      error.message
-    );
+  let packageJSON = result.data;
+  if (packageJSON === undefined) {
+    try {
+      packageJSON = JSONParse(result.string);
+    } catch (error) {
+      throw new ERR_INVALID_PACKAGE_CONFIG(
+        path,
+        (base ? `"${specifier}" from ` : '') + fileURLToPath(base || specifier),
+        error.message
+      );
+    }
   }
 
   let { imports, main, name, type } = filterOwnProperties(packageJSON, ['imports', 'main', 'name', 'type']);
@@ -1,14 +1,31 @@
 'use strict';
 
-const { SafeMap } = primordials;
-const { internalModuleReadJSON } = internalBinding('fs');
+const { JSONParse, SafeMap } = primordials;
+const {
+  internalModuleReadJSON,
+  internalModuleReadPackageJSON,
+} = internalBinding('fs');
 const { pathToFileURL } = require('url');
 const { toNamespacedPath } = require('path');
 
 const cache = new SafeMap();
+const packageCache = new SafeMap();
+
+// In the order of the values returned by internalModuleReadPackageJSON().
+const kPackageFields = ['name', 'main', 'type', 'exports', 'imports'];
 
 let manifest;
 
+function getManifest() {
+  if (manifest === undefined) {
+    const { getOptionValue } = require('internal/options');
+    manifest = getOptionValue('--experimental-policy') ?
+      require('internal/process/policy').manifest :
+      null;
+  }
+  return manifest;
+}
+
 /**
  *
  * @param {string} jsonPath
@@ -22,20 +39,71 @@ function read(jsonPath) {
     toNamespacedPath(jsonPath)
   );
   const result = { string, containsKeys };
-  const { getOptionValue } = require('internal/options');
-  if (string !== undefined) {
-    if (manifest === undefined) {
-      manifest = getOptionValue('--experimental-policy') ?
-        require('internal/process/policy').manifest :
-        null;
-    }
-    if (manifest !== null) {
-      const jsonURL = pathToFileURL(jsonPath);
-      manifest.assertIntegrity(jsonURL, string);
-    }
+  if (string !== undefined && getManifest() !== null) {
+    const jsonURL = pathToFileURL(jsonPath);
+    manifest.assertIntegrity(jsonURL, string);
   }
   cache.set(jsonPath, result);
   return result;
 }
 
-module.exports = { read };
+/**
+ * Reads the fields of a package.json that the module loaders use. Unless a
+ * policy needs to see the whole file, only the values of those fields are
+ * parsed here. `data` is undefined if the file could not be parsed that way,
+ * and the caller has to parse `string` itself.
+ * @param {string} jsonPath
+ * @returns {{
+ *   exists: boolean,
+ *   containsKeys: boolean,
+ *   string: string | undefined,
+ *   data: object | undefined,
+ * }}
+ */
+function readPackage(jsonPath) {
+  const existing = packageCache.get(jsonPath);
+  if (existing !== undefined) {
+    return existing;
+  }
+
+  let result;
+  if (getManifest() !== null) {
+    const { string, containsKeys } = read(jsonPath);
+    result = {
+      exists: string !== undefined,
+      containsKeys: !!containsKeys,
+      string,
+      data: undefined,
+    };
+  } else {
+    const values = internalModuleReadPackageJSON(toNamespacedPath(jsonPath));
+    if (values === undefined) {
+      result = {
+        exists: false,
+        containsKeys: false,
+        string: undefined,
+        data: undefined,
+      };
+    } else {
+      let data;
+      if (values[0] === undefined) {
+        data = { __proto__: null };
+        for (let i = 0; i < kPackageFields.length; i++) {
+          const value = values[i + 2];
+          if (value !== undefined)
+            data[kPackageFields[i]] = JSONParse(value);
+        }
+      }
+      result = {
+        exists: true,
+        containsKeys: values[1],
+        string: values[0],
+        data,
+      };
+    }
+  }
+  packageCache.set(jsonPath, result);
+  return result;
+}
+
+module.exports = { read, readPackage };
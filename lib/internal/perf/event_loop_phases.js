@@ -0,0 +1,101 @@
+'use strict';
+const {
+  ArrayPrototypeMap,
+  NumberMAX_SAFE_INTEGER,
+  ObjectDefineProperty,
+  ReflectConstruct,
+  Symbol,
+} = primordials;
+
+const {
+  codes: {
+    ERR_ILLEGAL_CONSTRUCTOR,
+    ERR_INVALID_THIS,
+  }
+} = require('internal/errors');
+
+const {
+  Histogram: _Histogram,
+  startLoopPhaseHistograms,
+  stopLoopPhaseHistograms,
+} = internalBinding('performance');
+
+const {
+  internalHistogram,
+} = require('internal/histogram');
+
+// Must match the order of uv_loop_phase.
+const kPhases = [
+  'timers',
+  'pending',
+  'idle',
+  'prepare',
+  'poll',
+  'check',
+  'close',
+];
+
+const kEnabled = Symbol('kEnabled');
+const kHandles = Symbol('kHandles');
+
+class EventLoopPhasesMonitor {
+  constructor() {
+    throw new ERR_ILLEGAL_CONSTRUCTOR();
+  }
+
+  /**
+   * @returns {boolean}
+   */
+  enable() {
+    if (this[kEnabled] === undefined)
+      throw new ERR_INVALID_THIS('EventLoopPhasesMonitor');
+    if (this[kEnabled]) return false;
+    this[kEnabled] = true;
+    startLoopPhaseHistograms(this[kHandles]);
+    return true;
+  }
+
+  /**
+   * @returns {boolean}
+   */
+  disable() {
+    if (this[kEnabled] === undefined)
+      throw new ERR_INVALID_THIS('EventLoopPhasesMonitor');
+    if (!this[kEnabled]) return false;
+    this[kEnabled] = false;
+    stopLoopPhaseHistograms(this[kHandles]);
+    return true;
+  }
+
+  /**
+   * @returns {void}
+   */
+  reset() {
+    if (this[kEnabled] === undefined)
+      throw new ERR_INVALID_THIS('EventLoopPhasesMonitor');
+    for (let i = 0; i < kPhases.length; i++)
+      this[kPhases[i]].reset();
+  }
+}
+
+/**
+ * @returns {EventLoopPhasesMonitor}
+ */
+function monitorEventLoopPhases() {
+  return ReflectConstruct(
+    function() {
+      this[kEnabled] = false;
+      this[kHandles] = ArrayPrototypeMap(
+        kPhases, () => new _Histogram(1, NumberMAX_SAFE_INTEGER, 3));
+      for (let i = 0; i < kPhases.length; i++) {
+        const histogram = internalHistogram(this[kHandles][i]);
+        ObjectDefineProperty(this, kPhases[i], {
+          __proto__: null,
+          enumerable: true,
+          value: histogram,
+        });
+      }
+    }, [], EventLoopPhasesMonitor);
+}
+
+module.exports = monitorEventLoopPhases;
@@ -0,0 +1,104 @@
+'use strict';
+const {
+  ArrayPrototypePush,
+  NumberMAX_SAFE_INTEGER,
+  ObjectDefineProperty,
+  ObjectFreeze,
+  ReflectConstruct,
+  Symbol,
+} = primordials;
+
+const {
+  codes: {
+    ERR_ILLEGAL_CONSTRUCTOR,
+    ERR_INVALID_THIS,
+  }
+} = require('internal/errors');
+
+const {
+  Histogram: _Histogram,
+  startThreadPoolHistograms,
+  stopThreadPoolHistograms,
+} = internalBinding('performance');
+
+const {
+  internalHistogram,
+} = require('internal/histogram');
+
+const {
+  threadpool: { classes: kClasses },
+} = internalBinding('constants');
+
+const kEnabled = Symbol('kEnabled');
+const kHandles = Symbol('kHandles');
+
+class ThreadpoolMonitor {
+  constructor() {
+    throw new ERR_ILLEGAL_CONSTRUCTOR();
+  }
+
+  /**
+   * @returns {boolean}
+   */
+  enable() {
+    if (this[kEnabled] === undefined)
+      throw new ERR_INVALID_THIS('ThreadpoolMonitor');
+    if (this[kEnabled]) return false;
+    this[kEnabled] = true;
+    startThreadPoolHistograms(this[kHandles]);
+    return true;
+  }
+
+  /**
+   * @returns {boolean}
+   */
+  disable() {
+    if (this[kEnabled] === undefined)
+      throw new ERR_INVALID_THIS('ThreadpoolMonitor');
+    if (!this[kEnabled]) return false;
+    this[kEnabled] = false;
+    stopThreadPoolHistograms(this[kHandles]);
+    return true;
+  }
+
+  /**
+   * @returns {void}
+   */
+  reset() {
+    if (this[kEnabled] === undefined)
+      throw new ERR_INVALID_THIS('ThreadpoolMonitor');
+    for (let i = 0; i < kClasses.length; i++) {
+      this[kClasses[i]].wait.reset();
+      this[kClasses[i]].run.reset();
+    }
+  }
+}
+
+/**
+ * @returns {ThreadpoolMonitor}
+ */
+function monitorThreadpool() {
+  return ReflectConstruct(
+    function() {
+      this[kEnabled] = false;
+      // Two histograms per class: queue wait time, then run time.
+      this[kHandles] = [];
+      for (let i = 0; i < 2 * kClasses.length; i++) {
+        ArrayPrototypePush(this[kHandles],
+                           new _Histogram(1, NumberMAX_SAFE_INTEGER, 3));
+      }
+      for (let i = 0; i < kClasses.length; i++) {
+        ObjectDefineProperty(this, kClasses[i], {
+          __proto__: null,
+          enumerable: true,
+          value: ObjectFreeze({
+            __proto__: null,
+            wait: internalHistogram(this[kHandles][2 * i]),
+            run: internalHistogram(this[kHandles][2 * i + 1]),
+          }),
+        });
+      }
+    }, [], ThreadpoolMonitor);
+}
+
+module.exports = monitorThreadpool;
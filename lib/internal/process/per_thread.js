@@ -108,7 +108,8 @@ function wrapProcessMethods(binding) {
     cpuUsage: _cpuUsage,
     memoryUsage: _memoryUsage,
     rss,
-    resourceUsage: _resourceUsage
+    resourceUsage: _resourceUsage,
+    threadpoolUsage: _threadpoolUsage,
   } = binding;
 
   function _rawDebug(...args) {
@@ -259,11 +260,27 @@ function wrapProcessMethods(binding) {
     };
   }
 
+  const { threadpool: { classes: threadpoolClasses } } =
+    internalBinding('constants');
+  const threadpoolValues = new Float64Array(2 * threadpoolClasses.length);
+  function threadpoolUsage() {
+    _threadpoolUsage(threadpoolValues);
+    const usage = {};
+    for (let i = 0; i < threadpoolClasses.length; i++) {
+      usage[threadpoolClasses[i]] = {
+        active: threadpoolValues[2 * i],
+        queued: threadpoolValues[2 * i + 1],
+      };
+    }
+    return usage;
+  }
+
 
   return {
     _rawDebug,
     cpuUsage,
     resourceUsage,
+    threadpoolUsage,
     memoryUsage,
     kill,
     exit
@@ -94,11 +94,13 @@ const {
     ERR_INVALID_FD_TYPE,
     ERR_INVALID_IP_ADDRESS,
     ERR_INVALID_HANDLE_TYPE,
+    ERR_INVALID_STATE,
     ERR_SERVER_ALREADY_LISTEN,
     ERR_SERVER_NOT_RUNNING,
     ERR_SOCKET_CLOSED,
     ERR_SOCKET_CLOSED_BEFORE_CONNECTION,
     ERR_MISSING_ARGS,
+    ERR_STREAM_PREMATURE_CLOSE,
   },
   aggregateErrors,
   errnoException,
@@ -115,10 +117,15 @@ const {
   validateFunction,
   validateInt32,
   validateNumber,
+  validateObject,
+  validateOneOf,
   validatePort,
   validateString
 } = require('internal/validators');
+const eos = require('internal/streams/end-of-stream');
+const { StreamPipe } = internalBinding('stream_pipe');
 const kLastWriteQueueSize = Symbol('lastWriteQueueSize');
+const kForwarding = Symbol('kForwarding');
 const { getOptionValue } = require('internal/options');
 
 // Lazy loaded to improve startup performance.
@@ -140,6 +147,7 @@ const isWindows = process.platform === 'win32';
 const noop = () => {};
 
 const kPerfHooksNetConnectContext = Symbol('kPerfHooksNetConnectContext');
+const kReusePortSteering = Symbol('kReusePortSteering');
 
 const dc = require('diagnostics_channel');
 const netClientSocketChannel = dc.channel('net.client.socket');
@@ -151,8 +159,13 @@ const {
   stopPerf,
 } = require('internal/perf/observe');
 
-function getFlags(ipv6Only) {
-  return ipv6Only === true ? TCPConstants.UV_TCP_IPV6ONLY : 0;
+function getFlags(options) {
+  let flags = 0;
+  if (options.ipv6Only === true)
+    flags |= TCPConstants.UV_TCP_IPV6ONLY;
+  if (options.reusePort === true)
+    flags |= TCPConstants.UV_TCP_REUSEPORT;
+  return flags;
 }
 
 function createHandle(fd, is_server) {
@@ -326,6 +339,8 @@ function closeSocketHandle(self, isException, isCleanupPending = false) {
 const kBytesRead = Symbol('kBytesRead');
 const kBytesWritten = Symbol('kBytesWritten');
 const kSetNoDelay = Symbol('kSetNoDelay');
+const kSetAutoCork = Symbol('kSetAutoCork');
+const kAutoCorkStats = Symbol('kAutoCorkStats');
 const kSetKeepAlive = Symbol('kSetKeepAlive');
 const kSetKeepAliveInitialDelay = Symbol('kSetKeepAliveInitialDelay');
 
@@ -441,6 +456,9 @@ function Socket(options) {
   }
 
   this[kSetNoDelay] = Boolean(options.noDelay);
+  this[kSetAutoCork] = Boolean(options.autoCork);
+  if (this[kSetAutoCork] && this._handle?.setAutoCork)
+    this._handle.setAutoCork(true);
   this[kSetKeepAlive] = Boolean(options.keepAlive);
   this[kSetKeepAliveInitialDelay] = ~~(options.keepAliveInitialDelay / 1000);
 
@@ -472,6 +490,7 @@ function Socket(options) {
   // Used after `.destroy()`
   this[kBytesRead] = 0;
   this[kBytesWritten] = 0;
+  this[kAutoCorkStats] = { writes: 0, flushes: 0 };
 }
 ObjectSetPrototypeOf(Socket.prototype, stream.Duplex.prototype);
 ObjectSetPrototypeOf(Socket, stream.Duplex);
@@ -583,6 +602,23 @@ Socket.prototype.setNoDelay = function(enable) {
 };
 
 
+Socket.prototype.setAutoCork = function(enable) {
+  enable = Boolean(enable === undefined ? true : enable);
+
+  if (!this._handle) {
+    this[kSetAutoCork] = enable;
+    return this;
+  }
+
+  if (this._handle.setAutoCork && enable !== this[kSetAutoCork]) {
+    this[kSetAutoCork] = enable;
+    this._handle.setAutoCork(enable);
+  }
+
+  return this;
+};
+
+
 Socket.prototype.setKeepAlive = function(enable, initialDelayMsecs) {
   enable = Boolean(enable);
   const initialDelay = ~~(initialDelayMsecs / 1000);
@@ -683,7 +719,8 @@ Socket.prototype._read = function(n) {
   if (this.connecting || !this._handle) {
     debug('_read wait for connection');
     this.once('connect', () => this._read(n));
-  } else if (!this._handle.reading) {
+  } else if (!this._handle.reading && !this[kForwarding]) {
+    // While the socket is forwarded, the StreamPipe reads from the handle.
     tryReadStart(this);
   }
 };
@@ -743,6 +780,130 @@ Socket.prototype.read = function(n) {
 };
 
 
+Socket.prototype.forward = function(destination, options, callback) {
+  if (typeof options === 'function') {
+    callback = options;
+    options = kEmptyObject;
+  } else if (options === undefined) {
+    options = kEmptyObject;
+  }
+  if (!(destination instanceof Socket))
+    throw new ERR_INVALID_ARG_TYPE('destination', 'net.Socket', destination);
+  validateObject(options, 'options');
+  const { end = true } = options;
+  validateBoolean(end, 'options.end');
+  if (callback !== undefined)
+    validateFunction(callback, 'callback');
+  if (this[kForwarding])
+    throw new ERR_INVALID_STATE('The socket is already being forwarded');
+
+  this[kForwarding] = true;
+  const done = (err) => {
+    this[kForwarding] = false;
+    // Go back to reading into JS if the source is still open.
+    if (!this.destroyed && !this._readableState.ended && this._handle &&
+        !this._handle.reading) {
+      tryReadStart(this);
+    }
+    if (callback !== undefined)
+      callback(err ?? null);
+  };
+  if (this.connecting) {
+    this.once('connect', () => startForward(this, destination, end, done));
+  } else {
+    startForward(this, destination, end, done);
+  }
+  return this;
+};
+
+// Raw TCP sockets and pipes are connected by a StreamPipe, which uses
+// splice() where the platform supports it, so that the data doesn't pass
+// through JS.
+function canForwardNatively(socket) {
+  return !socket.destroyed &&
+         !socket[kBuffer] &&
+         (socket._handle instanceof TCP || socket._handle instanceof Pipe);
+}
+
+function startForward(source, destination, end, done) {
+  if (destination.connecting) {
+    destination.once('connect', () => startForward(source, destination, end, done));
+    return;
+  }
+  if (!canForwardNatively(source) || !canForwardNatively(destination)) {
+    source[kForwarding] = false;
+    source.pipe(destination, { end });
+    eos(source, { writable: false }, (err) => {
+      source.unpipe(destination);
+      done(err);
+    });
+    return;
+  }
+
+  if (!destination.writable) {
+    process.nextTick(done, new ERR_SOCKET_CLOSED());
+    return;
+  }
+
+  // Data that was already read into JS goes first.
+  source.pause();
+  if (source._handle.reading) {
+    source._handle.reading = false;
+    source._handle.readStop();
+  }
+  let chunk;
+  while ((chunk = source.read()) !== null)
+    destination.write(chunk);
+  if (source._readableState.ended) {
+    if (end)
+      destination.end();
+    process.nextTick(done);
+    return;
+  }
+
+  // Wait for writes that are still queued, so that the pipe can write to
+  // the handle directly.
+  destination.write(Buffer.alloc(0), (err) => {
+    if (err)
+      return done(err);
+    if (source.destroyed || destination.destroyed)
+      return done(source.errored ?? destination.errored ??
+                  new ERR_STREAM_PREMATURE_CLOSE());
+    pipeSockets(source, destination, end, done);
+  });
+}
+
+function pipeSockets(source, destination, end, done) {
+  // The pipe does not shut down the destination, so that its JS state stays
+  // consistent.
+  const pipe = new StreamPipe(source._handle, destination._handle, false);
+  const onClose = () => pipe.unpipe();
+  source.once('close', onClose);
+  destination.once('close', onClose);
+  pipe.onunpipe = (status) => {
+    source.removeListener('close', onClose);
+    destination.removeListener('close', onClose);
+    if (status < 0) {
+      const err = errnoException(status, 'write');
+      destination.destroy(err);
+      return done(err);
+    }
+    if (source._readableState.ended) {
+      if (end)
+        destination.end();
+      return done();
+    }
+    if (source.destroyed || destination.destroyed) {
+      return done(source.errored ?? destination.errored ??
+                  new ERR_STREAM_PREMATURE_CLOSE());
+    }
+    done();
+  };
+  pipe.start();
+  debug('forward', pipe.usesSplice() ? 'with splice()' : 'natively');
+}
+
+
 // Called when the 'end' event is emitted.
 function onReadableStreamEnd() {
   if (!this.allowHalfOpen) {
@@ -779,6 +940,7 @@ Socket.prototype._destroy = function(exception, cb) {
     // `bytesRead` and `kBytesWritten` should be accessible after `.destroy()`
     this[kBytesRead] = this._handle.bytesRead;
     this[kBytesWritten] = this._handle.bytesWritten;
+    this[kAutoCorkStats] = this.autoCorkStats;
 
     if (this.resetAndClosing) {
       this.resetAndClosing = false;
@@ -942,6 +1104,13 @@ protoGetter('_bytesDispatched', function _bytesDispatched() {
   return this._handle ? this._handle.bytesWritten : this[kBytesWritten];
 });
 
+protoGetter('autoCorkStats', function autoCorkStats() {
+  const handle = this._handle;
+  if (handle?.corkedWrites === undefined)
+    return this[kAutoCorkStats];
+  return { writes: handle.corkedWrites, flushes: handle.corkedFlushes };
+});
+
 protoGetter('bytesWritten', function bytesWritten() {
   let bytes = this._bytesDispatched;
   const data = this._pendingData;
@@ -1472,6 +1641,10 @@ function afterConnect(status, handle, req, readable, writable) {
       self._handle.setNoDelay(true);
     }
 
+    if (self[kSetAutoCork] && self._handle.setAutoCork) {
+      self._handle.setAutoCork(true);
+    }
+
     if (self[kSetKeepAlive] && self._handle.setKeepAlive) {
       self._handle.setKeepAlive(true, self[kSetKeepAliveInitialDelay]);
     }
@@ -1622,6 +1795,7 @@ function Server(options, connectionListener) {
   this.allowHalfOpen = options.allowHalfOpen || false;
   this.pauseOnConnect = !!options.pauseOnConnect;
   this.noDelay = Boolean(options.noDelay);
+  this.autoCork = Boolean(options.autoCork);
   this.keepAlive = Boolean(options.keepAlive);
   this.keepAliveInitialDelay = ~~(options.keepAliveInitialDelay / 1000);
 }
@@ -1673,12 +1847,13 @@ function createServerHandle(address, port, addressType, fd, flags) {
       if (err) {
         handle.close();
         // Fallback to ipv4
-        return createServerHandle(DEFAULT_IPV4_ADDR, port);
+        return createServerHandle(DEFAULT_IPV4_ADDR, port, 4, undefined, flags);
       }
     } else if (addressType === 6) {
       err = handle.bind6(address, port, flags);
     } else {
-      err = handle.bind(address, port);
+      // ipv6Only is meaningless for IPv4 addresses.
+      err = handle.bind(address, port, flags & ~TCPConstants.UV_TCP_IPV6ONLY);
     }
   }
 
@@ -1724,6 +1899,16 @@ function setupListenHandle(address, port, addressType, backlog, fd, flags) {
       process.nextTick(emitErrorNT, this, error);
       return;
     }
+
+    if (this[kReusePortSteering] === 'cpu') {
+      const err = rval.attachReusePortCpuSteering();
+      if (err) {
+        rval.close();
+        const error = uvExceptionWithHostPort(err, 'listen', address, port);
+        process.nextTick(emitErrorNT, this, error);
+        return;
+      }
+    }
     this._handle = rval;
   }
 
@@ -1781,7 +1966,11 @@ function listenInCluster(server, address, port, addressType,
 
   if (cluster === undefined) cluster = require('cluster');
 
-  if (cluster.isPrimary || exclusive) {
+  // With SO_REUSEPORT every worker binds a socket of its own and the kernel
+  // balances connections between them.
+  const reusePort = (flags & TCPConstants.UV_TCP_REUSEPORT) !== 0;
+
+  if (cluster.isPrimary || exclusive || reusePort) {
     // Will create a new handle
     // _listen2 sets up the listened handle, it is still named like this
     // to avoid breaking code that wraps this method
@@ -1836,7 +2025,7 @@ Server.prototype.listen = function(...args) {
     toNumber(args.length > 2 && args[2]);  // (port, host, backlog)
 
   options = options._handle || options.handle || options;
-  const flags = getFlags(options.ipv6Only);
+  const flags = getFlags(options);
   // (handle[, backlog][, cb]) where handle is an object with a handle
   if (options instanceof TCP) {
     this._handle = options;
@@ -1866,15 +2055,29 @@ Server.prototype.listen = function(...args) {
   let backlog;
   if (typeof options.port === 'number' || typeof options.port === 'string') {
     validatePort(options.port, 'options.port');
+    if (options.reusePort !== undefined)
+      validateBoolean(options.reusePort, 'options.reusePort');
+    if (options.reusePortSteering !== undefined) {
+      validateOneOf(options.reusePortSteering, 'options.reusePortSteering',
+                    ['cpu']);
+      if (options.reusePort !== true) {
+        throw new ERR_INVALID_ARG_VALUE('options.reusePortSteering',
+                                        options.reusePortSteering,
+                                        'requires options.reusePort');
+      }
+      this[kReusePortSteering] = options.reusePortSteering;
+    }
     backlog = options.backlog || backlogFromArgs;
     // start TCP server listening on host:port
     if (options.host) {
       lookupAndListen(this, options.port | 0, options.host, backlog,
                       options.exclusive, flags);
     } else { // Undefined host, listens on unspecified address
-      // Default addressType 4 will be used to search for primary server
+      // Default addressType 4 will be used to search for primary server.
+      // ipv6Only has never applied to the unspecified address.
       listenInCluster(this, null, options.port | 0, 4,
-                      backlog, undefined, options.exclusive);
+                      backlog, undefined, options.exclusive,
+                      flags & ~TCPConstants.UV_TCP_IPV6ONLY);
     }
     return this;
   }
@@ -2011,6 +2214,10 @@ function onconnection(err, clientHandle) {
     socket[kSetNoDelay] = true;
     clientHandle.setNoDelay(true);
   }
+  if (self.autoCork && clientHandle.setAutoCork) {
+    socket[kSetAutoCork] = true;
+    clientHandle.setAutoCork(true);
+  }
   if (self.keepAlive && clientHandle.setKeepAlive) {
     socket[kSetKeepAlive] = true;
     socket[kSetKeepAliveInitialDelay] = self.keepAliveInitialDelay;
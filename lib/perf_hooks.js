@@ -28,6 +28,8 @@ const {
 } = require('internal/histogram');
 
 const monitorEventLoopDelay = require('internal/perf/event_loop_delay');
+const monitorEventLoopPhases = require('internal/perf/event_loop_phases');
+const monitorThreadpool = require('internal/perf/threadpool');
 
 module.exports = {
   Performance,
@@ -38,6 +40,8 @@ module.exports = {
   PerformanceObserverEntryList,
   PerformanceResourceTiming,
   monitorEventLoopDelay,
+  monitorEventLoopPhases,
+  monitorThreadpool,
   createHistogram,
   performance,
 };
@@ -499,6 +499,7 @@
         'src/node_contextify.cc',
         'src/node_credentials.cc',
         'src/node_dir.cc',
+        'src/node_doorbell.cc',
         'src/node_env_var.cc',
         'src/node_errors.cc',
         'src/node_external_reference.cc',
@@ -511,6 +512,7 @@
         'src/node_metadata.cc',
         'src/node_options.cc',
         'src/node_os.cc',
+        'src/node_package_json.cc',
         'src/node_perf.cc',
         'src/node_platform.cc',
         'src/node_postmortem_metadata.cc',
@@ -528,6 +530,7 @@
         'src/node_stat_watcher.cc',
         'src/node_symbols.cc',
         'src/node_task_queue.cc',
+        'src/node_threadpool.cc',
         'src/node_trace_events.cc',
         'src/node_types.cc',
         'src/node_url.cc',
@@ -602,6 +605,7 @@
         'src/node_context_data.h',
         'src/node_contextify.h',
         'src/node_dir.h',
+        'src/node_doorbell.h',
         'src/node_errors.h',
         'src/node_exit_code.h',
         'src/node_external_reference.h',
@@ -622,6 +626,7 @@
         'src/node_object_wrap.h',
         'src/node_options.h',
         'src/node_options-inl.h',
+        'src/node_package_json.h',
         'src/node_perf.h',
         'src/node_perf_common.h',
         'src/node_platform.h',
@@ -638,6 +643,7 @@
         'src/node_sockaddr.h',
         'src/node_sockaddr-inl.h',
         'src/node_stat_watcher.h',
+        'src/node_threadpool.h',
         'src/node_union_bytes.h',
         'src/node_url.h',
         'src/node_util.h',
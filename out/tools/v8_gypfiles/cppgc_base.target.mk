@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := cppgc_base
+### Rules for final target.
+$(obj).target/tools/v8_gypfiles/cppgc_base.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/tools/v8_gypfiles/cppgc_base.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/tools/v8_gypfiles/cppgc_base.stamp
+# Add target alias
+.PHONY: cppgc_base
+cppgc_base: $(obj).target/tools/v8_gypfiles/cppgc_base.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: cppgc_base
+
@@ -0,0 +1,38 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := postmortem-metadata
+### Rules for action "gen-postmortem-metadata":
+quiet_cmd__root_repo_tools_v8_gypfiles_v8_gyp_postmortem_metadata_target_gen_postmortem_metadata = ACTION _root_repo_tools_v8_gypfiles_v8_gyp_postmortem_metadata_target_gen_postmortem_metadata $@
+cmd__root_repo_tools_v8_gypfiles_v8_gyp_postmortem_metadata_target_gen_postmortem_metadata = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/tools/v8_gypfiles; mkdir -p $(obj)/gen; python ../../deps/v8/tools/gen-postmortem-metadata.py "$(obj)/gen/debug-support.cc" "$(obj)/gen/torque-generated/instance-types.h" ../../deps/v8/src/objects/allocation-site.h ../../deps/v8/src/objects/allocation-site-inl.h ../../deps/v8/src/objects/cell.h ../../deps/v8/src/objects/cell-inl.h ../../deps/v8/src/objects/code.h ../../deps/v8/src/objects/code-inl.h ../../deps/v8/src/objects/data-handler.h ../../deps/v8/src/objects/data-handler-inl.h ../../deps/v8/src/objects/descriptor-array.h ../../deps/v8/src/objects/descriptor-array-inl.h ../../deps/v8/src/objects/feedback-cell.h ../../deps/v8/src/objects/feedback-cell-inl.h ../../deps/v8/src/objects/fixed-array.h ../../deps/v8/src/objects/fixed-array-inl.h ../../deps/v8/src/objects/heap-number.h ../../deps/v8/src/objects/heap-number-inl.h ../../deps/v8/src/objects/heap-object.h ../../deps/v8/src/objects/heap-object-inl.h ../../deps/v8/src/objects/instance-type.h ../../deps/v8/src/objects/js-array-buffer.h ../../deps/v8/src/objects/js-array-buffer-inl.h ../../deps/v8/src/objects/js-array.h ../../deps/v8/src/objects/js-array-inl.h ../../deps/v8/src/objects/js-function-inl.h ../../deps/v8/src/objects/js-function.cc ../../deps/v8/src/objects/js-function.h ../../deps/v8/src/objects/js-objects.cc ../../deps/v8/src/objects/js-objects.h ../../deps/v8/src/objects/js-objects-inl.h ../../deps/v8/src/objects/js-promise.h ../../deps/v8/src/objects/js-promise-inl.h ../../deps/v8/src/objects/js-regexp.cc ../../deps/v8/src/objects/js-regexp.h ../../deps/v8/src/objects/js-regexp-inl.h ../../deps/v8/src/objects/js-regexp-string-iterator.h ../../deps/v8/src/objects/js-regexp-string-iterator-inl.h ../../deps/v8/src/objects/map.cc ../../deps/v8/src/objects/map.h ../../deps/v8/src/objects/map-inl.h ../../deps/v8/src/objects/name.h ../../deps/v8/src/objects/name-inl.h ../../deps/v8/src/objects/objects.h ../../deps/v8/src/objects/objects-inl.h ../../deps/v8/src/objects/oddball.h ../../deps/v8/src/objects/oddball-inl.h ../../deps/v8/src/objects/primitive-heap-object.h ../../deps/v8/src/objects/primitive-heap-object-inl.h ../../deps/v8/src/objects/scope-info.h ../../deps/v8/src/objects/scope-info-inl.h ../../deps/v8/src/objects/script.h ../../deps/v8/src/objects/script-inl.h ../../deps/v8/src/objects/shared-function-info.cc ../../deps/v8/src/objects/shared-function-info.h ../../deps/v8/src/objects/shared-function-info-inl.h ../../deps/v8/src/objects/string.cc ../../deps/v8/src/objects/string-comparator.cc ../../deps/v8/src/objects/string-comparator.h ../../deps/v8/src/objects/string.h ../../deps/v8/src/objects/string-inl.h ../../deps/v8/src/objects/struct.h ../../deps/v8/src/objects/struct-inl.h
+
+$(obj)/gen/debug-support.cc: obj := $(abs_obj)
+$(obj)/gen/debug-support.cc: builddir := $(abs_builddir)
+$(obj)/gen/debug-support.cc: TOOLSET := $(TOOLSET)
+$(obj)/gen/debug-support.cc: $(srcdir)/deps/v8/tools/gen-postmortem-metadata.py $(obj)/gen/torque-generated/instance-types.h $(srcdir)/deps/v8/src/objects/allocation-site.h $(srcdir)/deps/v8/src/objects/allocation-site-inl.h $(srcdir)/deps/v8/src/objects/cell.h $(srcdir)/deps/v8/src/objects/cell-inl.h $(srcdir)/deps/v8/src/objects/code.h $(srcdir)/deps/v8/src/objects/code-inl.h $(srcdir)/deps/v8/src/objects/data-handler.h $(srcdir)/deps/v8/src/objects/data-handler-inl.h $(srcdir)/deps/v8/src/objects/descriptor-array.h $(srcdir)/deps/v8/src/objects/descriptor-array-inl.h $(srcdir)/deps/v8/src/objects/feedback-cell.h $(srcdir)/deps/v8/src/objects/feedback-cell-inl.h $(srcdir)/deps/v8/src/objects/fixed-array.h $(srcdir)/deps/v8/src/objects/fixed-array-inl.h $(srcdir)/deps/v8/src/objects/heap-number.h $(srcdir)/deps/v8/src/objects/heap-number-inl.h $(srcdir)/deps/v8/src/objects/heap-object.h $(srcdir)/deps/v8/src/objects/heap-object-inl.h $(srcdir)/deps/v8/src/objects/instance-type.h $(srcdir)/deps/v8/src/objects/js-array-buffer.h $(srcdir)/deps/v8/src/objects/js-array-buffer-inl.h $(srcdir)/deps/v8/src/objects/js-array.h $(srcdir)/deps/v8/src/objects/js-array-inl.h $(srcdir)/deps/v8/src/objects/js-function-inl.h $(srcdir)/deps/v8/src/objects/js-function.cc $(srcdir)/deps/v8/src/objects/js-function.h $(srcdir)/deps/v8/src/objects/js-objects.cc $(srcdir)/deps/v8/src/objects/js-objects.h $(srcdir)/deps/v8/src/objects/js-objects-inl.h $(srcdir)/deps/v8/src/objects/js-promise.h $(srcdir)/deps/v8/src/objects/js-promise-inl.h $(srcdir)/deps/v8/src/objects/js-regexp.cc $(srcdir)/deps/v8/src/objects/js-regexp.h $(srcdir)/deps/v8/src/objects/js-regexp-inl.h $(srcdir)/deps/v8/src/objects/js-regexp-string-iterator.h $(srcdir)/deps/v8/src/objects/js-regexp-string-iterator-inl.h $(srcdir)/deps/v8/src/objects/map.cc $(srcdir)/deps/v8/src/objects/map.h $(srcdir)/deps/v8/src/objects/map-inl.h $(srcdir)/deps/v8/src/objects/name.h $(srcdir)/deps/v8/src/objects/name-inl.h $(srcdir)/deps/v8/src/objects/objects.h $(srcdir)/deps/v8/src/objects/objects-inl.h $(srcdir)/deps/v8/src/objects/oddball.h $(srcdir)/deps/v8/src/objects/oddball-inl.h $(srcdir)/deps/v8/src/objects/primitive-heap-object.h $(srcdir)/deps/v8/src/objects/primitive-heap-object-inl.h $(srcdir)/deps/v8/src/objects/scope-info.h $(srcdir)/deps/v8/src/objects/scope-info-inl.h $(srcdir)/deps/v8/src/objects/script.h $(srcdir)/deps/v8/src/objects/script-inl.h $(srcdir)/deps/v8/src/objects/shared-function-info.cc $(srcdir)/deps/v8/src/objects/shared-function-info.h $(srcdir)/deps/v8/src/objects/shared-function-info-inl.h $(srcdir)/deps/v8/src/objects/string.cc $(srcdir)/deps/v8/src/objects/string-comparator.cc $(srcdir)/deps/v8/src/objects/string-comparator.h $(srcdir)/deps/v8/src/objects/string.h $(srcdir)/deps/v8/src/objects/string-inl.h $(srcdir)/deps/v8/src/objects/struct.h $(srcdir)/deps/v8/src/objects/struct-inl.h FORCE_DO_CMD
+	$(call do_cmd,_root_repo_tools_v8_gypfiles_v8_gyp_postmortem_metadata_target_gen_postmortem_metadata)
+
+all_deps += $(obj)/gen/debug-support.cc
+action__root_repo_tools_v8_gypfiles_v8_gyp_postmortem_metadata_target_gen_postmortem_metadata_outputs := $(obj)/gen/debug-support.cc
+
+
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/tools/v8_gypfiles/postmortem-metadata.stamp: | $(action__root_repo_tools_v8_gypfiles_v8_gyp_postmortem_metadata_target_gen_postmortem_metadata_outputs)
+
+# Preserve order dependency of special output on deps.
+$(action__root_repo_tools_v8_gypfiles_v8_gyp_postmortem_metadata_target_gen_postmortem_metadata_outputs): | $(obj).target/tools/v8_gypfiles/run_torque.stamp
+
+$(obj).target/tools/v8_gypfiles/postmortem-metadata.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/tools/v8_gypfiles/postmortem-metadata.stamp: $(obj).target/tools/v8_gypfiles/run_torque.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/tools/v8_gypfiles/postmortem-metadata.stamp
+# Add target alias
+.PHONY: postmortem-metadata
+postmortem-metadata: $(obj).target/tools/v8_gypfiles/postmortem-metadata.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: postmortem-metadata
+
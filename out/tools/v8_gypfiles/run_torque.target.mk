@@ -0,0 +1,42 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := run_torque
+### Rules for action "run_torque_action":
+quiet_cmd__root_repo_tools_v8_gypfiles_v8_gyp_run_torque_target_run_torque_action = ACTION _root_repo_tools_v8_gypfiles_v8_gyp_run_torque_target_run_torque_action $@
+cmd__root_repo_tools_v8_gypfiles_v8_gyp_run_torque_target_run_torque_action = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/tools/v8_gypfiles; mkdir -p $(obj)/gen/torque-generated/src/builtins $(obj)/gen/torque-generated $(obj)/gen/torque-generated/src/ic $(obj)/gen/torque-generated/src/debug $(obj)/gen/torque-generated/third_party/v8/builtins $(obj)/gen/torque-generated/src/objects $(obj)/gen/torque-generated/src/wasm $(obj)/gen/torque-generated/test/torque; "$(builddir)/torque" -o "$(obj)/gen/torque-generated" -v8-root ../../deps/v8 src/builtins/aggregate-error.tq src/builtins/array-at.tq src/builtins/array-concat.tq src/builtins/array-copywithin.tq src/builtins/array-every.tq src/builtins/array-filter.tq src/builtins/array-find.tq src/builtins/array-findindex.tq src/builtins/array-findlast.tq src/builtins/array-findlastindex.tq src/builtins/array-foreach.tq src/builtins/array-from.tq src/builtins/array-isarray.tq src/builtins/array-join.tq src/builtins/array-lastindexof.tq src/builtins/array-map.tq src/builtins/array-of.tq src/builtins/array-reduce-right.tq src/builtins/array-reduce.tq src/builtins/array-reverse.tq src/builtins/array-shift.tq src/builtins/array-slice.tq src/builtins/array-some.tq src/builtins/array-splice.tq src/builtins/array-to-reversed.tq src/builtins/array-to-sorted.tq src/builtins/array-to-spliced.tq src/builtins/array-unshift.tq src/builtins/array-with.tq src/builtins/array.tq src/builtins/arraybuffer.tq src/builtins/base.tq src/builtins/boolean.tq src/builtins/builtins-bigint.tq src/builtins/builtins-string.tq src/builtins/cast.tq src/builtins/collections.tq src/builtins/constructor.tq src/builtins/conversion.tq src/builtins/convert.tq src/builtins/console.tq src/builtins/data-view.tq src/builtins/finalization-registry.tq src/builtins/frames.tq src/builtins/frame-arguments.tq src/builtins/function.tq src/builtins/growable-fixed-array.tq src/builtins/ic-callable.tq src/builtins/ic.tq src/builtins/internal-coverage.tq src/builtins/internal.tq src/builtins/iterator.tq src/builtins/math.tq src/builtins/number.tq src/builtins/object-fromentries.tq src/builtins/object.tq src/builtins/promise-abstract-operations.tq src/builtins/promise-all.tq src/builtins/promise-all-element-closure.tq src/builtins/promise-any.tq src/builtins/promise-constructor.tq src/builtins/promise-finally.tq src/builtins/promise-misc.tq src/builtins/promise-race.tq src/builtins/promise-reaction-job.tq src/builtins/promise-resolve.tq src/builtins/promise-then.tq src/builtins/promise-jobs.tq src/builtins/proxy-constructor.tq src/builtins/proxy-delete-property.tq src/builtins/proxy-get-property.tq src/builtins/proxy-get-prototype-of.tq src/builtins/proxy-has-property.tq src/builtins/proxy-is-extensible.tq src/builtins/proxy-prevent-extensions.tq src/builtins/proxy-revocable.tq src/builtins/proxy-revoke.tq src/builtins/proxy-set-property.tq src/builtins/proxy-set-prototype-of.tq src/builtins/proxy.tq src/builtins/reflect.tq src/builtins/regexp-exec.tq src/builtins/regexp-match-all.tq src/builtins/regexp-match.tq src/builtins/regexp-replace.tq src/builtins/regexp-search.tq src/builtins/regexp-source.tq src/builtins/regexp-split.tq src/builtins/regexp-test.tq src/builtins/regexp.tq src/builtins/string-at.tq src/builtins/string-endswith.tq src/builtins/string-html.tq src/builtins/string-includes.tq src/builtins/string-indexof.tq src/builtins/string-iterator.tq src/builtins/string-match-search.tq src/builtins/string-pad.tq src/builtins/string-repeat.tq src/builtins/string-replaceall.tq src/builtins/string-slice.tq src/builtins/string-startswith.tq src/builtins/string-substr.tq src/builtins/string-substring.tq src/builtins/string-trim.tq src/builtins/symbol.tq src/builtins/torque-internal.tq src/builtins/typed-array-at.tq src/builtins/typed-array-createtypedarray.tq src/builtins/typed-array-every.tq src/builtins/typed-array-entries.tq src/builtins/typed-array-filter.tq src/builtins/typed-array-find.tq src/builtins/typed-array-findindex.tq src/builtins/typed-array-findlast.tq src/builtins/typed-array-findlastindex.tq src/builtins/typed-array-foreach.tq src/builtins/typed-array-from.tq src/builtins/typed-array-keys.tq src/builtins/typed-array-of.tq src/builtins/typed-array-reduce.tq src/builtins/typed-array-reduceright.tq src/builtins/typed-array-set.tq src/builtins/typed-array-slice.tq src/builtins/typed-array-some.tq src/builtins/typed-array-sort.tq src/builtins/typed-array-subarray.tq src/builtins/typed-array-to-reversed.tq src/builtins/typed-array-to-sorted.tq src/builtins/typed-array-values.tq src/builtins/typed-array-with.tq src/builtins/typed-array.tq src/builtins/weak-ref.tq src/ic/handler-configuration.tq src/objects/allocation-site.tq src/objects/api-callbacks.tq src/objects/arguments.tq src/objects/bigint.tq src/objects/call-site-info.tq src/objects/cell.tq src/objects/code.tq src/objects/contexts.tq src/objects/data-handler.tq src/objects/debug-objects.tq src/objects/descriptor-array.tq src/objects/embedder-data-array.tq src/objects/feedback-cell.tq src/objects/feedback-vector.tq src/objects/fixed-array.tq src/objects/foreign.tq src/objects/free-space.tq src/objects/heap-number.tq src/objects/heap-object.tq src/objects/js-array-buffer.tq src/objects/js-array.tq src/objects/js-atomics-synchronization.tq src/objects/js-collection-iterator.tq src/objects/js-collection.tq src/objects/js-function.tq src/objects/js-generator.tq src/objects/js-objects.tq src/objects/js-promise.tq src/objects/js-proxy.tq src/objects/js-raw-json.tq src/objects/js-regexp-string-iterator.tq src/objects/js-regexp.tq src/objects/js-shadow-realm.tq src/objects/js-shared-array.tq src/objects/js-struct.tq src/objects/js-temporal-objects.tq src/objects/js-weak-refs.tq src/objects/literal-objects.tq src/objects/map.tq src/objects/megadom-handler.tq src/objects/microtask.tq src/objects/module.tq src/objects/name.tq src/objects/oddball.tq src/objects/ordered-hash-table.tq src/objects/primitive-heap-object.tq src/objects/promise.tq src/objects/property-array.tq src/objects/property-cell.tq src/objects/property-descriptor-object.tq src/objects/prototype-info.tq src/objects/regexp-match-info.tq src/objects/scope-info.tq src/objects/script.tq src/objects/shared-function-info.tq src/objects/source-text-module.tq src/objects/string.tq src/objects/struct.tq src/objects/swiss-hash-table-helpers.tq src/objects/swiss-name-dictionary.tq src/objects/synthetic-module.tq src/objects/template-objects.tq src/objects/templates.tq src/objects/torque-defined-classes.tq src/objects/turbofan-types.tq test/torque/test-torque.tq third_party/v8/builtins/array-sort.tq src/builtins/wasm.tq src/debug/debug-wasm-objects.tq src/wasm/wasm-objects.tq
+
+$(obj)/gen/torque-generated/bit-fields.h: obj := $(abs_obj)
+$(obj)/gen/torque-generated/bit-fields.h: builddir := $(abs_builddir)
+$(obj)/gen/torque-generated/bit-fields.h: TOOLSET := $(TOOLSET)
+$(obj)/gen/torque-generated/bit-fields.h $(obj)/gen/torque-generated/builtin-definitions.h $(obj)/gen/torque-generated/class-debug-readers.cc $(obj)/gen/torque-generated/class-debug-readers.h $(obj)/gen/torque-generated/class-forward-declarations.h $(obj)/gen/torque-generated/class-verifiers.cc $(obj)/gen/torque-generated/class-verifiers.h $(obj)/gen/torque-generated/csa-types.h $(obj)/gen/torque-generated/debug-macros.cc $(obj)/gen/torque-generated/debug-macros.h $(obj)/gen/torque-generated/enum-verifiers.cc $(obj)/gen/torque-generated/exported-macros-assembler.cc $(obj)/gen/torque-generated/exported-macros-assembler.h $(obj)/gen/torque-generated/factory.cc $(obj)/gen/torque-generated/factory.inc $(obj)/gen/torque-generated/instance-types.h $(obj)/gen/torque-generated/interface-descriptors.inc $(obj)/gen/torque-generated/objects-body-descriptors-inl.inc $(obj)/gen/torque-generated/objects-printer.cc $(obj)/gen/torque-generated/visitor-lists.h $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-at-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-concat-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-every-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-filter-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-find-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-findindex-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-findlast-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-foreach-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-from-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-isarray-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-join-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-map-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-of-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-reduce-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-reverse-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-shift-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-slice-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-some-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-splice-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-unshift-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-with-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/base-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/boolean-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/builtins-string-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/cast-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/collections-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/constructor-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/conversion-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/convert-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/console-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/data-view-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/frames-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/function-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/ic-callable-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/ic-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/internal-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/iterator-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/math-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/number-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/object-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-all-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-any-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-finally-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-misc-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-race-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-then-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/reflect-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-match-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-search-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-source-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-split-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-test-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-at-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-endswith-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-html-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-includes-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-indexof-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-iterator-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-match-search-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-pad-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-repeat-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-slice-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-startswith-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-substr-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-substring-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-trim-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/symbol-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/torque-internal-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/weak-ref-tq-csa.cc $(obj)/gen/torque-generated/src/ic/handler-configuration-tq-csa.cc $(obj)/gen/torque-generated/src/objects/allocation-site-tq-csa.cc $(obj)/gen/torque-generated/src/objects/api-callbacks-tq-csa.cc $(obj)/gen/torque-generated/src/objects/arguments-tq-csa.cc $(obj)/gen/torque-generated/src/objects/bigint-tq-csa.cc $(obj)/gen/torque-generated/src/objects/call-site-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/cell-tq-csa.cc $(obj)/gen/torque-generated/src/objects/code-tq-csa.cc $(obj)/gen/torque-generated/src/objects/contexts-tq-csa.cc $(obj)/gen/torque-generated/src/objects/data-handler-tq-csa.cc $(obj)/gen/torque-generated/src/objects/debug-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/descriptor-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/feedback-cell-tq-csa.cc $(obj)/gen/torque-generated/src/objects/feedback-vector-tq-csa.cc $(obj)/gen/torque-generated/src/objects/fixed-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/foreign-tq-csa.cc $(obj)/gen/torque-generated/src/objects/free-space-tq-csa.cc $(obj)/gen/torque-generated/src/objects/heap-number-tq-csa.cc $(obj)/gen/torque-generated/src/objects/heap-object-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-collection-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-function-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-generator-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-promise-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-proxy-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-raw-json-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-regexp-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-shared-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-struct-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq-csa.cc $(obj)/gen/torque-generated/src/objects/literal-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/map-tq-csa.cc $(obj)/gen/torque-generated/src/objects/megadom-handler-tq-csa.cc $(obj)/gen/torque-generated/src/objects/microtask-tq-csa.cc $(obj)/gen/torque-generated/src/objects/module-tq-csa.cc $(obj)/gen/torque-generated/src/objects/name-tq-csa.cc $(obj)/gen/torque-generated/src/objects/oddball-tq-csa.cc $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq-csa.cc $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq-csa.cc $(obj)/gen/torque-generated/src/objects/promise-tq-csa.cc $(obj)/gen/torque-generated/src/objects/property-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/property-cell-tq-csa.cc $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq-csa.cc $(obj)/gen/torque-generated/src/objects/prototype-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/scope-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/script-tq-csa.cc $(obj)/gen/torque-generated/src/objects/shared-function-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/source-text-module-tq-csa.cc $(obj)/gen/torque-generated/src/objects/string-tq-csa.cc $(obj)/gen/torque-generated/src/objects/struct-tq-csa.cc $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq-csa.cc $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq-csa.cc $(obj)/gen/torque-generated/src/objects/synthetic-module-tq-csa.cc $(obj)/gen/torque-generated/src/objects/template-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/templates-tq-csa.cc $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq-csa.cc $(obj)/gen/torque-generated/src/objects/turbofan-types-tq-csa.cc $(obj)/gen/torque-generated/test/torque/test-torque-tq-csa.cc $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/wasm-tq-csa.cc $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq-csa.cc $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-at-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-concat-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-every-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-filter-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-find-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-findindex-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-findlast-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-foreach-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-from-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-isarray-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-join-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-map-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-of-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-reduce-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-reverse-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-shift-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-slice-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-some-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-splice-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-unshift-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-with-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-tq-csa.h $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq-csa.h $(obj)/gen/torque-generated/src/builtins/base-tq-csa.h $(obj)/gen/torque-generated/src/builtins/boolean-tq-csa.h $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq-csa.h $(obj)/gen/torque-generated/src/builtins/builtins-string-tq-csa.h $(obj)/gen/torque-generated/src/builtins/cast-tq-csa.h $(obj)/gen/torque-generated/src/builtins/collections-tq-csa.h $(obj)/gen/torque-generated/src/builtins/constructor-tq-csa.h $(obj)/gen/torque-generated/src/builtins/conversion-tq-csa.h $(obj)/gen/torque-generated/src/builtins/convert-tq-csa.h $(obj)/gen/torque-generated/src/builtins/console-tq-csa.h $(obj)/gen/torque-generated/src/builtins/data-view-tq-csa.h $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq-csa.h $(obj)/gen/torque-generated/src/builtins/frames-tq-csa.h $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq-csa.h $(obj)/gen/torque-generated/src/builtins/function-tq-csa.h $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq-csa.h $(obj)/gen/torque-generated/src/builtins/ic-callable-tq-csa.h $(obj)/gen/torque-generated/src/builtins/ic-tq-csa.h $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq-csa.h $(obj)/gen/torque-generated/src/builtins/internal-tq-csa.h $(obj)/gen/torque-generated/src/builtins/iterator-tq-csa.h $(obj)/gen/torque-generated/src/builtins/math-tq-csa.h $(obj)/gen/torque-generated/src/builtins/number-tq-csa.h $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq-csa.h $(obj)/gen/torque-generated/src/builtins/object-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-all-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-any-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-finally-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-misc-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-race-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-then-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-tq-csa.h $(obj)/gen/torque-generated/src/builtins/reflect-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-match-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-search-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-source-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-split-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-test-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-at-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-endswith-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-html-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-includes-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-indexof-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-iterator-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-match-search-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-pad-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-repeat-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-slice-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-startswith-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-substr-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-substring-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-trim-tq-csa.h $(obj)/gen/torque-generated/src/builtins/symbol-tq-csa.h $(obj)/gen/torque-generated/src/builtins/torque-internal-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-tq-csa.h $(obj)/gen/torque-generated/src/builtins/weak-ref-tq-csa.h $(obj)/gen/torque-generated/src/ic/handler-configuration-tq-csa.h $(obj)/gen/torque-generated/src/objects/allocation-site-tq-csa.h $(obj)/gen/torque-generated/src/objects/api-callbacks-tq-csa.h $(obj)/gen/torque-generated/src/objects/arguments-tq-csa.h $(obj)/gen/torque-generated/src/objects/bigint-tq-csa.h $(obj)/gen/torque-generated/src/objects/call-site-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/cell-tq-csa.h $(obj)/gen/torque-generated/src/objects/code-tq-csa.h $(obj)/gen/torque-generated/src/objects/contexts-tq-csa.h $(obj)/gen/torque-generated/src/objects/data-handler-tq-csa.h $(obj)/gen/torque-generated/src/objects/debug-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/descriptor-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/feedback-cell-tq-csa.h $(obj)/gen/torque-generated/src/objects/feedback-vector-tq-csa.h $(obj)/gen/torque-generated/src/objects/fixed-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/foreign-tq-csa.h $(obj)/gen/torque-generated/src/objects/free-space-tq-csa.h $(obj)/gen/torque-generated/src/objects/heap-number-tq-csa.h $(obj)/gen/torque-generated/src/objects/heap-object-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-collection-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-function-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-generator-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-promise-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-proxy-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-raw-json-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-regexp-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-shared-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-struct-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq-csa.h $(obj)/gen/torque-generated/src/objects/literal-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/map-tq-csa.h $(obj)/gen/torque-generated/src/objects/megadom-handler-tq-csa.h $(obj)/gen/torque-generated/src/objects/microtask-tq-csa.h $(obj)/gen/torque-generated/src/objects/module-tq-csa.h $(obj)/gen/torque-generated/src/objects/name-tq-csa.h $(obj)/gen/torque-generated/src/objects/oddball-tq-csa.h $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq-csa.h $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq-csa.h $(obj)/gen/torque-generated/src/objects/promise-tq-csa.h $(obj)/gen/torque-generated/src/objects/property-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/property-cell-tq-csa.h $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq-csa.h $(obj)/gen/torque-generated/src/objects/prototype-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/scope-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/script-tq-csa.h $(obj)/gen/torque-generated/src/objects/shared-function-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/source-text-module-tq-csa.h $(obj)/gen/torque-generated/src/objects/string-tq-csa.h $(obj)/gen/torque-generated/src/objects/struct-tq-csa.h $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq-csa.h $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq-csa.h $(obj)/gen/torque-generated/src/objects/synthetic-module-tq-csa.h $(obj)/gen/torque-generated/src/objects/template-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/templates-tq-csa.h $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq-csa.h $(obj)/gen/torque-generated/src/objects/turbofan-types-tq-csa.h $(obj)/gen/torque-generated/test/torque/test-torque-tq-csa.h $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq-csa.h $(obj)/gen/torque-generated/src/builtins/wasm-tq-csa.h $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq-csa.h $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq-csa.h $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-at-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-concat-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-every-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-filter-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-find-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-findindex-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-findlast-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-foreach-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-from-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-isarray-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-join-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-map-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-of-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-reduce-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-reverse-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-shift-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-slice-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-some-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-splice-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-unshift-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-with-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/base-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/boolean-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/builtins-string-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/cast-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/collections-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/constructor-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/conversion-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/convert-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/console-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/data-view-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/frames-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/function-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/ic-callable-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/ic-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/internal-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/iterator-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/math-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/number-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/object-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-all-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-any-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-finally-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-misc-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-race-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-then-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/reflect-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-match-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-search-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-source-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-split-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-test-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-at-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-endswith-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-html-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-includes-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-indexof-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-iterator-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-match-search-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-pad-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-repeat-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-slice-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-startswith-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-substr-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-substring-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-trim-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/symbol-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/torque-internal-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/weak-ref-tq-inl.inc $(obj)/gen/torque-generated/src/ic/handler-configuration-tq-inl.inc $(obj)/gen/torque-generated/src/objects/allocation-site-tq-inl.inc $(obj)/gen/torque-generated/src/objects/api-callbacks-tq-inl.inc $(obj)/gen/torque-generated/src/objects/arguments-tq-inl.inc $(obj)/gen/torque-generated/src/objects/bigint-tq-inl.inc $(obj)/gen/torque-generated/src/objects/call-site-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/cell-tq-inl.inc $(obj)/gen/torque-generated/src/objects/code-tq-inl.inc $(obj)/gen/torque-generated/src/objects/contexts-tq-inl.inc $(obj)/gen/torque-generated/src/objects/data-handler-tq-inl.inc $(obj)/gen/torque-generated/src/objects/debug-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/descriptor-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/feedback-cell-tq-inl.inc $(obj)/gen/torque-generated/src/objects/feedback-vector-tq-inl.inc $(obj)/gen/torque-generated/src/objects/fixed-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/foreign-tq-inl.inc $(obj)/gen/torque-generated/src/objects/free-space-tq-inl.inc $(obj)/gen/torque-generated/src/objects/heap-number-tq-inl.inc $(obj)/gen/torque-generated/src/objects/heap-object-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-collection-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-function-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-generator-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-promise-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-proxy-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-raw-json-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-regexp-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-shared-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-struct-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq-inl.inc $(obj)/gen/torque-generated/src/objects/literal-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/map-tq-inl.inc $(obj)/gen/torque-generated/src/objects/megadom-handler-tq-inl.inc $(obj)/gen/torque-generated/src/objects/microtask-tq-inl.inc $(obj)/gen/torque-generated/src/objects/module-tq-inl.inc $(obj)/gen/torque-generated/src/objects/name-tq-inl.inc $(obj)/gen/torque-generated/src/objects/oddball-tq-inl.inc $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq-inl.inc $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq-inl.inc $(obj)/gen/torque-generated/src/objects/promise-tq-inl.inc $(obj)/gen/torque-generated/src/objects/property-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/property-cell-tq-inl.inc $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq-inl.inc $(obj)/gen/torque-generated/src/objects/prototype-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/scope-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/script-tq-inl.inc $(obj)/gen/torque-generated/src/objects/shared-function-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/source-text-module-tq-inl.inc $(obj)/gen/torque-generated/src/objects/string-tq-inl.inc $(obj)/gen/torque-generated/src/objects/struct-tq-inl.inc $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq-inl.inc $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq-inl.inc $(obj)/gen/torque-generated/src/objects/synthetic-module-tq-inl.inc $(obj)/gen/torque-generated/src/objects/template-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/templates-tq-inl.inc $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq-inl.inc $(obj)/gen/torque-generated/src/objects/turbofan-types-tq-inl.inc $(obj)/gen/torque-generated/test/torque/test-torque-tq-inl.inc $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/wasm-tq-inl.inc $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq-inl.inc $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq.cc $(obj)/gen/torque-generated/src/builtins/array-at-tq.cc $(obj)/gen/torque-generated/src/builtins/array-concat-tq.cc $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq.cc $(obj)/gen/torque-generated/src/builtins/array-every-tq.cc $(obj)/gen/torque-generated/src/builtins/array-filter-tq.cc $(obj)/gen/torque-generated/src/builtins/array-find-tq.cc $(obj)/gen/torque-generated/src/builtins/array-findindex-tq.cc $(obj)/gen/torque-generated/src/builtins/array-findlast-tq.cc $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq.cc $(obj)/gen/torque-generated/src/builtins/array-foreach-tq.cc $(obj)/gen/torque-generated/src/builtins/array-from-tq.cc $(obj)/gen/torque-generated/src/builtins/array-isarray-tq.cc $(obj)/gen/torque-generated/src/builtins/array-join-tq.cc $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq.cc $(obj)/gen/torque-generated/src/builtins/array-map-tq.cc $(obj)/gen/torque-generated/src/builtins/array-of-tq.cc $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq.cc $(obj)/gen/torque-generated/src/builtins/array-reduce-tq.cc $(obj)/gen/torque-generated/src/builtins/array-reverse-tq.cc $(obj)/gen/torque-generated/src/builtins/array-shift-tq.cc $(obj)/gen/torque-generated/src/builtins/array-slice-tq.cc $(obj)/gen/torque-generated/src/builtins/array-some-tq.cc $(obj)/gen/torque-generated/src/builtins/array-splice-tq.cc $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq.cc $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq.cc $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq.cc $(obj)/gen/torque-generated/src/builtins/array-unshift-tq.cc $(obj)/gen/torque-generated/src/builtins/array-with-tq.cc $(obj)/gen/torque-generated/src/builtins/array-tq.cc $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq.cc $(obj)/gen/torque-generated/src/builtins/base-tq.cc $(obj)/gen/torque-generated/src/builtins/boolean-tq.cc $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq.cc $(obj)/gen/torque-generated/src/builtins/builtins-string-tq.cc $(obj)/gen/torque-generated/src/builtins/cast-tq.cc $(obj)/gen/torque-generated/src/builtins/collections-tq.cc $(obj)/gen/torque-generated/src/builtins/constructor-tq.cc $(obj)/gen/torque-generated/src/builtins/conversion-tq.cc $(obj)/gen/torque-generated/src/builtins/convert-tq.cc $(obj)/gen/torque-generated/src/builtins/console-tq.cc $(obj)/gen/torque-generated/src/builtins/data-view-tq.cc $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq.cc $(obj)/gen/torque-generated/src/builtins/frames-tq.cc $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq.cc $(obj)/gen/torque-generated/src/builtins/function-tq.cc $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq.cc $(obj)/gen/torque-generated/src/builtins/ic-callable-tq.cc $(obj)/gen/torque-generated/src/builtins/ic-tq.cc $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq.cc $(obj)/gen/torque-generated/src/builtins/internal-tq.cc $(obj)/gen/torque-generated/src/builtins/iterator-tq.cc $(obj)/gen/torque-generated/src/builtins/math-tq.cc $(obj)/gen/torque-generated/src/builtins/number-tq.cc $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq.cc $(obj)/gen/torque-generated/src/builtins/object-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-all-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-any-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-finally-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-misc-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-race-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-then-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-tq.cc $(obj)/gen/torque-generated/src/builtins/reflect-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-match-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-search-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-source-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-split-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-test-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-tq.cc $(obj)/gen/torque-generated/src/builtins/string-at-tq.cc $(obj)/gen/torque-generated/src/builtins/string-endswith-tq.cc $(obj)/gen/torque-generated/src/builtins/string-html-tq.cc $(obj)/gen/torque-generated/src/builtins/string-includes-tq.cc $(obj)/gen/torque-generated/src/builtins/string-indexof-tq.cc $(obj)/gen/torque-generated/src/builtins/string-iterator-tq.cc $(obj)/gen/torque-generated/src/builtins/string-match-search-tq.cc $(obj)/gen/torque-generated/src/builtins/string-pad-tq.cc $(obj)/gen/torque-generated/src/builtins/string-repeat-tq.cc $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq.cc $(obj)/gen/torque-generated/src/builtins/string-slice-tq.cc $(obj)/gen/torque-generated/src/builtins/string-startswith-tq.cc $(obj)/gen/torque-generated/src/builtins/string-substr-tq.cc $(obj)/gen/torque-generated/src/builtins/string-substring-tq.cc $(obj)/gen/torque-generated/src/builtins/string-trim-tq.cc $(obj)/gen/torque-generated/src/builtins/symbol-tq.cc $(obj)/gen/torque-generated/src/builtins/torque-internal-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-tq.cc $(obj)/gen/torque-generated/src/builtins/weak-ref-tq.cc $(obj)/gen/torque-generated/src/ic/handler-configuration-tq.cc $(obj)/gen/torque-generated/src/objects/allocation-site-tq.cc $(obj)/gen/torque-generated/src/objects/api-callbacks-tq.cc $(obj)/gen/torque-generated/src/objects/arguments-tq.cc $(obj)/gen/torque-generated/src/objects/bigint-tq.cc $(obj)/gen/torque-generated/src/objects/call-site-info-tq.cc $(obj)/gen/torque-generated/src/objects/cell-tq.cc $(obj)/gen/torque-generated/src/objects/code-tq.cc $(obj)/gen/torque-generated/src/objects/contexts-tq.cc $(obj)/gen/torque-generated/src/objects/data-handler-tq.cc $(obj)/gen/torque-generated/src/objects/debug-objects-tq.cc $(obj)/gen/torque-generated/src/objects/descriptor-array-tq.cc $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq.cc $(obj)/gen/torque-generated/src/objects/feedback-cell-tq.cc $(obj)/gen/torque-generated/src/objects/feedback-vector-tq.cc $(obj)/gen/torque-generated/src/objects/fixed-array-tq.cc $(obj)/gen/torque-generated/src/objects/foreign-tq.cc $(obj)/gen/torque-generated/src/objects/free-space-tq.cc $(obj)/gen/torque-generated/src/objects/heap-number-tq.cc $(obj)/gen/torque-generated/src/objects/heap-object-tq.cc $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq.cc $(obj)/gen/torque-generated/src/objects/js-array-tq.cc $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq.cc $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq.cc $(obj)/gen/torque-generated/src/objects/js-collection-tq.cc $(obj)/gen/torque-generated/src/objects/js-function-tq.cc $(obj)/gen/torque-generated/src/objects/js-generator-tq.cc $(obj)/gen/torque-generated/src/objects/js-objects-tq.cc $(obj)/gen/torque-generated/src/objects/js-promise-tq.cc $(obj)/gen/torque-generated/src/objects/js-proxy-tq.cc $(obj)/gen/torque-generated/src/objects/js-raw-json-tq.cc $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq.cc $(obj)/gen/torque-generated/src/objects/js-regexp-tq.cc $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq.cc $(obj)/gen/torque-generated/src/objects/js-shared-array-tq.cc $(obj)/gen/torque-generated/src/objects/js-struct-tq.cc $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq.cc $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq.cc $(obj)/gen/torque-generated/src/objects/literal-objects-tq.cc $(obj)/gen/torque-generated/src/objects/map-tq.cc $(obj)/gen/torque-generated/src/objects/megadom-handler-tq.cc $(obj)/gen/torque-generated/src/objects/microtask-tq.cc $(obj)/gen/torque-generated/src/objects/module-tq.cc $(obj)/gen/torque-generated/src/objects/name-tq.cc $(obj)/gen/torque-generated/src/objects/oddball-tq.cc $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq.cc $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq.cc $(obj)/gen/torque-generated/src/objects/promise-tq.cc $(obj)/gen/torque-generated/src/objects/property-array-tq.cc $(obj)/gen/torque-generated/src/objects/property-cell-tq.cc $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq.cc $(obj)/gen/torque-generated/src/objects/prototype-info-tq.cc $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq.cc $(obj)/gen/torque-generated/src/objects/scope-info-tq.cc $(obj)/gen/torque-generated/src/objects/script-tq.cc $(obj)/gen/torque-generated/src/objects/shared-function-info-tq.cc $(obj)/gen/torque-generated/src/objects/source-text-module-tq.cc $(obj)/gen/torque-generated/src/objects/string-tq.cc $(obj)/gen/torque-generated/src/objects/struct-tq.cc $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq.cc $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq.cc $(obj)/gen/torque-generated/src/objects/synthetic-module-tq.cc $(obj)/gen/torque-generated/src/objects/template-objects-tq.cc $(obj)/gen/torque-generated/src/objects/templates-tq.cc $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq.cc $(obj)/gen/torque-generated/src/objects/turbofan-types-tq.cc $(obj)/gen/torque-generated/test/torque/test-torque-tq.cc $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq.cc $(obj)/gen/torque-generated/src/builtins/wasm-tq.cc $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq.cc $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq.cc $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq.inc $(obj)/gen/torque-generated/src/builtins/array-at-tq.inc $(obj)/gen/torque-generated/src/builtins/array-concat-tq.inc $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq.inc $(obj)/gen/torque-generated/src/builtins/array-every-tq.inc $(obj)/gen/torque-generated/src/builtins/array-filter-tq.inc $(obj)/gen/torque-generated/src/builtins/array-find-tq.inc $(obj)/gen/torque-generated/src/builtins/array-findindex-tq.inc $(obj)/gen/torque-generated/src/builtins/array-findlast-tq.inc $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq.inc $(obj)/gen/torque-generated/src/builtins/array-foreach-tq.inc $(obj)/gen/torque-generated/src/builtins/array-from-tq.inc $(obj)/gen/torque-generated/src/builtins/array-isarray-tq.inc $(obj)/gen/torque-generated/src/builtins/array-join-tq.inc $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq.inc $(obj)/gen/torque-generated/src/builtins/array-map-tq.inc $(obj)/gen/torque-generated/src/builtins/array-of-tq.inc $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq.inc $(obj)/gen/torque-generated/src/builtins/array-reduce-tq.inc $(obj)/gen/torque-generated/src/builtins/array-reverse-tq.inc $(obj)/gen/torque-generated/src/builtins/array-shift-tq.inc $(obj)/gen/torque-generated/src/builtins/array-slice-tq.inc $(obj)/gen/torque-generated/src/builtins/array-some-tq.inc $(obj)/gen/torque-generated/src/builtins/array-splice-tq.inc $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq.inc $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq.inc $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq.inc $(obj)/gen/torque-generated/src/builtins/array-unshift-tq.inc $(obj)/gen/torque-generated/src/builtins/array-with-tq.inc $(obj)/gen/torque-generated/src/builtins/array-tq.inc $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq.inc $(obj)/gen/torque-generated/src/builtins/base-tq.inc $(obj)/gen/torque-generated/src/builtins/boolean-tq.inc $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq.inc $(obj)/gen/torque-generated/src/builtins/builtins-string-tq.inc $(obj)/gen/torque-generated/src/builtins/cast-tq.inc $(obj)/gen/torque-generated/src/builtins/collections-tq.inc $(obj)/gen/torque-generated/src/builtins/constructor-tq.inc $(obj)/gen/torque-generated/src/builtins/conversion-tq.inc $(obj)/gen/torque-generated/src/builtins/convert-tq.inc $(obj)/gen/torque-generated/src/builtins/console-tq.inc $(obj)/gen/torque-generated/src/builtins/data-view-tq.inc $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq.inc $(obj)/gen/torque-generated/src/builtins/frames-tq.inc $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq.inc $(obj)/gen/torque-generated/src/builtins/function-tq.inc $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq.inc $(obj)/gen/torque-generated/src/builtins/ic-callable-tq.inc $(obj)/gen/torque-generated/src/builtins/ic-tq.inc $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq.inc $(obj)/gen/torque-generated/src/builtins/internal-tq.inc $(obj)/gen/torque-generated/src/builtins/iterator-tq.inc $(obj)/gen/torque-generated/src/builtins/math-tq.inc $(obj)/gen/torque-generated/src/builtins/number-tq.inc $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq.inc $(obj)/gen/torque-generated/src/builtins/object-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-all-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-any-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-finally-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-misc-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-race-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-then-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-tq.inc $(obj)/gen/torque-generated/src/builtins/reflect-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-match-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-search-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-source-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-split-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-test-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-tq.inc $(obj)/gen/torque-generated/src/builtins/string-at-tq.inc $(obj)/gen/torque-generated/src/builtins/string-endswith-tq.inc $(obj)/gen/torque-generated/src/builtins/string-html-tq.inc $(obj)/gen/torque-generated/src/builtins/string-includes-tq.inc $(obj)/gen/torque-generated/src/builtins/string-indexof-tq.inc $(obj)/gen/torque-generated/src/builtins/string-iterator-tq.inc $(obj)/gen/torque-generated/src/builtins/string-match-search-tq.inc $(obj)/gen/torque-generated/src/builtins/string-pad-tq.inc $(obj)/gen/torque-generated/src/builtins/string-repeat-tq.inc $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq.inc $(obj)/gen/torque-generated/src/builtins/string-slice-tq.inc $(obj)/gen/torque-generated/src/builtins/string-startswith-tq.inc $(obj)/gen/torque-generated/src/builtins/string-substr-tq.inc $(obj)/gen/torque-generated/src/builtins/string-substring-tq.inc $(obj)/gen/torque-generated/src/builtins/string-trim-tq.inc $(obj)/gen/torque-generated/src/builtins/symbol-tq.inc $(obj)/gen/torque-generated/src/builtins/torque-internal-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-tq.inc $(obj)/gen/torque-generated/src/builtins/weak-ref-tq.inc $(obj)/gen/torque-generated/src/ic/handler-configuration-tq.inc $(obj)/gen/torque-generated/src/objects/allocation-site-tq.inc $(obj)/gen/torque-generated/src/objects/api-callbacks-tq.inc $(obj)/gen/torque-generated/src/objects/arguments-tq.inc $(obj)/gen/torque-generated/src/objects/bigint-tq.inc $(obj)/gen/torque-generated/src/objects/call-site-info-tq.inc $(obj)/gen/torque-generated/src/objects/cell-tq.inc $(obj)/gen/torque-generated/src/objects/code-tq.inc $(obj)/gen/torque-generated/src/objects/contexts-tq.inc $(obj)/gen/torque-generated/src/objects/data-handler-tq.inc $(obj)/gen/torque-generated/src/objects/debug-objects-tq.inc $(obj)/gen/torque-generated/src/objects/descriptor-array-tq.inc $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq.inc $(obj)/gen/torque-generated/src/objects/feedback-cell-tq.inc $(obj)/gen/torque-generated/src/objects/feedback-vector-tq.inc $(obj)/gen/torque-generated/src/objects/fixed-array-tq.inc $(obj)/gen/torque-generated/src/objects/foreign-tq.inc $(obj)/gen/torque-generated/src/objects/free-space-tq.inc $(obj)/gen/torque-generated/src/objects/heap-number-tq.inc $(obj)/gen/torque-generated/src/objects/heap-object-tq.inc $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq.inc $(obj)/gen/torque-generated/src/objects/js-array-tq.inc $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq.inc $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq.inc $(obj)/gen/torque-generated/src/objects/js-collection-tq.inc $(obj)/gen/torque-generated/src/objects/js-function-tq.inc $(obj)/gen/torque-generated/src/objects/js-generator-tq.inc $(obj)/gen/torque-generated/src/objects/js-objects-tq.inc $(obj)/gen/torque-generated/src/objects/js-promise-tq.inc $(obj)/gen/torque-generated/src/objects/js-proxy-tq.inc $(obj)/gen/torque-generated/src/objects/js-raw-json-tq.inc $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq.inc $(obj)/gen/torque-generated/src/objects/js-regexp-tq.inc $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq.inc $(obj)/gen/torque-generated/src/objects/js-shared-array-tq.inc $(obj)/gen/torque-generated/src/objects/js-struct-tq.inc $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq.inc $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq.inc $(obj)/gen/torque-generated/src/objects/literal-objects-tq.inc $(obj)/gen/torque-generated/src/objects/map-tq.inc $(obj)/gen/torque-generated/src/objects/megadom-handler-tq.inc $(obj)/gen/torque-generated/src/objects/microtask-tq.inc $(obj)/gen/torque-generated/src/objects/module-tq.inc $(obj)/gen/torque-generated/src/objects/name-tq.inc $(obj)/gen/torque-generated/src/objects/oddball-tq.inc $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq.inc $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq.inc $(obj)/gen/torque-generated/src/objects/promise-tq.inc $(obj)/gen/torque-generated/src/objects/property-array-tq.inc $(obj)/gen/torque-generated/src/objects/property-cell-tq.inc $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq.inc $(obj)/gen/torque-generated/src/objects/prototype-info-tq.inc $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq.inc $(obj)/gen/torque-generated/src/objects/scope-info-tq.inc $(obj)/gen/torque-generated/src/objects/script-tq.inc $(obj)/gen/torque-generated/src/objects/shared-function-info-tq.inc $(obj)/gen/torque-generated/src/objects/source-text-module-tq.inc $(obj)/gen/torque-generated/src/objects/string-tq.inc $(obj)/gen/torque-generated/src/objects/struct-tq.inc $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq.inc $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq.inc $(obj)/gen/torque-generated/src/objects/synthetic-module-tq.inc $(obj)/gen/torque-generated/src/objects/template-objects-tq.inc $(obj)/gen/torque-generated/src/objects/templates-tq.inc $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq.inc $(obj)/gen/torque-generated/src/objects/turbofan-types-tq.inc $(obj)/gen/torque-generated/test/torque/test-torque-tq.inc $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq.inc $(obj)/gen/torque-generated/src/builtins/wasm-tq.inc $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq.inc $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq.inc: 541771286289518efa2205a853042917992636bc.intermediate
+	@:
+.INTERMEDIATE: 541771286289518efa2205a853042917992636bc.intermediate
+541771286289518efa2205a853042917992636bc.intermediate: $(builddir)/torque $(srcdir)/deps/v8/src/builtins/aggregate-error.tq $(srcdir)/deps/v8/src/builtins/array-at.tq $(srcdir)/deps/v8/src/builtins/array-concat.tq $(srcdir)/deps/v8/src/builtins/array-copywithin.tq $(srcdir)/deps/v8/src/builtins/array-every.tq $(srcdir)/deps/v8/src/builtins/array-filter.tq $(srcdir)/deps/v8/src/builtins/array-find.tq $(srcdir)/deps/v8/src/builtins/array-findindex.tq $(srcdir)/deps/v8/src/builtins/array-findlast.tq $(srcdir)/deps/v8/src/builtins/array-findlastindex.tq $(srcdir)/deps/v8/src/builtins/array-foreach.tq $(srcdir)/deps/v8/src/builtins/array-from.tq $(srcdir)/deps/v8/src/builtins/array-isarray.tq $(srcdir)/deps/v8/src/builtins/array-join.tq $(srcdir)/deps/v8/src/builtins/array-lastindexof.tq $(srcdir)/deps/v8/src/builtins/array-map.tq $(srcdir)/deps/v8/src/builtins/array-of.tq $(srcdir)/deps/v8/src/builtins/array-reduce-right.tq $(srcdir)/deps/v8/src/builtins/array-reduce.tq $(srcdir)/deps/v8/src/builtins/array-reverse.tq $(srcdir)/deps/v8/src/builtins/array-shift.tq $(srcdir)/deps/v8/src/builtins/array-slice.tq $(srcdir)/deps/v8/src/builtins/array-some.tq $(srcdir)/deps/v8/src/builtins/array-splice.tq $(srcdir)/deps/v8/src/builtins/array-to-reversed.tq $(srcdir)/deps/v8/src/builtins/array-to-sorted.tq $(srcdir)/deps/v8/src/builtins/array-to-spliced.tq $(srcdir)/deps/v8/src/builtins/array-unshift.tq $(srcdir)/deps/v8/src/builtins/array-with.tq $(srcdir)/deps/v8/src/builtins/array.tq $(srcdir)/deps/v8/src/builtins/arraybuffer.tq $(srcdir)/deps/v8/src/builtins/base.tq $(srcdir)/deps/v8/src/builtins/boolean.tq $(srcdir)/deps/v8/src/builtins/builtins-bigint.tq $(srcdir)/deps/v8/src/builtins/builtins-string.tq $(srcdir)/deps/v8/src/builtins/cast.tq $(srcdir)/deps/v8/src/builtins/collections.tq $(srcdir)/deps/v8/src/builtins/constructor.tq $(srcdir)/deps/v8/src/builtins/conversion.tq $(srcdir)/deps/v8/src/builtins/convert.tq $(srcdir)/deps/v8/src/builtins/console.tq $(srcdir)/deps/v8/src/builtins/data-view.tq $(srcdir)/deps/v8/src/builtins/finalization-registry.tq $(srcdir)/deps/v8/src/builtins/frames.tq $(srcdir)/deps/v8/src/builtins/frame-arguments.tq $(srcdir)/deps/v8/src/builtins/function.tq $(srcdir)/deps/v8/src/builtins/growable-fixed-array.tq $(srcdir)/deps/v8/src/builtins/ic-callable.tq $(srcdir)/deps/v8/src/builtins/ic.tq $(srcdir)/deps/v8/src/builtins/internal-coverage.tq $(srcdir)/deps/v8/src/builtins/internal.tq $(srcdir)/deps/v8/src/builtins/iterator.tq $(srcdir)/deps/v8/src/builtins/math.tq $(srcdir)/deps/v8/src/builtins/number.tq $(srcdir)/deps/v8/src/builtins/object-fromentries.tq $(srcdir)/deps/v8/src/builtins/object.tq $(srcdir)/deps/v8/src/builtins/promise-abstract-operations.tq $(srcdir)/deps/v8/src/builtins/promise-all.tq $(srcdir)/deps/v8/src/builtins/promise-all-element-closure.tq $(srcdir)/deps/v8/src/builtins/promise-any.tq $(srcdir)/deps/v8/src/builtins/promise-constructor.tq $(srcdir)/deps/v8/src/builtins/promise-finally.tq $(srcdir)/deps/v8/src/builtins/promise-misc.tq $(srcdir)/deps/v8/src/builtins/promise-race.tq $(srcdir)/deps/v8/src/builtins/promise-reaction-job.tq $(srcdir)/deps/v8/src/builtins/promise-resolve.tq $(srcdir)/deps/v8/src/builtins/promise-then.tq $(srcdir)/deps/v8/src/builtins/promise-jobs.tq $(srcdir)/deps/v8/src/builtins/proxy-constructor.tq $(srcdir)/deps/v8/src/builtins/proxy-delete-property.tq $(srcdir)/deps/v8/src/builtins/proxy-get-property.tq $(srcdir)/deps/v8/src/builtins/proxy-get-prototype-of.tq $(srcdir)/deps/v8/src/builtins/proxy-has-property.tq $(srcdir)/deps/v8/src/builtins/proxy-is-extensible.tq $(srcdir)/deps/v8/src/builtins/proxy-prevent-extensions.tq $(srcdir)/deps/v8/src/builtins/proxy-revocable.tq $(srcdir)/deps/v8/src/builtins/proxy-revoke.tq $(srcdir)/deps/v8/src/builtins/proxy-set-property.tq $(srcdir)/deps/v8/src/builtins/proxy-set-prototype-of.tq $(srcdir)/deps/v8/src/builtins/proxy.tq $(srcdir)/deps/v8/src/builtins/reflect.tq $(srcdir)/deps/v8/src/builtins/regexp-exec.tq $(srcdir)/deps/v8/src/builtins/regexp-match-all.tq $(srcdir)/deps/v8/src/builtins/regexp-match.tq $(srcdir)/deps/v8/src/builtins/regexp-replace.tq $(srcdir)/deps/v8/src/builtins/regexp-search.tq $(srcdir)/deps/v8/src/builtins/regexp-source.tq $(srcdir)/deps/v8/src/builtins/regexp-split.tq $(srcdir)/deps/v8/src/builtins/regexp-test.tq $(srcdir)/deps/v8/src/builtins/regexp.tq $(srcdir)/deps/v8/src/builtins/string-at.tq $(srcdir)/deps/v8/src/builtins/string-endswith.tq $(srcdir)/deps/v8/src/builtins/string-html.tq $(srcdir)/deps/v8/src/builtins/string-includes.tq $(srcdir)/deps/v8/src/builtins/string-indexof.tq $(srcdir)/deps/v8/src/builtins/string-iterator.tq $(srcdir)/deps/v8/src/builtins/string-match-search.tq $(srcdir)/deps/v8/src/builtins/string-pad.tq $(srcdir)/deps/v8/src/builtins/string-repeat.tq $(srcdir)/deps/v8/src/builtins/string-replaceall.tq $(srcdir)/deps/v8/src/builtins/string-slice.tq $(srcdir)/deps/v8/src/builtins/string-startswith.tq $(srcdir)/deps/v8/src/builtins/string-substr.tq $(srcdir)/deps/v8/src/builtins/string-substring.tq $(srcdir)/deps/v8/src/builtins/string-trim.tq $(srcdir)/deps/v8/src/builtins/symbol.tq $(srcdir)/deps/v8/src/builtins/torque-internal.tq $(srcdir)/deps/v8/src/builtins/typed-array-at.tq $(srcdir)/deps/v8/src/builtins/typed-array-createtypedarray.tq $(srcdir)/deps/v8/src/builtins/typed-array-every.tq $(srcdir)/deps/v8/src/builtins/typed-array-entries.tq $(srcdir)/deps/v8/src/builtins/typed-array-filter.tq $(srcdir)/deps/v8/src/builtins/typed-array-find.tq $(srcdir)/deps/v8/src/builtins/typed-array-findindex.tq $(srcdir)/deps/v8/src/builtins/typed-array-findlast.tq $(srcdir)/deps/v8/src/builtins/typed-array-findlastindex.tq $(srcdir)/deps/v8/src/builtins/typed-array-foreach.tq $(srcdir)/deps/v8/src/builtins/typed-array-from.tq $(srcdir)/deps/v8/src/builtins/typed-array-keys.tq $(srcdir)/deps/v8/src/builtins/typed-array-of.tq $(srcdir)/deps/v8/src/builtins/typed-array-reduce.tq $(srcdir)/deps/v8/src/builtins/typed-array-reduceright.tq $(srcdir)/deps/v8/src/builtins/typed-array-set.tq $(srcdir)/deps/v8/src/builtins/typed-array-slice.tq $(srcdir)/deps/v8/src/builtins/typed-array-some.tq $(srcdir)/deps/v8/src/builtins/typed-array-sort.tq $(srcdir)/deps/v8/src/builtins/typed-array-subarray.tq $(srcdir)/deps/v8/src/builtins/typed-array-to-reversed.tq $(srcdir)/deps/v8/src/builtins/typed-array-to-sorted.tq $(srcdir)/deps/v8/src/builtins/typed-array-values.tq $(srcdir)/deps/v8/src/builtins/typed-array-with.tq $(srcdir)/deps/v8/src/builtins/typed-array.tq $(srcdir)/deps/v8/src/builtins/weak-ref.tq $(srcdir)/deps/v8/src/ic/handler-configuration.tq $(srcdir)/deps/v8/src/objects/allocation-site.tq $(srcdir)/deps/v8/src/objects/api-callbacks.tq $(srcdir)/deps/v8/src/objects/arguments.tq $(srcdir)/deps/v8/src/objects/bigint.tq $(srcdir)/deps/v8/src/objects/call-site-info.tq $(srcdir)/deps/v8/src/objects/cell.tq $(srcdir)/deps/v8/src/objects/code.tq $(srcdir)/deps/v8/src/objects/contexts.tq $(srcdir)/deps/v8/src/objects/data-handler.tq $(srcdir)/deps/v8/src/objects/debug-objects.tq $(srcdir)/deps/v8/src/objects/descriptor-array.tq $(srcdir)/deps/v8/src/objects/embedder-data-array.tq $(srcdir)/deps/v8/src/objects/feedback-cell.tq $(srcdir)/deps/v8/src/objects/feedback-vector.tq $(srcdir)/deps/v8/src/objects/fixed-array.tq $(srcdir)/deps/v8/src/objects/foreign.tq $(srcdir)/deps/v8/src/objects/free-space.tq $(srcdir)/deps/v8/src/objects/heap-number.tq $(srcdir)/deps/v8/src/objects/heap-object.tq $(srcdir)/deps/v8/src/objects/js-array-buffer.tq $(srcdir)/deps/v8/src/objects/js-array.tq $(srcdir)/deps/v8/src/objects/js-atomics-synchronization.tq $(srcdir)/deps/v8/src/objects/js-collection-iterator.tq $(srcdir)/deps/v8/src/objects/js-collection.tq $(srcdir)/deps/v8/src/objects/js-function.tq $(srcdir)/deps/v8/src/objects/js-generator.tq $(srcdir)/deps/v8/src/objects/js-objects.tq $(srcdir)/deps/v8/src/objects/js-promise.tq $(srcdir)/deps/v8/src/objects/js-proxy.tq $(srcdir)/deps/v8/src/objects/js-raw-json.tq $(srcdir)/deps/v8/src/objects/js-regexp-string-iterator.tq $(srcdir)/deps/v8/src/objects/js-regexp.tq $(srcdir)/deps/v8/src/objects/js-shadow-realm.tq $(srcdir)/deps/v8/src/objects/js-shared-array.tq $(srcdir)/deps/v8/src/objects/js-struct.tq $(srcdir)/deps/v8/src/objects/js-temporal-objects.tq $(srcdir)/deps/v8/src/objects/js-weak-refs.tq $(srcdir)/deps/v8/src/objects/literal-objects.tq $(srcdir)/deps/v8/src/objects/map.tq $(srcdir)/deps/v8/src/objects/megadom-handler.tq $(srcdir)/deps/v8/src/objects/microtask.tq $(srcdir)/deps/v8/src/objects/module.tq $(srcdir)/deps/v8/src/objects/name.tq $(srcdir)/deps/v8/src/objects/oddball.tq $(srcdir)/deps/v8/src/objects/ordered-hash-table.tq $(srcdir)/deps/v8/src/objects/primitive-heap-object.tq $(srcdir)/deps/v8/src/objects/promise.tq $(srcdir)/deps/v8/src/objects/property-array.tq $(srcdir)/deps/v8/src/objects/property-cell.tq $(srcdir)/deps/v8/src/objects/property-descriptor-object.tq $(srcdir)/deps/v8/src/objects/prototype-info.tq $(srcdir)/deps/v8/src/objects/regexp-match-info.tq $(srcdir)/deps/v8/src/objects/scope-info.tq $(srcdir)/deps/v8/src/objects/script.tq $(srcdir)/deps/v8/src/objects/shared-function-info.tq $(srcdir)/deps/v8/src/objects/source-text-module.tq $(srcdir)/deps/v8/src/objects/string.tq $(srcdir)/deps/v8/src/objects/struct.tq $(srcdir)/deps/v8/src/objects/swiss-hash-table-helpers.tq $(srcdir)/deps/v8/src/objects/swiss-name-dictionary.tq $(srcdir)/deps/v8/src/objects/synthetic-module.tq $(srcdir)/deps/v8/src/objects/template-objects.tq $(srcdir)/deps/v8/src/objects/templates.tq $(srcdir)/deps/v8/src/objects/torque-defined-classes.tq $(srcdir)/deps/v8/src/objects/turbofan-types.tq $(srcdir)/deps/v8/test/torque/test-torque.tq $(srcdir)/deps/v8/third_party/v8/builtins/array-sort.tq $(srcdir)/deps/v8/src/builtins/wasm.tq $(srcdir)/deps/v8/src/debug/debug-wasm-objects.tq $(srcdir)/deps/v8/src/wasm/wasm-objects.tq FORCE_DO_CMD
+	$(call do_cmd,touch)
+	$(call do_cmd,_root_repo_tools_v8_gypfiles_v8_gyp_run_torque_target_run_torque_action)
+
+all_deps += $(obj)/gen/torque-generated/bit-fields.h $(obj)/gen/torque-generated/builtin-definitions.h $(obj)/gen/torque-generated/class-debug-readers.cc $(obj)/gen/torque-generated/class-debug-readers.h $(obj)/gen/torque-generated/class-forward-declarations.h $(obj)/gen/torque-generated/class-verifiers.cc $(obj)/gen/torque-generated/class-verifiers.h $(obj)/gen/torque-generated/csa-types.h $(obj)/gen/torque-generated/debug-macros.cc $(obj)/gen/torque-generated/debug-macros.h $(obj)/gen/torque-generated/enum-verifiers.cc $(obj)/gen/torque-generated/exported-macros-assembler.cc $(obj)/gen/torque-generated/exported-macros-assembler.h $(obj)/gen/torque-generated/factory.cc $(obj)/gen/torque-generated/factory.inc $(obj)/gen/torque-generated/instance-types.h $(obj)/gen/torque-generated/interface-descriptors.inc $(obj)/gen/torque-generated/objects-body-descriptors-inl.inc $(obj)/gen/torque-generated/objects-printer.cc $(obj)/gen/torque-generated/visitor-lists.h $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-at-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-concat-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-every-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-filter-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-find-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-findindex-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-findlast-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-foreach-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-from-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-isarray-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-join-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-map-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-of-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-reduce-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-reverse-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-shift-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-slice-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-some-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-splice-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-unshift-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-with-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/base-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/boolean-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/builtins-string-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/cast-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/collections-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/constructor-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/conversion-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/convert-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/console-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/data-view-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/frames-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/function-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/ic-callable-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/ic-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/internal-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/iterator-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/math-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/number-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/object-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-all-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-any-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-finally-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-misc-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-race-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-then-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/reflect-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-match-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-search-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-source-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-split-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-test-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-at-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-endswith-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-html-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-includes-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-indexof-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-iterator-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-match-search-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-pad-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-repeat-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-slice-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-startswith-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-substr-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-substring-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-trim-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/symbol-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/torque-internal-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/weak-ref-tq-csa.cc $(obj)/gen/torque-generated/src/ic/handler-configuration-tq-csa.cc $(obj)/gen/torque-generated/src/objects/allocation-site-tq-csa.cc $(obj)/gen/torque-generated/src/objects/api-callbacks-tq-csa.cc $(obj)/gen/torque-generated/src/objects/arguments-tq-csa.cc $(obj)/gen/torque-generated/src/objects/bigint-tq-csa.cc $(obj)/gen/torque-generated/src/objects/call-site-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/cell-tq-csa.cc $(obj)/gen/torque-generated/src/objects/code-tq-csa.cc $(obj)/gen/torque-generated/src/objects/contexts-tq-csa.cc $(obj)/gen/torque-generated/src/objects/data-handler-tq-csa.cc $(obj)/gen/torque-generated/src/objects/debug-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/descriptor-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/feedback-cell-tq-csa.cc $(obj)/gen/torque-generated/src/objects/feedback-vector-tq-csa.cc $(obj)/gen/torque-generated/src/objects/fixed-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/foreign-tq-csa.cc $(obj)/gen/torque-generated/src/objects/free-space-tq-csa.cc $(obj)/gen/torque-generated/src/objects/heap-number-tq-csa.cc $(obj)/gen/torque-generated/src/objects/heap-object-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-collection-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-function-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-generator-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-promise-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-proxy-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-raw-json-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-regexp-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-shared-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-struct-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq-csa.cc $(obj)/gen/torque-generated/src/objects/literal-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/map-tq-csa.cc $(obj)/gen/torque-generated/src/objects/megadom-handler-tq-csa.cc $(obj)/gen/torque-generated/src/objects/microtask-tq-csa.cc $(obj)/gen/torque-generated/src/objects/module-tq-csa.cc $(obj)/gen/torque-generated/src/objects/name-tq-csa.cc $(obj)/gen/torque-generated/src/objects/oddball-tq-csa.cc $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq-csa.cc $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq-csa.cc $(obj)/gen/torque-generated/src/objects/promise-tq-csa.cc $(obj)/gen/torque-generated/src/objects/property-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/property-cell-tq-csa.cc $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq-csa.cc $(obj)/gen/torque-generated/src/objects/prototype-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/scope-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/script-tq-csa.cc $(obj)/gen/torque-generated/src/objects/shared-function-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/source-text-module-tq-csa.cc $(obj)/gen/torque-generated/src/objects/string-tq-csa.cc $(obj)/gen/torque-generated/src/objects/struct-tq-csa.cc $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq-csa.cc $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq-csa.cc $(obj)/gen/torque-generated/src/objects/synthetic-module-tq-csa.cc $(obj)/gen/torque-generated/src/objects/template-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/templates-tq-csa.cc $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq-csa.cc $(obj)/gen/torque-generated/src/objects/turbofan-types-tq-csa.cc $(obj)/gen/torque-generated/test/torque/test-torque-tq-csa.cc $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/wasm-tq-csa.cc $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq-csa.cc $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-at-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-concat-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-every-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-filter-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-find-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-findindex-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-findlast-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-foreach-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-from-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-isarray-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-join-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-map-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-of-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-reduce-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-reverse-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-shift-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-slice-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-some-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-splice-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-unshift-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-with-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-tq-csa.h $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq-csa.h $(obj)/gen/torque-generated/src/builtins/base-tq-csa.h $(obj)/gen/torque-generated/src/builtins/boolean-tq-csa.h $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq-csa.h $(obj)/gen/torque-generated/src/builtins/builtins-string-tq-csa.h $(obj)/gen/torque-generated/src/builtins/cast-tq-csa.h $(obj)/gen/torque-generated/src/builtins/collections-tq-csa.h $(obj)/gen/torque-generated/src/builtins/constructor-tq-csa.h $(obj)/gen/torque-generated/src/builtins/conversion-tq-csa.h $(obj)/gen/torque-generated/src/builtins/convert-tq-csa.h $(obj)/gen/torque-generated/src/builtins/console-tq-csa.h $(obj)/gen/torque-generated/src/builtins/data-view-tq-csa.h $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq-csa.h $(obj)/gen/torque-generated/src/builtins/frames-tq-csa.h $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq-csa.h $(obj)/gen/torque-generated/src/builtins/function-tq-csa.h $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq-csa.h $(obj)/gen/torque-generated/src/builtins/ic-callable-tq-csa.h $(obj)/gen/torque-generated/src/builtins/ic-tq-csa.h $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq-csa.h $(obj)/gen/torque-generated/src/builtins/internal-tq-csa.h $(obj)/gen/torque-generated/src/builtins/iterator-tq-csa.h $(obj)/gen/torque-generated/src/builtins/math-tq-csa.h $(obj)/gen/torque-generated/src/builtins/number-tq-csa.h $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq-csa.h $(obj)/gen/torque-generated/src/builtins/object-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-all-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-any-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-finally-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-misc-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-race-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-then-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-tq-csa.h $(obj)/gen/torque-generated/src/builtins/reflect-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-match-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-search-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-source-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-split-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-test-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-at-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-endswith-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-html-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-includes-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-indexof-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-iterator-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-match-search-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-pad-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-repeat-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-slice-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-startswith-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-substr-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-substring-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-trim-tq-csa.h $(obj)/gen/torque-generated/src/builtins/symbol-tq-csa.h $(obj)/gen/torque-generated/src/builtins/torque-internal-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-tq-csa.h $(obj)/gen/torque-generated/src/builtins/weak-ref-tq-csa.h $(obj)/gen/torque-generated/src/ic/handler-configuration-tq-csa.h $(obj)/gen/torque-generated/src/objects/allocation-site-tq-csa.h $(obj)/gen/torque-generated/src/objects/api-callbacks-tq-csa.h $(obj)/gen/torque-generated/src/objects/arguments-tq-csa.h $(obj)/gen/torque-generated/src/objects/bigint-tq-csa.h $(obj)/gen/torque-generated/src/objects/call-site-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/cell-tq-csa.h $(obj)/gen/torque-generated/src/objects/code-tq-csa.h $(obj)/gen/torque-generated/src/objects/contexts-tq-csa.h $(obj)/gen/torque-generated/src/objects/data-handler-tq-csa.h $(obj)/gen/torque-generated/src/objects/debug-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/descriptor-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/feedback-cell-tq-csa.h $(obj)/gen/torque-generated/src/objects/feedback-vector-tq-csa.h $(obj)/gen/torque-generated/src/objects/fixed-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/foreign-tq-csa.h $(obj)/gen/torque-generated/src/objects/free-space-tq-csa.h $(obj)/gen/torque-generated/src/objects/heap-number-tq-csa.h $(obj)/gen/torque-generated/src/objects/heap-object-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-collection-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-function-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-generator-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-promise-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-proxy-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-raw-json-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-regexp-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-shared-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-struct-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq-csa.h $(obj)/gen/torque-generated/src/objects/literal-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/map-tq-csa.h $(obj)/gen/torque-generated/src/objects/megadom-handler-tq-csa.h $(obj)/gen/torque-generated/src/objects/microtask-tq-csa.h $(obj)/gen/torque-generated/src/objects/module-tq-csa.h $(obj)/gen/torque-generated/src/objects/name-tq-csa.h $(obj)/gen/torque-generated/src/objects/oddball-tq-csa.h $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq-csa.h $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq-csa.h $(obj)/gen/torque-generated/src/objects/promise-tq-csa.h $(obj)/gen/torque-generated/src/objects/property-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/property-cell-tq-csa.h $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq-csa.h $(obj)/gen/torque-generated/src/objects/prototype-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/scope-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/script-tq-csa.h $(obj)/gen/torque-generated/src/objects/shared-function-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/source-text-module-tq-csa.h $(obj)/gen/torque-generated/src/objects/string-tq-csa.h $(obj)/gen/torque-generated/src/objects/struct-tq-csa.h $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq-csa.h $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq-csa.h $(obj)/gen/torque-generated/src/objects/synthetic-module-tq-csa.h $(obj)/gen/torque-generated/src/objects/template-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/templates-tq-csa.h $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq-csa.h $(obj)/gen/torque-generated/src/objects/turbofan-types-tq-csa.h $(obj)/gen/torque-generated/test/torque/test-torque-tq-csa.h $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq-csa.h $(obj)/gen/torque-generated/src/builtins/wasm-tq-csa.h $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq-csa.h $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq-csa.h $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-at-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-concat-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-every-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-filter-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-find-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-findindex-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-findlast-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-foreach-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-from-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-isarray-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-join-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-map-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-of-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-reduce-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-reverse-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-shift-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-slice-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-some-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-splice-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-unshift-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-with-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/base-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/boolean-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/builtins-string-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/cast-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/collections-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/constructor-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/conversion-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/convert-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/console-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/data-view-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/frames-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/function-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/ic-callable-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/ic-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/internal-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/iterator-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/math-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/number-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/object-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-all-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-any-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-finally-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-misc-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-race-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-then-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/reflect-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-match-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-search-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-source-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-split-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-test-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-at-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-endswith-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-html-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-includes-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-indexof-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-iterator-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-match-search-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-pad-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-repeat-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-slice-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-startswith-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-substr-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-substring-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-trim-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/symbol-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/torque-internal-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/weak-ref-tq-inl.inc $(obj)/gen/torque-generated/src/ic/handler-configuration-tq-inl.inc $(obj)/gen/torque-generated/src/objects/allocation-site-tq-inl.inc $(obj)/gen/torque-generated/src/objects/api-callbacks-tq-inl.inc $(obj)/gen/torque-generated/src/objects/arguments-tq-inl.inc $(obj)/gen/torque-generated/src/objects/bigint-tq-inl.inc $(obj)/gen/torque-generated/src/objects/call-site-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/cell-tq-inl.inc $(obj)/gen/torque-generated/src/objects/code-tq-inl.inc $(obj)/gen/torque-generated/src/objects/contexts-tq-inl.inc $(obj)/gen/torque-generated/src/objects/data-handler-tq-inl.inc $(obj)/gen/torque-generated/src/objects/debug-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/descriptor-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/feedback-cell-tq-inl.inc $(obj)/gen/torque-generated/src/objects/feedback-vector-tq-inl.inc $(obj)/gen/torque-generated/src/objects/fixed-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/foreign-tq-inl.inc $(obj)/gen/torque-generated/src/objects/free-space-tq-inl.inc $(obj)/gen/torque-generated/src/objects/heap-number-tq-inl.inc $(obj)/gen/torque-generated/src/objects/heap-object-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-collection-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-function-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-generator-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-promise-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-proxy-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-raw-json-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-regexp-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-shared-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-struct-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq-inl.inc $(obj)/gen/torque-generated/src/objects/literal-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/map-tq-inl.inc $(obj)/gen/torque-generated/src/objects/megadom-handler-tq-inl.inc $(obj)/gen/torque-generated/src/objects/microtask-tq-inl.inc $(obj)/gen/torque-generated/src/objects/module-tq-inl.inc $(obj)/gen/torque-generated/src/objects/name-tq-inl.inc $(obj)/gen/torque-generated/src/objects/oddball-tq-inl.inc $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq-inl.inc $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq-inl.inc $(obj)/gen/torque-generated/src/objects/promise-tq-inl.inc $(obj)/gen/torque-generated/src/objects/property-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/property-cell-tq-inl.inc $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq-inl.inc $(obj)/gen/torque-generated/src/objects/prototype-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/scope-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/script-tq-inl.inc $(obj)/gen/torque-generated/src/objects/shared-function-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/source-text-module-tq-inl.inc $(obj)/gen/torque-generated/src/objects/string-tq-inl.inc $(obj)/gen/torque-generated/src/objects/struct-tq-inl.inc $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq-inl.inc $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq-inl.inc $(obj)/gen/torque-generated/src/objects/synthetic-module-tq-inl.inc $(obj)/gen/torque-generated/src/objects/template-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/templates-tq-inl.inc $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq-inl.inc $(obj)/gen/torque-generated/src/objects/turbofan-types-tq-inl.inc $(obj)/gen/torque-generated/test/torque/test-torque-tq-inl.inc $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/wasm-tq-inl.inc $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq-inl.inc $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq.cc $(obj)/gen/torque-generated/src/builtins/array-at-tq.cc $(obj)/gen/torque-generated/src/builtins/array-concat-tq.cc $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq.cc $(obj)/gen/torque-generated/src/builtins/array-every-tq.cc $(obj)/gen/torque-generated/src/builtins/array-filter-tq.cc $(obj)/gen/torque-generated/src/builtins/array-find-tq.cc $(obj)/gen/torque-generated/src/builtins/array-findindex-tq.cc $(obj)/gen/torque-generated/src/builtins/array-findlast-tq.cc $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq.cc $(obj)/gen/torque-generated/src/builtins/array-foreach-tq.cc $(obj)/gen/torque-generated/src/builtins/array-from-tq.cc $(obj)/gen/torque-generated/src/builtins/array-isarray-tq.cc $(obj)/gen/torque-generated/src/builtins/array-join-tq.cc $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq.cc $(obj)/gen/torque-generated/src/builtins/array-map-tq.cc $(obj)/gen/torque-generated/src/builtins/array-of-tq.cc $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq.cc $(obj)/gen/torque-generated/src/builtins/array-reduce-tq.cc $(obj)/gen/torque-generated/src/builtins/array-reverse-tq.cc $(obj)/gen/torque-generated/src/builtins/array-shift-tq.cc $(obj)/gen/torque-generated/src/builtins/array-slice-tq.cc $(obj)/gen/torque-generated/src/builtins/array-some-tq.cc $(obj)/gen/torque-generated/src/builtins/array-splice-tq.cc $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq.cc $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq.cc $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq.cc $(obj)/gen/torque-generated/src/builtins/array-unshift-tq.cc $(obj)/gen/torque-generated/src/builtins/array-with-tq.cc $(obj)/gen/torque-generated/src/builtins/array-tq.cc $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq.cc $(obj)/gen/torque-generated/src/builtins/base-tq.cc $(obj)/gen/torque-generated/src/builtins/boolean-tq.cc $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq.cc $(obj)/gen/torque-generated/src/builtins/builtins-string-tq.cc $(obj)/gen/torque-generated/src/builtins/cast-tq.cc $(obj)/gen/torque-generated/src/builtins/collections-tq.cc $(obj)/gen/torque-generated/src/builtins/constructor-tq.cc $(obj)/gen/torque-generated/src/builtins/conversion-tq.cc $(obj)/gen/torque-generated/src/builtins/convert-tq.cc $(obj)/gen/torque-generated/src/builtins/console-tq.cc $(obj)/gen/torque-generated/src/builtins/data-view-tq.cc $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq.cc $(obj)/gen/torque-generated/src/builtins/frames-tq.cc $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq.cc $(obj)/gen/torque-generated/src/builtins/function-tq.cc $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq.cc $(obj)/gen/torque-generated/src/builtins/ic-callable-tq.cc $(obj)/gen/torque-generated/src/builtins/ic-tq.cc $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq.cc $(obj)/gen/torque-generated/src/builtins/internal-tq.cc $(obj)/gen/torque-generated/src/builtins/iterator-tq.cc $(obj)/gen/torque-generated/src/builtins/math-tq.cc $(obj)/gen/torque-generated/src/builtins/number-tq.cc $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq.cc $(obj)/gen/torque-generated/src/builtins/object-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-all-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-any-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-finally-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-misc-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-race-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-then-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-tq.cc $(obj)/gen/torque-generated/src/builtins/reflect-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-match-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-search-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-source-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-split-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-test-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-tq.cc $(obj)/gen/torque-generated/src/builtins/string-at-tq.cc $(obj)/gen/torque-generated/src/builtins/string-endswith-tq.cc $(obj)/gen/torque-generated/src/builtins/string-html-tq.cc $(obj)/gen/torque-generated/src/builtins/string-includes-tq.cc $(obj)/gen/torque-generated/src/builtins/string-indexof-tq.cc $(obj)/gen/torque-generated/src/builtins/string-iterator-tq.cc $(obj)/gen/torque-generated/src/builtins/string-match-search-tq.cc $(obj)/gen/torque-generated/src/builtins/string-pad-tq.cc $(obj)/gen/torque-generated/src/builtins/string-repeat-tq.cc $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq.cc $(obj)/gen/torque-generated/src/builtins/string-slice-tq.cc $(obj)/gen/torque-generated/src/builtins/string-startswith-tq.cc $(obj)/gen/torque-generated/src/builtins/string-substr-tq.cc $(obj)/gen/torque-generated/src/builtins/string-substring-tq.cc $(obj)/gen/torque-generated/src/builtins/string-trim-tq.cc $(obj)/gen/torque-generated/src/builtins/symbol-tq.cc $(obj)/gen/torque-generated/src/builtins/torque-internal-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-tq.cc $(obj)/gen/torque-generated/src/builtins/weak-ref-tq.cc $(obj)/gen/torque-generated/src/ic/handler-configuration-tq.cc $(obj)/gen/torque-generated/src/objects/allocation-site-tq.cc $(obj)/gen/torque-generated/src/objects/api-callbacks-tq.cc $(obj)/gen/torque-generated/src/objects/arguments-tq.cc $(obj)/gen/torque-generated/src/objects/bigint-tq.cc $(obj)/gen/torque-generated/src/objects/call-site-info-tq.cc $(obj)/gen/torque-generated/src/objects/cell-tq.cc $(obj)/gen/torque-generated/src/objects/code-tq.cc $(obj)/gen/torque-generated/src/objects/contexts-tq.cc $(obj)/gen/torque-generated/src/objects/data-handler-tq.cc $(obj)/gen/torque-generated/src/objects/debug-objects-tq.cc $(obj)/gen/torque-generated/src/objects/descriptor-array-tq.cc $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq.cc $(obj)/gen/torque-generated/src/objects/feedback-cell-tq.cc $(obj)/gen/torque-generated/src/objects/feedback-vector-tq.cc $(obj)/gen/torque-generated/src/objects/fixed-array-tq.cc $(obj)/gen/torque-generated/src/objects/foreign-tq.cc $(obj)/gen/torque-generated/src/objects/free-space-tq.cc $(obj)/gen/torque-generated/src/objects/heap-number-tq.cc $(obj)/gen/torque-generated/src/objects/heap-object-tq.cc $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq.cc $(obj)/gen/torque-generated/src/objects/js-array-tq.cc $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq.cc $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq.cc $(obj)/gen/torque-generated/src/objects/js-collection-tq.cc $(obj)/gen/torque-generated/src/objects/js-function-tq.cc $(obj)/gen/torque-generated/src/objects/js-generator-tq.cc $(obj)/gen/torque-generated/src/objects/js-objects-tq.cc $(obj)/gen/torque-generated/src/objects/js-promise-tq.cc $(obj)/gen/torque-generated/src/objects/js-proxy-tq.cc $(obj)/gen/torque-generated/src/objects/js-raw-json-tq.cc $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq.cc $(obj)/gen/torque-generated/src/objects/js-regexp-tq.cc $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq.cc $(obj)/gen/torque-generated/src/objects/js-shared-array-tq.cc $(obj)/gen/torque-generated/src/objects/js-struct-tq.cc $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq.cc $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq.cc $(obj)/gen/torque-generated/src/objects/literal-objects-tq.cc $(obj)/gen/torque-generated/src/objects/map-tq.cc $(obj)/gen/torque-generated/src/objects/megadom-handler-tq.cc $(obj)/gen/torque-generated/src/objects/microtask-tq.cc $(obj)/gen/torque-generated/src/objects/module-tq.cc $(obj)/gen/torque-generated/src/objects/name-tq.cc $(obj)/gen/torque-generated/src/objects/oddball-tq.cc $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq.cc $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq.cc $(obj)/gen/torque-generated/src/objects/promise-tq.cc $(obj)/gen/torque-generated/src/objects/property-array-tq.cc $(obj)/gen/torque-generated/src/objects/property-cell-tq.cc $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq.cc $(obj)/gen/torque-generated/src/objects/prototype-info-tq.cc $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq.cc $(obj)/gen/torque-generated/src/objects/scope-info-tq.cc $(obj)/gen/torque-generated/src/objects/script-tq.cc $(obj)/gen/torque-generated/src/objects/shared-function-info-tq.cc $(obj)/gen/torque-generated/src/objects/source-text-module-tq.cc $(obj)/gen/torque-generated/src/objects/string-tq.cc $(obj)/gen/torque-generated/src/objects/struct-tq.cc $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq.cc $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq.cc $(obj)/gen/torque-generated/src/objects/synthetic-module-tq.cc $(obj)/gen/torque-generated/src/objects/template-objects-tq.cc $(obj)/gen/torque-generated/src/objects/templates-tq.cc $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq.cc $(obj)/gen/torque-generated/src/objects/turbofan-types-tq.cc $(obj)/gen/torque-generated/test/torque/test-torque-tq.cc $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq.cc $(obj)/gen/torque-generated/src/builtins/wasm-tq.cc $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq.cc $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq.cc $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq.inc $(obj)/gen/torque-generated/src/builtins/array-at-tq.inc $(obj)/gen/torque-generated/src/builtins/array-concat-tq.inc $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq.inc $(obj)/gen/torque-generated/src/builtins/array-every-tq.inc $(obj)/gen/torque-generated/src/builtins/array-filter-tq.inc $(obj)/gen/torque-generated/src/builtins/array-find-tq.inc $(obj)/gen/torque-generated/src/builtins/array-findindex-tq.inc $(obj)/gen/torque-generated/src/builtins/array-findlast-tq.inc $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq.inc $(obj)/gen/torque-generated/src/builtins/array-foreach-tq.inc $(obj)/gen/torque-generated/src/builtins/array-from-tq.inc $(obj)/gen/torque-generated/src/builtins/array-isarray-tq.inc $(obj)/gen/torque-generated/src/builtins/array-join-tq.inc $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq.inc $(obj)/gen/torque-generated/src/builtins/array-map-tq.inc $(obj)/gen/torque-generated/src/builtins/array-of-tq.inc $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq.inc $(obj)/gen/torque-generated/src/builtins/array-reduce-tq.inc $(obj)/gen/torque-generated/src/builtins/array-reverse-tq.inc $(obj)/gen/torque-generated/src/builtins/array-shift-tq.inc $(obj)/gen/torque-generated/src/builtins/array-slice-tq.inc $(obj)/gen/torque-generated/src/builtins/array-some-tq.inc $(obj)/gen/torque-generated/src/builtins/array-splice-tq.inc $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq.inc $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq.inc $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq.inc $(obj)/gen/torque-generated/src/builtins/array-unshift-tq.inc $(obj)/gen/torque-generated/src/builtins/array-with-tq.inc $(obj)/gen/torque-generated/src/builtins/array-tq.inc $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq.inc $(obj)/gen/torque-generated/src/builtins/base-tq.inc $(obj)/gen/torque-generated/src/builtins/boolean-tq.inc $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq.inc $(obj)/gen/torque-generated/src/builtins/builtins-string-tq.inc $(obj)/gen/torque-generated/src/builtins/cast-tq.inc $(obj)/gen/torque-generated/src/builtins/collections-tq.inc $(obj)/gen/torque-generated/src/builtins/constructor-tq.inc $(obj)/gen/torque-generated/src/builtins/conversion-tq.inc $(obj)/gen/torque-generated/src/builtins/convert-tq.inc $(obj)/gen/torque-generated/src/builtins/console-tq.inc $(obj)/gen/torque-generated/src/builtins/data-view-tq.inc $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq.inc $(obj)/gen/torque-generated/src/builtins/frames-tq.inc $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq.inc $(obj)/gen/torque-generated/src/builtins/function-tq.inc $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq.inc $(obj)/gen/torque-generated/src/builtins/ic-callable-tq.inc $(obj)/gen/torque-generated/src/builtins/ic-tq.inc $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq.inc $(obj)/gen/torque-generated/src/builtins/internal-tq.inc $(obj)/gen/torque-generated/src/builtins/iterator-tq.inc $(obj)/gen/torque-generated/src/builtins/math-tq.inc $(obj)/gen/torque-generated/src/builtins/number-tq.inc $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq.inc $(obj)/gen/torque-generated/src/builtins/object-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-all-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-any-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-finally-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-misc-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-race-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-then-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-tq.inc $(obj)/gen/torque-generated/src/builtins/reflect-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-match-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-search-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-source-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-split-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-test-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-tq.inc $(obj)/gen/torque-generated/src/builtins/string-at-tq.inc $(obj)/gen/torque-generated/src/builtins/string-endswith-tq.inc $(obj)/gen/torque-generated/src/builtins/string-html-tq.inc $(obj)/gen/torque-generated/src/builtins/string-includes-tq.inc $(obj)/gen/torque-generated/src/builtins/string-indexof-tq.inc $(obj)/gen/torque-generated/src/builtins/string-iterator-tq.inc $(obj)/gen/torque-generated/src/builtins/string-match-search-tq.inc $(obj)/gen/torque-generated/src/builtins/string-pad-tq.inc $(obj)/gen/torque-generated/src/builtins/string-repeat-tq.inc $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq.inc $(obj)/gen/torque-generated/src/builtins/string-slice-tq.inc $(obj)/gen/torque-generated/src/builtins/string-startswith-tq.inc $(obj)/gen/torque-generated/src/builtins/string-substr-tq.inc $(obj)/gen/torque-generated/src/builtins/string-substring-tq.inc $(obj)/gen/torque-generated/src/builtins/string-trim-tq.inc $(obj)/gen/torque-generated/src/builtins/symbol-tq.inc $(obj)/gen/torque-generated/src/builtins/torque-internal-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-tq.inc $(obj)/gen/torque-generated/src/builtins/weak-ref-tq.inc $(obj)/gen/torque-generated/src/ic/handler-configuration-tq.inc $(obj)/gen/torque-generated/src/objects/allocation-site-tq.inc $(obj)/gen/torque-generated/src/objects/api-callbacks-tq.inc $(obj)/gen/torque-generated/src/objects/arguments-tq.inc $(obj)/gen/torque-generated/src/objects/bigint-tq.inc $(obj)/gen/torque-generated/src/objects/call-site-info-tq.inc $(obj)/gen/torque-generated/src/objects/cell-tq.inc $(obj)/gen/torque-generated/src/objects/code-tq.inc $(obj)/gen/torque-generated/src/objects/contexts-tq.inc $(obj)/gen/torque-generated/src/objects/data-handler-tq.inc $(obj)/gen/torque-generated/src/objects/debug-objects-tq.inc $(obj)/gen/torque-generated/src/objects/descriptor-array-tq.inc $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq.inc $(obj)/gen/torque-generated/src/objects/feedback-cell-tq.inc $(obj)/gen/torque-generated/src/objects/feedback-vector-tq.inc $(obj)/gen/torque-generated/src/objects/fixed-array-tq.inc $(obj)/gen/torque-generated/src/objects/foreign-tq.inc $(obj)/gen/torque-generated/src/objects/free-space-tq.inc $(obj)/gen/torque-generated/src/objects/heap-number-tq.inc $(obj)/gen/torque-generated/src/objects/heap-object-tq.inc $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq.inc $(obj)/gen/torque-generated/src/objects/js-array-tq.inc $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq.inc $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq.inc $(obj)/gen/torque-generated/src/objects/js-collection-tq.inc $(obj)/gen/torque-generated/src/objects/js-function-tq.inc $(obj)/gen/torque-generated/src/objects/js-generator-tq.inc $(obj)/gen/torque-generated/src/objects/js-objects-tq.inc $(obj)/gen/torque-generated/src/objects/js-promise-tq.inc $(obj)/gen/torque-generated/src/objects/js-proxy-tq.inc $(obj)/gen/torque-generated/src/objects/js-raw-json-tq.inc $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq.inc $(obj)/gen/torque-generated/src/objects/js-regexp-tq.inc $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq.inc $(obj)/gen/torque-generated/src/objects/js-shared-array-tq.inc $(obj)/gen/torque-generated/src/objects/js-struct-tq.inc $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq.inc $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq.inc $(obj)/gen/torque-generated/src/objects/literal-objects-tq.inc $(obj)/gen/torque-generated/src/objects/map-tq.inc $(obj)/gen/torque-generated/src/objects/megadom-handler-tq.inc $(obj)/gen/torque-generated/src/objects/microtask-tq.inc $(obj)/gen/torque-generated/src/objects/module-tq.inc $(obj)/gen/torque-generated/src/objects/name-tq.inc $(obj)/gen/torque-generated/src/objects/oddball-tq.inc $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq.inc $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq.inc $(obj)/gen/torque-generated/src/objects/promise-tq.inc $(obj)/gen/torque-generated/src/objects/property-array-tq.inc $(obj)/gen/torque-generated/src/objects/property-cell-tq.inc $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq.inc $(obj)/gen/torque-generated/src/objects/prototype-info-tq.inc $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq.inc $(obj)/gen/torque-generated/src/objects/scope-info-tq.inc $(obj)/gen/torque-generated/src/objects/script-tq.inc $(obj)/gen/torque-generated/src/objects/shared-function-info-tq.inc $(obj)/gen/torque-generated/src/objects/source-text-module-tq.inc $(obj)/gen/torque-generated/src/objects/string-tq.inc $(obj)/gen/torque-generated/src/objects/struct-tq.inc $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq.inc $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq.inc $(obj)/gen/torque-generated/src/objects/synthetic-module-tq.inc $(obj)/gen/torque-generated/src/objects/template-objects-tq.inc $(obj)/gen/torque-generated/src/objects/templates-tq.inc $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq.inc $(obj)/gen/torque-generated/src/objects/turbofan-types-tq.inc $(obj)/gen/torque-generated/test/torque/test-torque-tq.inc $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq.inc $(obj)/gen/torque-generated/src/builtins/wasm-tq.inc $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq.inc $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq.inc
+action__root_repo_tools_v8_gypfiles_v8_gyp_run_torque_target_run_torque_action_outputs := $(obj)/gen/torque-generated/bit-fields.h $(obj)/gen/torque-generated/builtin-definitions.h $(obj)/gen/torque-generated/class-debug-readers.cc $(obj)/gen/torque-generated/class-debug-readers.h $(obj)/gen/torque-generated/class-forward-declarations.h $(obj)/gen/torque-generated/class-verifiers.cc $(obj)/gen/torque-generated/class-verifiers.h $(obj)/gen/torque-generated/csa-types.h $(obj)/gen/torque-generated/debug-macros.cc $(obj)/gen/torque-generated/debug-macros.h $(obj)/gen/torque-generated/enum-verifiers.cc $(obj)/gen/torque-generated/exported-macros-assembler.cc $(obj)/gen/torque-generated/exported-macros-assembler.h $(obj)/gen/torque-generated/factory.cc $(obj)/gen/torque-generated/factory.inc $(obj)/gen/torque-generated/instance-types.h $(obj)/gen/torque-generated/interface-descriptors.inc $(obj)/gen/torque-generated/objects-body-descriptors-inl.inc $(obj)/gen/torque-generated/objects-printer.cc $(obj)/gen/torque-generated/visitor-lists.h $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-at-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-concat-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-every-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-filter-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-find-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-findindex-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-findlast-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-foreach-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-from-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-isarray-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-join-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-map-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-of-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-reduce-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-reverse-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-shift-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-slice-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-some-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-splice-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-unshift-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-with-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/array-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/base-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/boolean-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/builtins-string-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/cast-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/collections-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/constructor-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/conversion-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/convert-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/console-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/data-view-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/frames-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/function-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/ic-callable-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/ic-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/internal-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/iterator-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/math-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/number-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/object-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-all-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-any-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-finally-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-misc-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-race-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-then-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/proxy-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/reflect-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-match-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-search-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-source-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-split-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-test-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/regexp-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-at-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-endswith-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-html-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-includes-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-indexof-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-iterator-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-match-search-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-pad-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-repeat-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-slice-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-startswith-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-substr-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-substring-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/string-trim-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/symbol-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/torque-internal-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/typed-array-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/weak-ref-tq-csa.cc $(obj)/gen/torque-generated/src/ic/handler-configuration-tq-csa.cc $(obj)/gen/torque-generated/src/objects/allocation-site-tq-csa.cc $(obj)/gen/torque-generated/src/objects/api-callbacks-tq-csa.cc $(obj)/gen/torque-generated/src/objects/arguments-tq-csa.cc $(obj)/gen/torque-generated/src/objects/bigint-tq-csa.cc $(obj)/gen/torque-generated/src/objects/call-site-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/cell-tq-csa.cc $(obj)/gen/torque-generated/src/objects/code-tq-csa.cc $(obj)/gen/torque-generated/src/objects/contexts-tq-csa.cc $(obj)/gen/torque-generated/src/objects/data-handler-tq-csa.cc $(obj)/gen/torque-generated/src/objects/debug-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/descriptor-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/feedback-cell-tq-csa.cc $(obj)/gen/torque-generated/src/objects/feedback-vector-tq-csa.cc $(obj)/gen/torque-generated/src/objects/fixed-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/foreign-tq-csa.cc $(obj)/gen/torque-generated/src/objects/free-space-tq-csa.cc $(obj)/gen/torque-generated/src/objects/heap-number-tq-csa.cc $(obj)/gen/torque-generated/src/objects/heap-object-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-collection-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-function-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-generator-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-promise-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-proxy-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-raw-json-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-regexp-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-shared-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-struct-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq-csa.cc $(obj)/gen/torque-generated/src/objects/literal-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/map-tq-csa.cc $(obj)/gen/torque-generated/src/objects/megadom-handler-tq-csa.cc $(obj)/gen/torque-generated/src/objects/microtask-tq-csa.cc $(obj)/gen/torque-generated/src/objects/module-tq-csa.cc $(obj)/gen/torque-generated/src/objects/name-tq-csa.cc $(obj)/gen/torque-generated/src/objects/oddball-tq-csa.cc $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq-csa.cc $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq-csa.cc $(obj)/gen/torque-generated/src/objects/promise-tq-csa.cc $(obj)/gen/torque-generated/src/objects/property-array-tq-csa.cc $(obj)/gen/torque-generated/src/objects/property-cell-tq-csa.cc $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq-csa.cc $(obj)/gen/torque-generated/src/objects/prototype-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/scope-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/script-tq-csa.cc $(obj)/gen/torque-generated/src/objects/shared-function-info-tq-csa.cc $(obj)/gen/torque-generated/src/objects/source-text-module-tq-csa.cc $(obj)/gen/torque-generated/src/objects/string-tq-csa.cc $(obj)/gen/torque-generated/src/objects/struct-tq-csa.cc $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq-csa.cc $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq-csa.cc $(obj)/gen/torque-generated/src/objects/synthetic-module-tq-csa.cc $(obj)/gen/torque-generated/src/objects/template-objects-tq-csa.cc $(obj)/gen/torque-generated/src/objects/templates-tq-csa.cc $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq-csa.cc $(obj)/gen/torque-generated/src/objects/turbofan-types-tq-csa.cc $(obj)/gen/torque-generated/test/torque/test-torque-tq-csa.cc $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/wasm-tq-csa.cc $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq-csa.cc $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq-csa.cc $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-at-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-concat-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-every-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-filter-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-find-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-findindex-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-findlast-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-foreach-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-from-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-isarray-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-join-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-map-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-of-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-reduce-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-reverse-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-shift-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-slice-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-some-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-splice-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-unshift-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-with-tq-csa.h $(obj)/gen/torque-generated/src/builtins/array-tq-csa.h $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq-csa.h $(obj)/gen/torque-generated/src/builtins/base-tq-csa.h $(obj)/gen/torque-generated/src/builtins/boolean-tq-csa.h $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq-csa.h $(obj)/gen/torque-generated/src/builtins/builtins-string-tq-csa.h $(obj)/gen/torque-generated/src/builtins/cast-tq-csa.h $(obj)/gen/torque-generated/src/builtins/collections-tq-csa.h $(obj)/gen/torque-generated/src/builtins/constructor-tq-csa.h $(obj)/gen/torque-generated/src/builtins/conversion-tq-csa.h $(obj)/gen/torque-generated/src/builtins/convert-tq-csa.h $(obj)/gen/torque-generated/src/builtins/console-tq-csa.h $(obj)/gen/torque-generated/src/builtins/data-view-tq-csa.h $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq-csa.h $(obj)/gen/torque-generated/src/builtins/frames-tq-csa.h $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq-csa.h $(obj)/gen/torque-generated/src/builtins/function-tq-csa.h $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq-csa.h $(obj)/gen/torque-generated/src/builtins/ic-callable-tq-csa.h $(obj)/gen/torque-generated/src/builtins/ic-tq-csa.h $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq-csa.h $(obj)/gen/torque-generated/src/builtins/internal-tq-csa.h $(obj)/gen/torque-generated/src/builtins/iterator-tq-csa.h $(obj)/gen/torque-generated/src/builtins/math-tq-csa.h $(obj)/gen/torque-generated/src/builtins/number-tq-csa.h $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq-csa.h $(obj)/gen/torque-generated/src/builtins/object-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-all-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-any-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-finally-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-misc-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-race-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-then-tq-csa.h $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq-csa.h $(obj)/gen/torque-generated/src/builtins/proxy-tq-csa.h $(obj)/gen/torque-generated/src/builtins/reflect-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-match-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-search-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-source-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-split-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-test-tq-csa.h $(obj)/gen/torque-generated/src/builtins/regexp-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-at-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-endswith-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-html-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-includes-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-indexof-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-iterator-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-match-search-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-pad-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-repeat-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-slice-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-startswith-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-substr-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-substring-tq-csa.h $(obj)/gen/torque-generated/src/builtins/string-trim-tq-csa.h $(obj)/gen/torque-generated/src/builtins/symbol-tq-csa.h $(obj)/gen/torque-generated/src/builtins/torque-internal-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq-csa.h $(obj)/gen/torque-generated/src/builtins/typed-array-tq-csa.h $(obj)/gen/torque-generated/src/builtins/weak-ref-tq-csa.h $(obj)/gen/torque-generated/src/ic/handler-configuration-tq-csa.h $(obj)/gen/torque-generated/src/objects/allocation-site-tq-csa.h $(obj)/gen/torque-generated/src/objects/api-callbacks-tq-csa.h $(obj)/gen/torque-generated/src/objects/arguments-tq-csa.h $(obj)/gen/torque-generated/src/objects/bigint-tq-csa.h $(obj)/gen/torque-generated/src/objects/call-site-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/cell-tq-csa.h $(obj)/gen/torque-generated/src/objects/code-tq-csa.h $(obj)/gen/torque-generated/src/objects/contexts-tq-csa.h $(obj)/gen/torque-generated/src/objects/data-handler-tq-csa.h $(obj)/gen/torque-generated/src/objects/debug-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/descriptor-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/feedback-cell-tq-csa.h $(obj)/gen/torque-generated/src/objects/feedback-vector-tq-csa.h $(obj)/gen/torque-generated/src/objects/fixed-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/foreign-tq-csa.h $(obj)/gen/torque-generated/src/objects/free-space-tq-csa.h $(obj)/gen/torque-generated/src/objects/heap-number-tq-csa.h $(obj)/gen/torque-generated/src/objects/heap-object-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-collection-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-function-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-generator-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-promise-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-proxy-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-raw-json-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-regexp-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-shared-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-struct-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq-csa.h $(obj)/gen/torque-generated/src/objects/literal-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/map-tq-csa.h $(obj)/gen/torque-generated/src/objects/megadom-handler-tq-csa.h $(obj)/gen/torque-generated/src/objects/microtask-tq-csa.h $(obj)/gen/torque-generated/src/objects/module-tq-csa.h $(obj)/gen/torque-generated/src/objects/name-tq-csa.h $(obj)/gen/torque-generated/src/objects/oddball-tq-csa.h $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq-csa.h $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq-csa.h $(obj)/gen/torque-generated/src/objects/promise-tq-csa.h $(obj)/gen/torque-generated/src/objects/property-array-tq-csa.h $(obj)/gen/torque-generated/src/objects/property-cell-tq-csa.h $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq-csa.h $(obj)/gen/torque-generated/src/objects/prototype-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/scope-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/script-tq-csa.h $(obj)/gen/torque-generated/src/objects/shared-function-info-tq-csa.h $(obj)/gen/torque-generated/src/objects/source-text-module-tq-csa.h $(obj)/gen/torque-generated/src/objects/string-tq-csa.h $(obj)/gen/torque-generated/src/objects/struct-tq-csa.h $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq-csa.h $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq-csa.h $(obj)/gen/torque-generated/src/objects/synthetic-module-tq-csa.h $(obj)/gen/torque-generated/src/objects/template-objects-tq-csa.h $(obj)/gen/torque-generated/src/objects/templates-tq-csa.h $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq-csa.h $(obj)/gen/torque-generated/src/objects/turbofan-types-tq-csa.h $(obj)/gen/torque-generated/test/torque/test-torque-tq-csa.h $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq-csa.h $(obj)/gen/torque-generated/src/builtins/wasm-tq-csa.h $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq-csa.h $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq-csa.h $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-at-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-concat-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-every-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-filter-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-find-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-findindex-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-findlast-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-foreach-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-from-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-isarray-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-join-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-map-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-of-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-reduce-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-reverse-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-shift-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-slice-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-some-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-splice-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-unshift-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-with-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/array-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/base-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/boolean-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/builtins-string-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/cast-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/collections-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/constructor-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/conversion-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/convert-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/console-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/data-view-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/frames-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/function-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/ic-callable-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/ic-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/internal-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/iterator-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/math-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/number-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/object-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-all-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-any-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-finally-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-misc-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-race-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-then-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/proxy-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/reflect-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-match-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-search-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-source-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-split-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-test-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/regexp-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-at-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-endswith-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-html-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-includes-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-indexof-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-iterator-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-match-search-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-pad-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-repeat-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-slice-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-startswith-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-substr-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-substring-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/string-trim-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/symbol-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/torque-internal-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/typed-array-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/weak-ref-tq-inl.inc $(obj)/gen/torque-generated/src/ic/handler-configuration-tq-inl.inc $(obj)/gen/torque-generated/src/objects/allocation-site-tq-inl.inc $(obj)/gen/torque-generated/src/objects/api-callbacks-tq-inl.inc $(obj)/gen/torque-generated/src/objects/arguments-tq-inl.inc $(obj)/gen/torque-generated/src/objects/bigint-tq-inl.inc $(obj)/gen/torque-generated/src/objects/call-site-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/cell-tq-inl.inc $(obj)/gen/torque-generated/src/objects/code-tq-inl.inc $(obj)/gen/torque-generated/src/objects/contexts-tq-inl.inc $(obj)/gen/torque-generated/src/objects/data-handler-tq-inl.inc $(obj)/gen/torque-generated/src/objects/debug-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/descriptor-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/feedback-cell-tq-inl.inc $(obj)/gen/torque-generated/src/objects/feedback-vector-tq-inl.inc $(obj)/gen/torque-generated/src/objects/fixed-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/foreign-tq-inl.inc $(obj)/gen/torque-generated/src/objects/free-space-tq-inl.inc $(obj)/gen/torque-generated/src/objects/heap-number-tq-inl.inc $(obj)/gen/torque-generated/src/objects/heap-object-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-collection-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-function-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-generator-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-promise-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-proxy-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-raw-json-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-regexp-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-shared-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-struct-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq-inl.inc $(obj)/gen/torque-generated/src/objects/literal-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/map-tq-inl.inc $(obj)/gen/torque-generated/src/objects/megadom-handler-tq-inl.inc $(obj)/gen/torque-generated/src/objects/microtask-tq-inl.inc $(obj)/gen/torque-generated/src/objects/module-tq-inl.inc $(obj)/gen/torque-generated/src/objects/name-tq-inl.inc $(obj)/gen/torque-generated/src/objects/oddball-tq-inl.inc $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq-inl.inc $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq-inl.inc $(obj)/gen/torque-generated/src/objects/promise-tq-inl.inc $(obj)/gen/torque-generated/src/objects/property-array-tq-inl.inc $(obj)/gen/torque-generated/src/objects/property-cell-tq-inl.inc $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq-inl.inc $(obj)/gen/torque-generated/src/objects/prototype-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/scope-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/script-tq-inl.inc $(obj)/gen/torque-generated/src/objects/shared-function-info-tq-inl.inc $(obj)/gen/torque-generated/src/objects/source-text-module-tq-inl.inc $(obj)/gen/torque-generated/src/objects/string-tq-inl.inc $(obj)/gen/torque-generated/src/objects/struct-tq-inl.inc $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq-inl.inc $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq-inl.inc $(obj)/gen/torque-generated/src/objects/synthetic-module-tq-inl.inc $(obj)/gen/torque-generated/src/objects/template-objects-tq-inl.inc $(obj)/gen/torque-generated/src/objects/templates-tq-inl.inc $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq-inl.inc $(obj)/gen/torque-generated/src/objects/turbofan-types-tq-inl.inc $(obj)/gen/torque-generated/test/torque/test-torque-tq-inl.inc $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/wasm-tq-inl.inc $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq-inl.inc $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq-inl.inc $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq.cc $(obj)/gen/torque-generated/src/builtins/array-at-tq.cc $(obj)/gen/torque-generated/src/builtins/array-concat-tq.cc $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq.cc $(obj)/gen/torque-generated/src/builtins/array-every-tq.cc $(obj)/gen/torque-generated/src/builtins/array-filter-tq.cc $(obj)/gen/torque-generated/src/builtins/array-find-tq.cc $(obj)/gen/torque-generated/src/builtins/array-findindex-tq.cc $(obj)/gen/torque-generated/src/builtins/array-findlast-tq.cc $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq.cc $(obj)/gen/torque-generated/src/builtins/array-foreach-tq.cc $(obj)/gen/torque-generated/src/builtins/array-from-tq.cc $(obj)/gen/torque-generated/src/builtins/array-isarray-tq.cc $(obj)/gen/torque-generated/src/builtins/array-join-tq.cc $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq.cc $(obj)/gen/torque-generated/src/builtins/array-map-tq.cc $(obj)/gen/torque-generated/src/builtins/array-of-tq.cc $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq.cc $(obj)/gen/torque-generated/src/builtins/array-reduce-tq.cc $(obj)/gen/torque-generated/src/builtins/array-reverse-tq.cc $(obj)/gen/torque-generated/src/builtins/array-shift-tq.cc $(obj)/gen/torque-generated/src/builtins/array-slice-tq.cc $(obj)/gen/torque-generated/src/builtins/array-some-tq.cc $(obj)/gen/torque-generated/src/builtins/array-splice-tq.cc $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq.cc $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq.cc $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq.cc $(obj)/gen/torque-generated/src/builtins/array-unshift-tq.cc $(obj)/gen/torque-generated/src/builtins/array-with-tq.cc $(obj)/gen/torque-generated/src/builtins/array-tq.cc $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq.cc $(obj)/gen/torque-generated/src/builtins/base-tq.cc $(obj)/gen/torque-generated/src/builtins/boolean-tq.cc $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq.cc $(obj)/gen/torque-generated/src/builtins/builtins-string-tq.cc $(obj)/gen/torque-generated/src/builtins/cast-tq.cc $(obj)/gen/torque-generated/src/builtins/collections-tq.cc $(obj)/gen/torque-generated/src/builtins/constructor-tq.cc $(obj)/gen/torque-generated/src/builtins/conversion-tq.cc $(obj)/gen/torque-generated/src/builtins/convert-tq.cc $(obj)/gen/torque-generated/src/builtins/console-tq.cc $(obj)/gen/torque-generated/src/builtins/data-view-tq.cc $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq.cc $(obj)/gen/torque-generated/src/builtins/frames-tq.cc $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq.cc $(obj)/gen/torque-generated/src/builtins/function-tq.cc $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq.cc $(obj)/gen/torque-generated/src/builtins/ic-callable-tq.cc $(obj)/gen/torque-generated/src/builtins/ic-tq.cc $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq.cc $(obj)/gen/torque-generated/src/builtins/internal-tq.cc $(obj)/gen/torque-generated/src/builtins/iterator-tq.cc $(obj)/gen/torque-generated/src/builtins/math-tq.cc $(obj)/gen/torque-generated/src/builtins/number-tq.cc $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq.cc $(obj)/gen/torque-generated/src/builtins/object-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-all-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-any-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-finally-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-misc-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-race-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-then-tq.cc $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq.cc $(obj)/gen/torque-generated/src/builtins/proxy-tq.cc $(obj)/gen/torque-generated/src/builtins/reflect-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-match-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-search-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-source-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-split-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-test-tq.cc $(obj)/gen/torque-generated/src/builtins/regexp-tq.cc $(obj)/gen/torque-generated/src/builtins/string-at-tq.cc $(obj)/gen/torque-generated/src/builtins/string-endswith-tq.cc $(obj)/gen/torque-generated/src/builtins/string-html-tq.cc $(obj)/gen/torque-generated/src/builtins/string-includes-tq.cc $(obj)/gen/torque-generated/src/builtins/string-indexof-tq.cc $(obj)/gen/torque-generated/src/builtins/string-iterator-tq.cc $(obj)/gen/torque-generated/src/builtins/string-match-search-tq.cc $(obj)/gen/torque-generated/src/builtins/string-pad-tq.cc $(obj)/gen/torque-generated/src/builtins/string-repeat-tq.cc $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq.cc $(obj)/gen/torque-generated/src/builtins/string-slice-tq.cc $(obj)/gen/torque-generated/src/builtins/string-startswith-tq.cc $(obj)/gen/torque-generated/src/builtins/string-substr-tq.cc $(obj)/gen/torque-generated/src/builtins/string-substring-tq.cc $(obj)/gen/torque-generated/src/builtins/string-trim-tq.cc $(obj)/gen/torque-generated/src/builtins/symbol-tq.cc $(obj)/gen/torque-generated/src/builtins/torque-internal-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq.cc $(obj)/gen/torque-generated/src/builtins/typed-array-tq.cc $(obj)/gen/torque-generated/src/builtins/weak-ref-tq.cc $(obj)/gen/torque-generated/src/ic/handler-configuration-tq.cc $(obj)/gen/torque-generated/src/objects/allocation-site-tq.cc $(obj)/gen/torque-generated/src/objects/api-callbacks-tq.cc $(obj)/gen/torque-generated/src/objects/arguments-tq.cc $(obj)/gen/torque-generated/src/objects/bigint-tq.cc $(obj)/gen/torque-generated/src/objects/call-site-info-tq.cc $(obj)/gen/torque-generated/src/objects/cell-tq.cc $(obj)/gen/torque-generated/src/objects/code-tq.cc $(obj)/gen/torque-generated/src/objects/contexts-tq.cc $(obj)/gen/torque-generated/src/objects/data-handler-tq.cc $(obj)/gen/torque-generated/src/objects/debug-objects-tq.cc $(obj)/gen/torque-generated/src/objects/descriptor-array-tq.cc $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq.cc $(obj)/gen/torque-generated/src/objects/feedback-cell-tq.cc $(obj)/gen/torque-generated/src/objects/feedback-vector-tq.cc $(obj)/gen/torque-generated/src/objects/fixed-array-tq.cc $(obj)/gen/torque-generated/src/objects/foreign-tq.cc $(obj)/gen/torque-generated/src/objects/free-space-tq.cc $(obj)/gen/torque-generated/src/objects/heap-number-tq.cc $(obj)/gen/torque-generated/src/objects/heap-object-tq.cc $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq.cc $(obj)/gen/torque-generated/src/objects/js-array-tq.cc $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq.cc $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq.cc $(obj)/gen/torque-generated/src/objects/js-collection-tq.cc $(obj)/gen/torque-generated/src/objects/js-function-tq.cc $(obj)/gen/torque-generated/src/objects/js-generator-tq.cc $(obj)/gen/torque-generated/src/objects/js-objects-tq.cc $(obj)/gen/torque-generated/src/objects/js-promise-tq.cc $(obj)/gen/torque-generated/src/objects/js-proxy-tq.cc $(obj)/gen/torque-generated/src/objects/js-raw-json-tq.cc $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq.cc $(obj)/gen/torque-generated/src/objects/js-regexp-tq.cc $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq.cc $(obj)/gen/torque-generated/src/objects/js-shared-array-tq.cc $(obj)/gen/torque-generated/src/objects/js-struct-tq.cc $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq.cc $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq.cc $(obj)/gen/torque-generated/src/objects/literal-objects-tq.cc $(obj)/gen/torque-generated/src/objects/map-tq.cc $(obj)/gen/torque-generated/src/objects/megadom-handler-tq.cc $(obj)/gen/torque-generated/src/objects/microtask-tq.cc $(obj)/gen/torque-generated/src/objects/module-tq.cc $(obj)/gen/torque-generated/src/objects/name-tq.cc $(obj)/gen/torque-generated/src/objects/oddball-tq.cc $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq.cc $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq.cc $(obj)/gen/torque-generated/src/objects/promise-tq.cc $(obj)/gen/torque-generated/src/objects/property-array-tq.cc $(obj)/gen/torque-generated/src/objects/property-cell-tq.cc $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq.cc $(obj)/gen/torque-generated/src/objects/prototype-info-tq.cc $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq.cc $(obj)/gen/torque-generated/src/objects/scope-info-tq.cc $(obj)/gen/torque-generated/src/objects/script-tq.cc $(obj)/gen/torque-generated/src/objects/shared-function-info-tq.cc $(obj)/gen/torque-generated/src/objects/source-text-module-tq.cc $(obj)/gen/torque-generated/src/objects/string-tq.cc $(obj)/gen/torque-generated/src/objects/struct-tq.cc $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq.cc $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq.cc $(obj)/gen/torque-generated/src/objects/synthetic-module-tq.cc $(obj)/gen/torque-generated/src/objects/template-objects-tq.cc $(obj)/gen/torque-generated/src/objects/templates-tq.cc $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq.cc $(obj)/gen/torque-generated/src/objects/turbofan-types-tq.cc $(obj)/gen/torque-generated/test/torque/test-torque-tq.cc $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq.cc $(obj)/gen/torque-generated/src/builtins/wasm-tq.cc $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq.cc $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq.cc $(obj)/gen/torque-generated/src/builtins/aggregate-error-tq.inc $(obj)/gen/torque-generated/src/builtins/array-at-tq.inc $(obj)/gen/torque-generated/src/builtins/array-concat-tq.inc $(obj)/gen/torque-generated/src/builtins/array-copywithin-tq.inc $(obj)/gen/torque-generated/src/builtins/array-every-tq.inc $(obj)/gen/torque-generated/src/builtins/array-filter-tq.inc $(obj)/gen/torque-generated/src/builtins/array-find-tq.inc $(obj)/gen/torque-generated/src/builtins/array-findindex-tq.inc $(obj)/gen/torque-generated/src/builtins/array-findlast-tq.inc $(obj)/gen/torque-generated/src/builtins/array-findlastindex-tq.inc $(obj)/gen/torque-generated/src/builtins/array-foreach-tq.inc $(obj)/gen/torque-generated/src/builtins/array-from-tq.inc $(obj)/gen/torque-generated/src/builtins/array-isarray-tq.inc $(obj)/gen/torque-generated/src/builtins/array-join-tq.inc $(obj)/gen/torque-generated/src/builtins/array-lastindexof-tq.inc $(obj)/gen/torque-generated/src/builtins/array-map-tq.inc $(obj)/gen/torque-generated/src/builtins/array-of-tq.inc $(obj)/gen/torque-generated/src/builtins/array-reduce-right-tq.inc $(obj)/gen/torque-generated/src/builtins/array-reduce-tq.inc $(obj)/gen/torque-generated/src/builtins/array-reverse-tq.inc $(obj)/gen/torque-generated/src/builtins/array-shift-tq.inc $(obj)/gen/torque-generated/src/builtins/array-slice-tq.inc $(obj)/gen/torque-generated/src/builtins/array-some-tq.inc $(obj)/gen/torque-generated/src/builtins/array-splice-tq.inc $(obj)/gen/torque-generated/src/builtins/array-to-reversed-tq.inc $(obj)/gen/torque-generated/src/builtins/array-to-sorted-tq.inc $(obj)/gen/torque-generated/src/builtins/array-to-spliced-tq.inc $(obj)/gen/torque-generated/src/builtins/array-unshift-tq.inc $(obj)/gen/torque-generated/src/builtins/array-with-tq.inc $(obj)/gen/torque-generated/src/builtins/array-tq.inc $(obj)/gen/torque-generated/src/builtins/arraybuffer-tq.inc $(obj)/gen/torque-generated/src/builtins/base-tq.inc $(obj)/gen/torque-generated/src/builtins/boolean-tq.inc $(obj)/gen/torque-generated/src/builtins/builtins-bigint-tq.inc $(obj)/gen/torque-generated/src/builtins/builtins-string-tq.inc $(obj)/gen/torque-generated/src/builtins/cast-tq.inc $(obj)/gen/torque-generated/src/builtins/collections-tq.inc $(obj)/gen/torque-generated/src/builtins/constructor-tq.inc $(obj)/gen/torque-generated/src/builtins/conversion-tq.inc $(obj)/gen/torque-generated/src/builtins/convert-tq.inc $(obj)/gen/torque-generated/src/builtins/console-tq.inc $(obj)/gen/torque-generated/src/builtins/data-view-tq.inc $(obj)/gen/torque-generated/src/builtins/finalization-registry-tq.inc $(obj)/gen/torque-generated/src/builtins/frames-tq.inc $(obj)/gen/torque-generated/src/builtins/frame-arguments-tq.inc $(obj)/gen/torque-generated/src/builtins/function-tq.inc $(obj)/gen/torque-generated/src/builtins/growable-fixed-array-tq.inc $(obj)/gen/torque-generated/src/builtins/ic-callable-tq.inc $(obj)/gen/torque-generated/src/builtins/ic-tq.inc $(obj)/gen/torque-generated/src/builtins/internal-coverage-tq.inc $(obj)/gen/torque-generated/src/builtins/internal-tq.inc $(obj)/gen/torque-generated/src/builtins/iterator-tq.inc $(obj)/gen/torque-generated/src/builtins/math-tq.inc $(obj)/gen/torque-generated/src/builtins/number-tq.inc $(obj)/gen/torque-generated/src/builtins/object-fromentries-tq.inc $(obj)/gen/torque-generated/src/builtins/object-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-abstract-operations-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-all-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-all-element-closure-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-any-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-constructor-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-finally-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-misc-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-race-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-reaction-job-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-resolve-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-then-tq.inc $(obj)/gen/torque-generated/src/builtins/promise-jobs-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-constructor-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-delete-property-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-get-property-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-has-property-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-is-extensible-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-revocable-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-revoke-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-set-property-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq.inc $(obj)/gen/torque-generated/src/builtins/proxy-tq.inc $(obj)/gen/torque-generated/src/builtins/reflect-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-exec-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-match-all-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-match-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-replace-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-search-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-source-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-split-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-test-tq.inc $(obj)/gen/torque-generated/src/builtins/regexp-tq.inc $(obj)/gen/torque-generated/src/builtins/string-at-tq.inc $(obj)/gen/torque-generated/src/builtins/string-endswith-tq.inc $(obj)/gen/torque-generated/src/builtins/string-html-tq.inc $(obj)/gen/torque-generated/src/builtins/string-includes-tq.inc $(obj)/gen/torque-generated/src/builtins/string-indexof-tq.inc $(obj)/gen/torque-generated/src/builtins/string-iterator-tq.inc $(obj)/gen/torque-generated/src/builtins/string-match-search-tq.inc $(obj)/gen/torque-generated/src/builtins/string-pad-tq.inc $(obj)/gen/torque-generated/src/builtins/string-repeat-tq.inc $(obj)/gen/torque-generated/src/builtins/string-replaceall-tq.inc $(obj)/gen/torque-generated/src/builtins/string-slice-tq.inc $(obj)/gen/torque-generated/src/builtins/string-startswith-tq.inc $(obj)/gen/torque-generated/src/builtins/string-substr-tq.inc $(obj)/gen/torque-generated/src/builtins/string-substring-tq.inc $(obj)/gen/torque-generated/src/builtins/string-trim-tq.inc $(obj)/gen/torque-generated/src/builtins/symbol-tq.inc $(obj)/gen/torque-generated/src/builtins/torque-internal-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-at-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-every-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-entries-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-filter-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-find-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findindex-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findlast-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-foreach-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-from-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-keys-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-of-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-reduce-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-reduceright-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-set-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-slice-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-some-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-sort-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-subarray-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-values-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-with-tq.inc $(obj)/gen/torque-generated/src/builtins/typed-array-tq.inc $(obj)/gen/torque-generated/src/builtins/weak-ref-tq.inc $(obj)/gen/torque-generated/src/ic/handler-configuration-tq.inc $(obj)/gen/torque-generated/src/objects/allocation-site-tq.inc $(obj)/gen/torque-generated/src/objects/api-callbacks-tq.inc $(obj)/gen/torque-generated/src/objects/arguments-tq.inc $(obj)/gen/torque-generated/src/objects/bigint-tq.inc $(obj)/gen/torque-generated/src/objects/call-site-info-tq.inc $(obj)/gen/torque-generated/src/objects/cell-tq.inc $(obj)/gen/torque-generated/src/objects/code-tq.inc $(obj)/gen/torque-generated/src/objects/contexts-tq.inc $(obj)/gen/torque-generated/src/objects/data-handler-tq.inc $(obj)/gen/torque-generated/src/objects/debug-objects-tq.inc $(obj)/gen/torque-generated/src/objects/descriptor-array-tq.inc $(obj)/gen/torque-generated/src/objects/embedder-data-array-tq.inc $(obj)/gen/torque-generated/src/objects/feedback-cell-tq.inc $(obj)/gen/torque-generated/src/objects/feedback-vector-tq.inc $(obj)/gen/torque-generated/src/objects/fixed-array-tq.inc $(obj)/gen/torque-generated/src/objects/foreign-tq.inc $(obj)/gen/torque-generated/src/objects/free-space-tq.inc $(obj)/gen/torque-generated/src/objects/heap-number-tq.inc $(obj)/gen/torque-generated/src/objects/heap-object-tq.inc $(obj)/gen/torque-generated/src/objects/js-array-buffer-tq.inc $(obj)/gen/torque-generated/src/objects/js-array-tq.inc $(obj)/gen/torque-generated/src/objects/js-atomics-synchronization-tq.inc $(obj)/gen/torque-generated/src/objects/js-collection-iterator-tq.inc $(obj)/gen/torque-generated/src/objects/js-collection-tq.inc $(obj)/gen/torque-generated/src/objects/js-function-tq.inc $(obj)/gen/torque-generated/src/objects/js-generator-tq.inc $(obj)/gen/torque-generated/src/objects/js-objects-tq.inc $(obj)/gen/torque-generated/src/objects/js-promise-tq.inc $(obj)/gen/torque-generated/src/objects/js-proxy-tq.inc $(obj)/gen/torque-generated/src/objects/js-raw-json-tq.inc $(obj)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq.inc $(obj)/gen/torque-generated/src/objects/js-regexp-tq.inc $(obj)/gen/torque-generated/src/objects/js-shadow-realm-tq.inc $(obj)/gen/torque-generated/src/objects/js-shared-array-tq.inc $(obj)/gen/torque-generated/src/objects/js-struct-tq.inc $(obj)/gen/torque-generated/src/objects/js-temporal-objects-tq.inc $(obj)/gen/torque-generated/src/objects/js-weak-refs-tq.inc $(obj)/gen/torque-generated/src/objects/literal-objects-tq.inc $(obj)/gen/torque-generated/src/objects/map-tq.inc $(obj)/gen/torque-generated/src/objects/megadom-handler-tq.inc $(obj)/gen/torque-generated/src/objects/microtask-tq.inc $(obj)/gen/torque-generated/src/objects/module-tq.inc $(obj)/gen/torque-generated/src/objects/name-tq.inc $(obj)/gen/torque-generated/src/objects/oddball-tq.inc $(obj)/gen/torque-generated/src/objects/ordered-hash-table-tq.inc $(obj)/gen/torque-generated/src/objects/primitive-heap-object-tq.inc $(obj)/gen/torque-generated/src/objects/promise-tq.inc $(obj)/gen/torque-generated/src/objects/property-array-tq.inc $(obj)/gen/torque-generated/src/objects/property-cell-tq.inc $(obj)/gen/torque-generated/src/objects/property-descriptor-object-tq.inc $(obj)/gen/torque-generated/src/objects/prototype-info-tq.inc $(obj)/gen/torque-generated/src/objects/regexp-match-info-tq.inc $(obj)/gen/torque-generated/src/objects/scope-info-tq.inc $(obj)/gen/torque-generated/src/objects/script-tq.inc $(obj)/gen/torque-generated/src/objects/shared-function-info-tq.inc $(obj)/gen/torque-generated/src/objects/source-text-module-tq.inc $(obj)/gen/torque-generated/src/objects/string-tq.inc $(obj)/gen/torque-generated/src/objects/struct-tq.inc $(obj)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq.inc $(obj)/gen/torque-generated/src/objects/swiss-name-dictionary-tq.inc $(obj)/gen/torque-generated/src/objects/synthetic-module-tq.inc $(obj)/gen/torque-generated/src/objects/template-objects-tq.inc $(obj)/gen/torque-generated/src/objects/templates-tq.inc $(obj)/gen/torque-generated/src/objects/torque-defined-classes-tq.inc $(obj)/gen/torque-generated/src/objects/turbofan-types-tq.inc $(obj)/gen/torque-generated/test/torque/test-torque-tq.inc $(obj)/gen/torque-generated/third_party/v8/builtins/array-sort-tq.inc $(obj)/gen/torque-generated/src/builtins/wasm-tq.inc $(obj)/gen/torque-generated/src/debug/debug-wasm-objects-tq.inc $(obj)/gen/torque-generated/src/wasm/wasm-objects-tq.inc
+
+
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/tools/v8_gypfiles/run_torque.stamp: | $(action__root_repo_tools_v8_gypfiles_v8_gyp_run_torque_target_run_torque_action_outputs)
+
+# Preserve order dependency of special output on deps.
+$(action__root_repo_tools_v8_gypfiles_v8_gyp_run_torque_target_run_torque_action_outputs): | $(builddir)/torque
+
+$(obj).target/tools/v8_gypfiles/run_torque.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/tools/v8_gypfiles/run_torque.stamp: $(builddir)/torque FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/tools/v8_gypfiles/run_torque.stamp
+# Add target alias
+.PHONY: run_torque
+run_torque: $(obj).target/tools/v8_gypfiles/run_torque.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: run_torque
+
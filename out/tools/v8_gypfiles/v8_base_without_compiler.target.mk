@@ -0,0 +1,1052 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := v8_base_without_compiler
+### Rules for action "protocol_compatibility":
+quiet_cmd__root_repo_tools_v8_gypfiles_v8_gyp_v8_base_without_compiler_target_protocol_compatibility = ACTION Checking inspector protocol compatibility $@
+cmd__root_repo_tools_v8_gypfiles_v8_gyp_v8_base_without_compiler_target_protocol_compatibility = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/tools/v8_gypfiles; mkdir -p $(obj)/gen/inspector-generated-output-root/src; python ../../deps/v8/third_party/inspector_protocol/check_protocol_compatibility.py --stamp "$(obj)/gen/inspector-generated-output-root/src/js_protocol.stamp" ../../deps/v8/include/js_protocol.pdl
+
+$(obj)/gen/inspector-generated-output-root/src/js_protocol.stamp: obj := $(abs_obj)
+$(obj)/gen/inspector-generated-output-root/src/js_protocol.stamp: builddir := $(abs_builddir)
+$(obj)/gen/inspector-generated-output-root/src/js_protocol.stamp: TOOLSET := $(TOOLSET)
+$(obj)/gen/inspector-generated-output-root/src/js_protocol.stamp: $(srcdir)/deps/v8/include/js_protocol.pdl FORCE_DO_CMD
+	$(call do_cmd,_root_repo_tools_v8_gypfiles_v8_gyp_v8_base_without_compiler_target_protocol_compatibility)
+
+all_deps += $(obj)/gen/inspector-generated-output-root/src/js_protocol.stamp
+action__root_repo_tools_v8_gypfiles_v8_gyp_v8_base_without_compiler_target_protocol_compatibility_outputs := $(obj)/gen/inspector-generated-output-root/src/js_protocol.stamp
+
+### Rules for action "protocol_generated_sources":
+quiet_cmd__root_repo_tools_v8_gypfiles_v8_gyp_v8_base_without_compiler_target_protocol_generated_sources = ACTION Generating inspector protocol sources from protocol json $@
+cmd__root_repo_tools_v8_gypfiles_v8_gyp_v8_base_without_compiler_target_protocol_generated_sources = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/tools/v8_gypfiles; mkdir -p $(obj)/gen/inspector-generated-output-root/src/inspector/protocol $(obj)/gen/inspector-generated-output-root/include/inspector; python ../../deps/v8/third_party/inspector_protocol/code_generator.py --jinja_dir ../../deps/v8/third_party --output_base "$(obj)/gen/inspector-generated-output-root/src/inspector" --config ../../deps/v8/src/inspector/inspector_protocol_config.json --config_value "protocol.path=../../deps/v8/include/js_protocol.pdl" --inspector_protocol_dir ../../deps/v8/third_party/inspector_protocol
+
+$(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Forward.h: obj := $(abs_obj)
+$(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Forward.h: builddir := $(abs_builddir)
+$(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Forward.h: TOOLSET := $(TOOLSET)
+$(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Forward.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Protocol.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Protocol.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Console.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Console.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Debugger.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Debugger.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/HeapProfiler.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/HeapProfiler.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Profiler.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Profiler.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Runtime.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Runtime.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Schema.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Schema.h $(obj)/gen/inspector-generated-output-root/include/inspector/Debugger.h $(obj)/gen/inspector-generated-output-root/include/inspector/Runtime.h $(obj)/gen/inspector-generated-output-root/include/inspector/Schema.h: 3c38a870255a5c0836127ed4710aca480c22446d.intermediate
+	@:
+.INTERMEDIATE: 3c38a870255a5c0836127ed4710aca480c22446d.intermediate
+3c38a870255a5c0836127ed4710aca480c22446d.intermediate: $(srcdir)/deps/v8/include/js_protocol.pdl $(srcdir)/deps/v8/src/inspector/inspector_protocol_config.json $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Forward_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Object_cpp.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Object_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Protocol_cpp.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/ValueConversions_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Values_cpp.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Values_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/templates/Exported_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/templates/Imported_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/templates/TypeBuilder_cpp.template $(srcdir)/deps/v8/third_party/inspector_protocol/templates/TypeBuilder_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/code_generator.py FORCE_DO_CMD
+	$(call do_cmd,touch)
+	$(call do_cmd,_root_repo_tools_v8_gypfiles_v8_gyp_v8_base_without_compiler_target_protocol_generated_sources)
+
+all_deps += $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Forward.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Protocol.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Protocol.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Console.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Console.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Debugger.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Debugger.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/HeapProfiler.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/HeapProfiler.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Profiler.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Profiler.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Runtime.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Runtime.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Schema.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Schema.h $(obj)/gen/inspector-generated-output-root/include/inspector/Debugger.h $(obj)/gen/inspector-generated-output-root/include/inspector/Runtime.h $(obj)/gen/inspector-generated-output-root/include/inspector/Schema.h
+action__root_repo_tools_v8_gypfiles_v8_gyp_v8_base_without_compiler_target_protocol_generated_sources_outputs := $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Forward.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Protocol.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Protocol.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Console.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Console.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Debugger.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Debugger.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/HeapProfiler.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/HeapProfiler.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Profiler.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Profiler.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Runtime.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Runtime.h $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Schema.cpp $(obj)/gen/inspector-generated-output-root/src/inspector/protocol/Schema.h $(obj)/gen/inspector-generated-output-root/include/inspector/Debugger.h $(obj)/gen/inspector-generated-output-root/include/inspector/Runtime.h $(obj)/gen/inspector-generated-output-root/include/inspector/Schema.h
+
+
+DEFS_Debug := \
+	'-D_GLIBCXX_USE_CXX11_ABI=1' \
+	'-DNODE_OPENSSL_CONF_NAME=nodejs_conf' \
+	'-DNODE_OPENSSL_HAS_QUIC' \
+	'-DV8_GYP_BUILD' \
+	'-DV8_TYPED_ARRAY_MAX_SIZE_IN_HEAP=64' \
+	'-D__STDC_FORMAT_MACROS' \
+	'-DOPENSSL_NO_PINSHARED' \
+	'-DOPENSSL_THREADS' \
+	'-DV8_TARGET_ARCH_X64' \
+	'-DV8_HAVE_TARGET_OS' \
+	'-DV8_TARGET_OS_LINUX' \
+	'-DV8_EMBEDDER_STRING="-node.8"' \
+	'-DENABLE_DISASSEMBLER' \
+	'-DV8_PROMISE_INTERNAL_FIELD_COUNT=1' \
+	'-DV8_SHORT_BUILTIN_CALLS' \
+	'-DOBJECT_PRINT' \
+	'-DV8_ATOMIC_OBJECT_FIELD_WRITES' \
+	'-DV8_ENABLE_LAZY_SOURCE_POSITIONS' \
+	'-DV8_USE_SIPHASH' \
+	'-DV8_SHARED_RO_HEAP' \
+	'-DV8_WIN64_UNWINDING_INFO' \
+	'-DV8_ENABLE_REGEXP_INTERPRETER_THREADED_DISPATCH' \
+	'-DV8_USE_ZLIB' \
+	'-DV8_ENABLE_WEBASSEMBLY' \
+	'-DV8_ENABLE_JAVASCRIPT_PROMISE_HOOKS' \
+	'-DV8_ALLOCATION_FOLDING' \
+	'-DV8_ALLOCATION_SITE_TRACKING' \
+	'-DV8_SCRIPTORMODULE_LEGACY_LIFETIME' \
+	'-DV8_ADVANCED_BIGINT_ALGORITHMS' \
+	'-DDEBUG' \
+	'-D_DEBUG' \
+	'-DV8_ENABLE_CHECKS' \
+	'-DV8_TRACE_MAPS' \
+	'-DV8_ENABLE_ALLOCATION_TIMEOUT' \
+	'-DV8_ENABLE_FORCE_SLOW_PATH' \
+	'-DENABLE_HANDLE_ZAPPING'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-pthread \
+	-Wno-unused-parameter \
+	-m64 \
+	-Wno-return-type \
+	-fno-strict-aliasing \
+	-m64 \
+	-g \
+	-fdata-sections \
+	-ffunction-sections \
+	-O3
+
+# Flags passed to only C files.
+CFLAGS_C_Debug :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fno-rtti \
+	-fno-exceptions \
+	-std=gnu++17
+
+INCS_Debug := \
+	-I$(srcdir)/deps/v8 \
+	-I$(srcdir)/deps/v8/include \
+	-I$(obj)/gen/inspector-generated-output-root \
+	-I$(srcdir)/deps/v8/third_party/inspector_protocol \
+	-I$(obj)/gen \
+	-I$(obj)/gen/generate-bytecode-output-root \
+	-I$(srcdir)/deps/v8/third_party/zlib \
+	-I$(srcdir)/deps/v8/third_party/zlib/google
+
+DEFS_Release := \
+	'-D_GLIBCXX_USE_CXX11_ABI=1' \
+	'-DNODE_OPENSSL_CONF_NAME=nodejs_conf' \
+	'-DNODE_OPENSSL_HAS_QUIC' \
+	'-DV8_GYP_BUILD' \
+	'-DV8_TYPED_ARRAY_MAX_SIZE_IN_HEAP=64' \
+	'-D__STDC_FORMAT_MACROS' \
+	'-DOPENSSL_NO_PINSHARED' \
+	'-DOPENSSL_THREADS' \
+	'-DV8_TARGET_ARCH_X64' \
+	'-DV8_HAVE_TARGET_OS' \
+	'-DV8_TARGET_OS_LINUX' \
+	'-DV8_EMBEDDER_STRING="-node.8"' \
+	'-DENABLE_DISASSEMBLER' \
+	'-DV8_PROMISE_INTERNAL_FIELD_COUNT=1' \
+	'-DV8_SHORT_BUILTIN_CALLS' \
+	'-DOBJECT_PRINT' \
+	'-DV8_ATOMIC_OBJECT_FIELD_WRITES' \
+	'-DV8_ENABLE_LAZY_SOURCE_POSITIONS' \
+	'-DV8_USE_SIPHASH' \
+	'-DV8_SHARED_RO_HEAP' \
+	'-DV8_WIN64_UNWINDING_INFO' \
+	'-DV8_ENABLE_REGEXP_INTERPRETER_THREADED_DISPATCH' \
+	'-DV8_USE_ZLIB' \
+	'-DV8_ENABLE_WEBASSEMBLY' \
+	'-DV8_ENABLE_JAVASCRIPT_PROMISE_HOOKS' \
+	'-DV8_ALLOCATION_FOLDING' \
+	'-DV8_ALLOCATION_SITE_TRACKING' \
+	'-DV8_SCRIPTORMODULE_LEGACY_LIFETIME' \
+	'-DV8_ADVANCED_BIGINT_ALGORITHMS'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-pthread \
+	-Wno-unused-parameter \
+	-m64 \
+	-Wno-return-type \
+	-fno-strict-aliasing \
+	-m64 \
+	-O3 \
+	-fno-omit-frame-pointer \
+	-fdata-sections \
+	-ffunction-sections \
+	-O3
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fno-rtti \
+	-fno-exceptions \
+	-std=gnu++17
+
+INCS_Release := \
+	-I$(srcdir)/deps/v8 \
+	-I$(srcdir)/deps/v8/include \
+	-I$(obj)/gen/inspector-generated-output-root \
+	-I$(srcdir)/deps/v8/third_party/inspector_protocol \
+	-I$(obj)/gen \
+	-I$(obj)/gen/generate-bytecode-output-root \
+	-I$(srcdir)/deps/v8/third_party/zlib \
+	-I$(srcdir)/deps/v8/third_party/zlib/google
+
+OBJS := \
+	$(obj).target/$(TARGET)/deps/v8/src/api/api-arguments.o \
+	$(obj).target/$(TARGET)/deps/v8/src/api/api-natives.o \
+	$(obj).target/$(TARGET)/deps/v8/src/api/api.o \
+	$(obj).target/$(TARGET)/deps/v8/src/ast/ast-function-literal-id-reindexer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/ast/ast-value-factory.o \
+	$(obj).target/$(TARGET)/deps/v8/src/ast/ast.o \
+	$(obj).target/$(TARGET)/deps/v8/src/ast/modules.o \
+	$(obj).target/$(TARGET)/deps/v8/src/ast/prettyprinter.o \
+	$(obj).target/$(TARGET)/deps/v8/src/ast/scopes.o \
+	$(obj).target/$(TARGET)/deps/v8/src/ast/source-range-ast-visitor.o \
+	$(obj).target/$(TARGET)/deps/v8/src/ast/variables.o \
+	$(obj).target/$(TARGET)/deps/v8/src/baseline/baseline-batch-compiler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/baseline/baseline-compiler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/baseline/baseline.o \
+	$(obj).target/$(TARGET)/deps/v8/src/baseline/bytecode-offset-iterator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/accessors.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-api.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-array.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-arraybuffer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-async-module.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-atomics-synchronization.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-bigint.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-callsite.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-collections.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-console.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-dataview.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-date.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-error.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-function.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-global.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-internal.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-json.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-number.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-object.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-reflect.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-regexp.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-shadow-realm.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-shared-array.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-sharedarraybuffer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-string.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-struct.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-symbol.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-temporal.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-trace.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-typed-array.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-weak-refs.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins-web-snapshots.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/builtins.o \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/constants-table-builder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/aligned-slot-allocator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/assembler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/bailout-reason.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/code-comments.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/code-desc.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/code-factory.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/code-reference.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/compilation-cache.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/compiler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/constant-pool.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/external-reference-encoder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/external-reference-table.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/external-reference.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/flush-instruction-cache.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/handler-table.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/interface-descriptors.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/machine-type.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/maglev-safepoint-table.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/optimized-compilation-info.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/pending-optimization-table.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/register-configuration.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/reloc-info.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/safepoint-table.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/source-position-table.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/source-position.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/tick-counter.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/tnode.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/turbo-assembler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/unoptimized-compilation-info.o \
+	$(obj).target/$(TARGET)/deps/v8/src/common/assert-scope.o \
+	$(obj).target/$(TARGET)/deps/v8/src/common/code-memory-access.o \
+	$(obj).target/$(TARGET)/deps/v8/src/compiler-dispatcher/lazy-compile-dispatcher.o \
+	$(obj).target/$(TARGET)/deps/v8/src/compiler-dispatcher/optimizing-compile-dispatcher.o \
+	$(obj).target/$(TARGET)/deps/v8/src/date/date.o \
+	$(obj).target/$(TARGET)/deps/v8/src/date/dateparser.o \
+	$(obj).target/$(TARGET)/deps/v8/src/debug/debug-coverage.o \
+	$(obj).target/$(TARGET)/deps/v8/src/debug/debug-evaluate.o \
+	$(obj).target/$(TARGET)/deps/v8/src/debug/debug-frames.o \
+	$(obj).target/$(TARGET)/deps/v8/src/debug/debug-interface.o \
+	$(obj).target/$(TARGET)/deps/v8/src/debug/debug-property-iterator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/debug/debug-scope-iterator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/debug/debug-scopes.o \
+	$(obj).target/$(TARGET)/deps/v8/src/debug/debug-stack-trace-iterator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/debug/debug.o \
+	$(obj).target/$(TARGET)/deps/v8/src/debug/liveedit-diff.o \
+	$(obj).target/$(TARGET)/deps/v8/src/debug/liveedit.o \
+	$(obj).target/$(TARGET)/deps/v8/src/deoptimizer/deoptimize-reason.o \
+	$(obj).target/$(TARGET)/deps/v8/src/deoptimizer/deoptimized-frame-info.o \
+	$(obj).target/$(TARGET)/deps/v8/src/deoptimizer/deoptimizer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/deoptimizer/materialized-object-store.o \
+	$(obj).target/$(TARGET)/deps/v8/src/deoptimizer/translated-state.o \
+	$(obj).target/$(TARGET)/deps/v8/src/deoptimizer/translation-array.o \
+	$(obj).target/$(TARGET)/deps/v8/src/diagnostics/basic-block-profiler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/diagnostics/compilation-statistics.o \
+	$(obj).target/$(TARGET)/deps/v8/src/diagnostics/disassembler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/diagnostics/eh-frame.o \
+	$(obj).target/$(TARGET)/deps/v8/src/diagnostics/gdb-jit.o \
+	$(obj).target/$(TARGET)/deps/v8/src/diagnostics/objects-debug.o \
+	$(obj).target/$(TARGET)/deps/v8/src/diagnostics/objects-printer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/diagnostics/perf-jit.o \
+	$(obj).target/$(TARGET)/deps/v8/src/diagnostics/unwinder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/arguments.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/clobber-registers.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/embedder-state.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/encoded-c-signature.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/execution.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/frames.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/futex-emulation.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/interrupts-scope.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/isolate.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/local-isolate.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/messages.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/microtask-queue.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/protectors.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/simulator-base.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/stack-guard.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/thread-id.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/thread-local-top.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/tiering-manager.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/v8threads.o \
+	$(obj).target/$(TARGET)/deps/v8/src/extensions/cputracemark-extension.o \
+	$(obj).target/$(TARGET)/deps/v8/src/extensions/externalize-string-extension.o \
+	$(obj).target/$(TARGET)/deps/v8/src/extensions/gc-extension.o \
+	$(obj).target/$(TARGET)/deps/v8/src/extensions/ignition-statistics-extension.o \
+	$(obj).target/$(TARGET)/deps/v8/src/extensions/statistics-extension.o \
+	$(obj).target/$(TARGET)/deps/v8/src/extensions/trigger-failure-extension.o \
+	$(obj).target/$(TARGET)/deps/v8/src/flags/flags.o \
+	$(obj).target/$(TARGET)/deps/v8/src/handles/global-handles.o \
+	$(obj).target/$(TARGET)/deps/v8/src/handles/handles.o \
+	$(obj).target/$(TARGET)/deps/v8/src/handles/local-handles.o \
+	$(obj).target/$(TARGET)/deps/v8/src/handles/persistent-handles.o \
+	$(obj).target/$(TARGET)/deps/v8/src/handles/shared-object-conveyor-handles.o \
+	$(obj).target/$(TARGET)/deps/v8/src/handles/traced-handles.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/allocation-observer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/array-buffer-sweeper.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/base-space.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/basic-memory-chunk.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/code-object-registry.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/code-range.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/code-stats.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/collection-barrier.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/combined-heap.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/concurrent-allocator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/concurrent-marking.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc-js/cpp-heap.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc-js/cpp-snapshot.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc-js/unified-heap-marking-state.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc-js/unified-heap-marking-verifier.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc-js/unified-heap-marking-visitor.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/embedder-tracing.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/evacuation-verifier.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/factory-base.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/factory.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/finalization-registry-cleanup-task.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/free-list.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/gc-idle-time-handler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/gc-tracer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/global-handle-marking-visitor.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/heap-allocator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/heap-controller.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/heap-layout-tracer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/heap-verifier.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/heap-write-barrier.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/heap.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/incremental-marking-job.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/incremental-marking.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/index-generator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/invalidated-slots.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/large-spaces.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/local-factory.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/local-heap.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/mark-compact.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/marking-barrier.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/marking-worklist.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/marking.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/memory-allocator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/memory-chunk-layout.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/memory-chunk.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/memory-measurement.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/memory-reducer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/new-spaces.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/object-stats.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/objects-visiting.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/paged-spaces.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/pretenuring-handler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/read-only-heap.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/read-only-spaces.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/safepoint.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/scavenge-job.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/scavenger.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/slot-set.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/spaces.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/stress-marking-observer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/stress-scavenge-observer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/sweeper.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/weak-object-worklists.o \
+	$(obj).target/$(TARGET)/deps/v8/src/ic/call-optimization.o \
+	$(obj).target/$(TARGET)/deps/v8/src/ic/handler-configuration.o \
+	$(obj).target/$(TARGET)/deps/v8/src/ic/ic-stats.o \
+	$(obj).target/$(TARGET)/deps/v8/src/ic/ic.o \
+	$(obj).target/$(TARGET)/deps/v8/src/ic/stub-cache.o \
+	$(obj).target/$(TARGET)/deps/v8/src/init/bootstrapper.o \
+	$(obj).target/$(TARGET)/deps/v8/src/init/icu_util.o \
+	$(obj).target/$(TARGET)/deps/v8/src/init/isolate-allocator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/init/startup-data-util.o \
+	$(obj).target/$(TARGET)/deps/v8/src/init/v8.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecode-array-builder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecode-array-iterator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecode-array-random-iterator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecode-array-writer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecode-decoder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecode-flags.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecode-generator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecode-label.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecode-node.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecode-operands.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecode-register-optimizer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecode-register.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecode-source-info.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecodes.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/constant-array-builder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/control-flow-builders.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/handler-table-builder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/interpreter-intrinsics.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/interpreter.o \
+	$(obj).target/$(TARGET)/deps/v8/src/json/json-parser.o \
+	$(obj).target/$(TARGET)/deps/v8/src/json/json-stringifier.o \
+	$(obj).target/$(TARGET)/deps/v8/src/libsampler/sampler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/logging/counters.o \
+	$(obj).target/$(TARGET)/deps/v8/src/logging/local-logger.o \
+	$(obj).target/$(TARGET)/deps/v8/src/logging/log-file.o \
+	$(obj).target/$(TARGET)/deps/v8/src/logging/log.o \
+	$(obj).target/$(TARGET)/deps/v8/src/logging/metrics.o \
+	$(obj).target/$(TARGET)/deps/v8/src/logging/runtime-call-stats.o \
+	$(obj).target/$(TARGET)/deps/v8/src/logging/tracing-flags.o \
+	$(obj).target/$(TARGET)/deps/v8/src/numbers/conversions.o \
+	$(obj).target/$(TARGET)/deps/v8/src/numbers/math-random.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/backing-store.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/bigint.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/call-site-info.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/code-kind.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/code.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/compilation-cache-table.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/contexts.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/debug-objects.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/elements-kind.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/elements.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/embedder-data-array.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/feedback-vector.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/field-type.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/js-array-buffer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/js-atomics-synchronization.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/js-function.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/js-objects.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/js-raw-json.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/js-regexp.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/js-temporal-objects.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/keys.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/literal-objects.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/lookup-cache.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/lookup.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/managed.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/map-updater.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/map.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/module.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/object-type.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/objects.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/option-utils.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/ordered-hash-table.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/property-descriptor.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/property.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/scope-info.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/shared-function-info.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/simd.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/source-text-module.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/string-comparator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/string-forwarding-table.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/string-table.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/string.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/swiss-name-dictionary.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/symbol-table.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/synthetic-module.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/tagged-impl.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/template-objects.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/templates.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/transitions.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/type-hints.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/value-serializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/objects/visitors.o \
+	$(obj).target/$(TARGET)/deps/v8/src/parsing/func-name-inferrer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/parsing/import-assertions.o \
+	$(obj).target/$(TARGET)/deps/v8/src/parsing/literal-buffer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/parsing/parse-info.o \
+	$(obj).target/$(TARGET)/deps/v8/src/parsing/parser.o \
+	$(obj).target/$(TARGET)/deps/v8/src/parsing/parsing.o \
+	$(obj).target/$(TARGET)/deps/v8/src/parsing/pending-compilation-error-handler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/parsing/preparse-data.o \
+	$(obj).target/$(TARGET)/deps/v8/src/parsing/preparser.o \
+	$(obj).target/$(TARGET)/deps/v8/src/parsing/rewriter.o \
+	$(obj).target/$(TARGET)/deps/v8/src/parsing/scanner-character-streams.o \
+	$(obj).target/$(TARGET)/deps/v8/src/parsing/scanner.o \
+	$(obj).target/$(TARGET)/deps/v8/src/parsing/token.o \
+	$(obj).target/$(TARGET)/deps/v8/src/profiler/allocation-tracker.o \
+	$(obj).target/$(TARGET)/deps/v8/src/profiler/cpu-profiler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/profiler/heap-profiler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/profiler/heap-snapshot-generator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/profiler/profile-generator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/profiler/profiler-listener.o \
+	$(obj).target/$(TARGET)/deps/v8/src/profiler/profiler-stats.o \
+	$(obj).target/$(TARGET)/deps/v8/src/profiler/sampling-heap-profiler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/profiler/strings-storage.o \
+	$(obj).target/$(TARGET)/deps/v8/src/profiler/symbolizer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/profiler/tick-sample.o \
+	$(obj).target/$(TARGET)/deps/v8/src/profiler/tracing-cpu-profiler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/profiler/weak-code-registry.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/experimental/experimental-bytecode.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/experimental/experimental-compiler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/experimental/experimental-interpreter.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/experimental/experimental.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp-ast.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp-bytecode-generator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp-bytecode-peephole.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp-bytecodes.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp-compiler-tonode.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp-compiler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp-dotprinter.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp-error.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp-interpreter.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp-macro-assembler-tracer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp-macro-assembler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp-parser.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp-stack.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp-utils.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/regexp.o \
+	$(obj).target/$(TARGET)/deps/v8/src/roots/roots.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-array.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-atomics.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-bigint.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-classes.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-collections.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-compiler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-date.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-debug.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-forin.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-function.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-futex.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-generator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-internal.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-literals.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-module.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-numbers.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-object.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-operators.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-promise.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-proxy.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-regexp.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-scopes.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-shadow-realm.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-strings.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-symbol.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-temporal.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-test.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-trace.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-typedarray.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-weak-refs.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime.o \
+	$(obj).target/$(TARGET)/deps/v8/src/sandbox/external-pointer-table.o \
+	$(obj).target/$(TARGET)/deps/v8/src/sandbox/sandbox.o \
+	$(obj).target/$(TARGET)/deps/v8/src/sandbox/testing.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/code-serializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/context-deserializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/context-serializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/deserializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/embedded/embedded-data.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/object-deserializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/read-only-deserializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/read-only-serializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/roots-serializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/serializer-deserializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/serializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/shared-heap-deserializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/shared-heap-serializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/snapshot-data.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/snapshot-source-sink.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/snapshot-utils.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/snapshot.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/startup-deserializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/snapshot/startup-serializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/strings/string-builder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/strings/string-case.o \
+	$(obj).target/$(TARGET)/deps/v8/src/strings/string-stream.o \
+	$(obj).target/$(TARGET)/deps/v8/src/strings/unicode-decoder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/strings/unicode.o \
+	$(obj).target/$(TARGET)/deps/v8/src/strings/uri.o \
+	$(obj).target/$(TARGET)/deps/v8/src/tasks/cancelable-task.o \
+	$(obj).target/$(TARGET)/deps/v8/src/tasks/operations-barrier.o \
+	$(obj).target/$(TARGET)/deps/v8/src/tasks/task-utils.o \
+	$(obj).target/$(TARGET)/deps/v8/src/temporal/temporal-parser.o \
+	$(obj).target/$(TARGET)/deps/v8/src/third_party/siphash/halfsiphash.o \
+	$(obj).target/$(TARGET)/deps/v8/src/tracing/trace-event.o \
+	$(obj).target/$(TARGET)/deps/v8/src/tracing/traced-value.o \
+	$(obj).target/$(TARGET)/deps/v8/src/tracing/tracing-category-observer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/utils/address-map.o \
+	$(obj).target/$(TARGET)/deps/v8/src/utils/allocation.o \
+	$(obj).target/$(TARGET)/deps/v8/src/utils/bit-vector.o \
+	$(obj).target/$(TARGET)/deps/v8/src/utils/detachable-vector.o \
+	$(obj).target/$(TARGET)/deps/v8/src/utils/identity-map.o \
+	$(obj).target/$(TARGET)/deps/v8/src/utils/memcopy.o \
+	$(obj).target/$(TARGET)/deps/v8/src/utils/ostreams.o \
+	$(obj).target/$(TARGET)/deps/v8/src/utils/utils.o \
+	$(obj).target/$(TARGET)/deps/v8/src/utils/version.o \
+	$(obj).target/$(TARGET)/deps/v8/src/web-snapshot/web-snapshot.o \
+	$(obj).target/$(TARGET)/deps/v8/src/zone/accounting-allocator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/zone/type-stats.o \
+	$(obj).target/$(TARGET)/deps/v8/src/zone/zone-segment.o \
+	$(obj).target/$(TARGET)/deps/v8/src/zone/zone.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/custom-preview.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/injected-script.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/inspected-context.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/remote-object-id.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/search-util.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/string-16.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/string-util.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/test-interface.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-console.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-console-agent-impl.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-console-message.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-debugger.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-debugger-agent-impl.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-debugger-id.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-debugger-script.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-heap-profiler-agent-impl.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-inspector-impl.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-inspector-session-impl.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-profiler-agent-impl.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-regex.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-runtime-agent-impl.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-schema-agent-impl.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-stack-trace-impl.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-value-utils.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-webdriver-serializer.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/value-mirror.o \
+	$(obj).target/$(TARGET)/deps/v8/src/inspector/v8-string-conversions.o \
+	$(obj).target/$(TARGET)/deps/v8/third_party/inspector_protocol/crdtp/json_platform_v8.o \
+	$(obj).target/$(TARGET)/deps/v8/third_party/inspector_protocol/crdtp/cbor.o \
+	$(obj).target/$(TARGET)/deps/v8/third_party/inspector_protocol/crdtp/dispatch.o \
+	$(obj).target/$(TARGET)/deps/v8/third_party/inspector_protocol/crdtp/error_support.o \
+	$(obj).target/$(TARGET)/deps/v8/third_party/inspector_protocol/crdtp/json.o \
+	$(obj).target/$(TARGET)/deps/v8/third_party/inspector_protocol/crdtp/protocol_core.o \
+	$(obj).target/$(TARGET)/deps/v8/third_party/inspector_protocol/crdtp/serializable.o \
+	$(obj).target/$(TARGET)/deps/v8/third_party/inspector_protocol/crdtp/span.o \
+	$(obj).target/$(TARGET)/deps/v8/third_party/inspector_protocol/crdtp/status.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/third-party/heap-api-stub.o \
+	$(obj).target/$(TARGET)/deps/v8/src/asmjs/asm-js.o \
+	$(obj).target/$(TARGET)/deps/v8/src/asmjs/asm-parser.o \
+	$(obj).target/$(TARGET)/deps/v8/src/asmjs/asm-scanner.o \
+	$(obj).target/$(TARGET)/deps/v8/src/asmjs/asm-types.o \
+	$(obj).target/$(TARGET)/deps/v8/src/debug/debug-wasm-objects.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-test-wasm.o \
+	$(obj).target/$(TARGET)/deps/v8/src/runtime/runtime-wasm.o \
+	$(obj).target/$(TARGET)/deps/v8/src/trap-handler/handler-inside.o \
+	$(obj).target/$(TARGET)/deps/v8/src/trap-handler/handler-outside.o \
+	$(obj).target/$(TARGET)/deps/v8/src/trap-handler/handler-shared.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/assembler-buffer-cache.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/baseline/liftoff-assembler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/baseline/liftoff-compiler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/canonical-types.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/code-space-access.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/constant-expression-interface.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/constant-expression.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/function-body-decoder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/function-compiler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/graph-builder-interface.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/jump-table-assembler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/local-decl-encoder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/memory-tracing.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/module-compiler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/module-decoder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/module-instantiate.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/names-provider.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/pgo.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/simd-shuffle.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/stacks.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/streaming-decoder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/sync-streaming-decoder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/value-type.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-code-manager.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-debug.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-disassembler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-engine.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-external-refs.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-features.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-import-wrapper-cache.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-init-expr.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-js.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-module-builder.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-module-sourcemap.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-module.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-objects.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-opcodes.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-result.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-serialization.o \
+	$(obj).target/$(TARGET)/deps/v8/src/wasm/wasm-subtyping.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/shared-ia32-x64/macro-assembler-shared-ia32-x64.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/x64/assembler-x64.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/x64/cpu-x64.o \
+	$(obj).target/$(TARGET)/deps/v8/src/codegen/x64/macro-assembler-x64.o \
+	$(obj).target/$(TARGET)/deps/v8/src/compiler/backend/x64/code-generator-x64.o \
+	$(obj).target/$(TARGET)/deps/v8/src/compiler/backend/x64/instruction-scheduler-x64.o \
+	$(obj).target/$(TARGET)/deps/v8/src/compiler/backend/x64/instruction-selector-x64.o \
+	$(obj).target/$(TARGET)/deps/v8/src/compiler/backend/x64/unwinding-info-writer-x64.o \
+	$(obj).target/$(TARGET)/deps/v8/src/deoptimizer/x64/deoptimizer-x64.o \
+	$(obj).target/$(TARGET)/deps/v8/src/diagnostics/x64/disasm-x64.o \
+	$(obj).target/$(TARGET)/deps/v8/src/diagnostics/x64/eh-frame-x64.o \
+	$(obj).target/$(TARGET)/deps/v8/src/diagnostics/x64/unwinder-x64.o \
+	$(obj).target/$(TARGET)/deps/v8/src/execution/x64/frame-constants-x64.o \
+	$(obj).target/$(TARGET)/deps/v8/src/regexp/x64/regexp-macro-assembler-x64.o \
+	$(obj).target/$(TARGET)/deps/v8/src/trap-handler/handler-inside-posix.o \
+	$(obj).target/$(TARGET)/deps/v8/src/trap-handler/handler-outside-posix.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/class-verifiers.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/factory.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/objects-printer.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/aggregate-error-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-at-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-concat-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-copywithin-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-every-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-filter-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-find-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-findindex-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-findlast-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-findlastindex-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-foreach-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-from-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-isarray-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-join-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-lastindexof-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-map-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-of-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-reduce-right-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-reduce-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-reverse-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-shift-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-slice-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-some-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-splice-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-to-reversed-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-to-sorted-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-to-spliced-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-unshift-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-with-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/array-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/arraybuffer-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/base-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/boolean-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/builtins-bigint-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/builtins-string-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/cast-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/collections-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/constructor-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/conversion-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/convert-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/console-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/data-view-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/finalization-registry-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/frames-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/frame-arguments-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/function-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/growable-fixed-array-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/ic-callable-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/ic-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/internal-coverage-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/internal-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/iterator-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/math-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/number-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/object-fromentries-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/object-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/promise-abstract-operations-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/promise-all-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/promise-all-element-closure-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/promise-any-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/promise-constructor-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/promise-finally-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/promise-misc-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/promise-race-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/promise-reaction-job-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/promise-resolve-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/promise-then-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/promise-jobs-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/proxy-constructor-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/proxy-delete-property-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/proxy-get-property-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/proxy-get-prototype-of-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/proxy-has-property-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/proxy-is-extensible-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/proxy-prevent-extensions-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/proxy-revocable-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/proxy-revoke-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/proxy-set-property-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/proxy-set-prototype-of-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/proxy-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/reflect-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/regexp-exec-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/regexp-match-all-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/regexp-match-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/regexp-replace-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/regexp-search-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/regexp-source-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/regexp-split-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/regexp-test-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/regexp-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-at-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-endswith-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-html-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-includes-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-indexof-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-iterator-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-match-search-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-pad-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-repeat-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-replaceall-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-slice-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-startswith-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-substr-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-substring-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/string-trim-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/symbol-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/torque-internal-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-at-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-createtypedarray-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-every-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-entries-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-filter-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-find-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-findindex-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-findlast-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-findlastindex-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-foreach-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-from-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-keys-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-of-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-reduce-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-reduceright-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-set-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-slice-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-some-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-sort-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-subarray-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-to-reversed-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-to-sorted-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-values-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-with-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/typed-array-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/weak-ref-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/ic/handler-configuration-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/allocation-site-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/api-callbacks-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/arguments-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/bigint-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/call-site-info-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/cell-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/code-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/contexts-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/data-handler-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/debug-objects-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/descriptor-array-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/embedder-data-array-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/feedback-cell-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/feedback-vector-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/fixed-array-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/foreign-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/free-space-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/heap-number-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/heap-object-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-array-buffer-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-array-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-atomics-synchronization-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-collection-iterator-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-collection-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-function-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-generator-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-objects-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-promise-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-proxy-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-raw-json-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-regexp-string-iterator-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-regexp-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-shadow-realm-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-shared-array-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-struct-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-temporal-objects-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/js-weak-refs-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/literal-objects-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/map-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/megadom-handler-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/microtask-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/module-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/name-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/oddball-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/ordered-hash-table-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/primitive-heap-object-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/promise-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/property-array-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/property-cell-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/property-descriptor-object-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/prototype-info-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/regexp-match-info-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/scope-info-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/script-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/shared-function-info-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/source-text-module-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/string-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/struct-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/swiss-hash-table-helpers-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/swiss-name-dictionary-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/synthetic-module-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/template-objects-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/templates-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/torque-defined-classes-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/objects/turbofan-types-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/test/torque/test-torque-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/third_party/v8/builtins/array-sort-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/builtins/wasm-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/debug/debug-wasm-objects-tq.o \
+	$(obj).target/$(TARGET)/gen/torque-generated/src/wasm/wasm-objects-tq.o \
+	$(obj).target/$(TARGET)/deps/v8/src/bigint/bigint-internal.o \
+	$(obj).target/$(TARGET)/deps/v8/src/bigint/bitwise.o \
+	$(obj).target/$(TARGET)/deps/v8/src/bigint/div-burnikel.o \
+	$(obj).target/$(TARGET)/deps/v8/src/bigint/div-helpers.o \
+	$(obj).target/$(TARGET)/deps/v8/src/bigint/div-schoolbook.o \
+	$(obj).target/$(TARGET)/deps/v8/src/bigint/fromstring.o \
+	$(obj).target/$(TARGET)/deps/v8/src/bigint/mul-karatsuba.o \
+	$(obj).target/$(TARGET)/deps/v8/src/bigint/mul-schoolbook.o \
+	$(obj).target/$(TARGET)/deps/v8/src/bigint/tostring.o \
+	$(obj).target/$(TARGET)/deps/v8/src/bigint/vector-arithmetic.o \
+	$(obj).target/$(TARGET)/deps/v8/src/bigint/div-barrett.o \
+	$(obj).target/$(TARGET)/deps/v8/src/bigint/mul-fft.o \
+	$(obj).target/$(TARGET)/deps/v8/src/bigint/mul-toom.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/base/active-system-pages.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/base/stack.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/base/worklist.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/base/asm/x64/save_registers_asm.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/allocation.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/compaction-worklists.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/compactor.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/concurrent-marker.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/explicit-management.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/free-list.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/gc-info-table.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/gc-info.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/gc-invoker.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/heap-base.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/heap-consistency.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/heap-growing.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/heap-object-header.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/heap-page.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/heap-space.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/heap-state.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/heap-statistics-collector.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/heap.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/incremental-marking-schedule.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/liveness-broker.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/logging.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/marker.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/marking-state.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/marking-verifier.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/marking-visitor.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/marking-worklists.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/member-storage.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/memory.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/name-trait.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/object-allocator.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/object-size-trait.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/page-memory.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/persistent-node.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/platform.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/pointer-policies.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/prefinalizer-handler.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/process-heap-statistics.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/process-heap.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/raw-heap.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/remembered-set.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/source-location.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/stats-collector.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/sweeper.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/testing.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/trace-trait.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/virtual-memory.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/visitor.o \
+	$(obj).target/$(TARGET)/deps/v8/src/heap/cppgc/write-barrier.o \
+	$(obj).target/$(TARGET)/gen/debug-support.o \
+	$(obj).target/$(TARGET)/gen/inspector-generated-output-root/src/inspector/protocol/Protocol.o \
+	$(obj).target/$(TARGET)/gen/inspector-generated-output-root/src/inspector/protocol/Console.o \
+	$(obj).target/$(TARGET)/gen/inspector-generated-output-root/src/inspector/protocol/Debugger.o \
+	$(obj).target/$(TARGET)/gen/inspector-generated-output-root/src/inspector/protocol/HeapProfiler.o \
+	$(obj).target/$(TARGET)/gen/inspector-generated-output-root/src/inspector/protocol/Profiler.o \
+	$(obj).target/$(TARGET)/gen/inspector-generated-output-root/src/inspector/protocol/Runtime.o \
+	$(obj).target/$(TARGET)/gen/inspector-generated-output-root/src/inspector/protocol/Schema.o
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/tools/v8_gypfiles/torque_generated_definitions.stamp $(obj).target/tools/v8_gypfiles/v8_bigint.stamp $(obj).target/tools/v8_gypfiles/v8_headers.stamp $(obj).target/tools/v8_gypfiles/v8_heap_base.stamp $(obj).target/tools/v8_gypfiles/v8_shared_internal_headers.stamp $(obj).target/tools/v8_gypfiles/v8_version.stamp $(obj).target/tools/v8_gypfiles/cppgc_base.stamp $(obj).target/tools/v8_gypfiles/generate_bytecode_builtins_list.stamp $(obj).target/tools/v8_gypfiles/run_torque.stamp $(obj).target/tools/v8_gypfiles/v8_internal_headers.stamp $(obj).target/tools/v8_gypfiles/v8_maybe_icu.stamp $(obj).target/tools/v8_gypfiles/postmortem-metadata.stamp
+
+# Make sure our actions/rules run before any of us.
+$(OBJS): | $(action__root_repo_tools_v8_gypfiles_v8_gyp_v8_base_without_compiler_target_protocol_compatibility_outputs) $(action__root_repo_tools_v8_gypfiles_v8_gyp_v8_base_without_compiler_target_protocol_generated_sources_outputs)
+
+# CFLAGS et al overrides must be target-local.
+# See "Target-specific Variable Values" in the GNU Make manual.
+$(OBJS): TOOLSET := $(TOOLSET)
+$(OBJS): GYP_CFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_C_$(BUILDTYPE))
+$(OBJS): GYP_CXXFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_CC_$(BUILDTYPE))
+
+# Suffix rules, putting all outputs into $(obj).
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# Try building from generated source, too.
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# End of this set of suffix rules
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/tools/v8_gypfiles/libv8_base_without_compiler.a: | $(action__root_repo_tools_v8_gypfiles_v8_gyp_v8_base_without_compiler_target_protocol_compatibility_outputs) $(action__root_repo_tools_v8_gypfiles_v8_gyp_v8_base_without_compiler_target_protocol_generated_sources_outputs)
+
+# Preserve order dependency of special output on deps.
+$(action__root_repo_tools_v8_gypfiles_v8_gyp_v8_base_without_compiler_target_protocol_compatibility_outputs) $(action__root_repo_tools_v8_gypfiles_v8_gyp_v8_base_without_compiler_target_protocol_generated_sources_outputs): | $(obj).target/tools/v8_gypfiles/torque_generated_definitions.stamp $(obj).target/tools/v8_gypfiles/v8_bigint.stamp $(obj).target/tools/v8_gypfiles/v8_headers.stamp $(obj).target/tools/v8_gypfiles/v8_heap_base.stamp $(obj).target/tools/v8_gypfiles/v8_shared_internal_headers.stamp $(obj).target/tools/v8_gypfiles/v8_version.stamp $(obj).target/tools/v8_gypfiles/cppgc_base.stamp $(obj).target/tools/v8_gypfiles/generate_bytecode_builtins_list.stamp $(obj).target/tools/v8_gypfiles/run_torque.stamp $(obj).target/tools/v8_gypfiles/v8_internal_headers.stamp $(obj).target/tools/v8_gypfiles/v8_maybe_icu.stamp $(obj).target/tools/v8_gypfiles/postmortem-metadata.stamp
+
+LDFLAGS_Debug := \
+	-pthread \
+	-rdynamic \
+	-m64 \
+	-m64
+
+LDFLAGS_Release := \
+	-pthread \
+	-rdynamic \
+	-m64 \
+	-m64
+
+LIBS :=
+
+$(obj).target/tools/v8_gypfiles/libv8_base_without_compiler.a: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
+$(obj).target/tools/v8_gypfiles/libv8_base_without_compiler.a: LIBS := $(LIBS)
+$(obj).target/tools/v8_gypfiles/libv8_base_without_compiler.a: TOOLSET := $(TOOLSET)
+$(obj).target/tools/v8_gypfiles/libv8_base_without_compiler.a: $(OBJS)
+	$(call create_thin_archive,$@,$^)
+
+# Add target alias
+.PHONY: v8_base_without_compiler
+v8_base_without_compiler: $(obj).target/tools/v8_gypfiles/libv8_base_without_compiler.a
+
+# Add target alias to "all" target.
+.PHONY: all
+all: v8_base_without_compiler
+
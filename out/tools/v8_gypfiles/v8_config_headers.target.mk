@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := v8_config_headers
+### Rules for final target.
+$(obj).target/tools/v8_gypfiles/v8_config_headers.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/tools/v8_gypfiles/v8_config_headers.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/tools/v8_gypfiles/v8_config_headers.stamp
+# Add target alias
+.PHONY: v8_config_headers
+v8_config_headers: $(obj).target/tools/v8_gypfiles/v8_config_headers.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: v8_config_headers
+
@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := v8_heap_base_headers
+### Rules for final target.
+$(obj).target/tools/v8_gypfiles/v8_heap_base_headers.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/tools/v8_gypfiles/v8_heap_base_headers.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/tools/v8_gypfiles/v8_heap_base_headers.stamp
+# Add target alias
+.PHONY: v8_heap_base_headers
+v8_heap_base_headers: $(obj).target/tools/v8_gypfiles/v8_heap_base_headers.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: v8_heap_base_headers
+
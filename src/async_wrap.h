@@ -34,14 +34,18 @@ namespace node {
 #define NODE_ASYNC_NON_CRYPTO_PROVIDER_TYPES(V)                               \
   V(NONE)                                                                     \
   V(DIRHANDLE)                                                                \
+  V(DIRWALKER)                                                                \
   V(DNSCHANNEL)                                                               \
   V(ELDHISTOGRAM)                                                             \
   V(FILEHANDLE)                                                               \
   V(FILEHANDLECLOSEREQ)                                                       \
+  V(FILEWRITER)                                                               \
   V(FIXEDSIZEBLOBCOPY)                                                        \
   V(FSEVENTWRAP)                                                              \
+  V(FSREADFILE)                                                               \
   V(FSREQCALLBACK)                                                            \
   V(FSREQPROMISE)                                                             \
+  V(FSSTATMANY)                                                               \
   V(GETADDRINFOREQWRAP)                                                       \
   V(GETNAMEINFOREQWRAP)                                                       \
   V(HEAPSNAPSHOT)                                                             \
@@ -60,6 +64,7 @@ namespace node {
   V(PROCESSWRAP)                                                              \
   V(PROMISE)                                                                  \
   V(QUERYWRAP)                                                                \
+  V(RECURSIVEFSEVENTWRAP)                                                     \
   V(SHUTDOWNWRAP)                                                             \
   V(SIGNALWRAP)                                                               \
   V(STATWATCHER)                                                              \
@@ -1433,6 +1433,9 @@ void AfterGetAddrInfo(uv_getaddrinfo_t* req, int status, struct addrinfo* res) {
   BaseObjectPtr<GetAddrInfoReqWrap> req_wrap{
       static_cast<GetAddrInfoReqWrap*>(req->data)};
   Environment* env = req_wrap->env();
+  env->threadpool_scheduler()->Finished(ThreadPoolWorkClass::kDns);
+  env->performance_state()->RecordThreadPoolWork(
+      ThreadPoolWorkClass::kDns, reinterpret_cast<uv_req_t*>(req));
 
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
@@ -1506,6 +1509,9 @@ void AfterGetNameInfo(uv_getnameinfo_t* req,
   BaseObjectPtr<GetNameInfoReqWrap> req_wrap{
       static_cast<GetNameInfoReqWrap*>(req->data)};
   Environment* env = req_wrap->env();
+  env->threadpool_scheduler()->Finished(ThreadPoolWorkClass::kDns);
+  env->performance_state()->RecordThreadPoolWork(
+      ThreadPoolWorkClass::kDns, reinterpret_cast<uv_req_t*>(req));
 
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
@@ -1602,9 +1608,11 @@ void GetAddrInfo(const FunctionCallbackInfo<Value>& args) {
                                *hostname,
                                nullptr,
                                &hints);
-  if (err == 0)
+  if (err == 0) {
+    env->threadpool_scheduler()->Started(ThreadPoolWorkClass::kDns);
     // Release ownership of the pointer allowing the ownership to be transferred
     USE(req_wrap.release());
+  }
 
   args.GetReturnValue().Set(err);
 }
@@ -1634,9 +1642,11 @@ void GetNameInfo(const FunctionCallbackInfo<Value>& args) {
                                AfterGetNameInfo,
                                reinterpret_cast<struct sockaddr*>(&addr),
                                NI_NAMEREQD);
-  if (err == 0)
+  if (err == 0) {
+    env->threadpool_scheduler()->Started(ThreadPoolWorkClass::kDns);
     // Release ownership of the pointer allowing the ownership to be transferred
     USE(req_wrap.release());
+  }
 
   args.GetReturnValue().Set(err);
 }
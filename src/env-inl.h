@@ -323,6 +323,14 @@ inline ImmediateInfo* Environment::immediate_info() {
   return &immediate_info_;
 }
 
+inline ThreadPoolScheduler* Environment::threadpool_scheduler() {
+  return &threadpool_scheduler_;
+}
+
+inline Doorbell* Environment::doorbell() {
+  return &doorbell_;
+}
+
 inline AliasedInt32Array& Environment::timeout_info() {
   return timeout_info_;
 }
@@ -351,6 +359,10 @@ inline void Environment::set_printed_error(bool value) {
   printed_error_ = value;
 }
 
+inline bool Environment::trace_sync_io() const {
+  return trace_sync_io_;
+}
+
 inline void Environment::set_trace_sync_io(bool value) {
   trace_sync_io_ = value;
 }
@@ -37,12 +37,14 @@
 #include "node.h"
 #include "node_binding.h"
 #include "node_builtins.h"
+#include "node_doorbell.h"
 #include "node_exit_code.h"
 #include "node_main_instance.h"
 #include "node_options.h"
 #include "node_perf_common.h"
 #include "node_realm.h"
 #include "node_snapshotable.h"
+#include "node_threadpool.h"
 #include "req_wrap.h"
 #include "util.h"
 #include "uv.h"
@@ -677,6 +679,8 @@ class Environment : public MemoryRetainer {
 
   inline AsyncHooks* async_hooks();
   inline ImmediateInfo* immediate_info();
+  inline ThreadPoolScheduler* threadpool_scheduler();
+  inline Doorbell* doorbell();
   inline AliasedInt32Array& timeout_info();
   inline TickInfo* tick_info();
   inline uint64_t timer_base() const;
@@ -689,6 +693,7 @@ class Environment : public MemoryRetainer {
   inline void set_printed_error(bool value);
 
   void PrintSyncTrace() const;
+  inline bool trace_sync_io() const;
   inline void set_trace_sync_io(bool value);
 
   inline void set_force_context_aware(bool value);
@@ -1009,6 +1014,8 @@ class Environment : public MemoryRetainer {
 
   AsyncHooks async_hooks_;
   ImmediateInfo immediate_info_;
+  ThreadPoolScheduler threadpool_scheduler_;
+  Doorbell doorbell_;
   AliasedInt32Array timeout_info_;
   TickInfo tick_info_;
   const uint64_t timer_base_;
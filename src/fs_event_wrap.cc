@@ -26,8 +26,21 @@
 #include "node_external_reference.h"
 #include "string_bytes.h"
 
+#ifdef __linux__
+#include "timer_wrap-inl.h"
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#endif  // __linux__
+
 namespace node {
 
+using v8::Array;
 using v8::Context;
 using v8::DontDelete;
 using v8::DontEnum;
@@ -43,6 +56,7 @@ using v8::PropertyAttribute;
 using v8::ReadOnly;
 using v8::Signature;
 using v8::String;
+using v8::Uint32;
 using v8::Value;
 
 namespace {
@@ -234,10 +248,490 @@ void FSEventWrap::OnEvent(uv_fs_event_t* handle, const char* filename,
   wrap->MakeCallback(env->onchange_string(), arraysize(argv), argv);
 }
 
+#ifdef __linux__
+// Watches a whole directory tree with a single inotify instance. libuv's
+// uv_fs_event_t only watches one directory on Linux, so this keeps a watch
+// descriptor for every subdirectory instead, adding and dropping them as
+// directories are created, moved and removed. Events are passed to JS in
+// batches, optionally coalesced over a time window so that a burst of writes
+// to one file is reported once.
+class RecursiveFSEventWrap : public HandleWrap {
+ public:
+  static void Initialize(Environment* env, Local<Object> target);
+  static void RegisterExternalReferences(ExternalReferenceRegistry* registry);
+  static void New(const FunctionCallbackInfo<Value>& args);
+  static void Start(const FunctionCallbackInfo<Value>& args);
+  static void GetInitialized(const FunctionCallbackInfo<Value>& args);
+
+  SET_NO_MEMORY_INFO()
+  SET_MEMORY_INFO_NAME(RecursiveFSEventWrap)
+  SET_SELF_SIZE(RecursiveFSEventWrap)
+
+ private:
+  static const encoding kDefaultEncoding = UTF8;
+  static constexpr uint32_t kEventMask =
+      IN_ATTRIB | IN_CREATE | IN_MODIFY | IN_DELETE | IN_DELETE_SELF |
+      IN_MOVE_SELF | IN_MOVED_FROM | IN_MOVED_TO;
+
+  struct Event {
+    bool rename;
+    std::string filename;
+  };
+
+  RecursiveFSEventWrap(Environment* env, Local<Object> object);
+  ~RecursiveFSEventWrap() override;
+
+  void OnClose() override;
+
+  std::string FullPath(const std::string& filename) const;
+  // Returns 0, or a negative libuv error code if the directory could not be
+  // watched for a reason other than it having gone away in the meantime.
+  int AddWatch(const std::string& filename);
+  void RemoveWatches(const std::string& filename);
+  // Watches all directories below `filename`, which must already be watched.
+  // With `report`, a 'rename' event is queued for every entry found, since
+  // they were created before the watch on their parent could see them.
+  int ScanTree(const std::string& filename, bool report);
+  // Brings the watches up to date after events were lost.
+  int Rescan();
+
+  void ReadEvents();
+  void QueueEvent(bool rename, std::string&& filename);
+  void Flush();
+  void EmitError(int status);
+
+  static void OnPoll(uv_poll_t* handle, int status, int events);
+
+  uv_poll_t handle_;
+  int fd_ = -1;
+  int root_wd_ = -1;
+  std::string root_;
+  std::string root_name_;
+  enum encoding encoding_ = kDefaultEncoding;
+  uint64_t coalesce_window_ = 0;
+  std::unique_ptr<TimerWrapHandle> timer_;
+  bool timer_armed_ = false;
+
+  // Watch descriptors and the paths, relative to root_, that they watch.
+  std::unordered_map<int, std::string> paths_;
+  std::unordered_map<std::string, int> watches_;
+
+  std::vector<Event> pending_;
+  // Index into pending_ by filename, only used while coalescing.
+  std::unordered_map<std::string, size_t> pending_index_;
+};
+
+RecursiveFSEventWrap::RecursiveFSEventWrap(Environment* env,
+                                           Local<Object> object)
+    : HandleWrap(env,
+                 object,
+                 reinterpret_cast<uv_handle_t*>(&handle_),
+                 AsyncWrap::PROVIDER_RECURSIVEFSEVENTWRAP) {
+  MarkAsUninitialized();
+}
+
+RecursiveFSEventWrap::~RecursiveFSEventWrap() {
+  if (fd_ != -1) close(fd_);
+}
+
+void RecursiveFSEventWrap::OnClose() {
+  timer_.reset();
+  close(fd_);
+  fd_ = -1;
+}
+
+void RecursiveFSEventWrap::GetInitialized(
+    const FunctionCallbackInfo<Value>& args) {
+  RecursiveFSEventWrap* wrap = Unwrap<RecursiveFSEventWrap>(args.This());
+  CHECK_NOT_NULL(wrap);
+  args.GetReturnValue().Set(!wrap->IsHandleClosing());
+}
+
+void RecursiveFSEventWrap::Initialize(Environment* env,
+                                      Local<Object> target) {
+  Isolate* isolate = env->isolate();
+
+  Local<FunctionTemplate> t = NewFunctionTemplate(isolate, New);
+  t->InstanceTemplate()->SetInternalFieldCount(
+      RecursiveFSEventWrap::kInternalFieldCount);
+
+  t->Inherit(HandleWrap::GetConstructorTemplate(env));
+  SetProtoMethod(isolate, t, "start", Start);
+
+  Local<FunctionTemplate> get_initialized_templ =
+      FunctionTemplate::New(isolate,
+                            GetInitialized,
+                            Local<Value>(),
+                            Signature::New(isolate, t));
+
+  t->PrototypeTemplate()->SetAccessorProperty(
+      FIXED_ONE_BYTE_STRING(isolate, "initialized"),
+      get_initialized_templ,
+      Local<FunctionTemplate>(),
+      static_cast<PropertyAttribute>(ReadOnly | DontDelete | DontEnum));
+
+  SetConstructorFunction(env->context(), target, "RecursiveFSEvent", t);
+}
+
+void RecursiveFSEventWrap::RegisterExternalReferences(
+    ExternalReferenceRegistry* registry) {
+  registry->Register(New);
+  registry->Register(Start);
+  registry->Register(GetInitialized);
+}
+
+void RecursiveFSEventWrap::New(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args.IsConstructCall());
+  Environment* env = Environment::GetCurrent(args);
+  new RecursiveFSEventWrap(env, args.This());
+}
+
+// wrap.start(filename, persistent, recursive, encoding, coalesceWindow)
+void RecursiveFSEventWrap::Start(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  RecursiveFSEventWrap* wrap = Unwrap<RecursiveFSEventWrap>(args.This());
+  CHECK_NOT_NULL(wrap);
+  CHECK(wrap->IsHandleClosing());  // Check that Start() has not been called.
+
+  CHECK_GE(args.Length(), 5);
+  BufferValue path(env->isolate(), args[0]);
+  CHECK_NOT_NULL(*path);
+  CHECK(args[2]->IsTrue());
+  CHECK(args[4]->IsUint32());
+
+  wrap->encoding_ = ParseEncoding(env->isolate(), args[3], kDefaultEncoding);
+  wrap->coalesce_window_ = args[4].As<Uint32>()->Value();
+
+  wrap->root_ = path.ToString();
+  while (wrap->root_.size() > 1 && wrap->root_.back() == '/')
+    wrap->root_.pop_back();
+  size_t slash = wrap->root_.rfind('/');
+  wrap->root_name_ = slash == std::string::npos ?
+      wrap->root_ : wrap->root_.substr(slash + 1);
+
+  wrap->fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (wrap->fd_ == -1)
+    return args.GetReturnValue().Set(uv_translate_sys_error(errno));
+
+  // Like uv_fs_event_t, a symbolic link is followed for the root only.
+  wrap->root_wd_ =
+      inotify_add_watch(wrap->fd_, wrap->root_.c_str(), kEventMask);
+  if (wrap->root_wd_ == -1) {
+    int err = uv_translate_sys_error(errno);
+    close(wrap->fd_);
+    wrap->fd_ = -1;
+    return args.GetReturnValue().Set(err);
+  }
+  wrap->paths_.emplace(wrap->root_wd_, std::string());
+  wrap->watches_.emplace(std::string(), wrap->root_wd_);
+
+  // Nothing is watched below a file, and ScanTree() fails with UV_ENOTDIR.
+  int err = wrap->ScanTree(std::string(), false);
+  if (err == UV_ENOTDIR) err = 0;
+
+  if (err == 0)
+    err = uv_poll_init(env->event_loop(), &wrap->handle_, wrap->fd_);
+  if (err != 0) {
+    close(wrap->fd_);
+    wrap->fd_ = -1;
+    return args.GetReturnValue().Set(err);
+  }
+
+  wrap->MarkAsInitialized();
+  err = uv_poll_start(&wrap->handle_, UV_READABLE, OnPoll);
+  if (err != 0) {
+    RecursiveFSEventWrap::Close(args);
+    return args.GetReturnValue().Set(err);
+  }
+
+  if (wrap->coalesce_window_ > 0) {
+    wrap->timer_ = std::make_unique<TimerWrapHandle>(env, [wrap]() {
+      wrap->timer_armed_ = false;
+      wrap->Flush();
+    });
+    wrap->timer_->Unref();
+  }
+
+  if (!args[1]->IsTrue()) {
+    uv_unref(reinterpret_cast<uv_handle_t*>(&wrap->handle_));
+  }
+
+  args.GetReturnValue().Set(0);
+}
+
+std::string RecursiveFSEventWrap::FullPath(const std::string& filename) const {
+  if (filename.empty()) return root_;
+  return root_ + "/" + filename;
+}
+
+int RecursiveFSEventWrap::AddWatch(const std::string& filename) {
+  int wd = inotify_add_watch(fd_,
+                             FullPath(filename).c_str(),
+                             kEventMask | IN_ONLYDIR | IN_DONT_FOLLOW);
+  if (wd == -1) {
+    if (errno == ENOENT || errno == ENOTDIR) return 0;
+    return uv_translate_sys_error(errno);
+  }
+  auto it = paths_.find(wd);
+  if (it != paths_.end()) watches_.erase(it->second);
+  paths_[wd] = filename;
+  watches_[filename] = wd;
+  return 0;
+}
+
+void RecursiveFSEventWrap::RemoveWatches(const std::string& filename) {
+  const std::string prefix = filename + "/";
+  for (auto it = watches_.begin(); it != watches_.end();) {
+    if (it->first == filename ||
+        it->first.compare(0, prefix.size(), prefix) == 0) {
+      inotify_rm_watch(fd_, it->second);
+      paths_.erase(it->second);
+      it = watches_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+int RecursiveFSEventWrap::ScanTree(const std::string& filename, bool report) {
+  std::vector<std::string> dirs { filename };
+  while (!dirs.empty()) {
+    std::string dir = std::move(dirs.back());
+    dirs.pop_back();
+
+    uv_fs_t req;
+    auto cleanup = OnScopeLeave([&req]() { uv_fs_req_cleanup(&req); });
+    int err = uv_fs_scandir(nullptr, &req, FullPath(dir).c_str(), 0, nullptr);
+    if (err < 0) {
+      // The root has to be readable, anything below may just have gone away
+      // or be inaccessible, which the directory watch can't do anything about.
+      if (dir == filename && !report) return err;
+      continue;
+    }
+
+    uv_dirent_t ent;
+    while (uv_fs_scandir_next(&req, &ent) != UV_EOF) {
+      std::string child = dir.empty() ? ent.name : dir + "/" + ent.name;
+      uv_dirent_type_t type = ent.type;
+      if (type == UV_DIRENT_UNKNOWN) {
+        uv_fs_t lstat_req;
+        if (uv_fs_lstat(nullptr, &lstat_req, FullPath(child).c_str(),
+                        nullptr) == 0 &&
+            S_ISDIR(lstat_req.statbuf.st_mode)) {
+          type = UV_DIRENT_DIR;
+        }
+        uv_fs_req_cleanup(&lstat_req);
+      }
+      if (report) QueueEvent(true, std::string(child));
+      if (type != UV_DIRENT_DIR) continue;
+      err = AddWatch(child);
+      if (err != 0) return err;
+      dirs.emplace_back(std::move(child));
+    }
+  }
+  return 0;
+}
+
+int RecursiveFSEventWrap::Rescan() {
+  // Drop the watches of directories that are gone. Their IN_IGNORED events
+  // may have been lost too.
+  for (auto it = watches_.begin(); it != watches_.end();) {
+    bool gone = false;
+    if (!it->first.empty()) {
+      uv_fs_t req;
+      gone = uv_fs_lstat(nullptr, &req, FullPath(it->first).c_str(),
+                         nullptr) != 0 ||
+             !S_ISDIR(req.statbuf.st_mode);
+      uv_fs_req_cleanup(&req);
+    }
+    if (gone) {
+      inotify_rm_watch(fd_, it->second);
+      paths_.erase(it->second);
+      it = watches_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  // Directories that were moved within the tree keep their watch descriptor,
+  // which AddWatch() maps to the new path.
+  int err = ScanTree(std::string(), false);
+  // The root itself being gone is reported by its own events.
+  if (err == UV_ENOENT || err == UV_ENOTDIR) err = 0;
+  return err;
+}
+
+void RecursiveFSEventWrap::OnPoll(uv_poll_t* handle, int status, int events) {
+  RecursiveFSEventWrap* wrap = static_cast<RecursiveFSEventWrap*>(handle->data);
+  if (status < 0) return wrap->EmitError(status);
+  wrap->ReadEvents();
+}
+
+void RecursiveFSEventWrap::ReadEvents() {
+  alignas(struct inotify_event) char buf[64 * 1024];
+  int err = 0;
+
+  for (;;) {
+    ssize_t size;
+    do {
+      size = read(fd_, buf, sizeof(buf));
+    } while (size == -1 && errno == EINTR);
+    if (size == -1) {
+      if (errno != EAGAIN && errno != EWOULDBLOCK)
+        err = uv_translate_sys_error(errno);
+      break;
+    }
+    if (size == 0) break;
+
+    for (const char* p = buf; p < buf + size;) {
+      const struct inotify_event* ev =
+          reinterpret_cast<const struct inotify_event*>(p);
+      p += sizeof(*ev) + ev->len;
+
+      // On IN_Q_OVERFLOW, events have been lost and there is no way to tell
+      // which. Report the root as renamed, so that JS knows to look at the
+      // whole tree again, and watch the directories created in the meantime.
+      if (ev->mask & IN_Q_OVERFLOW) {
+        QueueEvent(true, std::string(root_name_));
+        if (err == 0) err = Rescan();
+        continue;
+      }
+
+      auto it = paths_.find(ev->wd);
+      if (it == paths_.end()) continue;
+
+      if (ev->mask & IN_IGNORED) {
+        // The path may have been watched again by now, by a new directory.
+        auto watch = watches_.find(it->second);
+        if (watch != watches_.end() && watch->second == ev->wd)
+          watches_.erase(watch);
+        paths_.erase(it);
+        continue;
+      }
+
+      const bool is_root = ev->wd == root_wd_;
+      std::string filename;
+      if (ev->len > 0) {
+        filename = it->second.empty() ?
+            std::string(ev->name) : it->second + "/" + ev->name;
+      } else if (is_root) {
+        filename = root_name_;
+      } else {
+        // IN_DELETE_SELF and IN_MOVE_SELF of a subdirectory are also reported
+        // to its parent, by name.
+        continue;
+      }
+
+      const bool rename = !(ev->mask & (IN_ATTRIB | IN_MODIFY));
+      if (ev->len > 0 && (ev->mask & IN_ISDIR)) {
+        if (ev->mask & (IN_CREATE | IN_MOVED_TO)) {
+          QueueEvent(rename, std::string(filename));
+          if (err == 0) err = AddWatch(filename);
+          if (err == 0) err = ScanTree(filename, true);
+          continue;
+        }
+        if (ev->mask & IN_MOVED_FROM) RemoveWatches(filename);
+      }
+      QueueEvent(rename, std::move(filename));
+    }
+  }
+
+  if (coalesce_window_ == 0) {
+    Flush();
+  } else if (!timer_armed_ && !pending_.empty()) {
+    timer_armed_ = true;
+    timer_->Update(coalesce_window_);
+  }
+
+  // Pending events are still delivered when the watch limit is reached, so
+  // that JS sees what happened up to that point.
+  if (err != 0 && !IsHandleClosing()) EmitError(err);
+}
+
+void RecursiveFSEventWrap::QueueEvent(bool rename, std::string&& filename) {
+  if (coalesce_window_ > 0) {
+    auto it = pending_index_.find(filename);
+    if (it != pending_index_.end()) {
+      // As in FSEventWrap::OnEvent(), a rename implies a change.
+      pending_[it->second].rename |= rename;
+      return;
+    }
+    pending_index_.emplace(filename, pending_.size());
+  }
+  pending_.push_back(Event { rename, std::move(filename) });
+}
+
+void RecursiveFSEventWrap::Flush() {
+  if (pending_.empty() || IsHandleClosing()) return;
+
+  Isolate* isolate = env()->isolate();
+  HandleScope handle_scope(isolate);
+  Context::Scope context_scope(env()->context());
+
+  std::vector<Local<Value>> event_types(pending_.size());
+  std::vector<Local<Value>> filenames(pending_.size());
+  for (size_t i = 0; i < pending_.size(); i++) {
+    const std::string& filename = pending_[i].filename;
+    event_types[i] =
+        pending_[i].rename ? env()->rename_string() : env()->change_string();
+    Local<Value> error;
+    if (!StringBytes::Encode(isolate,
+                             filename.data(),
+                             filename.size(),
+                             encoding_,
+                             &error).ToLocal(&filenames[i])) {
+      filenames[i] = StringBytes::Encode(isolate,
+                                         filename.data(),
+                                         filename.size(),
+                                         BUFFER,
+                                         &error).ToLocalChecked();
+    }
+  }
+  pending_.clear();
+  pending_index_.clear();
+
+  Local<Value> argv[] = {
+    Integer::New(isolate, 0),
+    Array::New(isolate, event_types.data(), event_types.size()),
+    Array::New(isolate, filenames.data(), filenames.size()),
+  };
+  MakeCallback(env()->onbatch_string(), arraysize(argv), argv);
+}
+
+void RecursiveFSEventWrap::EmitError(int status) {
+  Isolate* isolate = env()->isolate();
+  HandleScope handle_scope(isolate);
+  Context::Scope context_scope(env()->context());
+
+  Local<Value> argv[] = {
+    Integer::New(isolate, status),
+    Undefined(isolate),
+    Undefined(isolate),
+  };
+  MakeCallback(env()->onbatch_string(), arraysize(argv), argv);
+}
+#endif  // __linux__
+
+void Initialize(Local<Object> target,
+                Local<Value> unused,
+                Local<Context> context,
+                void* priv) {
+  FSEventWrap::Initialize(target, unused, context, priv);
+#ifdef __linux__
+  RecursiveFSEventWrap::Initialize(Environment::GetCurrent(context), target);
+#endif
+}
+
+void RegisterExternalReferences(ExternalReferenceRegistry* registry) {
+  FSEventWrap::RegisterExternalReferences(registry);
+#ifdef __linux__
+  RecursiveFSEventWrap::RegisterExternalReferences(registry);
+#endif
+}
+
 }  // anonymous namespace
 }  // namespace node
 
-NODE_BINDING_CONTEXT_AWARE_INTERNAL(fs_event_wrap,
-                                    node::FSEventWrap::Initialize)
-NODE_BINDING_EXTERNAL_REFERENCE(fs_event_wrap,
-                                node::FSEventWrap::RegisterExternalReferences)
+NODE_BINDING_CONTEXT_AWARE_INTERNAL(fs_event_wrap, node::Initialize)
+NODE_BINDING_EXTERNAL_REFERENCE(fs_event_wrap, node::RegisterExternalReferences)
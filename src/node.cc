@@ -1195,6 +1195,19 @@ ExitCode LoadSnapshotDataAndRun(const SnapshotData** snapshot_data_ptr,
   return exit_code;
 }
 
+void ConfigureBusyPoll(uv_loop_t* loop) {
+  const int64_t spin = per_process::cli_options->event_loop_busy_poll;
+  const int64_t socket = per_process::cli_options->socket_busy_poll;
+  if (spin == 0 && socket == 0) return;
+  // Both values have been range checked, and rejected on platforms that
+  // don't support busy polling, by PerProcessOptions::CheckOptions().
+  CHECK_EQ(uv_loop_configure(loop,
+                             UV_LOOP_BUSY_POLL,
+                             static_cast<unsigned int>(spin),
+                             static_cast<unsigned int>(socket)),
+           0);
+}
+
 static ExitCode StartInternal(int argc, char** argv) {
   CHECK_GT(argc, 0);
 
@@ -1224,6 +1237,7 @@ static ExitCode StartInternal(int argc, char** argv) {
   });
 
   uv_loop_configure(uv_default_loop(), UV_METRICS_IDLE_TIME);
+  ConfigureBusyPoll(uv_default_loop());
 
   // --build-snapshot indicates that we are in snapshot building mode.
   if (per_process::cli_options->build_snapshot) {
@@ -408,6 +408,24 @@ class NODE_EXTERN IsolatePlatformDelegate {
   virtual bool IdleTasksEnabled() = 0;
 };
 
+// Counters for the tasks that a MultiIsolatePlatform runs on its worker
+// threads, as returned by MultiIsolatePlatform::GetWorkerTaskStatistics().
+struct WorkerTaskStatistics {
+  // Tasks that have been handed to the worker threads, including delayed
+  // tasks once their delay has expired.
+  uint64_t posted = 0;
+  // Tasks that a worker thread has picked up.
+  uint64_t started = 0;
+  // Tasks that a worker thread picked up from another thread's queue.
+  uint64_t stolen = 0;
+  // Tasks that did not fit into the bounded per-thread queues.
+  uint64_t overflowed = 0;
+  // Sum and maximum of the time that started tasks spent waiting for a
+  // worker thread, in nanoseconds.
+  uint64_t total_wait_ns = 0;
+  uint64_t max_wait_ns = 0;
+};
+
 class NODE_EXTERN MultiIsolatePlatform : public v8::Platform {
  public:
   ~MultiIsolatePlatform() override = default;
@@ -443,6 +461,11 @@ class NODE_EXTERN MultiIsolatePlatform : public v8::Platform {
                                           void (*callback)(void*),
                                           void* data) = 0;
 
+  // Returns counters for the tasks run on the platform's worker threads.
+  // This may be called from any thread. Platforms that do not keep track of
+  // these return all zeros.
+  virtual WorkerTaskStatistics GetWorkerTaskStatistics() { return {}; }
+
   static std::unique_ptr<MultiIsolatePlatform> Create(
       int thread_pool_size,
       v8::TracingController* tracing_controller = nullptr,
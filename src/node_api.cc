@@ -177,7 +177,8 @@ inline napi_env NewEnv(v8::Local<v8::Context> context,
   return result;
 }
 
-class ThreadSafeFunction : public node::AsyncResource {
+class ThreadSafeFunction : public node::AsyncResource,
+                           public node::DoorbellTarget {
  public:
   ThreadSafeFunction(v8::Local<v8::Function> func,
                      v8::Local<v8::Object> resource,
@@ -209,6 +210,7 @@ class ThreadSafeFunction : public node::AsyncResource {
 
   ~ThreadSafeFunction() override {
     node::RemoveEnvironmentCleanupHook(env->isolate, Cleanup, this);
+    env->node_env()->doorbell()->Cancel(this);
     env->Unref();
   }
 
@@ -286,7 +288,9 @@ class ThreadSafeFunction : public node::AsyncResource {
     ThreadSafeFunction* ts_fn = this;
     uv_loop_t* loop = env->node_env()->event_loop();
 
-    if (uv_async_init(loop, &async, AsyncCb) == 0) {
+    // Calls are announced through the Environment's Doorbell, see Send(). The
+    // handle only keeps the loop alive, so its callback never runs.
+    if (uv_async_init(loop, &async, [](uv_async_t*) {}) == 0) {
       if (max_queue_size > 0) {
         cond = std::make_unique<node::ConditionVariable>();
       }
@@ -328,15 +332,21 @@ class ThreadSafeFunction : public node::AsyncResource {
   inline void* Context() { return context; }
 
  protected:
-  void Dispatch() {
+  size_t OnDoorbell(size_t budget) override {
+    if (handles_closing) {
+      return 0;
+    }
+
     bool has_more = true;
+    size_t dispatched = 0;
 
-    // Limit maximum synchronous iteration count to prevent event loop
-    // starvation. See `src/node_messaging.cc` for an inspiration.
-    unsigned int iterations_left = kMaxIterationCount;
-    while (has_more && --iterations_left != 0) {
+    // The Doorbell limits the number of calls per event loop iteration that
+    // all threadsafe functions and MessagePorts share, to prevent event loop
+    // starvation.
+    while (has_more && dispatched < budget) {
       dispatch_state = kDispatchRunning;
       has_more = DispatchOne();
+      dispatched++;
 
       // Send() was called while we were executing the JS function
       if (dispatch_state.exchange(kDispatchIdle) != kDispatchRunning) {
@@ -347,6 +357,8 @@ class ThreadSafeFunction : public node::AsyncResource {
     if (has_more) {
       Send();
     }
+
+    return dispatched;
   }
 
   bool DispatchOne() {
@@ -433,13 +445,13 @@ class ThreadSafeFunction : public node::AsyncResource {
   }
 
   void Send() {
-    // Ask currently running Dispatch() to make one more iteration
+    // Ask currently running OnDoorbell() to make one more iteration
     unsigned char current_state = dispatch_state.fetch_or(kDispatchPending);
     if ((current_state & kDispatchRunning) == kDispatchRunning) {
       return;
     }
 
-    CHECK_EQ(0, uv_async_send(&async));
+    env->node_env()->doorbell()->Ring(this);
   }
 
   // Default way of calling into JavaScript. Used when ThreadSafeFunction is
@@ -466,12 +478,6 @@ class ThreadSafeFunction : public node::AsyncResource {
     }
   }
 
-  static void AsyncCb(uv_async_t* async) {
-    ThreadSafeFunction* ts_fn =
-        node::ContainerOf(&ThreadSafeFunction::async, async);
-    ts_fn->Dispatch();
-  }
-
   static void Cleanup(void* data) {
     reinterpret_cast<ThreadSafeFunction*>(data)->CloseHandlesAndMaybeDelete(
         true);
@@ -482,8 +488,6 @@ class ThreadSafeFunction : public node::AsyncResource {
   static const unsigned char kDispatchRunning = 1 << 0;
   static const unsigned char kDispatchPending = 1 << 1;
 
-  static const unsigned int kMaxIterationCount = 1000;
-
   // These are variables protected by the mutex.
   node::Mutex mutex;
   std::unique_ptr<node::ConditionVariable> cond;
@@ -1101,7 +1105,8 @@ class Work : public node::AsyncResource, public node::ThreadPoolWork {
             env->isolate,
             async_resource,
             *v8::String::Utf8Value(env->isolate, async_resource_name)),
-        ThreadPoolWork(env->node_env(), "node_api"),
+        ThreadPoolWork(
+            env->node_env(), "node_api", node::ThreadPoolWorkClass::kUser),
         _env(env),
         _data(data),
         _execute(execute),
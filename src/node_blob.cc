@@ -313,7 +313,7 @@ FixedSizeBlobCopyJob::FixedSizeBlobCopyJob(Environment* env,
                                            Blob* blob,
                                            FixedSizeBlobCopyJob::Mode mode)
     : AsyncWrap(env, object, AsyncWrap::PROVIDER_FIXEDSIZEBLOBCOPY),
-      ThreadPoolWork(env, "blob"),
+      ThreadPoolWork(env, "blob", ThreadPoolWorkClass::kUser),
       mode_(mode) {
   if (mode == FixedSizeBlobCopyJob::Mode::SYNC) MakeWeak();
   source_ = blob->entries();
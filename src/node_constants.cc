@@ -22,6 +22,7 @@
 #include "env-inl.h"
 #include "node_constants.h"
 #include "node_internals.h"
+#include "node_threadpool.h"
 #include "util-inl.h"
 
 #include "zlib.h"
@@ -63,8 +64,10 @@
 
 namespace node {
 
+using v8::Array;
 using v8::Local;
 using v8::Object;
+using v8::Value;
 
 namespace {
 
@@ -1380,6 +1383,10 @@ void DefineConstants(v8::Isolate* isolate, Local<Object> target) {
   CHECK(trace_constants->SetPrototype(env->context(),
                                       Null(env->isolate())).FromJust());
 
+  Local<Object> threadpool_constants = Object::New(isolate);
+  CHECK(threadpool_constants->SetPrototype(env->context(),
+                                           Null(env->isolate())).FromJust());
+
   DefineErrnoConstants(err_constants);
   DefineWindowsErrorConstants(err_constants);
   DefineSignalConstants(sig_constants);
@@ -1393,6 +1400,18 @@ void DefineConstants(v8::Isolate* isolate, Local<Object> target) {
   // Define libuv constants.
   NODE_DEFINE_CONSTANT(os_constants, UV_UDP_REUSEADDR);
 
+  // Names of the ThreadPoolWorkClass values, in order.
+  Local<Value> threadpool_classes[] = {
+#define V(_, name) OneByteString(isolate, name),
+      THREADPOOL_WORK_CLASSES(V)
+#undef V
+  };
+  threadpool_constants->Set(env->context(),
+                            OneByteString(isolate, "classes"),
+                            Array::New(isolate,
+                                       threadpool_classes,
+                                       arraysize(threadpool_classes))).Check();
+
   os_constants->Set(env->context(),
                     OneByteString(isolate, "dlopen"),
                     dlopen_constants).Check();
@@ -1420,6 +1439,9 @@ void DefineConstants(v8::Isolate* isolate, Local<Object> target) {
   target->Set(env->context(),
               OneByteString(isolate, "trace"),
               trace_constants).Check();
+  target->Set(env->context(),
+              OneByteString(isolate, "threadpool"),
+              threadpool_constants).Check();
 }
 
 }  // namespace node
@@ -3,6 +3,7 @@
 #include "node_file-inl.h"
 #include "node_process-inl.h"
 #include "memory_tracker-inl.h"
+#include "threadpoolwork-inl.h"
 #include "util.h"
 
 #include "tracing/trace_event.h"
@@ -16,6 +17,12 @@
 #include <cerrno>
 #include <climits>
 
+#ifdef __linux__
+#include <dirent.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #include <memory>
 
 namespace node {
@@ -28,6 +35,7 @@ using fs::FSReqWrapSync;
 using fs::GetReqWrap;
 
 using v8::Array;
+using v8::ArrayBuffer;
 using v8::Context;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
@@ -40,6 +48,8 @@ using v8::Null;
 using v8::Number;
 using v8::Object;
 using v8::ObjectTemplate;
+using v8::Uint32Array;
+using v8::Uint8Array;
 using v8::Value;
 
 static const char* get_dir_func_name_by_type(uv_fs_type req_type) {
@@ -394,6 +404,490 @@ static void OpenDir(const FunctionCallbackInfo<Value>& args) {
   }
 }
 
+// Large enough for a few thousand entries per getdents64() call.
+static constexpr size_t kGetdentsBufferSize = 128 * 1024;
+// Number of threadpool threads that a single walk may use at a time.
+static constexpr size_t kDirWalkerMaxJobs = 4;
+
+static int DirentTypeFromMode(uint64_t mode) {
+  switch (mode & S_IFMT) {
+    case S_IFREG: return UV_DIRENT_FILE;
+    case S_IFDIR: return UV_DIRENT_DIR;
+    case S_IFLNK: return UV_DIRENT_LINK;
+    case S_IFCHR: return UV_DIRENT_CHAR;
+#ifdef S_IFIFO
+    case S_IFIFO: return UV_DIRENT_FIFO;
+#endif
+#ifdef S_IFSOCK
+    case S_IFSOCK: return UV_DIRENT_SOCKET;
+#endif
+#ifdef S_IFBLK
+    case S_IFBLK: return UV_DIRENT_BLOCK;
+#endif
+    default: return UV_DIRENT_UNKNOWN;
+  }
+}
+
+#ifdef __linux__
+static int DirentTypeFromDType(unsigned char type) {
+  switch (type) {
+    case DT_REG: return UV_DIRENT_FILE;
+    case DT_DIR: return UV_DIRENT_DIR;
+    case DT_LNK: return UV_DIRENT_LINK;
+    case DT_CHR: return UV_DIRENT_CHAR;
+    case DT_FIFO: return UV_DIRENT_FIFO;
+    case DT_SOCK: return UV_DIRENT_SOCKET;
+    case DT_BLK: return UV_DIRENT_BLOCK;
+    default: return UV_DIRENT_UNKNOWN;
+  }
+}
+#endif
+
+// Matches `name` against a pattern in which `*` matches any number of
+// characters and `?` matches a single character.
+static bool MatchesPattern(const std::string& pattern,
+                           const char* name,
+                           size_t name_length) {
+  size_t p = 0;
+  size_t n = 0;
+  size_t star = std::string::npos;
+  size_t star_match = 0;
+  while (n < name_length) {
+    if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n])) {
+      p++;
+      n++;
+    } else if (p < pattern.size() && pattern[p] == '*') {
+      star = p++;
+      star_match = n;
+    } else if (star != std::string::npos) {
+      // Let the last `*` match one more character and try again.
+      p = star + 1;
+      n = ++star_match;
+    } else {
+      return false;
+    }
+  }
+  while (p < pattern.size() && pattern[p] == '*') p++;
+  return p == pattern.size();
+}
+
+static bool MatchesAnyPattern(const std::vector<std::string>& patterns,
+                              const char* name,
+                              size_t name_length) {
+  for (const std::string& pattern : patterns) {
+    if (MatchesPattern(pattern, name, name_length)) return true;
+  }
+  return false;
+}
+
+size_t DirWalkBatch::self_size() const {
+  size_t size = sizeof(*this) + types.size() +
+                parents.size() * sizeof(parents[0]);
+  for (const std::string& dir : dirs) size += sizeof(dir) + dir.size();
+  for (const std::string& name : names) size += sizeof(name) + name.size();
+  return size;
+}
+
+DirWalk::DirWalk(std::string&& root,
+                 std::vector<std::string>&& include,
+                 std::vector<std::string>&& exclude,
+                 size_t max_jobs)
+    : root_(std::move(root)),
+      include_(std::move(include)),
+      exclude_(std::move(exclude)),
+      max_jobs_(max_jobs) {
+  pending_.emplace_back();
+}
+
+void DirWalk::Work(DirWalkBatch* batch,
+                   std::vector<char>* buffer,
+                   size_t max_entries,
+                   bool yield) {
+  std::string dir;
+  while (batch->size() < max_entries && Next(&dir)) {
+    ReadDirectory(dir, batch, buffer);
+    if (yield && ShouldYield()) break;
+  }
+}
+
+bool DirWalk::StartJob() {
+  Mutex::ScopedLock lock(mutex_);
+  if (error_ != 0 || pending_.empty() || running_jobs_ >= max_jobs_)
+    return false;
+  running_jobs_++;
+  return true;
+}
+
+bool DirWalk::JobFinished() {
+  Mutex::ScopedLock lock(mutex_);
+  CHECK_GT(running_jobs_, 0);
+  running_jobs_--;
+  return running_jobs_ == 0 && (error_ != 0 || pending_.empty());
+}
+
+void DirWalk::Cancel() {
+  Fail(UV_ECANCELED, "scandir", root_);
+}
+
+int DirWalk::error(const char** syscall, std::string* path) {
+  Mutex::ScopedLock lock(mutex_);
+  *syscall = error_syscall_;
+  *path = error_path_;
+  return error_;
+}
+
+bool DirWalk::Next(std::string* dir) {
+  Mutex::ScopedLock lock(mutex_);
+  if (error_ != 0 || pending_.empty()) return false;
+  *dir = std::move(pending_.front());
+  pending_.pop_front();
+  return true;
+}
+
+bool DirWalk::ShouldYield() {
+  Mutex::ScopedLock lock(mutex_);
+  // Returning lets the main thread start another job for the directories
+  // that this one would otherwise read on its own.
+  return pending_.size() > 1 && running_jobs_ < max_jobs_;
+}
+
+void DirWalk::Fail(int err, const char* syscall, const std::string& path) {
+  Mutex::ScopedLock lock(mutex_);
+  if (error_ != 0) return;
+  error_ = err;
+  error_syscall_ = syscall;
+  error_path_ = path;
+}
+
+void DirWalk::ReadDirectory(const std::string& dir,
+                            DirWalkBatch* batch,
+                            std::vector<char>* buffer) {
+  std::string dir_path = root_;
+  if (!dir.empty()) {
+    dir_path += kPathSeparator;
+    dir_path += dir;
+  }
+  batch->dirs.push_back(dir);
+  std::vector<std::string> subdirs;
+
+#ifdef __linux__
+  // Unlike readdir(), this reads as many entries per syscall as fit into the
+  // buffer.
+  int fd = open(dir_path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (fd == -1)
+    return Fail(uv_translate_sys_error(errno), "scandir", dir_path);
+  if (buffer->empty()) buffer->resize(kGetdentsBufferSize);
+  for (;;) {
+    long nread =  // NOLINT(runtime/int)
+        syscall(SYS_getdents64, fd, buffer->data(), buffer->size());
+    if (nread == 0) break;
+    if (nread < 0) {
+      if (errno == EINTR) continue;
+      Fail(uv_translate_sys_error(errno), "scandir", dir_path);
+      break;
+    }
+    for (long offset = 0; offset < nread;) {  // NOLINT(runtime/int)
+      const struct dirent64* ent =
+          reinterpret_cast<const struct dirent64*>(buffer->data() + offset);
+      offset += ent->d_reclen;
+      AddEntry(dir,
+               dir_path,
+               ent->d_name,
+               strlen(ent->d_name),
+               DirentTypeFromDType(ent->d_type),
+               batch,
+               &subdirs);
+    }
+  }
+  close(fd);
+#else
+  uv_fs_t req;
+  int err = uv_fs_scandir(nullptr, &req, dir_path.c_str(), 0, nullptr);
+  if (err >= 0) {
+    uv_dirent_t ent;
+    while ((err = uv_fs_scandir_next(&req, &ent)) == 0) {
+      AddEntry(
+          dir, dir_path, ent.name, strlen(ent.name), ent.type, batch, &subdirs);
+    }
+  }
+  uv_fs_req_cleanup(&req);
+  if (err != UV_EOF) Fail(err, "scandir", dir_path);
+#endif
+
+  if (subdirs.empty()) return;
+  Mutex::ScopedLock lock(mutex_);
+  for (std::string& subdir : subdirs) pending_.push_back(std::move(subdir));
+}
+
+void DirWalk::AddEntry(const std::string& dir,
+                       const std::string& dir_path,
+                       const char* name,
+                       size_t name_length,
+                       int type,
+                       DirWalkBatch* batch,
+                       std::vector<std::string>* subdirs) {
+  if (name[0] == '.' &&
+      (name_length == 1 || (name_length == 2 && name[1] == '.'))) {
+    return;
+  }
+  if (MatchesAnyPattern(exclude_, name, name_length)) return;
+
+  if (type == UV_DIRENT_UNKNOWN) {
+    // Some file systems don't report types, find out here rather than
+    // leaving it to JS.
+    std::string path = dir_path + kPathSeparator;
+    path.append(name, name_length);
+    uv_fs_t req;
+    int err = uv_fs_lstat(nullptr, &req, path.c_str(), nullptr);
+    if (err == 0) type = DirentTypeFromMode(req.statbuf.st_mode);
+    uv_fs_req_cleanup(&req);
+    if (err == UV_ENOENT) return;  // Removed since it was listed.
+    if (err < 0) return Fail(err, "lstat", path);
+  }
+
+  if (type == UV_DIRENT_DIR) {
+    std::string subdir = dir;
+    if (!subdir.empty()) subdir += kPathSeparator;
+    subdir.append(name, name_length);
+    subdirs->push_back(std::move(subdir));
+  }
+
+  if (include_.empty() || MatchesAnyPattern(include_, name, name_length)) {
+    batch->names.emplace_back(name, name_length);
+    batch->types.push_back(type);
+    batch->parents.push_back(batch->dirs.size() - 1);
+  }
+}
+
+static bool ToStringVector(Isolate* isolate,
+                           Local<Context> context,
+                           Local<Value> value,
+                           std::vector<std::string>* out) {
+  if (value->IsUndefined()) return true;
+  CHECK(value->IsArray());
+  Local<Array> array = value.As<Array>();
+  out->reserve(array->Length());
+  for (uint32_t i = 0; i < array->Length(); i++) {
+    Local<Value> element;
+    if (!array->Get(context, i).ToLocal(&element)) return false;
+    BufferValue string(isolate, element);
+    CHECK_NOT_NULL(*string);
+    out->emplace_back(*string, string.length());
+  }
+  return true;
+}
+
+static std::unique_ptr<DirWalk> NewDirWalk(
+    Environment* env,
+    const FunctionCallbackInfo<Value>& args,
+    size_t max_jobs) {
+  Isolate* isolate = env->isolate();
+  BufferValue path(isolate, args[0]);
+  CHECK_NOT_NULL(*path);
+  std::vector<std::string> include;
+  std::vector<std::string> exclude;
+  if (!ToStringVector(isolate, env->context(), args[2], &include) ||
+      !ToStringVector(isolate, env->context(), args[3], &exclude)) {
+    return nullptr;
+  }
+  return std::make_unique<DirWalk>(std::string(*path, path.length()),
+                                   std::move(include),
+                                   std::move(exclude),
+                                   max_jobs);
+}
+
+// Returns [dirs, names, types, parents], see DirWalkBatch.
+static MaybeLocal<Array> DirWalkBatchToArray(Environment* env,
+                                             const DirWalkBatch& batch,
+                                             enum encoding encoding,
+                                             Local<Value>* err_out) {
+  Isolate* isolate = env->isolate();
+  auto encode = [&](const std::vector<std::string>& strings)
+      -> MaybeLocal<Array> {
+    MaybeStackBuffer<Local<Value>, 64> values(strings.size());
+    for (size_t i = 0; i < strings.size(); i++) {
+      if (!StringBytes::Encode(isolate,
+                               strings[i].data(),
+                               strings[i].size(),
+                               encoding,
+                               err_out).ToLocal(&values[i])) {
+        return MaybeLocal<Array>();
+      }
+    }
+    return Array::New(isolate, values.out(), strings.size());
+  };
+
+  Local<Value> result[4];
+  Local<Array> dirs;
+  Local<Array> names;
+  if (!encode(batch.dirs).ToLocal(&dirs) ||
+      !encode(batch.names).ToLocal(&names)) {
+    return MaybeLocal<Array>();
+  }
+  result[0] = dirs;
+  result[1] = names;
+
+  const size_t count = batch.size();
+  Local<ArrayBuffer> types_buffer = ArrayBuffer::New(isolate, count);
+  if (count > 0) memcpy(types_buffer->Data(), batch.types.data(), count);
+  result[2] = Uint8Array::New(types_buffer, 0, count);
+
+  Local<ArrayBuffer> parents_buffer =
+      ArrayBuffer::New(isolate, count * sizeof(uint32_t));
+  if (count > 0) {
+    memcpy(parents_buffer->Data(),
+           batch.parents.data(),
+           count * sizeof(uint32_t));
+  }
+  result[3] = Uint32Array::New(parents_buffer, 0, count);
+
+  return Array::New(isolate, result, arraysize(result));
+}
+
+class DirWalker::Job final : public ThreadPoolWork {
+ public:
+  explicit Job(DirWalker* walker)
+      : ThreadPoolWork(walker->env(), "fs", ThreadPoolWorkClass::kFs),
+        walker_(walker) {}
+
+  void DoThreadPoolWork() override {
+    walker_->walk_->Work(&batch_, &buffer_, DirWalk::kBatchSize, true);
+  }
+
+  void AfterThreadPoolWork(int status) override {
+    std::unique_ptr<Job> ptr(this);
+    walker_->OnJobDone(status, batch_);
+  }
+
+ private:
+  BaseObjectPtr<DirWalker> walker_;
+  DirWalkBatch batch_;
+  std::vector<char> buffer_;
+};
+
+DirWalker::DirWalker(Environment* env,
+                     Local<Object> object,
+                     std::unique_ptr<DirWalk> walk,
+                     enum encoding encoding)
+    : AsyncWrap(env, object, AsyncWrap::PROVIDER_DIRWALKER),
+      walk_(std::move(walk)),
+      encoding_(encoding) {}
+
+void DirWalker::New(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args.IsConstructCall());
+  const enum encoding encoding = ParseEncoding(env->isolate(), args[1], UTF8);
+  std::unique_ptr<DirWalk> walk = NewDirWalk(env, args, kDirWalkerMaxJobs);
+  if (!walk) return;
+  new DirWalker(env, args.This(), std::move(walk), encoding);
+}
+
+void DirWalker::Start(const FunctionCallbackInfo<Value>& args) {
+  DirWalker* walker;
+  ASSIGN_OR_RETURN_UNWRAP(&walker, args.Holder());
+  walker->StartJobs();
+}
+
+void DirWalker::StartJobs() {
+  while (walk_->StartJob()) {
+    Job* job = new Job(this);
+    job->ScheduleWork();
+  }
+}
+
+void DirWalker::OnJobDone(int status, const DirWalkBatch& batch) {
+  Environment* env = this->env();
+  Isolate* isolate = env->isolate();
+  CHECK(status == 0 || status == UV_ECANCELED);
+  if (status == UV_ECANCELED) walk_->Cancel();
+  const bool finished = walk_->JobFinished();
+  if (failed_ || !env->can_call_into_js()) return;
+  // Keep the other threads busy while JS processes this batch.
+  StartJobs();
+
+  HandleScope handle_scope(isolate);
+  Context::Scope context_scope(env->context());
+
+  const char* syscall;
+  std::string path;
+  int err = walk_->error(&syscall, &path);
+  if (err == 0 && batch.size() > 0) {
+    Local<Value> error;
+    Local<Array> entries;
+    if (!DirWalkBatchToArray(env, batch, encoding_, &error)
+             .ToLocal(&entries)) {
+      failed_ = true;
+      walk_->Cancel();
+      if (error.IsEmpty()) return;  // Exception pending.
+      MakeCallback(env->oncomplete_string(), 1, &error);
+      return;
+    }
+    Local<Value> arg = entries;
+    if (MakeCallback(env->onbatch_string(), 1, &arg).IsEmpty()) {
+      failed_ = true;
+      walk_->Cancel();
+      return;
+    }
+  }
+
+  if (!finished) return;
+  Local<Value> arg = Null(isolate);
+  if (err != 0) arg = UVException(isolate, err, syscall, nullptr, path.c_str());
+  MakeCallback(env->oncomplete_string(), 1, &arg);
+}
+
+void DirWalker::WalkSync(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+  CHECK_EQ(args.Length(), 6);
+  const enum encoding encoding = ParseEncoding(isolate, args[1], UTF8);
+  std::unique_ptr<DirWalk> walk = NewDirWalk(env, args, 1);
+  if (!walk) return;
+
+  DirWalkBatch batch;
+  std::vector<char> buffer;
+  CHECK(walk->StartJob());
+  walk->Work(&batch, &buffer, SIZE_MAX, false);
+  CHECK(walk->JobFinished());
+
+  Local<Object> ctx = args[5].As<Object>();
+  const char* syscall;
+  std::string path;
+  int err = walk->error(&syscall, &path);
+  Local<Value> error;
+  if (err != 0) {
+    error = UVException(isolate, err, syscall, nullptr, path.c_str());
+  } else {
+    Local<Array> entries;
+    if (DirWalkBatchToArray(env, batch, encoding, &error).ToLocal(&entries))
+      return args.GetReturnValue().Set(entries);
+    if (error.IsEmpty()) return;  // Exception pending.
+  }
+  USE(ctx->Set(env->context(), env->error_string(), error));
+}
+
+void DirWalker::MemoryInfo(MemoryTracker* tracker) const {
+  tracker->TrackFieldWithSize("walk", sizeof(DirWalk));
+}
+
+void DirWalker::Initialize(Environment* env, Local<Object> target) {
+  Isolate* isolate = env->isolate();
+  Local<FunctionTemplate> walker = NewFunctionTemplate(isolate, New);
+  walker->Inherit(AsyncWrap::GetConstructorTemplate(env));
+  walker->InstanceTemplate()->SetInternalFieldCount(
+      AsyncWrap::kInternalFieldCount);
+  SetProtoMethod(isolate, walker, "start", Start);
+  SetConstructorFunction(env->context(), target, "DirWalker", walker);
+  SetMethod(env->context(), target, "walkSync", WalkSync);
+}
+
+void DirWalker::RegisterExternalReferences(
+    ExternalReferenceRegistry* registry) {
+  registry->Register(New);
+  registry->Register(Start);
+  registry->Register(WalkSync);
+}
+
 void Initialize(Local<Object> target,
                 Local<Value> unused,
                 Local<Context> context,
@@ -412,6 +906,8 @@ void Initialize(Local<Object> target,
   dirt->SetInternalFieldCount(DirHandle::kInternalFieldCount);
   SetConstructorFunction(context, target, "DirHandle", dir);
   env->set_dir_instance_template(dirt);
+
+  DirWalker::Initialize(env, target);
 }
 
 void RegisterExternalReferences(ExternalReferenceRegistry* registry) {
@@ -419,6 +915,7 @@ void RegisterExternalReferences(ExternalReferenceRegistry* registry) {
   registry->Register(DirHandle::New);
   registry->Register(DirHandle::Read);
   registry->Register(DirHandle::Close);
+  DirWalker::RegisterExternalReferences(registry);
 }
 
 }  // namespace fs_dir
@@ -4,6 +4,11 @@
 #if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
 
 #include "node_file.h"
+#include "node_mutex.h"
+
+#include <deque>
+#include <string>
+#include <vector>
 
 namespace node {
 
@@ -43,6 +48,126 @@ class DirHandle : public AsyncWrap {
   bool closed_ = false;
 };
 
+// Entries found by a DirWalk, grouped by the directory they were found in.
+// Directories are relative to the root of the walk, "" being the root itself.
+struct DirWalkBatch {
+  std::vector<std::string> dirs;
+  std::vector<std::string> names;
+  std::vector<uint8_t> types;  // uv_dirent_type_t
+  std::vector<uint32_t> parents;  // Index into `dirs` for each entry.
+
+  size_t size() const { return names.size(); }
+  size_t self_size() const;
+};
+
+// The thread-safe part of a recursive directory walk. Directories that still
+// have to be read are kept in a shared queue, so that several threads can
+// read them in parallel. On Linux, directories are read with getdents64()
+// into a large buffer rather than one readdir() call per entry. Entries of
+// unknown type are lstat()ed, so that all reported types are known.
+//
+// `include` and `exclude` are glob patterns that are matched against the
+// names of entries, where `*` matches any number of characters and `?` one
+// character. Excluded directories are not descended into. Entries that match
+// no pattern from a non-empty `include` list are not reported, but
+// directories are still descended into.
+class DirWalk final {
+ public:
+  DirWalk(std::string&& root,
+          std::vector<std::string>&& include,
+          std::vector<std::string>&& exclude,
+          size_t max_jobs);
+
+  DirWalk(const DirWalk&) = delete;
+  DirWalk& operator=(const DirWalk&) = delete;
+
+  // Reads directories from the queue into `batch` until it has at least
+  // `max_entries` entries or the queue is empty. With `yield`, it also returns
+  // early once there is enough work in the queue for another job.
+  void Work(DirWalkBatch* batch,
+            std::vector<char>* buffer,
+            size_t max_entries,
+            bool yield);
+
+  // Returns true and counts a new job if there is room for another job and
+  // work to give it.
+  bool StartJob();
+  // Returns true if this was the last job and the walk is over.
+  bool JobFinished();
+
+  // Makes all jobs stop as soon as possible.
+  void Cancel();
+  // Returns 0 if no error occurred, or the first error otherwise.
+  int error(const char** syscall, std::string* path);
+
+  static constexpr size_t kBatchSize = 4096;
+
+ private:
+  bool Next(std::string* dir);
+  bool ShouldYield();
+  void Fail(int err, const char* syscall, const std::string& path);
+  void ReadDirectory(const std::string& dir,
+                     DirWalkBatch* batch,
+                     std::vector<char>* buffer);
+  void AddEntry(const std::string& dir,
+                const std::string& dir_path,
+                const char* name,
+                size_t name_length,
+                int type,
+                DirWalkBatch* batch,
+                std::vector<std::string>* subdirs);
+
+  const std::string root_;
+  const std::vector<std::string> include_;
+  const std::vector<std::string> exclude_;
+  const size_t max_jobs_;
+
+  Mutex mutex_;
+  // Guarded by mutex_.
+  std::deque<std::string> pending_;
+  size_t running_jobs_ = 0;
+  int error_ = 0;
+  const char* error_syscall_ = nullptr;
+  std::string error_path_;
+};
+
+// Runs a DirWalk on up to `max_jobs` threadpool threads at a time for
+// fs.readdir() with `recursive: true`. Each finished job passes its entries
+// to `onbatch(dirs, names, types, parents)`, and `oncomplete(err)` is called
+// once the whole tree has been read or the walk failed.
+class DirWalker final : public AsyncWrap {
+ public:
+  static void Initialize(Environment* env, v8::Local<v8::Object> target);
+  static void RegisterExternalReferences(ExternalReferenceRegistry* registry);
+
+  // new DirWalker(path, encoding, include, exclude)
+  static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Start(const v8::FunctionCallbackInfo<v8::Value>& args);
+  // walkSync(path, encoding, include, exclude, undefined, ctx)
+  static void WalkSync(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  void MemoryInfo(MemoryTracker* tracker) const override;
+  SET_MEMORY_INFO_NAME(DirWalker)
+  SET_SELF_SIZE(DirWalker)
+
+ private:
+  class Job;
+
+  DirWalker(Environment* env,
+            v8::Local<v8::Object> object,
+            std::unique_ptr<DirWalk> walk,
+            enum encoding encoding);
+
+  void StartJobs();
+  void OnJobDone(int status, const DirWalkBatch& batch);
+
+  std::unique_ptr<DirWalk> walk_;
+  enum encoding encoding_;
+  // Set once `oncomplete` has been called early because of an error that
+  // happened on this thread.
+  bool failed_ = false;
+};
+
 }  // namespace fs_dir
 
 }  // namespace node
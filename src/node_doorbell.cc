@@ -0,0 +1,66 @@
+#include "node_doorbell.h"
+#include "util-inl.h"
+
+#include <algorithm>
+
+namespace node {
+
+void Doorbell::Initialize(uv_loop_t* loop) {
+  CHECK_EQ(0, uv_async_init(loop, &async_, OnAsync));
+  // Targets keep the loop alive through handles of their own.
+  uv_unref(handle());
+
+  Mutex::ScopedLock lock(mutex_);
+  initialized_ = true;
+  if (!pending_.IsEmpty())
+    CHECK_EQ(0, uv_async_send(&async_));
+}
+
+void Doorbell::Stop() {
+  Mutex::ScopedLock lock(mutex_);
+  initialized_ = false;
+}
+
+void Doorbell::Ring(DoorbellTarget* target) {
+  Mutex::ScopedLock lock(mutex_);
+  if (!target->doorbell_node_.IsEmpty()) return;  // Already waiting.
+  // If other targets are waiting, a wakeup is pending or Drain() is running
+  // and will get to this one as well.
+  bool wake_up = pending_.IsEmpty();
+  pending_.PushBack(target);
+  if (wake_up && initialized_)
+    CHECK_EQ(0, uv_async_send(&async_));
+}
+
+void Doorbell::Cancel(DoorbellTarget* target) {
+  Mutex::ScopedLock lock(mutex_);
+  target->doorbell_node_.Remove();
+}
+
+void Doorbell::OnAsync(uv_async_t* handle) {
+  Doorbell* doorbell = ContainerOf(&Doorbell::async_, handle);
+  doorbell->Drain();
+}
+
+void Doorbell::Drain() {
+  size_t budget = kBudget;
+  // Targets are popped one at a time rather than all at once, because one
+  // target's callback may cancel another one that is waiting.
+  while (budget > 0) {
+    DoorbellTarget* target;
+    {
+      Mutex::ScopedLock lock(mutex_);
+      target = pending_.PopFront();
+    }
+    if (target == nullptr) return;
+    // Count every visit so that targets that process nothing cannot keep
+    // this loop going forever by ringing again.
+    budget -= std::clamp<size_t>(target->OnDoorbell(budget), 1, budget);
+  }
+
+  Mutex::ScopedLock lock(mutex_);
+  if (!pending_.IsEmpty() && initialized_)
+    CHECK_EQ(0, uv_async_send(&async_));
+}
+
+}  // namespace node
@@ -0,0 +1,74 @@
+#ifndef SRC_NODE_DOORBELL_H_
+#define SRC_NODE_DOORBELL_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include "node_mutex.h"
+#include "util.h"
+#include "uv.h"
+
+#include <cstddef>
+
+namespace node {
+
+// Something that other threads hand work to and that needs to be woken up on
+// its Environment's thread to process it, e.g. a MessagePort or a napi
+// threadsafe function.
+class DoorbellTarget {
+ public:
+  virtual ~DoorbellTarget() = default;
+
+  // Called on the loop thread after the target rang the doorbell. Processes
+  // at most `budget` items and returns how many it processed. A target that
+  // has more work left rings again to be called back later.
+  virtual size_t OnDoorbell(size_t budget) = 0;
+
+ private:
+  friend class Doorbell;
+  ListNode<DoorbellTarget> doorbell_node_;  // Guarded by Doorbell::mutex_.
+};
+
+// One uv_async_t per Environment that all of its DoorbellTargets share.
+//
+// Ringing only wakes up the loop when no other target is waiting already, so
+// that a burst of cross-thread messages to many ports costs one wakeup rather
+// than one per port, and libuv doesn't have to scan one uv_async_t per port to
+// find the ones that fired. Waiting targets are processed in the order they
+// rang, up to kBudget items per loop iteration in total. Whatever is left over
+// then waits for the next iteration, so that the loop keeps processing I/O and
+// timers under a flood of messages.
+class Doorbell {
+ public:
+  static constexpr size_t kBudget = 1000;
+
+  Doorbell() = default;
+  Doorbell(const Doorbell&) = delete;
+  Doorbell& operator=(const Doorbell&) = delete;
+
+  // Must be called on the loop thread.
+  void Initialize(uv_loop_t* loop);
+  void Stop();
+  uv_handle_t* handle() { return reinterpret_cast<uv_handle_t*>(&async_); }
+
+  // Can be called from any thread, as long as `target` is alive.
+  void Ring(DoorbellTarget* target);
+  // Must be called on the loop thread before `target` goes away.
+  void Cancel(DoorbellTarget* target);
+
+ private:
+  static void OnAsync(uv_async_t* handle);
+  void Drain();
+
+  Mutex mutex_;
+  ListHead<DoorbellTarget, &DoorbellTarget::doorbell_node_> pending_;
+  // Also guarded by mutex_. Targets may ring before Initialize() and after
+  // Stop(), when there is no uv_async_t to send to.
+  bool initialized_ = false;
+  uv_async_t async_;
+};
+
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_DOORBELL_H_
@@ -11,6 +11,17 @@
 namespace node {
 
 using CFunctionCallback = void (*)(v8::Local<v8::Value> receiver);
+using CFunctionCallbackWithOneByteString =
+    int32_t (*)(v8::Local<v8::Value> receiver, const v8::FastOneByteString&);
+using CFunctionCallbackWithOneByteStringAndBool =
+    int32_t (*)(v8::Local<v8::Value> receiver,
+                const v8::FastOneByteString&,
+                bool,
+                v8::FastApiCallbackOptions&);
+using CFunctionCallbackReturnBoolWithOneByteString =
+    bool (*)(v8::Local<v8::Value> receiver,
+             const v8::FastOneByteString&,
+             v8::FastApiCallbackOptions&);
 
 // This class manages the external references from the V8 heap
 // to the C++ addresses in Node.js.
@@ -20,6 +31,9 @@ class ExternalReferenceRegistry {
 
 #define ALLOWED_EXTERNAL_REFERENCE_TYPES(V)                                    \
   V(CFunctionCallback)                                                         \
+  V(CFunctionCallbackWithOneByteString)                                        \
+  V(CFunctionCallbackWithOneByteStringAndBool)                                 \
+  V(CFunctionCallbackReturnBoolWithOneByteString)                              \
   V(const v8::CFunctionInfo*)                                                  \
   V(v8::FunctionCallback)                                                      \
   V(v8::AccessorGetterCallback)                                                \
@@ -82,13 +82,13 @@ FSReqCallback::FSReqCallback(BindingData* binding_data,
               AsyncWrap::PROVIDER_FSREQCALLBACK,
               use_bigint) {}
 
-template <typename NativeT, typename V8T>
-void FillStatsArray(AliasedBufferBase<NativeT, V8T>* fields,
+template <typename NativeT>
+void FillStatsArray(NativeT* fields,
                     const uv_stat_t* s,
                     const size_t offset) {
 #define SET_FIELD_WITH_STAT(stat_offset, stat)                                 \
-  fields->SetValue(offset + static_cast<size_t>(FsStatsOffset::stat_offset),   \
-                   static_cast<NativeT>(stat))
+  fields[offset + static_cast<size_t>(FsStatsOffset::stat_offset)] =          \
+      static_cast<NativeT>(stat)
 
 // On win32, time is stored in uint64_t and starts from 1601-01-01.
 // libuv calculates tv_sec and tv_nsec from it and converts to signed long,
@@ -127,6 +127,18 @@ void FillStatsArray(AliasedBufferBase<NativeT, V8T>* fields,
 #undef SET_FIELD_WITH_STAT
 }
 
+template <typename NativeT, typename V8T>
+void FillStatsArray(AliasedBufferBase<NativeT, V8T>* fields,
+                    const uv_stat_t* s,
+                    const size_t offset) {
+  constexpr size_t kFields =
+      static_cast<size_t>(FsStatsOffset::kFsStatsFieldsNumber);
+  NativeT values[kFields];
+  FillStatsArray(values, s);
+  for (size_t i = 0; i < kFields; i++)
+    fields->SetValue(offset + i, values[i]);
+}
+
 v8::Local<v8::Value> FillGlobalStatsArray(BindingData* binding_data,
                                           const bool use_bigint,
                                           const uv_stat_t* s,
@@ -267,6 +279,8 @@ FSReqBase* AsyncDestCall(Environment* env, FSReqBase* req_wrap,
     after(uv_req);  // after may delete req_wrap if there is an error
     req_wrap = nullptr;
   } else {
+    env->threadpool_scheduler()->Started(ThreadPoolWorkClass::kFs);
+    req_wrap->set_in_threadpool(true);
     req_wrap->SetReturnValue(args);
   }
 
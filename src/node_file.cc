@@ -23,16 +23,21 @@
 #include "aliased_buffer.h"
 #include "memory_tracker-inl.h"
 #include "node_buffer.h"
+#include "node_errors.h"
 #include "node_external_reference.h"
 #include "node_process-inl.h"
 #include "node_stat_watcher.h"
+#include "simdutf.h"
 #include "util-inl.h"
+#include "v8-fast-api-calls.h"
 
 #include "tracing/trace_event.h"
 
 #include "req_wrap-inl.h"
 #include "stream_base-inl.h"
 #include "string_bytes.h"
+#include "threadpoolwork-inl.h"
+#include "timer_wrap-inl.h"
 
 #include <fcntl.h>
 #include <sys/types.h>
@@ -45,6 +50,13 @@
 # include <io.h>
 #endif
 
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
 #include <memory>
 
 namespace node {
@@ -52,15 +64,23 @@ namespace node {
 namespace fs {
 
 using v8::Array;
+using v8::ArrayBuffer;
+using v8::BackingStore;
 using v8::BigInt;
+using v8::BigInt64Array;
 using v8::Boolean;
+using v8::CFunction;
 using v8::Context;
 using v8::EscapableHandleScope;
+using v8::Float64Array;
+using v8::FastApiCallbackOptions;
+using v8::FastOneByteString;
 using v8::Function;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::HandleScope;
 using v8::Int32;
+using v8::Int32Array;
 using v8::Integer;
 using v8::Isolate;
 using v8::Local;
@@ -71,6 +91,7 @@ using v8::ObjectTemplate;
 using v8::Promise;
 using v8::String;
 using v8::Symbol;
+using v8::Uint32;
 using v8::Undefined;
 using v8::Value;
 
@@ -273,6 +294,15 @@ FileHandle::~FileHandle() {
   CHECK(closed_);    // We have to be closed at the point
 }
 
+void FileHandle::SkipRead(int64_t nread) {
+  CHECK_GE(read_offset_, 0);
+  if (read_length_ >= 0) {
+    CHECK_LE(nread, read_length_);
+    read_length_ -= nread;
+  }
+  read_offset_ += nread;
+}
+
 int FileHandle::DoWrite(WriteWrap* w,
                         uv_buf_t* bufs,
                         size_t count,
@@ -714,6 +744,12 @@ FSReqAfterScope::FSReqAfterScope(FSReqBase* wrap, uv_fs_t* req)
       handle_scope_(wrap->env()->isolate()),
       context_scope_(wrap->env()->context()) {
   CHECK_EQ(wrap_->req(), req);
+  if (wrap_->in_threadpool()) {
+    wrap_->set_in_threadpool(false);
+    wrap_->env()->threadpool_scheduler()->Finished(ThreadPoolWorkClass::kFs);
+    wrap_->env()->performance_state()->RecordThreadPoolWork(
+        ThreadPoolWorkClass::kFs, reinterpret_cast<uv_req_t*>(req));
+  }
 }
 
 FSReqAfterScope::~FSReqAfterScope() {
@@ -984,67 +1020,51 @@ void Close(const FunctionCallbackInfo<Value>& args) {
 }
 
 
-// Used to speed up module loading. Returns an array [string, boolean]
-static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
-  Environment* env = Environment::GetCurrent(args);
-  Isolate* isolate = env->isolate();
-  uv_loop_t* loop = env->event_loop();
-
-  CHECK(args[0]->IsString());
-  node::Utf8Value path(isolate, args[0]);
-
-  if (strlen(*path) != path.length()) {
-    args.GetReturnValue().Set(Array::New(isolate));
-    return;  // Contains a nul byte.
-  }
+// Reads a package.json for the module loaders, without its UTF-8 BOM.
+static bool ReadPackageJson(const char* path, std::string* json) {
   uv_fs_t open_req;
-  const int fd = uv_fs_open(loop, &open_req, *path, O_RDONLY, 0, nullptr);
+  const int fd = uv_fs_open(nullptr, &open_req, path, O_RDONLY, 0, nullptr);
   uv_fs_req_cleanup(&open_req);
+  if (fd < 0) return false;
 
-  if (fd < 0) {
-    args.GetReturnValue().Set(Array::New(isolate));
-    return;
-  }
-
-  auto defer_close = OnScopeLeave([fd, loop]() {
+  auto defer_close = OnScopeLeave([fd]() {
     uv_fs_t close_req;
-    CHECK_EQ(0, uv_fs_close(loop, &close_req, fd, nullptr));
+    CHECK_EQ(0, uv_fs_close(nullptr, &close_req, fd, nullptr));
     uv_fs_req_cleanup(&close_req);
   });
 
   const size_t kBlockSize = 32 << 10;
-  std::vector<char> chars;
   int64_t offset = 0;
   ssize_t numchars;
   do {
-    const size_t start = chars.size();
-    chars.resize(start + kBlockSize);
+    json->resize(offset + kBlockSize);
 
     uv_buf_t buf;
-    buf.base = &chars[start];
+    buf.base = &(*json)[offset];
     buf.len = kBlockSize;
 
     uv_fs_t read_req;
-    numchars = uv_fs_read(loop, &read_req, fd, &buf, 1, offset, nullptr);
+    numchars = uv_fs_read(nullptr, &read_req, fd, &buf, 1, offset, nullptr);
     uv_fs_req_cleanup(&read_req);
 
-    if (numchars < 0) {
-      args.GetReturnValue().Set(Array::New(isolate));
-      return;
-    }
+    if (numchars < 0) return false;
     offset += numchars;
   } while (static_cast<size_t>(numchars) == kBlockSize);
+  json->resize(offset);
 
-  size_t start = 0;
-  if (offset >= 3 && 0 == memcmp(&chars[0], "\xEF\xBB\xBF", 3)) {
-    start = 3;  // Skip UTF-8 BOM.
+  if (offset >= 3 && 0 == memcmp(json->data(), "\xEF\xBB\xBF", 3)) {
+    json->erase(0, 3);  // Skip UTF-8 BOM.
   }
+  return true;
+}
 
-  const size_t size = offset - start;
-  char* p = &chars[start];
-  char* pe = &chars[size];
-  char* pos[2];
-  char** ppos = &pos[0];
+// Returns true if any of the keys that the module loaders look at appear in
+// `json` as a string. A cheap check for whether parsing is needed at all.
+static bool ContainsPackageKeys(std::string_view json) {
+  const char* p = json.data();
+  const char* pe = p + json.size();
+  const char* pos[2];
+  const char** ppos = &pos[0];
 
   while (p < pe) {
     char c = *p++;
@@ -1054,52 +1074,194 @@ static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
     if (ppos < &pos[2]) continue;
     ppos = &pos[0];
 
-    char* s = &pos[0][0];
-    char* se = &pos[1][-1];  // Exclude quote.
+    const char* s = &pos[0][0];
+    const char* se = &pos[1][-1];  // Exclude quote.
     size_t n = se - s;
 
     if (n == 4) {
-      if (0 == memcmp(s, "main", 4)) break;
-      if (0 == memcmp(s, "name", 4)) break;
-      if (0 == memcmp(s, "type", 4)) break;
+      if (0 == memcmp(s, "main", 4)) return true;
+      if (0 == memcmp(s, "name", 4)) return true;
+      if (0 == memcmp(s, "type", 4)) return true;
     } else if (n == 7) {
-      if (0 == memcmp(s, "exports", 7)) break;
-      if (0 == memcmp(s, "imports", 7)) break;
+      if (0 == memcmp(s, "exports", 7)) return true;
+      if (0 == memcmp(s, "imports", 7)) return true;
     }
   }
+  return false;
+}
+
+// Used to speed up module loading. Returns an array [string, boolean]
+static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+
+  CHECK(args[0]->IsString());
+  node::Utf8Value path(isolate, args[0]);
 
+  std::string json;
+  if (strlen(*path) != path.length() ||  // Contains a nul byte.
+      !ReadPackageJson(*path, &json)) {
+    args.GetReturnValue().Set(Array::New(isolate));
+    return;
+  }
 
   Local<Value> return_value[] = {
     String::NewFromUtf8(isolate,
-                        &chars[start],
+                        json.data(),
                         v8::NewStringType::kNormal,
-                        size).ToLocalChecked(),
-    Boolean::New(isolate, p < pe ? true : false)
+                        json.size()).ToLocalChecked(),
+    Boolean::New(isolate, ContainsPackageKeys(json))
   };
   args.GetReturnValue().Set(
     Array::New(isolate, return_value, arraysize(return_value)));
 }
 
-// Used to speed up module loading.  Returns 0 if the path refers to
-// a file, 1 when it's a directory or < 0 on error (usually -ENOENT.)
-// The speedup comes from not creating thousands of Stat and Error objects.
-static void InternalModuleStat(const FunctionCallbackInfo<Value>& args) {
+static PackageConfigCache* GetPackageConfigCache(Environment* env,
+                                                 BindingData* binding_data) {
+  if (!binding_data->package_config_cache) {
+    const std::string& path = env->options()->experimental_package_json_cache;
+    // Workers would only race the main thread to write the same file.
+    if (path.empty() || !env->is_main_thread()) return nullptr;
+    binding_data->package_config_cache =
+        std::make_unique<PackageConfigCache>(std::string(path));
+  }
+  return binding_data->package_config_cache.get();
+}
+
+// Writes new cache entries once the current batch of module loading is over,
+// which is usually all of startup, rather than after every package.json.
+static void SchedulePackageConfigCacheSave(Environment* env,
+                                           BindingData* binding_data) {
+  if (binding_data->package_config_cache_save_pending) return;
+  binding_data->package_config_cache_save_pending = true;
+  env->SetImmediate([binding_data = BaseObjectPtr<BindingData>(binding_data)](
+                        Environment* env) {
+    binding_data->package_config_cache_save_pending = false;
+    binding_data->package_config_cache->Save();
+  }, CallbackFlags::kUnrefed);
+}
+
+// Returns [string, containsKeys, ...values] with the JSON texts of the
+// PackageConfig fields as values, or undefined for missing fields. `string` is
+// only set if `config` is nullptr because the file couldn't be scanned here,
+// so that JSON.parse() can report the error.
+static Local<Array> PackageConfigToArray(Isolate* isolate,
+                                         std::string_view json,
+                                         const PackageConfig* config) {
+  Local<Value> values[2 + PackageConfig::kFieldCount];
+  std::fill(std::begin(values), std::end(values), Undefined(isolate));
+  if (config == nullptr) {
+    values[0] = String::NewFromUtf8(isolate,
+                                    json.data(),
+                                    v8::NewStringType::kNormal,
+                                    json.size()).ToLocalChecked();
+    values[1] = Boolean::New(isolate, ContainsPackageKeys(json));
+  } else {
+    values[1] = Boolean::New(isolate, config->present != 0);
+    for (int i = 0; i < PackageConfig::kFieldCount; i++) {
+      if (!config->has(static_cast<PackageConfig::Field>(i))) continue;
+      const std::string& value = config->values[i];
+      values[2 + i] = String::NewFromUtf8(isolate,
+                                          value.data(),
+                                          v8::NewStringType::kNormal,
+                                          value.size()).ToLocalChecked();
+    }
+  }
+  return Array::New(isolate, values, arraysize(values));
+}
+
+// Used by the module loaders instead of InternalModuleReadJSON() when no
+// policy needs to check the whole file. Returns undefined if the file can't
+// be read.
+static void InternalModuleReadPackageJSON(
+    const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+  BindingData* binding_data = Environment::GetBindingData<BindingData>(args);
 
   CHECK(args[0]->IsString());
-  node::Utf8Value path(env->isolate(), args[0]);
+  node::Utf8Value path(isolate, args[0]);
+  if (strlen(*path) != path.length()) return;  // Contains a nul byte.
+
+  PackageConfigCache* cache = GetPackageConfigCache(env, binding_data);
+  uv_stat_t stat;
+  if (cache != nullptr) {
+    uv_fs_t req;
+    int err = uv_fs_stat(nullptr, &req, *path, nullptr);
+    if (err == 0) stat = req.statbuf;
+    uv_fs_req_cleanup(&req);
+    if (err < 0) return;
+    const PackageConfig* config = cache->Get(*path, stat);
+    if (config != nullptr) {
+      args.GetReturnValue().Set(PackageConfigToArray(isolate, {}, config));
+      return;
+    }
+  }
 
+  std::string json;
+  if (!ReadPackageJson(*path, &json)) return;
+  PackageConfig config;
+  if (!config.Parse(json)) {
+    args.GetReturnValue().Set(PackageConfigToArray(isolate, json, nullptr));
+    return;
+  }
+  if (cache != nullptr) {
+    cache->Set(*path, stat, config);
+    SchedulePackageConfigCacheSave(env, binding_data);
+  }
+  args.GetReturnValue().Set(PackageConfigToArray(isolate, {}, &config));
+}
+
+// V8 passes sequential one-byte strings to fast API calls as Latin-1, which
+// only agrees with UTF-8 for ASCII.
+static std::string OneByteStringToUtf8(const FastOneByteString& str) {
+  std::string out;
+  out.reserve(str.length);
+  for (uint32_t i = 0; i < str.length; i++) {
+    const unsigned char c = str.data[i];
+    if (c < 0x80) {
+      out.push_back(c);
+    } else {
+      out.push_back(0xc0 | (c >> 6));
+      out.push_back(0x80 | (c & 0x3f));
+    }
+  }
+  return out;
+}
+
+// Used to speed up module loading.  Returns 0 if the path refers to
+// a file, 1 when it's a directory or < 0 on error (usually -ENOENT.)
+// The speedup comes from not creating thousands of Stat and Error objects.
+static int32_t InternalModuleStatImpl(uv_loop_t* loop, const char* path) {
   uv_fs_t req;
-  int rc = uv_fs_stat(env->event_loop(), &req, *path, nullptr);
+  int rc = uv_fs_stat(loop, &req, path, nullptr);
   if (rc == 0) {
     const uv_stat_t* const s = static_cast<const uv_stat_t*>(req.ptr);
     rc = !!(s->st_mode & S_IFDIR);
   }
   uv_fs_req_cleanup(&req);
+  return rc;
+}
+
+static void InternalModuleStat(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  CHECK(args[0]->IsString());
+  node::Utf8Value path(env->isolate(), args[0]);
+
+  args.GetReturnValue().Set(InternalModuleStatImpl(env->event_loop(), *path));
+}
 
-  args.GetReturnValue().Set(rc);
+// The CommonJS loader calls this without a receiver, so there is no
+// Environment to get the loop from. Synchronous requests don't use it.
+static int32_t FastInternalModuleStat(Local<Value> receiver,
+                                      const FastOneByteString& path) {
+  return InternalModuleStatImpl(nullptr, OneByteStringToUtf8(path).c_str());
 }
 
+static CFunction fast_internal_module_stat_(
+    CFunction::Make(FastInternalModuleStat));
+
 static void Stat(const FunctionCallbackInfo<Value>& args) {
   BindingData* binding_data = Environment::GetBindingData<BindingData>(args);
   Environment* env = binding_data->env();
@@ -1199,6 +1361,102 @@ static void FStat(const FunctionCallbackInfo<Value>& args) {
   }
 }
 
+// statSync(path, use_bigint) is a cheaper variant of the synchronous stat()
+// for fs.statSync(). It returns 0 and fills in the global stats array on
+// success, or a negative errno, instead of setting up a ctx object, so that
+// it can also be called through the V8 fast API.
+static int32_t StatSyncImpl(BindingData* binding_data,
+                            const char* path,
+                            bool use_bigint) {
+  uv_fs_t req;
+  FS_SYNC_TRACE_BEGIN(stat);
+  int err =
+      uv_fs_stat(binding_data->env()->event_loop(), &req, path, nullptr);
+  FS_SYNC_TRACE_END(stat);
+  if (err == 0) {
+    FillGlobalStatsArray(
+        binding_data, use_bigint, static_cast<const uv_stat_t*>(req.ptr));
+  }
+  uv_fs_req_cleanup(&req);
+  return err;
+}
+
+static void StatSync(const FunctionCallbackInfo<Value>& args) {
+  BindingData* binding_data = Environment::GetBindingData<BindingData>(args);
+  Environment* env = binding_data->env();
+
+  CHECK_EQ(args.Length(), 2);
+  BufferValue path(env->isolate(), args[0]);
+  CHECK_NOT_NULL(*path);
+  bool use_bigint = args[1]->IsTrue();
+
+  env->PrintSyncTrace();
+  args.GetReturnValue().Set(StatSyncImpl(binding_data, *path, use_bigint));
+}
+
+static int32_t FastStatSync(Local<Value> receiver,
+                            const FastOneByteString& path,
+                            bool use_bigint,
+                            // NOLINTNEXTLINE(runtime/references)
+                            FastApiCallbackOptions& options) {
+  BindingData* binding_data = Unwrap<BindingData>(receiver.As<Object>());
+  // Printing the stack trace for --trace-sync-io needs to allocate.
+  if (binding_data->env()->trace_sync_io()) {
+    options.fallback = true;
+    return 0;
+  }
+  return StatSyncImpl(
+      binding_data, OneByteStringToUtf8(path).c_str(), use_bigint);
+}
+
+static CFunction fast_stat_sync_(CFunction::Make(FastStatSync));
+
+// existsSync(path) returns whether the path can be accessed, without creating
+// an error when it cannot.
+static bool ExistsSyncImpl(Environment* env, const char* path) {
+  uv_fs_t req;
+  FS_SYNC_TRACE_BEGIN(access);
+  int err = uv_fs_access(env->event_loop(), &req, path, F_OK, nullptr);
+  FS_SYNC_TRACE_END(access);
+  uv_fs_req_cleanup(&req);
+#ifdef _WIN32
+  // In case of an invalid symlink, access() on win32 will **not** return an
+  // error and is therefore not enough. Double check with stat().
+  if (err == 0) {
+    FS_SYNC_TRACE_BEGIN(stat);
+    err = uv_fs_stat(env->event_loop(), &req, path, nullptr);
+    FS_SYNC_TRACE_END(stat);
+    uv_fs_req_cleanup(&req);
+  }
+#endif  // _WIN32
+  return err == 0;
+}
+
+static void ExistsSync(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  CHECK_EQ(args.Length(), 1);
+  BufferValue path(env->isolate(), args[0]);
+  CHECK_NOT_NULL(*path);
+
+  env->PrintSyncTrace();
+  args.GetReturnValue().Set(ExistsSyncImpl(env, *path));
+}
+
+static bool FastExistsSync(Local<Value> receiver,
+                           const FastOneByteString& path,
+                           // NOLINTNEXTLINE(runtime/references) This is V8 api.
+                           FastApiCallbackOptions& options) {
+  Environment* env = Unwrap<BindingData>(receiver.As<Object>())->env();
+  if (env->trace_sync_io()) {
+    options.fallback = true;
+    return false;
+  }
+  return ExistsSyncImpl(env, OneByteStringToUtf8(path).c_str());
+}
+
+static CFunction fast_exists_sync_(CFunction::Make(FastExistsSync));
+
 static void Symlink(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
   Isolate* isolate = env->isolate();
@@ -2554,11 +2812,490 @@ static void Mkdtemp(const FunctionCallbackInfo<Value>& args) {
   }
 }
 
+// Keep in sync with lib/internal/fs/utils.js.
+constexpr uint64_t kIoMaxLength = (uint64_t{1} << 31) - 1;
+constexpr size_t kReadFileBufferLength = 512 * 1024;
+constexpr size_t kReadFileUnknownBufferLength = 64 * 1024;
+// Regular files up to this size are read in a single threadpool job, bigger
+// ones and files of unknown size one kReadFileBufferLength chunk per job.
+constexpr uint64_t kReadFileSingleStepLength = 4 * 1024 * 1024;
+
+ReadFileOperation::ReadFileOperation(std::string&& path, int flags, bool utf8)
+    : path_(std::move(path)), flags_(flags), utf8_(utf8) {}
+
+ReadFileOperation::ReadFileOperation(uv_file fd, bool utf8)
+    : fd_(fd), utf8_(utf8) {}
+
+ReadFileOperation::~ReadFileOperation() {
+  // Only happens when the job is cancelled or the environment goes away
+  // between two steps.
+  if (owns_fd_) {
+    uv_fs_t req;
+    uv_fs_close(nullptr, &req, fd_, nullptr);
+    uv_fs_req_cleanup(&req);
+  }
+  free(data_);
+  free(utf16_);
+}
+
+void ReadFileOperation::Fail(int err, const char* syscall) {
+  error_ = err;
+  syscall_ = syscall;
+}
+
+// Trace each step like the binding calls that fs.readFile() used to make for
+// it from JS were traced.
+#define READ_FILE_TRACE_BEGIN(syscall, fs_type)                                \
+  if (trace_id_ == nullptr) {                                                  \
+    FS_SYNC_TRACE_BEGIN(syscall);                                              \
+  } else {                                                                     \
+    FS_ASYNC_TRACE_BEGIN0(fs_type, trace_id_)                                  \
+  }
+#define READ_FILE_TRACE_END(syscall, fs_type, result)                          \
+  if (trace_id_ == nullptr) {                                                  \
+    FS_SYNC_TRACE_END(syscall);                                                \
+  } else {                                                                     \
+    FS_ASYNC_TRACE_END1(fs_type, trace_id_, "result", result)                  \
+  }
+
+void ReadFileOperation::Run() {
+  trace_id_ = nullptr;
+  while (!Step(false)) {
+  }
+}
+
+bool ReadFileOperation::RunStep(const void* trace_id) {
+  trace_id_ = trace_id;
+  return Step(true);
+}
+
+// Synchronous requests don't use the loop, so none of these do, which is what
+// allows running them on the threadpool.
+bool ReadFileOperation::Step(bool bounded) {
+  bool done = false;
+  if (!started_) {
+    started_ = true;
+    done = Start();
+  }
+
+  if (!bounded || (size_ > 0 && size_ <= kReadFileSingleStepLength)) {
+    while (!done) done = ReadMore(kIoMaxLength);
+  } else if (!done) {
+    done = ReadMore(kReadFileBufferLength);
+  }
+
+  if (done) Finish();
+  return done;
+}
+
+bool ReadFileOperation::Start() {
+  uv_fs_t req;
+  if (fd_ < 0) {
+    READ_FILE_TRACE_BEGIN(open, UV_FS_OPEN)
+    int fd = uv_fs_open(nullptr, &req, path_.c_str(), flags_, 0666, nullptr);
+    READ_FILE_TRACE_END(open, UV_FS_OPEN, fd)
+    uv_fs_req_cleanup(&req);
+    if (fd < 0) {
+      Fail(fd, "open");
+      return true;
+    }
+    fd_ = fd;
+    owns_fd_ = true;
+  }
+
+  READ_FILE_TRACE_BEGIN(fstat, UV_FS_FSTAT)
+  int err = uv_fs_fstat(nullptr, &req, fd_, nullptr);
+  READ_FILE_TRACE_END(fstat, UV_FS_FSTAT, err)
+  // The kernel lies about the size of many files that are not regular ones,
+  // read those until EOF instead.
+  uint64_t size = 0;
+  if (err == 0 && (req.statbuf.st_mode & S_IFMT) == S_IFREG)
+    size = req.statbuf.st_size;
+  uv_fs_req_cleanup(&req);
+  if (err < 0) {
+    Fail(err, "fstat");
+    return true;
+  }
+  if (size > kIoMaxLength) {
+    too_large_size_ = size;
+    return true;
+  }
+
+  size_ = size;
+  capacity_ = size > 0 ? size : kReadFileUnknownBufferLength;
+  data_ = UncheckedMalloc(capacity_);
+  if (data_ == nullptr) {
+    Fail(UV_ENOMEM, "read");
+    return true;
+  }
+  return false;
+}
+
+// Makes a single read() of at most `max_length` bytes, returns true once there
+// is nothing left to read.
+bool ReadFileOperation::ReadMore(size_t max_length) {
+  if (length_ == capacity_) {
+    // Files can grow while they are read, but only read what fstat()
+    // reported, like reading in chunks from JS did.
+    if (size_ > 0) return true;
+    if (capacity_ == kIoMaxLength) {
+      too_large_size_ = capacity_ + 1;
+      return true;
+    }
+    size_t capacity = std::min<uint64_t>(capacity_ * 2, kIoMaxLength);
+    char* data = UncheckedRealloc(data_, capacity);
+    if (data == nullptr) {
+      Fail(UV_ENOMEM, "read");
+      return true;
+    }
+    data_ = data;
+    capacity_ = capacity;
+  }
+
+  size_t length = std::min(capacity_ - length_, max_length);
+  uv_buf_t buf =
+      uv_buf_init(data_ + length_, static_cast<unsigned int>(length));
+  uv_fs_t req;
+  READ_FILE_TRACE_BEGIN(read, UV_FS_READ)
+  int bytes_read = uv_fs_read(nullptr, &req, fd_, &buf, 1, -1, nullptr);
+  READ_FILE_TRACE_END(read, UV_FS_READ, bytes_read)
+  uv_fs_req_cleanup(&req);
+  if (bytes_read < 0) {
+    Fail(bytes_read, "read");
+    return true;
+  }
+  if (bytes_read == 0) return true;
+  length_ += bytes_read;
+  return size_ > 0 && length_ == capacity_;
+}
+
+void ReadFileOperation::Finish() {
+  if (owns_fd_) {
+    uv_fs_t req;
+    READ_FILE_TRACE_BEGIN(close, UV_FS_CLOSE)
+    int err = uv_fs_close(nullptr, &req, fd_, nullptr);
+    READ_FILE_TRACE_END(close, UV_FS_CLOSE, err)
+    uv_fs_req_cleanup(&req);
+    owns_fd_ = false;
+    fd_ = -1;
+    if (err < 0 && error_ == 0 && too_large_size_ == 0) Fail(err, "close");
+  }
+  if (error_ != 0 || too_large_size_ > 0) return;
+
+  // Give back what was over-allocated for files of unknown size.
+  if (length_ < capacity_ && length_ > 0) {
+    char* data = UncheckedRealloc(data_, length_);
+    if (data != nullptr) data_ = data;
+  }
+  if (utf8_) DecodeUtf8();
+}
+
+#undef READ_FILE_TRACE_END
+#undef READ_FILE_TRACE_BEGIN
+
+void ReadFileOperation::DecodeUtf8() {
+  if (simdutf::validate_ascii(data_, length_)) {
+    is_ascii_ = true;
+    return;
+  }
+  // Leave invalid input to V8, which replaces invalid sequences the same way
+  // Buffer#toString() does.
+  if (!simdutf::validate_utf8(data_, length_)) return;
+
+  size_t utf16_length = simdutf::utf16_length_from_utf8(data_, length_);
+  char16_t* utf16 = UncheckedMalloc<char16_t>(utf16_length);
+  if (utf16 == nullptr) return;
+  utf16_length_ = simdutf::convert_valid_utf8_to_utf16le(data_, length_, utf16);
+  utf16_ = utf16;
+  free(data_);
+  data_ = nullptr;
+  length_ = 0;
+}
+
+MaybeLocal<Value> ReadFileOperation::ToValue(Environment* env,
+                                             Local<Value>* error) {
+  Isolate* isolate = env->isolate();
+  if (too_large_size_ > 0) {
+    *error = ERR_FS_FILE_TOO_LARGE(
+        isolate, "File size (%d) is greater than 2 GiB", too_large_size_);
+    return MaybeLocal<Value>();
+  }
+  if (error_ != 0) {
+    // Only errors from open() refer to the path, like they did when
+    // fs.readFile() made one binding call per step.
+    const bool opened = strcmp(syscall_, "open") == 0;
+    *error = UVException(isolate,
+                         error_,
+                         syscall_,
+                         nullptr,
+                         opened ? path_.c_str() : nullptr);
+    return MaybeLocal<Value>();
+  }
+
+  if (!utf8_) {
+    char* data = data_;
+    data_ = nullptr;
+    // Takes ownership of data.
+    MaybeLocal<Object> buffer = Buffer::New(env, data, length_);
+    return buffer.FromMaybe(Local<Value>());
+  }
+  if (utf16_ != nullptr) {
+    return StringBytes::Encode(isolate,
+                               reinterpret_cast<const uint16_t*>(utf16_),
+                               utf16_length_,
+                               error);
+  }
+  return StringBytes::Encode(
+      isolate, data_, length_, is_ascii_ ? LATIN1 : UTF8, error);
+}
+
+size_t ReadFileOperation::self_size() const {
+  return sizeof(*this) + path_.size() + length_ +
+         utf16_length_ * sizeof(char16_t);
+}
+
+static std::unique_ptr<ReadFileOperation> NewReadFileOperation(
+    Isolate* isolate,
+    Local<Value> path_or_fd,
+    Local<Value> flags,
+    bool utf8) {
+  if (path_or_fd->IsInt32()) {
+    return std::make_unique<ReadFileOperation>(
+        path_or_fd.As<Int32>()->Value(), utf8);
+  }
+  BufferValue path(isolate, path_or_fd);
+  CHECK_NOT_NULL(*path);
+  CHECK(flags->IsInt32());
+  return std::make_unique<ReadFileOperation>(
+      std::string(*path, path.length()), flags.As<Int32>()->Value(), utf8);
+}
+
+// readFileSync(pathOrFd, flags, utf8, ctx)
+static void ReadWholeFileSync(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  CHECK_EQ(args.Length(), 4);
+  CHECK(args[3]->IsObject());
+  std::unique_ptr<ReadFileOperation> operation = NewReadFileOperation(
+      env->isolate(), args[0], args[1], args[2]->IsTrue());
+
+  env->PrintSyncTrace();
+  FS_SYNC_TRACE_BEGIN(readFile);
+  operation->Run();
+  FS_SYNC_TRACE_END(readFile);
+
+  Local<Value> error;
+  Local<Value> value;
+  if (!operation->ToValue(env, &error).ToLocal(&value)) {
+    if (!error.IsEmpty()) {
+      args[3]
+          .As<Object>()
+          ->Set(env->context(), env->error_string(), error)
+          .Check();
+    }
+    return;
+  }
+  args.GetReturnValue().Set(value);
+}
+
+// Keep in sync with lib/fs.js.
+enum MmapAdvice {
+  kMmapAdviceSequential = 1 << 0,
+  kMmapAdviceRandom = 1 << 1,
+  kMmapAdviceWillNeed = 1 << 2,
+  kMmapAdviceHugePage = 1 << 3,
+};
+
+namespace {
+
+// The whole region that was mapped, which starts at an aligned offset before
+// the data that the Buffer covers.
+struct MappedRegion {
+  void* base;
+  size_t length;
+};
+
+void UnmapRegion(void* data, size_t length, void* deleter_data) {
+  std::unique_ptr<MappedRegion> region(
+      static_cast<MappedRegion*>(deleter_data));
+#ifdef _WIN32
+  UnmapViewOfFile(region->base);
+#else
+  munmap(region->base, region->length);
+#endif
+}
+
+// Maps `length` bytes of `fd` at `offset` privately, so that writes to the
+// memory never reach the file. On success, returns 0 and sets `region` and
+// `data`, which points at `offset` in the region.
+int MapFile(uv_file fd,
+            uint64_t offset,
+            size_t length,
+            int advice,
+            MappedRegion* region,
+            char** data) {
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  const uint64_t alignment = info.dwAllocationGranularity;
+#else
+  const uint64_t alignment = sysconf(_SC_PAGESIZE);
+#endif
+  const uint64_t aligned_offset = offset - offset % alignment;
+  const size_t delta = static_cast<size_t>(offset - aligned_offset);
+  region->length = length + delta;
+
+#ifdef _WIN32
+  HANDLE file = reinterpret_cast<HANDLE>(uv_get_osfhandle(fd));
+  if (file == INVALID_HANDLE_VALUE) return UV_EBADF;
+  HANDLE mapping =
+      CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+  if (mapping == nullptr) return uv_translate_sys_error(GetLastError());
+  region->base = MapViewOfFile(mapping,
+                               FILE_MAP_COPY,
+                               static_cast<DWORD>(aligned_offset >> 32),
+                               static_cast<DWORD>(aligned_offset),
+                               region->length);
+  // The view keeps the mapping object alive.
+  const DWORD err = region->base == nullptr ? GetLastError() : 0;
+  CloseHandle(mapping);
+  if (err != 0) return uv_translate_sys_error(err);
+  // Windows has no equivalent of the advice below that applies to views.
+  USE(advice);
+#else
+  region->base = mmap(nullptr,
+                      region->length,
+                      PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE,
+                      fd,
+                      static_cast<off_t>(aligned_offset));
+  if (region->base == MAP_FAILED) return uv_translate_sys_error(errno);
+
+  // Advice is only a hint, and failing to follow it doesn't make the mapping
+  // any less usable.
+  if (advice & kMmapAdviceSequential)
+    madvise(region->base, region->length, MADV_SEQUENTIAL);
+  if (advice & kMmapAdviceRandom)
+    madvise(region->base, region->length, MADV_RANDOM);
+  if (advice & kMmapAdviceWillNeed)
+    madvise(region->base, region->length, MADV_WILLNEED);
+#ifdef MADV_HUGEPAGE
+  if (advice & kMmapAdviceHugePage)
+    madvise(region->base, region->length, MADV_HUGEPAGE);
+#endif
+#endif  // _WIN32
+
+  *data = static_cast<char*>(region->base) + delta;
+  return 0;
+}
+
+}  // anonymous namespace
+
+// mmapSync(pathOrFd, offset, length, advice, ctx)
+// `length` is -1 to map up to the end of the file.
+static void MmapSync(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+
+  CHECK_EQ(args.Length(), 5);
+  CHECK(args[1]->IsNumber());
+  CHECK(args[2]->IsNumber());
+  CHECK(args[3]->IsInt32());
+  CHECK(args[4]->IsObject());
+  Local<Object> ctx = args[4].As<Object>();
+  const uint64_t offset = args[1].As<Number>()->Value();
+  const double requested_length = args[2].As<Number>()->Value();
+  const int advice = args[3].As<Int32>()->Value();
+
+  auto fail = [&](int err, const char* syscall, const char* path) {
+    ctx->Set(env->context(),
+             env->error_string(),
+             UVException(isolate, err, syscall, nullptr, path)).Check();
+  };
+
+  env->PrintSyncTrace();
+  FS_SYNC_TRACE_BEGIN(mmap);
+
+  uv_fs_t req;
+  uv_file fd;
+  std::string path;
+  if (args[0]->IsInt32()) {
+    fd = args[0].As<Int32>()->Value();
+  } else {
+    BufferValue path_value(isolate, args[0]);
+    CHECK_NOT_NULL(*path_value);
+    path = path_value.ToString();
+    fd = uv_fs_open(nullptr, &req, path.c_str(), O_RDONLY, 0, nullptr);
+    uv_fs_req_cleanup(&req);
+    if (fd < 0) {
+      FS_SYNC_TRACE_END(mmap);
+      return fail(fd, "open", path.c_str());
+    }
+  }
+  // The mapping stays valid after the file is closed.
+  auto close_fd = OnScopeLeave([&]() {
+    if (path.empty()) return;
+    uv_fs_close(nullptr, &req, fd, nullptr);
+    uv_fs_req_cleanup(&req);
+  });
+
+  int err = uv_fs_fstat(nullptr, &req, fd, nullptr);
+  const uv_stat_t stat = req.statbuf;
+  uv_fs_req_cleanup(&req);
+  if (err < 0) {
+    FS_SYNC_TRACE_END(mmap);
+    return fail(err, "fstat", nullptr);
+  }
+
+  // Accessing a mapping past the end of the file raises SIGBUS, so never map
+  // more than the file contains.
+  const uint64_t size = stat.st_size;
+  uint64_t length = offset < size ? size - offset : 0;
+  if (requested_length >= 0)
+    length = std::min<uint64_t>(length, requested_length);
+  if (length > v8::TypedArray::kMaxLength) {
+    FS_SYNC_TRACE_END(mmap);
+    ctx->Set(env->context(), env->error_string(), ERR_BUFFER_TOO_LARGE(isolate))
+        .Check();
+    return;
+  }
+
+  if (length == 0) {
+    FS_SYNC_TRACE_END(mmap);
+    Local<Object> buffer;
+    if (Buffer::New(isolate, 0).ToLocal(&buffer))
+      args.GetReturnValue().Set(buffer);
+    return;
+  }
+
+  MappedRegion* region = new MappedRegion();
+  char* data;
+  err = MapFile(fd, offset, length, advice, region, &data);
+  FS_SYNC_TRACE_END(mmap);
+  if (err != 0) {
+    delete region;
+    return fail(err, "mmap", path.empty() ? nullptr : path.c_str());
+  }
+
+  std::shared_ptr<BackingStore> store =
+      ArrayBuffer::NewBackingStore(data, length, UnmapRegion, region);
+  Local<ArrayBuffer> ab = ArrayBuffer::New(isolate, std::move(store));
+  Local<Object> buffer;
+  if (Buffer::New(env, ab, 0, length).ToLocal(&buffer))
+    args.GetReturnValue().Set(buffer);
+}
+
 void BindingData::MemoryInfo(MemoryTracker* tracker) const {
   tracker->TrackField("stats_field_array", stats_field_array);
   tracker->TrackField("stats_field_bigint_array", stats_field_bigint_array);
   tracker->TrackField("file_handle_read_wrap_freelist",
                       file_handle_read_wrap_freelist);
+  if (package_config_cache) {
+    tracker->TrackFieldWithSize("package_config_cache",
+                                package_config_cache->self_size());
+  }
+  if (stat_poll_scheduler)
+    tracker->TrackField("stat_poll_scheduler", stat_poll_scheduler);
 }
 
 BindingData::BindingData(Environment* env, v8::Local<v8::Object> wrap)
@@ -2629,9 +3366,21 @@ void Initialize(Local<Object> target,
   SetMethod(context, target, "rmdir", RMDir);
   SetMethod(context, target, "mkdir", MKDir);
   SetMethod(context, target, "readdir", ReadDir);
+  SetMethod(context, target, "readFileSync", ReadWholeFileSync);
+  SetMethod(context, target, "mmapSync", MmapSync);
   SetMethod(context, target, "internalModuleReadJSON", InternalModuleReadJSON);
-  SetMethod(context, target, "internalModuleStat", InternalModuleStat);
+  SetMethod(context,
+            target,
+            "internalModuleReadPackageJSON",
+            InternalModuleReadPackageJSON);
+  SetFastMethod(context,
+                target,
+                "internalModuleStat",
+                InternalModuleStat,
+                &fast_internal_module_stat_);
   SetMethod(context, target, "stat", Stat);
+  SetFastMethod(context, target, "statSync", StatSync, &fast_stat_sync_);
+  SetFastMethod(context, target, "existsSync", ExistsSync, &fast_exists_sync_);
   SetMethod(context, target, "lstat", LStat);
   SetMethod(context, target, "fstat", FStat);
   SetMethod(context, target, "link", Link);
@@ -2666,6 +3415,9 @@ void Initialize(Local<Object> target,
       .Check();
 
   StatWatcher::Initialize(env, target);
+  FSStatManyJob::Initialize(env, target);
+  FSReadFileJob::Initialize(env, target);
+  FileWriter::Initialize(env, target);
 
   // Create FunctionTemplate for FSReqCallback
   Local<FunctionTemplate> fst = NewFunctionTemplate(isolate, NewFSReqCallback);
@@ -2725,6 +3477,565 @@ void Initialize(Local<Object> target,
               use_promises_symbol).Check();
 }
 
+FSStatManyJob::FSStatManyJob(Environment* env,
+                             Local<Object> object,
+                             std::vector<std::string>&& paths,
+                             Syscall syscall,
+                             int mode,
+                             bool use_bigint)
+    : AsyncWrap(env, object, AsyncWrap::PROVIDER_FSSTATMANY),
+      ThreadPoolWork(env, "fs", ThreadPoolWorkClass::kFs),
+      paths_(std::move(paths)),
+      syscall_(syscall),
+      mode_(mode),
+      use_bigint_(use_bigint) {}
+
+void FSStatManyJob::New(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+  Local<Context> context = env->context();
+  CHECK(args.IsConstructCall());
+  CHECK(args[0]->IsArray());
+  CHECK(args[1]->IsString());
+  CHECK(args[2]->IsInt32());
+
+  Local<Array> array = args[0].As<Array>();
+  std::vector<std::string> paths;
+  paths.reserve(array->Length());
+  for (uint32_t i = 0; i < array->Length(); i++) {
+    Local<Value> value;
+    if (!array->Get(context, i).ToLocal(&value)) return;
+    BufferValue path(isolate, value);
+    CHECK_NOT_NULL(*path);
+    paths.emplace_back(*path, path.length());
+  }
+
+  Syscall syscall;
+  Utf8Value syscall_name(isolate, args[1]);
+  if (syscall_name == "stat") {
+    syscall = Syscall::kStat;
+  } else if (syscall_name == "lstat") {
+    syscall = Syscall::kLstat;
+  } else {
+    CHECK_EQ(syscall_name, "access");
+    syscall = Syscall::kAccess;
+  }
+
+  new FSStatManyJob(env,
+                    args.This(),
+                    std::move(paths),
+                    syscall,
+                    args[2].As<Int32>()->Value(),
+                    args[3]->IsTrue());
+}
+
+void FSStatManyJob::Run(const FunctionCallbackInfo<Value>& args) {
+  FSStatManyJob* job;
+  ASSIGN_OR_RETURN_UNWRAP(&job, args.Holder());
+  job->ScheduleWork();
+}
+
+void FSStatManyJob::DoThreadPoolWork() {
+  errors_.resize(paths_.size());
+  if (syscall_ != Syscall::kAccess) stats_.resize(paths_.size());
+
+  // Synchronous requests don't touch the loop, which belongs to the main
+  // thread.
+  for (size_t i = 0; i < paths_.size(); i++) {
+    const char* path = paths_[i].c_str();
+    uv_fs_t req;
+    int err;
+    switch (syscall_) {
+      case Syscall::kStat:
+        err = uv_fs_stat(nullptr, &req, path, nullptr);
+        break;
+      case Syscall::kLstat:
+        err = uv_fs_lstat(nullptr, &req, path, nullptr);
+        break;
+      case Syscall::kAccess:
+        err = uv_fs_access(nullptr, &req, path, mode_, nullptr);
+        break;
+    }
+    if (err == 0 && syscall_ != Syscall::kAccess) stats_[i] = req.statbuf;
+    errors_[i] = err;
+    uv_fs_req_cleanup(&req);
+  }
+}
+
+void FSStatManyJob::AfterThreadPoolWork(int status) {
+  Environment* env = AsyncWrap::env();
+  Isolate* isolate = env->isolate();
+  CHECK(status == 0 || status == UV_ECANCELED);
+  std::unique_ptr<FSStatManyJob> ptr(this);
+  if (!env->can_call_into_js()) return;
+  HandleScope handle_scope(isolate);
+  Context::Scope context_scope(env->context());
+
+  Local<Value> argv[3] = {
+      Integer::New(isolate, status),
+      Undefined(isolate),
+      Undefined(isolate),
+  };
+  if (status == 0) {
+    std::unique_ptr<BackingStore> errors = ArrayBuffer::NewBackingStore(
+        isolate, errors_.size() * sizeof(errors_[0]));
+    std::copy(errors_.begin(),
+              errors_.end(),
+              static_cast<int32_t*>(errors->Data()));
+    argv[1] = Int32Array::New(ArrayBuffer::New(isolate, std::move(errors)),
+                              0,
+                              errors_.size());
+
+    if (syscall_ != Syscall::kAccess) {
+      argv[2] = use_bigint_ ? PackStats<int64_t, BigInt64Array>(isolate)
+                            : PackStats<double, Float64Array>(isolate);
+    }
+  }
+
+  ptr->MakeCallback(env->oncomplete_string(), arraysize(argv), argv);
+}
+
+template <typename NativeT, typename TypedArrayT>
+Local<Value> FSStatManyJob::PackStats(Isolate* isolate) const {
+  const size_t fields =
+      static_cast<size_t>(FsStatsOffset::kFsStatsFieldsNumber);
+  std::unique_ptr<BackingStore> store = ArrayBuffer::NewBackingStore(
+      isolate, fields * stats_.size() * sizeof(NativeT));
+  NativeT* data = static_cast<NativeT*>(store->Data());
+  for (size_t i = 0; i < stats_.size(); i++) {
+    if (errors_[i] == 0) FillStatsArray(data, &stats_[i], i * fields);
+  }
+  return TypedArrayT::New(ArrayBuffer::New(isolate, std::move(store)),
+                          0,
+                          fields * stats_.size());
+}
+
+void FSStatManyJob::MemoryInfo(MemoryTracker* tracker) const {
+  tracker->TrackField("paths", paths_);
+  tracker->TrackField("errors", errors_);
+  tracker->TrackFieldWithSize("stats", stats_.size() * sizeof(uv_stat_t));
+}
+
+void FSStatManyJob::Initialize(Environment* env, Local<Object> target) {
+  Isolate* isolate = env->isolate();
+  Local<FunctionTemplate> job = NewFunctionTemplate(isolate, New);
+  job->Inherit(AsyncWrap::GetConstructorTemplate(env));
+  job->InstanceTemplate()->SetInternalFieldCount(
+      AsyncWrap::kInternalFieldCount);
+  SetProtoMethod(isolate, job, "run", Run);
+  SetConstructorFunction(env->context(), target, "FSStatManyJob", job);
+}
+
+void FSStatManyJob::RegisterExternalReferences(
+    ExternalReferenceRegistry* registry) {
+  registry->Register(New);
+  registry->Register(Run);
+}
+
+FSReadFileJob::FSReadFileJob(Environment* env,
+                             Local<Object> object,
+                             std::unique_ptr<ReadFileOperation> operation)
+    : AsyncWrap(env, object, AsyncWrap::PROVIDER_FSREADFILE),
+      ThreadPoolWork(env, "fs", ThreadPoolWorkClass::kFs),
+      operation_(std::move(operation)) {}
+
+void FSReadFileJob::New(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args.IsConstructCall());
+  new FSReadFileJob(
+      env,
+      args.This(),
+      NewReadFileOperation(
+          env->isolate(), args[0], args[1], args[2]->IsTrue()));
+}
+
+void FSReadFileJob::Run(const FunctionCallbackInfo<Value>& args) {
+  FSReadFileJob* job;
+  ASSIGN_OR_RETURN_UNWRAP(&job, args.Holder());
+  job->ScheduleWork();
+}
+
+void FSReadFileJob::DoThreadPoolWork() {
+  done_ = operation_->RunStep(this);
+}
+
+void FSReadFileJob::AfterThreadPoolWork(int status) {
+  Environment* env = AsyncWrap::env();
+  Isolate* isolate = env->isolate();
+  CHECK(status == 0 || status == UV_ECANCELED);
+  // Queue the next step behind whatever was queued in the meantime.
+  if (status == 0 && !done_ && env->can_call_into_js()) {
+    ScheduleWork();
+    return;
+  }
+  std::unique_ptr<FSReadFileJob> ptr(this);
+  if (!env->can_call_into_js()) return;
+  HandleScope handle_scope(isolate);
+  Context::Scope context_scope(env->context());
+
+  Local<Value> argv[2] = {
+      Null(isolate),
+      Undefined(isolate),
+  };
+  if (status == UV_ECANCELED) {
+    argv[0] = UVException(isolate, status, "read");
+  } else {
+    errors::TryCatchScope try_catch(env);
+    Local<Value> error;
+    if (!operation_->ToValue(env, &error).ToLocal(&argv[1])) {
+      argv[1] = Undefined(isolate);
+      if (try_catch.HasCaught()) {
+        if (!try_catch.CanContinue()) return;
+        argv[0] = try_catch.Exception();
+      } else {
+        CHECK(!error.IsEmpty());
+        argv[0] = error;
+      }
+    }
+  }
+
+  ptr->MakeCallback(env->oncomplete_string(), arraysize(argv), argv);
+}
+
+void FSReadFileJob::MemoryInfo(MemoryTracker* tracker) const {
+  tracker->TrackFieldWithSize("operation", operation_->self_size());
+}
+
+void FSReadFileJob::Initialize(Environment* env, Local<Object> target) {
+  Isolate* isolate = env->isolate();
+  Local<FunctionTemplate> job = NewFunctionTemplate(isolate, New);
+  job->Inherit(AsyncWrap::GetConstructorTemplate(env));
+  job->InstanceTemplate()->SetInternalFieldCount(
+      AsyncWrap::kInternalFieldCount);
+  SetProtoMethod(isolate, job, "run", Run);
+  SetConstructorFunction(env->context(), target, "FSReadFileJob", job);
+}
+
+void FSReadFileJob::RegisterExternalReferences(
+    ExternalReferenceRegistry* registry) {
+  registry->Register(New);
+  registry->Register(Run);
+}
+
+// Writes out the in-flight buffer of a FileWriter.
+class FileWriter::FlushJob final : public ThreadPoolWork {
+ public:
+  FlushJob(FileWriter* writer,
+           int64_t offset,
+           size_t length,
+           int64_t truncate_to,
+           uint64_t end)
+      : ThreadPoolWork(writer->env(), "fs", ThreadPoolWorkClass::kFs),
+        writer_(writer),
+        fd_(writer->fd_),
+        sync_(writer->sync_),
+        data_(writer->in_flight_.data),
+        offset_(offset),
+        length_(length),
+        truncate_to_(truncate_to),
+        end_(end) {}
+
+  void DoThreadPoolWork() override {
+    // Synchronous requests don't touch the loop, which belongs to the main
+    // thread. Writes are split so that each one fits into a uv_buf_t, and so
+    // that with O_DIRECT, each one is a whole number of blocks.
+    constexpr size_t kMaxChunk = size_t{1} << 30;
+    uv_fs_t req;
+    size_t done = 0;
+    while (done < length_) {
+      uv_buf_t buf = uv_buf_init(
+          data_ + done,
+          static_cast<unsigned int>(std::min(length_ - done, kMaxChunk)));
+      const int64_t offset = offset_ < 0 ? -1 : offset_ + done;
+      const int result = uv_fs_write(nullptr, &req, fd_, &buf, 1, offset,
+                                     nullptr);
+      uv_fs_req_cleanup(&req);
+      if (result < 0) return Fail(result, "write");
+      if (result == 0) return Fail(UV_EIO, "write");
+      done += result;
+    }
+
+    if (truncate_to_ >= 0) {
+      const int err =
+          uv_fs_ftruncate(nullptr, &req, fd_, truncate_to_, nullptr);
+      uv_fs_req_cleanup(&req);
+      if (err < 0) return Fail(err, "ftruncate");
+    }
+
+    if (sync_) {
+      const int err = uv_fs_fdatasync(nullptr, &req, fd_, nullptr);
+      uv_fs_req_cleanup(&req);
+      if (err < 0) return Fail(err, "fdatasync");
+    }
+  }
+
+  void AfterThreadPoolWork(int status) override {
+    std::unique_ptr<FlushJob> ptr(this);
+    CHECK(status == 0 || status == UV_ECANCELED);
+    if (status != 0) Fail(status, "write");
+    writer_->OnFlushDone(err_, syscall_, end_);
+  }
+
+ private:
+  void Fail(int err, const char* syscall) {
+    err_ = err;
+    syscall_ = syscall;
+  }
+
+  BaseObjectPtr<FileWriter> writer_;
+  uv_file fd_;
+  bool sync_;
+  char* data_;
+  int64_t offset_;
+  size_t length_;
+  int64_t truncate_to_;
+  uint64_t end_;
+  int err_ = 0;
+  const char* syscall_ = nullptr;
+};
+
+FileWriter::FileWriter(Environment* env,
+                       Local<Object> object,
+                       uv_file fd,
+                       int64_t position,
+                       size_t high_water_mark,
+                       uint64_t flush_interval,
+                       size_t block_size,
+                       bool direct,
+                       bool sync)
+    : AsyncWrap(env, object, AsyncWrap::PROVIDER_FILEWRITER),
+      fd_(fd),
+      position_(position),
+      high_water_mark_(high_water_mark),
+      flush_interval_(flush_interval),
+      block_size_(block_size),
+      direct_(direct),
+      sync_(sync),
+      timer_(std::make_unique<TimerWrapHandle>(env, [this]() {
+        OnTimeout();
+      })) {
+  // Direct writes must start at a block boundary, and go to known offsets.
+  if (direct_) {
+    CHECK_GE(position_, 0);
+    CHECK_EQ(position_ % static_cast<int64_t>(block_size_), 0);
+  }
+}
+
+void FileWriter::New(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args.IsConstructCall());
+  CHECK(args[0]->IsInt32());
+  CHECK(args[1]->IsNumber());
+  CHECK(args[2]->IsUint32());
+  CHECK(args[3]->IsUint32());
+  CHECK(args[4]->IsUint32());
+
+  const uint32_t block_size = args[4].As<Uint32>()->Value();
+  CHECK_GT(block_size, 0);
+  CHECK_EQ(block_size & (block_size - 1), 0);
+  new FileWriter(env,
+                 args.This(),
+                 args[0].As<Int32>()->Value(),
+                 static_cast<int64_t>(args[1].As<Number>()->Value()),
+                 std::max<uint32_t>(1, args[2].As<Uint32>()->Value()),
+                 args[3].As<Uint32>()->Value(),
+                 block_size,
+                 args[5]->IsTrue(),
+                 args[6]->IsTrue());
+}
+
+void FileWriter::Write(const FunctionCallbackInfo<Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  FileWriter* writer;
+  ASSIGN_OR_RETURN_UNWRAP(&writer, args.Holder());
+  CHECK(!writer->closed_);
+
+  size_t length;
+  if (args[0]->IsArrayBufferView()) {
+    ArrayBufferViewContents<char> data(args[0]);
+    length = data.length();
+    if (length > 0) memcpy(writer->Reserve(length), data.data(), length);
+  } else {
+    CHECK(args[0]->IsString());
+    const enum encoding enc = ParseEncoding(isolate, args[1], UTF8);
+    size_t storage;
+    if (!StringBytes::StorageSize(isolate, args[0], enc).To(&storage)) return;
+    length = StringBytes::Write(
+        isolate, writer->Reserve(storage), storage, args[0], enc);
+  }
+  writer->Commit(length);
+  args.GetReturnValue().Set(static_cast<double>(writer->buffered_));
+}
+
+void FileWriter::Flush(const FunctionCallbackInfo<Value>& args) {
+  FileWriter* writer;
+  ASSIGN_OR_RETURN_UNWRAP(&writer, args.Holder());
+  if (writer->flushing_)
+    writer->flush_requested_ = true;
+  else
+    writer->StartFlush();
+}
+
+void FileWriter::Close(const FunctionCallbackInfo<Value>& args) {
+  FileWriter* writer;
+  ASSIGN_OR_RETURN_UNWRAP(&writer, args.Holder());
+  if (writer->closed_) return;
+  // Anything that is still buffered is dropped. Callers flush first.
+  writer->closed_ = true;
+  writer->timer_armed_ = false;
+  writer->timer_.reset();
+  writer->MakeWeak();
+}
+
+char* FileWriter::Reserve(size_t length) {
+  const size_t needed = active_.size + length;
+  if (needed > active_.capacity) {
+    // Keep the capacity a whole number of blocks, so that direct writes can
+    // be padded in place.
+    const size_t capacity = RoundUp(
+        std::max({needed, high_water_mark_, 2 * active_.capacity}),
+        block_size_);
+    Block block;
+    block.storage.reset(new char[capacity + block_size_]);
+    block.data = AlignUp(block.storage.get(), block_size_);
+    block.capacity = capacity;
+    block.size = active_.size;
+    if (active_.size > 0) memcpy(block.data, active_.data, active_.size);
+    active_ = std::move(block);
+  }
+  return active_.data + active_.size;
+}
+
+void FileWriter::Commit(size_t length) {
+  if (length == 0) return;
+  active_.size += length;
+  buffered_ += length;
+  if (failed_) {
+    // Nothing is written anymore, so don't hold on to the data.
+    active_.size = 0;
+    return;
+  }
+
+  if (active_.size - carried_ >= high_water_mark_) {
+    if (flushing_)
+      flush_requested_ = true;
+    else
+      StartFlush();
+  } else if (!timer_armed_) {
+    timer_armed_ = true;
+    timer_->Update(flush_interval_);
+  }
+}
+
+void FileWriter::OnTimeout() {
+  timer_armed_ = false;
+  if (flushing_)
+    flush_requested_ = true;
+  else
+    StartFlush();
+}
+
+void FileWriter::StartFlush() {
+  CHECK(!flushing_);
+  if (timer_armed_) {
+    timer_armed_ = false;
+    timer_->Stop();
+  }
+  flush_requested_ = false;
+  if (failed_ || active_.size == carried_) return;
+
+  const size_t length = active_.size;
+  const int64_t offset = position_;
+  size_t write_length = length;
+  int64_t truncate_to = -1;
+  std::swap(active_, in_flight_);
+  active_.size = 0;
+
+  if (direct_) {
+    // Pad the last block with zeros, then cut the file back to the real end.
+    // The partial block is carried over and written again next time.
+    const size_t tail = length % block_size_;
+    write_length = RoundUp(length, block_size_);
+    memset(in_flight_.data + length, 0, write_length - length);
+    if (tail > 0) {
+      memcpy(Reserve(tail), in_flight_.data + length - tail, tail);
+      active_.size = tail;
+      truncate_to = offset + length;
+    }
+    carried_ = tail;
+    position_ += length - tail;
+  } else if (position_ >= 0) {
+    position_ += length;
+  }
+
+  flushing_ = true;
+  FlushJob* job =
+      new FlushJob(this, offset, write_length, truncate_to, buffered_);
+  job->ScheduleWork();
+}
+
+void FileWriter::OnFlushDone(int err, const char* syscall, uint64_t end) {
+  Environment* env = this->env();
+  Isolate* isolate = env->isolate();
+  flushing_ = false;
+
+  if (err == 0) {
+    written_ = end;
+    if (sync_) synced_ = end;
+    if (!closed_ && (flush_requested_ ||
+                     active_.size - carried_ >= high_water_mark_)) {
+      StartFlush();
+    }
+  } else {
+    failed_ = true;
+    active_.size = 0;
+    carried_ = 0;
+    if (timer_armed_) {
+      timer_armed_ = false;
+      timer_->Stop();
+    }
+  }
+
+  if (!env->can_call_into_js()) return;
+  HandleScope handle_scope(isolate);
+  Context::Scope context_scope(env->context());
+  Local<Value> syscall_value = Undefined(isolate);
+  if (syscall != nullptr) syscall_value = OneByteString(isolate, syscall);
+  Local<Value> argv[] = {
+      Integer::New(isolate, err),
+      syscall_value,
+      Number::New(isolate, static_cast<double>(written_)),
+      Number::New(isolate, static_cast<double>(synced_)),
+  };
+  MakeCallback(env->oncomplete_string(), arraysize(argv), argv);
+}
+
+void FileWriter::MemoryInfo(MemoryTracker* tracker) const {
+  tracker->TrackFieldWithSize("buffers",
+                              active_.capacity + in_flight_.capacity);
+  tracker->TrackField("timer", timer_);
+}
+
+void FileWriter::Initialize(Environment* env, Local<Object> target) {
+  Isolate* isolate = env->isolate();
+  Local<FunctionTemplate> writer = NewFunctionTemplate(isolate, New);
+  writer->Inherit(AsyncWrap::GetConstructorTemplate(env));
+  writer->InstanceTemplate()->SetInternalFieldCount(
+      AsyncWrap::kInternalFieldCount);
+  SetProtoMethod(isolate, writer, "write", Write);
+  SetProtoMethod(isolate, writer, "flush", Flush);
+  SetProtoMethod(isolate, writer, "close", Close);
+  SetConstructorFunction(env->context(), target, "FileWriter", writer);
+}
+
+void FileWriter::RegisterExternalReferences(
+    ExternalReferenceRegistry* registry) {
+  registry->Register(New);
+  registry->Register(Write);
+  registry->Register(Flush);
+  registry->Register(Close);
+}
+
 BindingData* FSReqBase::binding_data() {
   return binding_data_.get();
 }
@@ -2732,6 +4043,9 @@ BindingData* FSReqBase::binding_data() {
 void RegisterExternalReferences(ExternalReferenceRegistry* registry) {
   registry->Register(Access);
   StatWatcher::RegisterExternalReferences(registry);
+  FSStatManyJob::RegisterExternalReferences(registry);
+  FSReadFileJob::RegisterExternalReferences(registry);
+  FileWriter::RegisterExternalReferences(registry);
 
   registry->Register(Close);
   registry->Register(Open);
@@ -2745,9 +4059,20 @@ void RegisterExternalReferences(ExternalReferenceRegistry* registry) {
   registry->Register(RMDir);
   registry->Register(MKDir);
   registry->Register(ReadDir);
+  registry->Register(ReadWholeFileSync);
+  registry->Register(MmapSync);
   registry->Register(InternalModuleReadJSON);
+  registry->Register(InternalModuleReadPackageJSON);
   registry->Register(InternalModuleStat);
+  registry->Register(FastInternalModuleStat);
+  registry->Register(fast_internal_module_stat_.GetTypeInfo());
   registry->Register(Stat);
+  registry->Register(StatSync);
+  registry->Register(FastStatSync);
+  registry->Register(fast_stat_sync_.GetTypeInfo());
+  registry->Register(ExistsSync);
+  registry->Register(FastExistsSync);
+  registry->Register(fast_exists_sync_.GetTypeInfo());
   registry->Register(LStat);
   registry->Register(FStat);
   registry->Register(Link);
@@ -4,8 +4,11 @@
 #if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
 
 #include "aliased_buffer.h"
+#include "node_internals.h"
 #include "node_messaging.h"
+#include "node_package_json.h"
 #include "node_snapshotable.h"
+#include "node_stat_watcher.h"
 #include "stream_base.h"
 
 namespace node {
@@ -50,6 +53,14 @@ class BindingData : public SnapshotableObject {
   std::vector<BaseObjectPtr<FileHandleReadWrap>>
       file_handle_read_wrap_freelist;
 
+  // Only created on the main thread, if --experimental-package-json-cache
+  // is set.
+  std::unique_ptr<PackageConfigCache> package_config_cache;
+  bool package_config_cache_save_pending = false;
+
+  // Created when the first StatWatcher is started.
+  std::unique_ptr<StatPollScheduler> stat_poll_scheduler;
+
   using InternalFieldInfo = InternalFieldInfoBase;
   SERIALIZABLE_OBJECT_METHODS()
   static constexpr FastStringKey type_name{"node::fs::BindingData"};
@@ -122,6 +133,11 @@ class FSReqBase : public ReqWrap<uv_fs_t> {
   void set_is_plain_open(bool value) { is_plain_open_ = value; }
   void set_with_file_types(bool value) { with_file_types_ = value; }
 
+  // Whether the request is accounted as active in the Environment's
+  // ThreadPoolScheduler.
+  bool in_threadpool() const { return in_threadpool_; }
+  void set_in_threadpool(bool value) { in_threadpool_ = value; }
+
   FSContinuationData* continuation_data() const {
     return continuation_data_.get();
   }
@@ -147,6 +163,7 @@ class FSReqBase : public ReqWrap<uv_fs_t> {
   bool use_bigint_ = false;
   bool is_plain_open_ = false;
   bool with_file_types_ = false;
+  bool in_threadpool_ = false;
   const char* syscall_ = nullptr;
 
   BaseObjectPtr<BindingData> binding_data_;
@@ -174,6 +191,11 @@ class FSReqCallback final : public FSReqBase {
   FSReqCallback& operator=(const FSReqCallback&) = delete;
 };
 
+template <typename NativeT>
+void FillStatsArray(NativeT* fields,
+                    const uv_stat_t* s,
+                    const size_t offset = 0);
+
 template <typename NativeT, typename V8T>
 void FillStatsArray(AliasedBufferBase<NativeT, V8T>* fields,
                     const uv_stat_t* s,
@@ -280,6 +302,14 @@ class FileHandle final : public AsyncWrap, public StreamBase {
 
   int GetFD() override { return fd_; }
 
+  // Where the next read starts, or -1 for the current position of the fd, and
+  // how much is left to read, or -1 for everything up to EOF.
+  int64_t read_offset() const { return read_offset_; }
+  int64_t read_length() const { return read_length_; }
+  // Skips `nread` bytes that were consumed without reading them through this
+  // FileHandle, e.g. by a StreamPipe that sent them with sendfile().
+  void SkipRead(int64_t nread);
+
   // Will asynchronously close the FD and return a Promise that will
   // be resolved once closing is complete.
   static void Close(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -416,6 +446,230 @@ class FSReqWrapSync {
   std::unique_ptr<FSContinuationData> continuation_data_;
 };
 
+// Runs stat(), lstat() or access() on a list of paths as a single threadpool
+// job, rather than as one FSReqCallback per path. Results are passed to
+// `oncomplete` as a packed stats array with kFsStatsFieldsNumber entries per
+// path (not for access()), and an Int32Array with 0 or a negative errno per
+// path. Both are fresh typed arrays, not AliasedBuffers, and JS never
+// starts a job for an empty list of paths.
+class FSStatManyJob final : public AsyncWrap, public ThreadPoolWork {
+ public:
+  enum class Syscall { kStat, kLstat, kAccess };
+
+  static void Initialize(Environment* env, v8::Local<v8::Object> target);
+  static void RegisterExternalReferences(ExternalReferenceRegistry* registry);
+
+  // new FSStatManyJob(paths, syscall, mode, useBigint)
+  static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Run(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  void DoThreadPoolWork() override;
+  void AfterThreadPoolWork(int status) override;
+
+  void MemoryInfo(MemoryTracker* tracker) const override;
+  SET_MEMORY_INFO_NAME(FSStatManyJob)
+  SET_SELF_SIZE(FSStatManyJob)
+
+ private:
+  FSStatManyJob(Environment* env,
+                v8::Local<v8::Object> object,
+                std::vector<std::string>&& paths,
+                Syscall syscall,
+                int mode,
+                bool use_bigint);
+
+  template <typename NativeT, typename TypedArrayT>
+  v8::Local<v8::Value> PackStats(v8::Isolate* isolate) const;
+
+  std::vector<std::string> paths_;
+  Syscall syscall_;
+  int mode_;
+  bool use_bigint_;
+  std::vector<int32_t> errors_;
+  std::vector<uv_stat_t> stats_;
+};
+
+// Reads all of a file: open() unless it was given an fd, fstat() to size the
+// buffer, read() until EOF and close(). With `utf8`, it also validates and
+// transcodes the contents with simdutf so that creating the string later is a
+// plain copy. Run() and RunStep() do not touch V8 and can be called off the
+// main thread; ToValue() must be called on the main thread afterwards.
+class ReadFileOperation final {
+ public:
+  // Opens `path` with `flags`.
+  ReadFileOperation(std::string&& path, int flags, bool utf8);
+  // Reads from the current position of `fd`, which is left open.
+  ReadFileOperation(uv_file fd, bool utf8);
+  ~ReadFileOperation();
+
+  ReadFileOperation(const ReadFileOperation&) = delete;
+  ReadFileOperation& operator=(const ReadFileOperation&) = delete;
+
+  // Does all of the work at once and reports each step as an fs.sync trace
+  // event.
+  void Run();
+  // Does a bounded part of the work, so that a large file, a FIFO or a slow
+  // mount cannot hold a threadpool thread for the whole read. The first step
+  // reads regular files of up to 4 MiB in full; otherwise every step makes a
+  // single read() of at most 512 KiB. Returns true once the operation is
+  // complete. Each step is reported as an fs.async trace event with
+  // `trace_id` as its id.
+  bool RunStep(const void* trace_id);
+  // Returns the contents as a Buffer, or as a string if `utf8` was set. On
+  // failure, returns an empty handle and sets `error`, unless an exception is
+  // pending.
+  v8::MaybeLocal<v8::Value> ToValue(Environment* env,
+                                    v8::Local<v8::Value>* error);
+
+  size_t self_size() const;
+
+ private:
+  bool Step(bool bounded);
+  bool Start();
+  bool ReadMore(size_t max_length);
+  void Finish();
+  void DecodeUtf8();
+  void Fail(int err, const char* syscall);
+
+  std::string path_;
+  int flags_ = 0;
+  uv_file fd_ = -1;
+  bool owns_fd_ = false;
+  bool utf8_;
+  const void* trace_id_ = nullptr;
+
+  bool started_ = false;
+  uint64_t size_ = 0;  // As reported by fstat(), 0 if unknown.
+  size_t capacity_ = 0;
+
+  int error_ = 0;
+  const char* syscall_ = nullptr;
+  // Set instead of error_ when the file is too large to read into a Buffer.
+  uint64_t too_large_size_ = 0;
+
+  char* data_ = nullptr;
+  size_t length_ = 0;
+  bool is_ascii_ = false;
+  // Only set if utf8_ is set and data_ was valid UTF-8 that is not ASCII.
+  char16_t* utf16_ = nullptr;
+  size_t utf16_length_ = 0;
+};
+
+// Runs a ReadFileOperation on the threadpool for fs.readFile(), one
+// RunStep() per job, then passes `(err, data)` to `oncomplete`.
+class FSReadFileJob final : public AsyncWrap, public ThreadPoolWork {
+ public:
+  static void Initialize(Environment* env, v8::Local<v8::Object> target);
+  static void RegisterExternalReferences(ExternalReferenceRegistry* registry);
+
+  // new FSReadFileJob(pathOrFd, flags, utf8)
+  static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Run(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  void DoThreadPoolWork() override;
+  void AfterThreadPoolWork(int status) override;
+
+  void MemoryInfo(MemoryTracker* tracker) const override;
+  SET_MEMORY_INFO_NAME(FSReadFileJob)
+  SET_SELF_SIZE(FSReadFileJob)
+
+ private:
+  FSReadFileJob(Environment* env,
+                v8::Local<v8::Object> object,
+                std::unique_ptr<ReadFileOperation> operation);
+
+  std::unique_ptr<ReadFileOperation> operation_;
+  bool done_ = false;
+};
+
+// Collects writes to a file in memory and writes them out from the threadpool
+// once `high_water_mark` bytes are buffered, `flush_interval` milliseconds
+// after the first buffered write, or when flush() is called. Only one write
+// is in flight at a time; data that arrives meanwhile goes out with the next
+// one, so that with `sync`, one fdatasync() commits all of it.
+//
+// With `direct`, the file is expected to be opened with O_DIRECT. Every write
+// then starts at a multiple of `block_size`, is padded to a whole number of
+// blocks from a buffer aligned to `block_size` and followed by ftruncate() to
+// the real end. The partial block at the end is kept and written again with
+// the next flush.
+//
+// After each write, `onflush(err, syscall, written, synced)` is called with
+// the number of bytes that have been written and synced so far.
+class FileWriter final : public AsyncWrap {
+ public:
+  static void Initialize(Environment* env, v8::Local<v8::Object> target);
+  static void RegisterExternalReferences(ExternalReferenceRegistry* registry);
+
+  // new FileWriter(fd, position, highWaterMark, flushInterval, blockSize,
+  //                direct, sync)
+  // `position` is -1 to write at the current position of the file.
+  static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+  // write(bufferOrString, encoding), returns the number of bytes buffered.
+  static void Write(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Flush(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Close(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  void MemoryInfo(MemoryTracker* tracker) const override;
+  SET_MEMORY_INFO_NAME(FileWriter)
+  SET_SELF_SIZE(FileWriter)
+
+ private:
+  class FlushJob;
+
+  // A buffer whose data is aligned to `alignment`.
+  struct Block {
+    std::unique_ptr<char[]> storage;
+    char* data = nullptr;
+    size_t size = 0;
+    size_t capacity = 0;
+  };
+
+  FileWriter(Environment* env,
+             v8::Local<v8::Object> object,
+             uv_file fd,
+             int64_t position,
+             size_t high_water_mark,
+             uint64_t flush_interval,
+             size_t block_size,
+             bool direct,
+             bool sync);
+
+  // Returns space for `length` more bytes at the end of `active_`.
+  char* Reserve(size_t length);
+  void Commit(size_t length);
+  void OnTimeout();
+  void StartFlush();
+  void OnFlushDone(int err, const char* syscall, uint64_t end);
+
+  uv_file fd_;
+  // Offset in the file at which active_ starts, or -1.
+  int64_t position_;
+  size_t high_water_mark_;
+  uint64_t flush_interval_;
+  size_t block_size_;
+  bool direct_;
+  bool sync_;
+
+  Block active_;
+  Block in_flight_;
+  // Bytes at the start of active_ that have already been written, because
+  // they are the end of a partial block from the last direct write.
+  size_t carried_ = 0;
+  bool flushing_ = false;
+  bool flush_requested_ = false;
+  bool timer_armed_ = false;
+  bool closed_ = false;
+  // Set after a write fails, which makes the writer discard further data.
+  bool failed_ = false;
+  std::unique_ptr<TimerWrapHandle> timer_;
+
+  // Totals since the writer was created.
+  uint64_t buffered_ = 0;
+  uint64_t written_ = 0;
+  uint64_t synced_ = 0;
+};
+
 // TODO(addaleax): Currently, callers check the return value and assume
 // that nullptr indicates a synchronous call, rather than a failure.
 // Failure conditions should be disambiguated and handled appropriately.
@@ -258,11 +258,13 @@ class DebugSealHandleScope {
 
 class ThreadPoolWork {
  public:
-  explicit inline ThreadPoolWork(Environment* env, const char* type)
-      : env_(env), type_(type) {
+  explicit inline ThreadPoolWork(Environment* env,
+                                 const char* type,
+                                 ThreadPoolWorkClass work_class)
+      : env_(env), type_(type), work_class_(work_class) {
     CHECK_NOT_NULL(env);
   }
-  inline virtual ~ThreadPoolWork() = default;
+  virtual ~ThreadPoolWork();
 
   inline void ScheduleWork();
   inline int CancelWork();
@@ -271,11 +273,17 @@ class ThreadPoolWork {
   virtual void AfterThreadPoolWork(int status) = 0;
 
   Environment* env() const { return env_; }
+  ThreadPoolWorkClass work_class() const { return work_class_; }
 
  private:
+  friend class ThreadPoolScheduler;
+
+  inline void QueueWork();
+
   Environment* env_;
   uv_work_t work_req_;
   const char* type_;
+  ThreadPoolWorkClass work_class_;
 };
 
 #define TRACING_CATEGORY_NODE "node"
@@ -305,6 +313,8 @@ v8::Isolate* NewIsolate(v8::Isolate::CreateParams* params,
                         uv_loop_t* event_loop,
                         MultiIsolatePlatform* platform,
                         bool has_snapshot_data = false);
+// Applies --event-loop-busy-poll and --socket-busy-poll to `loop`.
+void ConfigureBusyPoll(uv_loop_t* loop);
 // This overload automatically picks the right 'main_script_id' if no callback
 // was provided by the embedder.
 v8::MaybeLocal<v8::Value> StartExecution(Environment* env,
@@ -603,7 +603,9 @@ void MessagePortData::Disentangle() {
 }
 
 MessagePort::~MessagePort() {
+  // Detach() first so that no other thread can ring the doorbell anymore.
   if (data_) Detach();
+  env()->doorbell()->Cancel(this);
 }
 
 MessagePort::MessagePort(Environment* env,
@@ -614,15 +616,11 @@ MessagePort::MessagePort(Environment* env,
                reinterpret_cast<uv_handle_t*>(&async_),
                AsyncWrap::PROVIDER_MESSAGEPORT),
     data_(new MessagePortData(this)) {
-  auto onmessage = [](uv_async_t* handle) {
-    // Called when data has been put into the queue.
-    MessagePort* channel = ContainerOf(&MessagePort::async_, handle);
-    channel->OnMessage(MessageProcessingMode::kNormalOperation);
-  };
-
+  // Incoming messages are announced through the Environment's Doorbell,
+  // see TriggerAsync(), so this callback never runs.
   CHECK_EQ(uv_async_init(env->event_loop(),
                          &async_,
-                         onmessage), 0);
+                         [](uv_async_t*) {}), 0);
   // Reset later to indicate success of the constructor.
   bool succeeded = false;
   auto cleanup = OnScopeLeave([&]() { if (!succeeded) Close(); });
@@ -652,7 +650,7 @@ bool MessagePort::IsDetached() const {
 
 void MessagePort::TriggerAsync() {
   if (IsHandleClosing()) return;
-  CHECK_EQ(uv_async_send(&async_), 0);
+  env()->doorbell()->Ring(this);
 }
 
 void MessagePort::Close(v8::Local<v8::Value> close_callback) {
@@ -752,36 +750,31 @@ MaybeLocal<Value> MessagePort::ReceiveMessage(Local<Context> context,
   return received->Deserialize(env(), context, port_list);
 }
 
-void MessagePort::OnMessage(MessageProcessingMode mode) {
+size_t MessagePort::OnDoorbell(size_t budget) {
+  // The handle may have started closing after the port rang the doorbell.
+  if (IsHandleClosing()) return 0;
+  return OnMessage(MessageProcessingMode::kNormalOperation, budget);
+}
+
+size_t MessagePort::OnMessage(MessageProcessingMode mode, size_t limit) {
   Debug(this, "Running MessagePort::OnMessage()");
   HandleScope handle_scope(env()->isolate());
   Local<Context> context =
       object(env()->isolate())->GetCreationContext().ToLocalChecked();
 
-  size_t processing_limit;
-  if (mode == MessageProcessingMode::kNormalOperation) {
-    Mutex::ScopedLock(data_->mutex_);
-    processing_limit = std::max(data_->incoming_messages_.size(),
-                                static_cast<size_t>(1000));
-  } else {
-    processing_limit = std::numeric_limits<size_t>::max();
-  }
+  size_t processed = 0;
 
   // data_ can only ever be modified by the owner thread, so no need to lock.
   // However, the message port may be transferred while it is processing
   // messages, so we need to check that this handle still owns its `data_` field
   // on every iteration.
   while (data_) {
-    if (processing_limit-- == 0) {
-      // Prevent event loop starvation by only processing those messages without
-      // interruption that were already present when the OnMessage() call was
-      // first triggered, but at least 1000 messages because otherwise the
-      // overhead of repeatedly triggering the uv_async_t instance becomes
-      // noticeable, at least on Windows.
-      // (That might require more investigation by somebody more familiar with
-      // Windows.)
+    if (processed == limit) {
+      // Prevent event loop starvation: the Doorbell shares a budget of
+      // messages per event loop iteration between all ports, and gets back to
+      // this one once the others had their turn.
       TriggerAsync();
-      return;
+      return processed;
     }
 
     HandleScope handle_scope(env()->isolate());
@@ -804,6 +797,7 @@ void MessagePort::OnMessage(MessageProcessingMode mode) {
       }
     }
     if (payload == env()->no_message_symbol()) break;
+    processed++;
 
     if (!env()->can_call_into_js()) {
       Debug(this, "MessagePort drains queue because !can_call_into_js()");
@@ -827,9 +821,10 @@ void MessagePort::OnMessage(MessageProcessingMode mode) {
       // Re-schedule OnMessage() execution in case of failure.
       if (data_)
         TriggerAsync();
-      return;
+      return processed;
     }
   }
+  return processed;
 }
 
 void MessagePort::OnClose() {
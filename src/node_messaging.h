@@ -7,6 +7,7 @@
 #include "node_mutex.h"
 #include "v8.h"
 #include <deque>
+#include <limits>
 #include <string>
 #include <unordered_map>
 #include <set>
@@ -215,10 +216,11 @@ class MessagePortData : public TransferData {
   friend class SiblingGroup;
 };
 
-// A message port that receives messages from other threads, including
-// the uv_async_t handle that is used to notify the current event loop of
-// new incoming messages.
-class MessagePort : public HandleWrap {
+// A message port that receives messages from other threads. Other threads
+// notify the current event loop of new incoming messages through the
+// Environment's Doorbell. The uv_async_t handle is never sent to, it only
+// determines whether the port keeps the event loop alive.
+class MessagePort : public HandleWrap, public DoorbellTarget {
  private:
   // Create a new MessagePort. The `context` argument specifies the Context
   // instance that is used for creating the values emitted from this port.
@@ -300,7 +302,10 @@ class MessagePort : public HandleWrap {
   };
 
   void OnClose() override;
-  void OnMessage(MessageProcessingMode mode);
+  size_t OnDoorbell(size_t budget) override;
+  // Emits up to `limit` messages and returns how many were emitted.
+  size_t OnMessage(MessageProcessingMode mode,
+                   size_t limit = std::numeric_limits<size_t>::max());
   void TriggerAsync();
   v8::MaybeLocal<v8::Value> ReceiveMessage(
       v8::Local<v8::Context> context,
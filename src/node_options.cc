@@ -93,6 +93,19 @@ void PerProcessOptions::CheckOptions(std::vector<std::string>* errors,
       use_largepages != "silent") {
     errors->push_back("invalid value for --use-largepages");
   }
+
+  if (event_loop_busy_poll < 0 || event_loop_busy_poll > 1000000) {
+    errors->push_back("--event-loop-busy-poll must be between 0 and 1000000");
+  }
+  if (socket_busy_poll < 0 || socket_busy_poll > 1000000) {
+    errors->push_back("--socket-busy-poll must be between 0 and 1000000");
+  }
+#ifndef __linux__
+  if (event_loop_busy_poll != 0 || socket_busy_poll != 0) {
+    errors->push_back("--event-loop-busy-poll and --socket-busy-poll are "
+                      "only supported on Linux");
+  }
+#endif
   per_isolate->CheckOptions(errors, argv);
 }
 
@@ -139,6 +152,35 @@ void EnvironmentOptions::CheckOptions(std::vector<std::string>* errors,
     errors->push_back("--heapsnapshot-near-heap-limit must not be negative");
   }
 
+  // fs and dns requests are submitted to libuv directly and are never held
+  // back, so a cap or weight for them would have no effect.
+  auto is_held_back = [](ThreadPoolWorkClass cls) {
+    return cls != ThreadPoolWorkClass::kFs && cls != ThreadPoolWorkClass::kDns;
+  };
+  ThreadPoolWorkClass threadpool_class;
+  uint64_t threadpool_value;
+  for (const std::string& setting : threadpool_class_concurrency) {
+    if (!ParseThreadPoolClassSetting(
+            setting, &threadpool_class, &threadpool_value)) {
+      errors->push_back("invalid value for --threadpool-class-concurrency: " +
+                        setting);
+    } else if (!is_held_back(threadpool_class)) {
+      errors->push_back("--threadpool-class-concurrency does not apply to fs "
+                        "and dns requests: " + setting);
+    }
+  }
+  for (const std::string& setting : threadpool_class_weight) {
+    if (!ParseThreadPoolClassSetting(
+            setting, &threadpool_class, &threadpool_value) ||
+        threadpool_value == 0 || threadpool_value > 1000) {
+      errors->push_back("--threadpool-class-weight must be class=n with n "
+                        "between 1 and 1000: " + setting);
+    } else if (!is_held_back(threadpool_class)) {
+      errors->push_back("--threadpool-class-weight does not apply to fs "
+                        "and dns requests: " + setting);
+    }
+  }
+
   if (test_runner) {
     if (test_runner_coverage) {
       // TODO(cjihrig): This restriction can be removed once multi-process
@@ -396,6 +438,11 @@ EnvironmentOptionsParser::EnvironmentOptionsParser() {
             "experimental ES Module import.meta.resolve() support",
             &EnvironmentOptions::experimental_import_meta_resolve,
             kAllowedInEnvvar);
+  AddOption("--experimental-package-json-cache",
+            "cache the package.json fields used by the module loaders "
+            "in the specified file",
+            &EnvironmentOptions::experimental_package_json_cache,
+            kAllowedInEnvvar);
   AddOption("--experimental-policy",
             "use the specified file as a "
             "security policy",
@@ -574,6 +621,22 @@ EnvironmentOptionsParser::EnvironmentOptionsParser() {
             kAllowedInEnvvar);
   AddOption("--test-udp-no-try-send", "",  // For testing only.
             &EnvironmentOptions::test_udp_no_try_send);
+  AddOption("--threadpool-concurrency",
+            "maximum number of requests this thread keeps in the libuv "
+            "threadpool at once (default: 0, unlimited)",
+            &EnvironmentOptions::threadpool_concurrency,
+            kAllowedInEnvvar);
+  AddOption("--threadpool-class-concurrency",
+            "maximum number of requests of one class (fs, crypto, "
+            "compression, dns, user) this thread keeps in the libuv "
+            "threadpool at once, e.g. crypto=2",
+            &EnvironmentOptions::threadpool_class_concurrency,
+            kAllowedInEnvvar);
+  AddOption("--threadpool-class-weight",
+            "relative share of freed threadpool slots given to a class "
+            "of requests, from 1 to 1000, e.g. fs=4 (default: 1)",
+            &EnvironmentOptions::threadpool_class_weight,
+            kAllowedInEnvvar);
   AddOption("--throw-deprecation",
             "throw an exception on deprecations",
             &EnvironmentOptions::throw_deprecation,
@@ -798,6 +861,16 @@ PerProcessOptionsParser::PerProcessOptionsParser(
             "set V8's thread pool size",
             &PerProcessOptions::v8_thread_pool_size,
             kAllowedInEnvvar);
+  AddOption("--event-loop-busy-poll",
+            "microseconds the event loop polls without blocking before "
+            "it waits for I/O (default: 0, off)",
+            &PerProcessOptions::event_loop_busy_poll,
+            kAllowedInEnvvar);
+  AddOption("--socket-busy-poll",
+            "SO_BUSY_POLL value in microseconds for TCP sockets "
+            "(default: 0, off)",
+            &PerProcessOptions::socket_busy_poll,
+            kAllowedInEnvvar);
   AddOption("--zero-fill-buffers",
             "automatically zero-fill all newly allocated Buffer and "
             "SlowBuffer instances",
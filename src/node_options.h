@@ -118,6 +118,7 @@ class EnvironmentOptions : public Options {
   bool experimental_import_meta_resolve = false;
   std::string module_type;
   std::string experimental_policy;
+  std::string experimental_package_json_cache;
   std::string experimental_policy_integrity;
   bool has_policy_integrity_string = false;
   bool experimental_repl_await = true;
@@ -160,6 +161,9 @@ class EnvironmentOptions : public Options {
   std::vector<std::string> test_reporter_destination;
   bool test_only = false;
   bool test_udp_no_try_send = false;
+  uint64_t threadpool_concurrency = 0;
+  std::vector<std::string> threadpool_class_concurrency;
+  std::vector<std::string> threadpool_class_weight;
   bool throw_deprecation = false;
   bool trace_atomics_wait = false;
   bool trace_deprecation = false;
@@ -245,6 +249,8 @@ class PerProcessOptions : public Options {
   std::string trace_event_categories;
   std::string trace_event_file_pattern = "node_trace.${rotation}.log";
   int64_t v8_thread_pool_size = 4;
+  int64_t event_loop_busy_poll = 0;
+  int64_t socket_busy_poll = 0;
   bool zero_fill_all_buffers = false;
   bool debug_arraybuffer_allocations = false;
   std::string disable_proto;
@@ -0,0 +1,391 @@
+#include "node_package_json.h"
+#include "node_internals.h"
+#include "util-inl.h"
+
+#include <cstring>
+
+namespace node {
+namespace fs {
+
+namespace {
+
+// Deeper documents are left to JSON.parse(), so that this can recurse.
+constexpr int kMaxDepth = 512;
+
+// Checks JSON text against the grammar of ECMA-404, the same one that
+// JSON.parse() accepts, without building any values.
+class JsonScanner {
+ public:
+  explicit JsonScanner(std::string_view json)
+      : p_(json.data()), end_(json.data() + json.size()) {}
+
+  bool ScanDocument(PackageConfig* config);
+
+ private:
+  void SkipWhitespace();
+  bool Consume(char c);
+  bool ScanValue(int depth);
+  bool ScanObject(int depth);
+  bool ScanArray(int depth);
+  // If `decoded` is not nullptr, the string is decoded into it, but with any
+  // non-ASCII character that was escaped replaced by '\x80', which is enough
+  // to compare it with ASCII keys.
+  bool ScanString(std::string* decoded);
+  bool ScanNumber();
+  bool ScanLiteral(std::string_view literal);
+  bool ScanDigits();
+
+  const char* p_;
+  const char* const end_;
+};
+
+int FieldFromKey(const std::string& key) {
+  static constexpr std::string_view kKeys[] = {
+      "name", "main", "type", "exports", "imports"};
+  static_assert(arraysize(kKeys) == PackageConfig::kFieldCount);
+  for (size_t i = 0; i < arraysize(kKeys); i++) {
+    if (key == kKeys[i]) return static_cast<int>(i);
+  }
+  return -1;
+}
+
+bool JsonScanner::ScanDocument(PackageConfig* config) {
+  SkipWhitespace();
+  if (p_ < end_ && *p_ == '{') {
+    p_++;
+    SkipWhitespace();
+    if (!Consume('}')) {
+      std::string key;
+      do {
+        SkipWhitespace();
+        key.clear();
+        if (p_ == end_ || *p_ != '"' || !ScanString(&key)) return false;
+        SkipWhitespace();
+        if (!Consume(':')) return false;
+        SkipWhitespace();
+        const char* value = p_;
+        if (!ScanValue(1)) return false;
+        // Like JSON.parse(), the last of duplicate keys wins.
+        int field = FieldFromKey(key);
+        if (field >= 0) {
+          config->values[field].assign(value, p_ - value);
+          config->present |= 1 << field;
+        }
+        SkipWhitespace();
+      } while (Consume(','));
+      if (!Consume('}')) return false;
+    }
+  } else if (!ScanValue(0)) {
+    return false;
+  }
+  SkipWhitespace();
+  return p_ == end_;
+}
+
+void JsonScanner::SkipWhitespace() {
+  while (p_ < end_ &&
+         (*p_ == ' ' || *p_ == '\t' || *p_ == '\n' || *p_ == '\r')) {
+    p_++;
+  }
+}
+
+bool JsonScanner::Consume(char c) {
+  if (p_ == end_ || *p_ != c) return false;
+  p_++;
+  return true;
+}
+
+bool JsonScanner::ScanValue(int depth) {
+  if (p_ == end_ || depth > kMaxDepth) return false;
+  switch (*p_) {
+    case '{': return ScanObject(depth);
+    case '[': return ScanArray(depth);
+    case '"': return ScanString(nullptr);
+    case 't': return ScanLiteral("true");
+    case 'f': return ScanLiteral("false");
+    case 'n': return ScanLiteral("null");
+    default: return ScanNumber();
+  }
+}
+
+bool JsonScanner::ScanObject(int depth) {
+  p_++;
+  SkipWhitespace();
+  if (Consume('}')) return true;
+  do {
+    SkipWhitespace();
+    if (p_ == end_ || *p_ != '"' || !ScanString(nullptr)) return false;
+    SkipWhitespace();
+    if (!Consume(':')) return false;
+    SkipWhitespace();
+    if (!ScanValue(depth + 1)) return false;
+    SkipWhitespace();
+  } while (Consume(','));
+  return Consume('}');
+}
+
+bool JsonScanner::ScanArray(int depth) {
+  p_++;
+  SkipWhitespace();
+  if (Consume(']')) return true;
+  do {
+    SkipWhitespace();
+    if (!ScanValue(depth + 1)) return false;
+    SkipWhitespace();
+  } while (Consume(','));
+  return Consume(']');
+}
+
+bool JsonScanner::ScanString(std::string* decoded) {
+  p_++;  // Opening quote.
+  while (p_ < end_) {
+    const char c = *p_++;
+    if (c == '"') return true;
+    if (static_cast<unsigned char>(c) < 0x20) return false;
+    if (c != '\\') {
+      if (decoded != nullptr) decoded->push_back(c);
+      continue;
+    }
+    if (p_ == end_) return false;
+    char unescaped;
+    switch (*p_++) {
+      case '"': unescaped = '"'; break;
+      case '\\': unescaped = '\\'; break;
+      case '/': unescaped = '/'; break;
+      case 'b': unescaped = '\b'; break;
+      case 'f': unescaped = '\f'; break;
+      case 'n': unescaped = '\n'; break;
+      case 'r': unescaped = '\r'; break;
+      case 't': unescaped = '\t'; break;
+      case 'u': {
+        if (end_ - p_ < 4) return false;
+        unsigned code_unit = 0;
+        for (int i = 0; i < 4; i++) {
+          const char h = *p_++;
+          code_unit <<= 4;
+          if (h >= '0' && h <= '9') {
+            code_unit |= h - '0';
+          } else if (h >= 'a' && h <= 'f') {
+            code_unit |= h - 'a' + 10;
+          } else if (h >= 'A' && h <= 'F') {
+            code_unit |= h - 'A' + 10;
+          } else {
+            return false;
+          }
+        }
+        unescaped = code_unit < 0x80 ? static_cast<char>(code_unit) : '\x80';
+        break;
+      }
+      default:
+        return false;
+    }
+    if (decoded != nullptr) decoded->push_back(unescaped);
+  }
+  return false;
+}
+
+bool JsonScanner::ScanDigits() {
+  const char* start = p_;
+  while (p_ < end_ && *p_ >= '0' && *p_ <= '9') p_++;
+  return p_ != start;
+}
+
+bool JsonScanner::ScanNumber() {
+  Consume('-');
+  if (Consume('0')) {
+    // No leading zeros.
+  } else if (!ScanDigits()) {
+    return false;
+  }
+  if (Consume('.') && !ScanDigits()) return false;
+  if (Consume('e') || Consume('E')) {
+    if (!Consume('+')) Consume('-');
+    if (!ScanDigits()) return false;
+  }
+  return true;
+}
+
+bool JsonScanner::ScanLiteral(std::string_view literal) {
+  if (static_cast<size_t>(end_ - p_) < literal.size() ||
+      memcmp(p_, literal.data(), literal.size()) != 0) {
+    return false;
+  }
+  p_ += literal.size();
+  return true;
+}
+
+constexpr char kCacheMagic[] = "NODEPJC1";
+constexpr size_t kCacheMagicLength = sizeof(kCacheMagic) - 1;
+
+// The cache file is only ever read by the machine that wrote it, so integers
+// are stored in native byte order.
+template <typename T>
+void Append(std::string* out, T value) {
+  out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void AppendString(std::string* out, const std::string& value) {
+  Append<uint32_t>(out, value.size());
+  out->append(value);
+}
+
+class CacheReader {
+ public:
+  explicit CacheReader(const std::string& data)
+      : p_(data.data()), end_(data.data() + data.size()) {}
+
+  bool done() const { return p_ == end_; }
+
+  bool Skip(std::string_view expected) {
+    if (static_cast<size_t>(end_ - p_) < expected.size() ||
+        memcmp(p_, expected.data(), expected.size()) != 0) {
+      return false;
+    }
+    p_ += expected.size();
+    return true;
+  }
+
+  template <typename T>
+  bool Read(T* value) {
+    if (static_cast<size_t>(end_ - p_) < sizeof(*value)) return false;
+    memcpy(value, p_, sizeof(*value));
+    p_ += sizeof(*value);
+    return true;
+  }
+
+  bool ReadString(std::string* value) {
+    uint32_t length;
+    if (!Read(&length) || static_cast<size_t>(end_ - p_) < length)
+      return false;
+    value->assign(p_, length);
+    p_ += length;
+    return true;
+  }
+
+ private:
+  const char* p_;
+  const char* const end_;
+};
+
+}  // anonymous namespace
+
+size_t PackageConfig::self_size() const {
+  size_t size = sizeof(*this);
+  for (const std::string& value : values) size += value.size();
+  return size;
+}
+
+bool PackageConfig::Parse(std::string_view json) {
+  return JsonScanner(json).ScanDocument(this);
+}
+
+PackageConfigCache::PackageConfigCache(std::string&& path)
+    : path_(std::move(path)) {}
+
+PackageConfigCache::~PackageConfigCache() {
+  Save();
+}
+
+bool PackageConfigCache::Matches(const Entry& entry, const uv_stat_t& stat) {
+  return entry.mtime_sec == static_cast<int64_t>(stat.st_mtim.tv_sec) &&
+         entry.mtime_nsec == static_cast<int64_t>(stat.st_mtim.tv_nsec) &&
+         entry.size == stat.st_size && entry.ino == stat.st_ino;
+}
+
+const PackageConfig* PackageConfigCache::Get(const std::string& path,
+                                             const uv_stat_t& stat) {
+  if (!loaded_) Load();
+  auto it = entries_.find(path);
+  if (it == entries_.end() || !Matches(it->second, stat)) return nullptr;
+  return &it->second.config;
+}
+
+void PackageConfigCache::Set(const std::string& path,
+                             const uv_stat_t& stat,
+                             const PackageConfig& config) {
+  if (!loaded_) Load();
+  Entry& entry = entries_[path];
+  entry.mtime_sec = stat.st_mtim.tv_sec;
+  entry.mtime_nsec = stat.st_mtim.tv_nsec;
+  entry.size = stat.st_size;
+  entry.ino = stat.st_ino;
+  entry.config = config;
+  dirty_ = true;
+}
+
+void PackageConfigCache::Load() {
+  loaded_ = true;
+  std::string data;
+  if (ReadFileSync(&data, path_.c_str()) != 0) return;
+
+  // A cache file that can't be read is ignored and overwritten later.
+  CacheReader reader(data);
+  if (!reader.Skip(std::string_view(kCacheMagic, kCacheMagicLength))) return;
+  while (!reader.done()) {
+    std::string path;
+    Entry entry;
+    bool ok = reader.ReadString(&path) &&
+              reader.Read(&entry.mtime_sec) &&
+              reader.Read(&entry.mtime_nsec) &&
+              reader.Read(&entry.size) &&
+              reader.Read(&entry.ino) &&
+              reader.Read(&entry.config.present);
+    for (int i = 0; ok && i < PackageConfig::kFieldCount; i++) {
+      if (entry.config.has(static_cast<PackageConfig::Field>(i)))
+        ok = reader.ReadString(&entry.config.values[i]);
+    }
+    if (!ok) {
+      entries_.clear();
+      return;
+    }
+    entries_[std::move(path)] = std::move(entry);
+  }
+}
+
+int PackageConfigCache::Save() {
+  if (!dirty_) return 0;
+
+  std::string data(kCacheMagic, kCacheMagicLength);
+  for (const auto& [path, entry] : entries_) {
+    AppendString(&data, path);
+    Append(&data, entry.mtime_sec);
+    Append(&data, entry.mtime_nsec);
+    Append(&data, entry.size);
+    Append(&data, entry.ino);
+    Append(&data, entry.config.present);
+    for (int i = 0; i < PackageConfig::kFieldCount; i++) {
+      if (entry.config.has(static_cast<PackageConfig::Field>(i)))
+        AppendString(&data, entry.config.values[i]);
+    }
+  }
+
+  // Write a temporary file first, so that other processes never see a
+  // partially written cache.
+  std::string temp_path =
+      path_ + "." + std::to_string(uv_os_getpid()) + ".tmp";
+  int err = WriteFileSync(temp_path.c_str(),
+                          uv_buf_init(data.data(), data.size()));
+  uv_fs_t req;
+  if (err == 0) {
+    err = uv_fs_rename(
+        nullptr, &req, temp_path.c_str(), path_.c_str(), nullptr);
+    uv_fs_req_cleanup(&req);
+  }
+  if (err < 0) {
+    uv_fs_unlink(nullptr, &req, temp_path.c_str(), nullptr);
+    uv_fs_req_cleanup(&req);
+    return err;
+  }
+  dirty_ = false;
+  return 0;
+}
+
+size_t PackageConfigCache::self_size() const {
+  size_t size = sizeof(*this) + path_.size();
+  for (const auto& [path, entry] : entries_)
+    size += path.size() + sizeof(entry) + entry.config.self_size();
+  return size;
+}
+
+}  // namespace fs
+}  // namespace node
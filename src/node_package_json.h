@@ -0,0 +1,83 @@
+#ifndef SRC_NODE_PACKAGE_JSON_H_
+#define SRC_NODE_PACKAGE_JSON_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include "uv.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace node {
+namespace fs {
+
+// The top-level fields of a package.json that the CommonJS and ES module
+// loaders look at, each kept as the JSON text of its value so that only these
+// values have to be parsed in JS rather than the whole file.
+struct PackageConfig {
+  enum Field { kName, kMain, kType, kExports, kImports, kFieldCount };
+
+  std::string values[kFieldCount];
+  uint8_t present = 0;  // Bit mask of the fields that were found.
+
+  bool has(Field field) const { return present & (1 << field); }
+  size_t self_size() const;
+
+  // Validates `json` and extracts the fields from it. Returns false if the
+  // text is not valid JSON, or if it is nested too deeply to be checked here,
+  // in which case callers should leave it to JSON.parse().
+  bool Parse(std::string_view json);
+};
+
+// Persists PackageConfigs across runs in the file passed to
+// --experimental-package-json-cache. Entries are only used while the
+// package.json that they were parsed from still has the same mtime, size and
+// inode, so a hit costs one stat() instead of open(), read(), close() and
+// parsing the whole file.
+class PackageConfigCache {
+ public:
+  explicit PackageConfigCache(std::string&& path);
+  ~PackageConfigCache();
+
+  PackageConfigCache(const PackageConfigCache&) = delete;
+  PackageConfigCache& operator=(const PackageConfigCache&) = delete;
+
+  // Returns nullptr if there is no entry for `path` that matches `stat`.
+  const PackageConfig* Get(const std::string& path, const uv_stat_t& stat);
+  void Set(const std::string& path,
+           const uv_stat_t& stat,
+           const PackageConfig& config);
+
+  bool dirty() const { return dirty_; }
+  // Writes the cache file if entries were added since it was loaded or last
+  // saved. Returns 0 or a negative libuv error code.
+  int Save();
+
+  size_t self_size() const;
+
+ private:
+  struct Entry {
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+    uint64_t size;
+    uint64_t ino;
+    PackageConfig config;
+  };
+
+  static bool Matches(const Entry& entry, const uv_stat_t& stat);
+  void Load();
+
+  const std::string path_;
+  std::unordered_map<std::string, Entry> entries_;
+  bool loaded_ = false;
+  bool dirty_ = false;
+};
+
+}  // namespace fs
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_PACKAGE_JSON_H_
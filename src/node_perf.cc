@@ -14,6 +14,7 @@
 namespace node {
 namespace performance {
 
+using v8::Array;
 using v8::Context;
 using v8::DontDelete;
 using v8::Function;
@@ -247,6 +248,130 @@ void LoopIdleTime(const FunctionCallbackInfo<Value>& args) {
   args.GetReturnValue().Set(1.0 * idle_time / 1e6);
 }
 
+static void RecordLoopPhase(uv_loop_t* loop,
+                            uv_loop_phase phase,
+                            uint64_t duration,
+                            void* arg) {
+  PerformanceState* state = static_cast<PerformanceState*>(arg);
+  // Histograms cannot record 0, round empty phases up to 1ns.
+  int64_t value = std::max<int64_t>(duration, 1);
+  for (const PerformanceState::LoopPhaseHistograms& histograms :
+       state->loop_phase_histograms) {
+    histograms[phase]->Record(value);
+  }
+}
+
+static void StopLoopPhaseTiming(void* data) {
+  Environment* env = static_cast<Environment*>(data);
+  env->performance_state()->loop_phase_histograms.clear();
+  uv_loop_configure(env->event_loop(), UV_METRICS_PHASE_TIME, nullptr, nullptr);
+}
+
+// Starts recording loop phase durations into the given array of Histogram
+// handles, one per uv_loop_phase.
+void StartLoopPhaseHistograms(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  PerformanceState* state = env->performance_state();
+  CHECK(args[0]->IsArray());
+  Local<Array> handles = args[0].As<Array>();
+  CHECK_EQ(handles->Length(), PerformanceState::kLoopPhaseCount);
+
+  PerformanceState::LoopPhaseHistograms histograms;
+  for (size_t i = 0; i < PerformanceState::kLoopPhaseCount; i++) {
+    Local<Value> handle;
+    if (!handles->Get(env->context(), i).ToLocal(&handle)) return;
+    HistogramBase* histogram;
+    ASSIGN_OR_RETURN_UNWRAP(&histogram, handle);
+    histograms[i] = histogram->histogram();
+  }
+
+  state->loop_phase_histograms.push_back(std::move(histograms));
+  if (state->loop_phase_histograms.size() == 1) {
+    uv_loop_configure(
+        env->event_loop(), UV_METRICS_PHASE_TIME, RecordLoopPhase, state);
+    env->AddCleanupHook(StopLoopPhaseTiming, env);
+  }
+}
+
+void StopLoopPhaseHistograms(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  PerformanceState* state = env->performance_state();
+  CHECK(args[0]->IsArray());
+  Local<Value> handle;
+  if (!args[0].As<Array>()->Get(env->context(), 0).ToLocal(&handle)) return;
+  HistogramBase* histogram;
+  ASSIGN_OR_RETURN_UNWRAP(&histogram, handle);
+
+  auto& monitors = state->loop_phase_histograms;
+  auto it = std::find_if(monitors.begin(), monitors.end(),
+      [&](const PerformanceState::LoopPhaseHistograms& histograms) {
+        return histograms[0] == histogram->histogram();
+      });
+  if (it == monitors.end()) return;
+  monitors.erase(it);
+  if (monitors.empty()) {
+    env->RemoveCleanupHook(StopLoopPhaseTiming, env);
+    StopLoopPhaseTiming(env);
+  }
+}
+
+void PerformanceState::RecordThreadPoolWork(ThreadPoolWorkClass cls,
+                                            const uv_req_t* req) {
+  if (threadpool_histograms.empty()) return;
+  uint64_t queue_time;
+  uint64_t run_time;
+  if (uv_metrics_work_time(req, &queue_time, &run_time) != 0) return;
+
+  size_t index = 2 * static_cast<size_t>(cls);
+  // Histograms cannot record 0, round up to 1ns.
+  for (const ThreadPoolHistograms& histograms : threadpool_histograms) {
+    histograms[index]->Record(std::max<int64_t>(queue_time, 1));
+    histograms[index + 1]->Record(std::max<int64_t>(run_time, 1));
+  }
+}
+
+// Starts recording threadpool queue wait and run times into the given array
+// of Histogram handles, laid out as PerformanceState::ThreadPoolHistograms.
+void StartThreadPoolHistograms(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  PerformanceState* state = env->performance_state();
+  CHECK(args[0]->IsArray());
+  Local<Array> handles = args[0].As<Array>();
+  CHECK_EQ(handles->Length(), PerformanceState::kThreadPoolHistogramCount);
+
+  PerformanceState::ThreadPoolHistograms histograms;
+  for (size_t i = 0; i < PerformanceState::kThreadPoolHistogramCount; i++) {
+    Local<Value> handle;
+    if (!handles->Get(env->context(), i).ToLocal(&handle)) return;
+    HistogramBase* histogram;
+    ASSIGN_OR_RETURN_UNWRAP(&histogram, handle);
+    histograms[i] = histogram->histogram();
+  }
+
+  // Timestamping is cheap next to a threadpool round trip, so it stays on
+  // once the first monitor has been enabled.
+  if (state->threadpool_histograms.empty())
+    uv_loop_configure(env->event_loop(), UV_METRICS_WORK_TIME);
+  state->threadpool_histograms.push_back(std::move(histograms));
+}
+
+void StopThreadPoolHistograms(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  PerformanceState* state = env->performance_state();
+  CHECK(args[0]->IsArray());
+  Local<Value> handle;
+  if (!args[0].As<Array>()->Get(env->context(), 0).ToLocal(&handle)) return;
+  HistogramBase* histogram;
+  ASSIGN_OR_RETURN_UNWRAP(&histogram, handle);
+
+  auto& monitors = state->threadpool_histograms;
+  auto it = std::find_if(monitors.begin(), monitors.end(),
+      [&](const PerformanceState::ThreadPoolHistograms& histograms) {
+        return histograms[0] == histogram->histogram();
+      });
+  if (it != monitors.end()) monitors.erase(it);
+}
+
 void CreateELDHistogram(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
   int64_t interval = args[0].As<Integer>()->Value();
@@ -325,6 +450,14 @@ void Initialize(Local<Object> target,
   SetMethod(context, target, "getTimeOrigin", GetTimeOrigin);
   SetMethod(context, target, "getTimeOriginTimestamp", GetTimeOriginTimeStamp);
   SetMethod(context, target, "createELDHistogram", CreateELDHistogram);
+  SetMethod(
+      context, target, "startLoopPhaseHistograms", StartLoopPhaseHistograms);
+  SetMethod(
+      context, target, "stopLoopPhaseHistograms", StopLoopPhaseHistograms);
+  SetMethod(
+      context, target, "startThreadPoolHistograms", StartThreadPoolHistograms);
+  SetMethod(
+      context, target, "stopThreadPoolHistograms", StopThreadPoolHistograms);
   SetMethod(context, target, "markBootstrapComplete", MarkBootstrapComplete);
 
   Local<Object> constants = Object::New(isolate);
@@ -380,6 +513,10 @@ void RegisterExternalReferences(ExternalReferenceRegistry* registry) {
   registry->Register(GetTimeOrigin);
   registry->Register(GetTimeOriginTimeStamp);
   registry->Register(CreateELDHistogram);
+  registry->Register(StartLoopPhaseHistograms);
+  registry->Register(StopLoopPhaseHistograms);
+  registry->Register(StartThreadPoolHistograms);
+  registry->Register(StopThreadPoolHistograms);
   registry->Register(MarkBootstrapComplete);
   HistogramBase::RegisterExternalReferences(registry);
   IntervalHistogram::RegisterExternalReferences(registry);
@@ -5,15 +5,22 @@
 
 #include "aliased_buffer.h"
 #include "node.h"
+#include "node_threadpool.h"
 #include "uv.h"
 #include "v8.h"
 
 #include <algorithm>
+#include <array>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace node {
+
+class Histogram;
+
 namespace performance {
 
 #define PERFORMANCE_NOW() uv_hrtime()
@@ -73,6 +80,26 @@ class PerformanceState {
   uint64_t performance_last_gc_start_mark = 0;
   uint16_t current_gc_type = 0;
 
+  // Histograms of the enabled perf_hooks.monitorEventLoopPhases() monitors,
+  // indexed by uv_loop_phase.
+  static constexpr size_t kLoopPhaseCount = UV_LOOP_PHASE_CLOSING + 1;
+  using LoopPhaseHistograms =
+      std::array<std::shared_ptr<Histogram>, kLoopPhaseCount>;
+  std::vector<LoopPhaseHistograms> loop_phase_histograms;
+
+  // Histograms of the enabled perf_hooks.monitorThreadpool() monitors: the
+  // queue wait time and the run time of each ThreadPoolWorkClass, in that
+  // order.
+  static constexpr size_t kThreadPoolHistogramCount =
+      2 * kThreadPoolWorkClassCount;
+  using ThreadPoolHistograms =
+      std::array<std::shared_ptr<Histogram>, kThreadPoolHistogramCount>;
+  std::vector<ThreadPoolHistograms> threadpool_histograms;
+
+  // Records the timing of a completed threadpool request, if any monitor
+  // is enabled and libuv timed the request.
+  void RecordThreadPoolWork(ThreadPoolWorkClass cls, const uv_req_t* req);
+
   void Mark(enum PerformanceMilestone milestone,
             uint64_t ts = PERFORMANCE_NOW());
 
@@ -17,7 +17,7 @@ using v8::Task;
 namespace {
 
 struct PlatformWorkerData {
-  TaskQueue<Task>* task_queue;
+  WorkerTaskQueue* task_queue;
   Mutex* platform_workers_mutex;
   ConditionVariable* platform_workers_ready;
   int* pending_platform_workers;
@@ -28,9 +28,10 @@ static void PlatformWorkerThread(void* data) {
   std::unique_ptr<PlatformWorkerData>
       worker_data(static_cast<PlatformWorkerData*>(data));
 
-  TaskQueue<Task>* pending_worker_tasks = worker_data->task_queue;
+  WorkerTaskQueue* pending_worker_tasks = worker_data->task_queue;
   TRACE_EVENT_METADATA1("__metadata", "thread_name", "name",
                         "PlatformWorkerThread");
+  pending_worker_tasks->SetCurrentWorker(worker_data->id);
 
   // Notify the main thread that the platform worker is ready.
   {
@@ -39,7 +40,8 @@ static void PlatformWorkerThread(void* data) {
     worker_data->platform_workers_ready->Signal(lock);
   }
 
-  while (std::unique_ptr<Task> task = pending_worker_tasks->BlockingPop()) {
+  while (std::unique_ptr<Task> task =
+             pending_worker_tasks->BlockingPop(worker_data->id)) {
     task->Run();
     pending_worker_tasks->NotifyOfCompletion();
   }
@@ -56,7 +58,7 @@ static int GetActualThreadPoolSize(int thread_pool_size) {
 
 class WorkerThreadsTaskRunner::DelayedTaskScheduler {
  public:
-  explicit DelayedTaskScheduler(TaskQueue<Task>* tasks)
+  explicit DelayedTaskScheduler(WorkerTaskQueue* tasks)
     : pending_worker_tasks_(tasks) {}
 
   std::unique_ptr<uv_thread_t> Start() {
@@ -162,7 +164,7 @@ class WorkerThreadsTaskRunner::DelayedTaskScheduler {
   }
 
   uv_sem_t ready_;
-  TaskQueue<Task>* pending_worker_tasks_;
+  WorkerTaskQueue* pending_worker_tasks_;
 
   TaskQueue<Task> tasks_;
   uv_loop_t loop_;
@@ -170,7 +172,8 @@ class WorkerThreadsTaskRunner::DelayedTaskScheduler {
   std::unordered_set<uv_timer_t*> timers_;
 };
 
-WorkerThreadsTaskRunner::WorkerThreadsTaskRunner(int thread_pool_size) {
+WorkerThreadsTaskRunner::WorkerThreadsTaskRunner(int thread_pool_size)
+    : pending_worker_tasks_(thread_pool_size) {
   Mutex platform_workers_mutex;
   ConditionVariable platform_workers_ready;
 
@@ -226,6 +229,10 @@ int WorkerThreadsTaskRunner::NumberOfWorkerThreads() const {
   return threads_.size();
 }
 
+WorkerTaskStatistics WorkerThreadsTaskRunner::GetStatistics() const {
+  return pending_worker_tasks_.GetStatistics();
+}
+
 PerIsolatePlatformData::PerIsolatePlatformData(
     Isolate* isolate, uv_loop_t* loop)
   : isolate_(isolate), loop_(loop) {
@@ -414,6 +421,10 @@ int NodePlatform::NumberOfWorkerThreads() {
   return worker_thread_task_runner_->NumberOfWorkerThreads();
 }
 
+WorkerTaskStatistics NodePlatform::GetWorkerTaskStatistics() {
+  return worker_thread_task_runner_->GetStatistics();
+}
+
 void PerIsolatePlatformData::RunForegroundTask(std::unique_ptr<Task> task) {
   if (isolate_->IsExecutionTerminating()) return;
   DebugSealHandleScope scope(isolate_);
@@ -569,6 +580,230 @@ v8::PageAllocator* NodePlatform::GetPageAllocator() {
   return page_allocator_;
 }
 
+// Dmitry Vyukov's bounded MPMC queue: every cell carries a sequence number
+// that tells producers and consumers whether it is theirs to fill or drain,
+// so both sides only contend on a single compare-and-swap.
+class WorkerTaskQueue::Ring {
+ public:
+  static constexpr size_t kCapacity = 256;  // Must be a power of two.
+
+  Ring() {
+    for (size_t i = 0; i < kCapacity; i++)
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  bool TryPush(Task* task, uint64_t enqueue_time) {
+    Cell* cell;
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells_[pos & (kCapacity - 1)];
+      size_t seq = cell->sequence.load(std::memory_order_acquire);
+      intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;  // Full.
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    cell->task = task;
+    cell->enqueue_time = enqueue_time;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool TryPop(Task** task, uint64_t* enqueue_time) {
+    Cell* cell;
+    size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells_[pos & (kCapacity - 1)];
+      size_t seq = cell->sequence.load(std::memory_order_acquire);
+      intptr_t diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;  // Empty, or the producer has not finished yet.
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    *task = cell->task;
+    *enqueue_time = cell->enqueue_time;
+    cell->sequence.store(pos + kCapacity, std::memory_order_release);
+    return true;
+  }
+
+  // Also true while a producer is still filling its cell, so that a worker
+  // does not go to sleep on a task that is about to become visible.
+  bool MaybeHasTasks() const {
+    return enqueue_pos_.load() != dequeue_pos_.load();
+  }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    Task* task;
+    uint64_t enqueue_time;
+  };
+
+  alignas(64) std::atomic<size_t> enqueue_pos_{0};
+  alignas(64) std::atomic<size_t> dequeue_pos_{0};
+  alignas(64) Cell cells_[kCapacity];
+};
+
+namespace {
+// Identifies the worker thread, if any, that the current thread is, so that
+// tasks it posts stay on its own ring.
+thread_local const WorkerTaskQueue* current_worker_queue = nullptr;
+thread_local int current_worker_index = -1;
+}  // namespace
+
+WorkerTaskQueue::WorkerTaskQueue(int thread_count) {
+  CHECK_GT(thread_count, 0);
+  for (int i = 0; i < thread_count; i++)
+    rings_.emplace_back(std::make_unique<Ring>());
+}
+
+WorkerTaskQueue::~WorkerTaskQueue() {
+  Task* task;
+  uint64_t enqueue_time;
+  for (const auto& ring : rings_) {
+    while (ring->TryPop(&task, &enqueue_time))
+      delete task;
+  }
+}
+
+void WorkerTaskQueue::SetCurrentWorker(int worker_index) {
+  CHECK_LT(static_cast<size_t>(worker_index), rings_.size());
+  current_worker_queue = this;
+  current_worker_index = worker_index;
+}
+
+void WorkerTaskQueue::Push(std::unique_ptr<Task> task) {
+  outstanding_tasks_++;
+  posted_.fetch_add(1, std::memory_order_relaxed);
+  uint64_t now = uv_hrtime();
+
+  size_t index;
+  if (current_worker_queue == this) {
+    index = current_worker_index;
+  } else {
+    index = next_ring_.fetch_add(1, std::memory_order_relaxed) % rings_.size();
+  }
+
+  Task* raw = task.release();
+  if (!rings_[index]->TryPush(raw, now)) {
+    overflowed_.fetch_add(1, std::memory_order_relaxed);
+    Mutex::ScopedLock scoped_lock(overflow_lock_);
+    overflow_.emplace(std::unique_ptr<Task>(raw), now);
+    overflow_size_++;
+  }
+
+  // Pairs with the fence in BlockingPop(): either the sleeping worker sees
+  // the new task, or we see the worker and wake it.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (sleeping_workers_.load() > 0) {
+    Mutex::ScopedLock scoped_lock(lock_);
+    tasks_available_.Signal(scoped_lock);
+  }
+}
+
+void WorkerTaskQueue::RecordWait(uint64_t enqueue_time, bool stolen) {
+  uint64_t wait = uv_hrtime() - enqueue_time;
+  started_.fetch_add(1, std::memory_order_relaxed);
+  if (stolen) stolen_.fetch_add(1, std::memory_order_relaxed);
+  total_wait_ns_.fetch_add(wait, std::memory_order_relaxed);
+  uint64_t max = max_wait_ns_.load(std::memory_order_relaxed);
+  while (wait > max &&
+         !max_wait_ns_.compare_exchange_weak(
+             max, wait, std::memory_order_relaxed)) {
+  }
+}
+
+std::unique_ptr<Task> WorkerTaskQueue::TryPop(int worker_index) {
+  Task* task;
+  uint64_t enqueue_time;
+  const size_t count = rings_.size();
+
+  for (size_t i = 0; i < count; i++) {
+    if (rings_[(worker_index + i) % count]->TryPop(&task, &enqueue_time)) {
+      RecordWait(enqueue_time, i != 0);
+      return std::unique_ptr<Task>(task);
+    }
+  }
+
+  if (overflow_size_.load() == 0) return nullptr;
+  Mutex::ScopedLock scoped_lock(overflow_lock_);
+  if (overflow_.empty()) return nullptr;
+  std::unique_ptr<Task> result = std::move(overflow_.front().first);
+  enqueue_time = overflow_.front().second;
+  overflow_.pop();
+  overflow_size_--;
+  RecordWait(enqueue_time, false);
+  return result;
+}
+
+bool WorkerTaskQueue::HasTasks() const {
+  if (overflow_size_.load() > 0) return true;
+  for (const auto& ring : rings_) {
+    if (ring->MaybeHasTasks()) return true;
+  }
+  return false;
+}
+
+std::unique_ptr<Task> WorkerTaskQueue::BlockingPop(int worker_index) {
+  for (;;) {
+    if (stopped_.load()) return nullptr;
+    if (std::unique_ptr<Task> task = TryPop(worker_index)) return task;
+
+    Mutex::ScopedLock scoped_lock(lock_);
+    sleeping_workers_++;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!HasTasks() && !stopped_.load())
+      tasks_available_.Wait(scoped_lock);
+    sleeping_workers_--;
+  }
+}
+
+void WorkerTaskQueue::NotifyOfCompletion() {
+  if (--outstanding_tasks_ == 0) {
+    Mutex::ScopedLock scoped_lock(lock_);
+    tasks_drained_.Broadcast(scoped_lock);
+  }
+}
+
+void WorkerTaskQueue::BlockingDrain() {
+  Mutex::ScopedLock scoped_lock(lock_);
+  while (outstanding_tasks_.load() > 0) {
+    tasks_drained_.Wait(scoped_lock);
+  }
+}
+
+void WorkerTaskQueue::Stop() {
+  Mutex::ScopedLock scoped_lock(lock_);
+  stopped_ = true;
+  tasks_available_.Broadcast(scoped_lock);
+}
+
+WorkerTaskStatistics WorkerTaskQueue::GetStatistics() const {
+  WorkerTaskStatistics stats;
+  stats.posted = posted_.load(std::memory_order_relaxed);
+  stats.started = started_.load(std::memory_order_relaxed);
+  stats.stolen = stolen_.load(std::memory_order_relaxed);
+  stats.overflowed = overflowed_.load(std::memory_order_relaxed);
+  stats.total_wait_ns = total_wait_ns_.load(std::memory_order_relaxed);
+  stats.max_wait_ns = max_wait_ns_.load(std::memory_order_relaxed);
+  return stats;
+}
+
 template <class T>
 TaskQueue<T>::TaskQueue()
     : lock_(), tasks_available_(), tasks_drained_(),
@@ -3,6 +3,7 @@
 
 #if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
 
+#include <atomic>
 #include <queue>
 #include <unordered_map>
 #include <vector>
@@ -42,6 +43,67 @@ class TaskQueue {
   std::queue<std::unique_ptr<T>> task_queue_;
 };
 
+// The task queue shared by the platform worker threads.
+//
+// Every worker thread owns a bounded lock-free multi-producer, multi-consumer
+// ring. Tasks posted from a worker thread, e.g. by a V8 job that spawns more
+// work, go to that thread's own ring; tasks posted from any other thread are
+// spread over all rings. A worker that finds its own ring empty steals from
+// the others before it goes to sleep. Tasks that do not fit into the rings
+// spill into a locked overflow queue, so Push() never fails.
+//
+// The mutex and condition variables are only used to put idle workers to
+// sleep, to wake them up, and for BlockingDrain().
+class WorkerTaskQueue {
+ public:
+  explicit WorkerTaskQueue(int thread_count);
+  ~WorkerTaskQueue();
+
+  WorkerTaskQueue(const WorkerTaskQueue&) = delete;
+  WorkerTaskQueue& operator=(const WorkerTaskQueue&) = delete;
+
+  void Push(std::unique_ptr<v8::Task> task);
+  // Returns nullptr once Stop() has been called.
+  std::unique_ptr<v8::Task> BlockingPop(int worker_index);
+  void NotifyOfCompletion();
+  void BlockingDrain();
+  void Stop();
+
+  // Marks the calling thread as the worker with the given index, which
+  // routes the tasks it posts to its own ring.
+  void SetCurrentWorker(int worker_index);
+
+  WorkerTaskStatistics GetStatistics() const;
+
+ private:
+  class Ring;
+
+  std::unique_ptr<v8::Task> TryPop(int worker_index);
+  bool HasTasks() const;
+  void RecordWait(uint64_t enqueue_time, bool stolen);
+
+  std::vector<std::unique_ptr<Ring>> rings_;
+  std::atomic<size_t> next_ring_{0};
+  std::atomic<bool> stopped_{false};
+  std::atomic<int> sleeping_workers_{0};
+  std::atomic<int64_t> outstanding_tasks_{0};
+
+  Mutex lock_;
+  ConditionVariable tasks_available_;
+  ConditionVariable tasks_drained_;
+
+  Mutex overflow_lock_;
+  std::queue<std::pair<std::unique_ptr<v8::Task>, uint64_t>> overflow_;
+  std::atomic<size_t> overflow_size_{0};
+
+  std::atomic<uint64_t> posted_{0};
+  std::atomic<uint64_t> started_{0};
+  std::atomic<uint64_t> stolen_{0};
+  std::atomic<uint64_t> overflowed_{0};
+  std::atomic<uint64_t> total_wait_ns_{0};
+  std::atomic<uint64_t> max_wait_ns_{0};
+};
+
 struct DelayedTask {
   std::unique_ptr<v8::Task> task;
   uv_timer_t timer;
@@ -125,9 +187,10 @@ class WorkerThreadsTaskRunner {
   void Shutdown();
 
   int NumberOfWorkerThreads() const;
+  WorkerTaskStatistics GetStatistics() const;
 
  private:
-  TaskQueue<v8::Task> pending_worker_tasks_;
+  WorkerTaskQueue pending_worker_tasks_;
 
   class DelayedTaskScheduler;
   std::unique_ptr<DelayedTaskScheduler> delayed_task_scheduler_;
@@ -166,6 +229,7 @@ class NodePlatform : public MultiIsolatePlatform {
   void UnregisterIsolate(v8::Isolate* isolate) override;
   void AddIsolateFinishedCallback(v8::Isolate* isolate,
                                   void (*callback)(void*), void* data) override;
+  WorkerTaskStatistics GetWorkerTaskStatistics() override;
 
   std::shared_ptr<v8::TaskRunner> GetForegroundTaskRunner(
       v8::Isolate* isolate) override;
@@ -336,6 +336,23 @@ static void ResourceUsage(const FunctionCallbackInfo<Value>& args) {
   fields[15] = static_cast<double>(rusage.ru_nivcsw);
 }
 
+// ThreadpoolUsage fills a Float64Array with the number of active and queued
+// threadpool requests of each ThreadPoolWorkClass, in declaration order.
+static void ThreadpoolUsage(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  ThreadPoolScheduler* scheduler = env->threadpool_scheduler();
+
+  Local<ArrayBuffer> ab =
+      get_fields_array_buffer(args, 0, 2 * kThreadPoolWorkClassCount);
+  double* fields = static_cast<double*>(ab->Data());
+
+  for (size_t i = 0; i < kThreadPoolWorkClassCount; i++) {
+    ThreadPoolWorkClass cls = static_cast<ThreadPoolWorkClass>(i);
+    fields[2 * i] = static_cast<double>(scheduler->active(cls));
+    fields[2 * i + 1] = static_cast<double>(scheduler->queued(cls));
+  }
+}
+
 #ifdef __POSIX__
 static void DebugProcess(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
@@ -585,6 +602,7 @@ static void Initialize(Local<Object> target,
   SetMethod(context, target, "rss", Rss);
   SetMethod(context, target, "cpuUsage", CPUUsage);
   SetMethod(context, target, "resourceUsage", ResourceUsage);
+  SetMethod(context, target, "threadpoolUsage", ThreadpoolUsage);
 
   SetMethod(context, target, "_debugEnd", DebugEnd);
   SetMethod(context, target, "_getActiveRequests", GetActiveRequests);
@@ -615,6 +633,7 @@ void RegisterExternalReferences(ExternalReferenceRegistry* registry) {
   registry->Register(Rss);
   registry->Register(CPUUsage);
   registry->Register(ResourceUsage);
+  registry->Register(ThreadpoolUsage);
 
   registry->Register(GetActiveRequests);
   registry->Register(GetActiveHandles);
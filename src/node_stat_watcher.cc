@@ -25,8 +25,11 @@
 #include "memory_tracker-inl.h"
 #include "node_external_reference.h"
 #include "node_file-inl.h"
+#include "threadpoolwork-inl.h"
+#include "timer_wrap-inl.h"
 #include "util-inl.h"
 
+#include <algorithm>
 #include <cstring>
 #include <cstdlib>
 
@@ -43,6 +46,180 @@ using v8::Object;
 using v8::Uint32;
 using v8::Value;
 
+namespace {
+
+// The fields that uv_fs_poll_t compares to decide whether a file changed.
+bool StatsEqual(const uv_stat_t& a, const uv_stat_t& b) {
+  return a.st_ctim.tv_nsec == b.st_ctim.tv_nsec &&
+         a.st_mtim.tv_nsec == b.st_mtim.tv_nsec &&
+         a.st_birthtim.tv_nsec == b.st_birthtim.tv_nsec &&
+         a.st_ctim.tv_sec == b.st_ctim.tv_sec &&
+         a.st_mtim.tv_sec == b.st_mtim.tv_sec &&
+         a.st_birthtim.tv_sec == b.st_birthtim.tv_sec &&
+         a.st_size == b.st_size &&
+         a.st_mode == b.st_mode &&
+         a.st_uid == b.st_uid &&
+         a.st_gid == b.st_gid &&
+         a.st_ino == b.st_ino &&
+         a.st_dev == b.st_dev &&
+         a.st_flags == b.st_flags &&
+         a.st_gen == b.st_gen;
+}
+
+}  // anonymous namespace
+
+// stat()s the files of a batch of watchers in the threadpool. The watchers
+// are kept alive until the results have been delivered, even if they are
+// closed in the meantime.
+class StatPollScheduler::Job final : public ThreadPoolWork {
+ public:
+  Job(Environment* env, std::vector<BaseObjectPtr<StatWatcher>>&& watchers)
+      : ThreadPoolWork(env, "statwatcher", ThreadPoolWorkClass::kFs),
+        watchers_(std::move(watchers)),
+        errors_(watchers_.size()),
+        stats_(watchers_.size()) {}
+
+  void DoThreadPoolWork() override {
+    // Synchronous requests don't touch the loop, which belongs to the main
+    // thread.
+    for (size_t i = 0; i < watchers_.size(); i++) {
+      uv_fs_t req;
+      errors_[i] =
+          uv_fs_stat(nullptr, &req, watchers_[i]->path_.c_str(), nullptr);
+      if (errors_[i] == 0) stats_[i] = req.statbuf;
+      uv_fs_req_cleanup(&req);
+    }
+  }
+
+  void AfterThreadPoolWork(int status) override {
+    std::unique_ptr<Job> ptr(this);
+    for (const BaseObjectPtr<StatWatcher>& watcher : watchers_)
+      watcher->polling_ = false;
+    if (status != 0 || !env()->can_call_into_js()) return;
+    for (size_t i = 0; i < watchers_.size(); i++)
+      watchers_[i]->OnPoll(errors_[i], &stats_[i]);
+  }
+
+ private:
+  std::vector<BaseObjectPtr<StatWatcher>> watchers_;
+  std::vector<int> errors_;
+  std::vector<uv_stat_t> stats_;
+};
+
+StatPollScheduler::StatPollScheduler(Environment* env)
+    : env_(env),
+      timer_(std::make_unique<TimerWrapHandle>(env, [this]() {
+        OnTimeout();
+      })) {
+  // Referenced watchers keep the loop alive through their own handles.
+  timer_->Unref();
+}
+
+StatPollScheduler::~StatPollScheduler() = default;
+
+void StatPollScheduler::Add(StatWatcher* watcher) {
+  auto it = groups_.find(watcher->interval_);
+  if (it == groups_.end()) {
+    Group group;
+    group.interval = watcher->interval_;
+    group.start = uv_now(env_->event_loop());
+    group.slots.resize(std::max<uint32_t>(
+        1, std::min(kSlotsPerInterval, watcher->interval_)));
+    it = groups_.emplace(watcher->interval_, std::move(group)).first;
+  }
+
+  // Put the watcher into the slot with the fewest watchers, to keep the
+  // number of stat() calls per slot even.
+  std::vector<std::vector<StatWatcher*>>& slots = it->second.slots;
+  auto slot = std::min_element(
+      slots.begin(), slots.end(), [](const auto& a, const auto& b) {
+        return a.size() < b.size();
+      });
+  watcher->slot_ = slot - slots.begin();
+  watcher->slot_index_ = slot->size();
+  slot->push_back(watcher);
+
+  pending_.push_back(watcher);
+  Schedule();
+}
+
+void StatPollScheduler::Remove(StatWatcher* watcher) {
+  auto pending = std::find(pending_.begin(), pending_.end(), watcher);
+  if (pending != pending_.end()) pending_.erase(pending);
+
+  auto it = groups_.find(watcher->interval_);
+  CHECK(it != groups_.end());
+  std::vector<StatWatcher*>& slot = it->second.slots[watcher->slot_];
+  CHECK_EQ(slot[watcher->slot_index_], watcher);
+  slot[watcher->slot_index_] = slot.back();
+  slot[watcher->slot_index_]->slot_index_ = watcher->slot_index_;
+  slot.pop_back();
+
+  bool empty = std::all_of(it->second.slots.begin(),
+                           it->second.slots.end(),
+                           [](const auto& slot) { return slot.empty(); });
+  if (empty) groups_.erase(it);
+  Schedule();
+}
+
+void StatPollScheduler::Schedule() {
+  if (pending_.empty() && groups_.empty()) return timer_->Stop();
+
+  const uint64_t now = uv_now(env_->event_loop());
+  uint64_t next = pending_.empty() ? UINT64_MAX : now;
+  for (const auto& [interval, group] : groups_)
+    next = std::min(next, group.next_tick());
+  timer_->Update(next > now ? next - now : 0);
+}
+
+void StatPollScheduler::OnTimeout() {
+  if (!pending_.empty()) {
+    std::vector<StatWatcher*> pending;
+    pending.swap(pending_);
+    Poll(pending);
+  }
+
+  const uint64_t now = uv_now(env_->event_loop());
+  for (auto& [interval, group] : groups_) {
+    // If the loop was blocked for a long time, poll every slot once rather
+    // than once for each time that it was due.
+    for (size_t i = 0; i < group.slots.size() && group.next_tick() <= now;
+         i++) {
+      Poll(group.slots[group.ticks % group.slots.size()]);
+      group.ticks++;
+    }
+    if (group.next_tick() <= now) {
+      group.start = now;
+      group.ticks = 0;
+    }
+  }
+  Schedule();
+}
+
+void StatPollScheduler::Poll(const std::vector<StatWatcher*>& watchers) {
+  std::vector<BaseObjectPtr<StatWatcher>> batch;
+  for (StatWatcher* watcher : watchers) {
+    // Like uv_fs_poll_t, don't start a poll while the previous one is still
+    // running, e.g. because the file system is slow to respond.
+    if (watcher->polling_) continue;
+    watcher->polling_ = true;
+    batch.emplace_back(watcher);
+    if (batch.size() == kMaxJobSize) {
+      (new Job(env_, std::move(batch)))->ScheduleWork();
+      batch.clear();
+    }
+  }
+  if (!batch.empty()) (new Job(env_, std::move(batch)))->ScheduleWork();
+}
+
+void StatPollScheduler::MemoryInfo(MemoryTracker* tracker) const {
+  size_t watchers = pending_.size();
+  for (const auto& [interval, group] : groups_) {
+    for (const auto& slot : group.slots) watchers += slot.size();
+  }
+  tracker->TrackFieldWithSize("watchers", watchers * sizeof(StatWatcher*));
+}
+
 void StatWatcher::Initialize(Environment* env, Local<Object> target) {
   Isolate* isolate = env->isolate();
   HandleScope scope(env->isolate());
@@ -68,30 +245,51 @@ StatWatcher::StatWatcher(fs::BindingData* binding_data,
                          bool use_bigint)
     : HandleWrap(binding_data->env(),
                  wrap,
-                 reinterpret_cast<uv_handle_t*>(&watcher_),
+                 reinterpret_cast<uv_handle_t*>(&handle_),
                  AsyncWrap::PROVIDER_STATWATCHER),
       use_bigint_(use_bigint),
       binding_data_(binding_data) {
-  CHECK_EQ(0, uv_fs_poll_init(env()->event_loop(), &watcher_));
+  MarkAsUninitialized();
 }
 
+void StatWatcher::OnClose() {
+  binding_data_->stat_poll_scheduler->Remove(this);
+}
+
+void StatWatcher::OnPoll(int status, const uv_stat_t* stat) {
+  if (IsHandleClosing()) return;
 
-void StatWatcher::Callback(uv_fs_poll_t* handle,
-                           int status,
+  if (status != 0) {
+    if (poll_state_ != status) {
+      static const uv_stat_t zero_stat {};
+      poll_state_ = status;
+      Callback(status, &stat_, &zero_stat);
+    }
+    return;
+  }
+
+  const uv_stat_t prev = stat_;
+  const bool changed =
+      poll_state_ < 0 || (poll_state_ > 0 && !StatsEqual(prev, *stat));
+  stat_ = *stat;
+  poll_state_ = 1;
+  if (changed) Callback(0, &prev, stat);
+}
+
+void StatWatcher::Callback(int status,
                            const uv_stat_t* prev,
                            const uv_stat_t* curr) {
-  StatWatcher* wrap = ContainerOf(&StatWatcher::watcher_, handle);
-  Environment* env = wrap->env();
+  Environment* env = this->env();
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
 
   Local<Value> arr = fs::FillGlobalStatsArray(
-      wrap->binding_data_.get(), wrap->use_bigint_, curr);
+      binding_data_.get(), use_bigint_, curr);
   USE(fs::FillGlobalStatsArray(
-      wrap->binding_data_.get(), wrap->use_bigint_, prev, true));
+      binding_data_.get(), use_bigint_, prev, true));
 
   Local<Value> argv[2] = { Integer::New(env->isolate(), status), arr };
-  wrap->MakeCallback(env->onchange_string(), arraysize(argv), argv);
+  MakeCallback(env->onchange_string(), arraysize(argv), argv);
 }
 
 
@@ -108,7 +306,7 @@ void StatWatcher::Start(const FunctionCallbackInfo<Value>& args) {
 
   StatWatcher* wrap;
   ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
-  CHECK(!uv_is_active(wrap->GetHandle()));
+  CHECK(wrap->IsHandleClosing());  // Check that Start() has not been called.
 
   node::Utf8Value path(args.GetIsolate(), args[0]);
   CHECK_NOT_NULL(*path);
@@ -116,12 +314,24 @@ void StatWatcher::Start(const FunctionCallbackInfo<Value>& args) {
   CHECK(args[1]->IsUint32());
   const uint32_t interval = args[1].As<Uint32>()->Value();
 
-  // Note that uv_fs_poll_start does not return ENOENT, we are handling
-  // mostly memory errors here.
-  const int err = uv_fs_poll_start(&wrap->watcher_, Callback, *path, interval);
+  // Note that stat() errors such as ENOENT are reported through onchange, we
+  // are handling mostly memory errors here.
+  const int err = uv_async_init(wrap->env()->event_loop(),
+                                &wrap->handle_,
+                                nullptr);
   if (err != 0) {
-    args.GetReturnValue().Set(err);
+    return args.GetReturnValue().Set(err);
+  }
+  wrap->MarkAsInitialized();
+
+  wrap->path_ = path.ToString();
+  wrap->interval_ = interval;
+  fs::BindingData* binding_data = wrap->binding_data_.get();
+  if (!binding_data->stat_poll_scheduler) {
+    binding_data->stat_poll_scheduler =
+        std::make_unique<StatPollScheduler>(wrap->env());
   }
+  binding_data->stat_poll_scheduler->Add(wrap);
 }
 
 }  // namespace node
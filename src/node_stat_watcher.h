@@ -26,9 +26,15 @@
 
 #include "node.h"
 #include "handle_wrap.h"
+#include "memory_tracker.h"
 #include "uv.h"
 #include "v8.h"
 
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace node {
 namespace fs {
 class BindingData;
@@ -36,6 +42,58 @@ class BindingData;
 
 class Environment;
 class ExternalReferenceRegistry;
+class StatWatcher;
+class TimerWrapHandle;
+
+// Polls the files of all StatWatchers of an Environment. Rather than giving
+// every watcher its own timer and stat() request, watchers are grouped by
+// interval, and each group's interval is split into up to kSlotsPerInterval
+// slots that the watchers are spread across evenly. Each slot is stat()ed as
+// one threadpool job when its turn comes, so that thousands of watchers
+// don't wake up, and hit the threadpool, all at the same time.
+class StatPollScheduler final : public MemoryRetainer {
+ public:
+  static constexpr uint32_t kSlotsPerInterval = 32;
+  static constexpr size_t kMaxJobSize = 256;
+
+  explicit StatPollScheduler(Environment* env);
+  ~StatPollScheduler() override;
+
+  StatPollScheduler(const StatPollScheduler&) = delete;
+  StatPollScheduler& operator=(const StatPollScheduler&) = delete;
+
+  void Add(StatWatcher* watcher);
+  void Remove(StatWatcher* watcher);
+
+  void MemoryInfo(MemoryTracker* tracker) const override;
+  SET_MEMORY_INFO_NAME(StatPollScheduler)
+  SET_SELF_SIZE(StatPollScheduler)
+
+ private:
+  class Job;
+
+  struct Group {
+    uint32_t interval;
+    uint64_t start;       // Loop time at which slot 0 was first due.
+    uint64_t ticks = 0;   // Number of slots that have been due so far.
+    std::vector<std::vector<StatWatcher*>> slots;
+
+    uint64_t next_tick() const {
+      return start + ticks * interval / slots.size();
+    }
+  };
+
+  void OnTimeout();
+  void Schedule();
+  void Poll(const std::vector<StatWatcher*>& watchers);
+
+  Environment* env_;
+  std::unique_ptr<TimerWrapHandle> timer_;
+  std::map<uint32_t, Group> groups_;
+  // Watchers that have not been stat()ed yet, to get the initial stats that
+  // later ones are compared with.
+  std::vector<StatWatcher*> pending_;
+};
 
 class StatWatcher : public HandleWrap {
  public:
@@ -50,19 +108,37 @@ class StatWatcher : public HandleWrap {
   static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Start(const v8::FunctionCallbackInfo<v8::Value>& args);
 
+  void OnClose() override;
+
   SET_NO_MEMORY_INFO()
   SET_MEMORY_INFO_NAME(StatWatcher)
   SET_SELF_SIZE(StatWatcher)
 
  private:
-  static void Callback(uv_fs_poll_t* handle,
-                       int status,
-                       const uv_stat_t* prev,
-                       const uv_stat_t* curr);
+  friend class StatPollScheduler;
 
-  uv_fs_poll_t watcher_;
+  // Compares the result of a poll with the previous one and calls into JS
+  // if it changed, the same way that uv_fs_poll_t does.
+  void OnPoll(int status, const uv_stat_t* stat);
+  void Callback(int status, const uv_stat_t* prev, const uv_stat_t* curr);
+
+  // Polling is done by StatPollScheduler. This handle does nothing but keep
+  // the event loop alive while the watcher is referenced and active.
+  uv_async_t handle_;
   const bool use_bigint_;
   BaseObjectPtr<fs::BindingData> binding_data_;
+
+  std::string path_;
+  uint32_t interval_ = 0;
+  // 0 before the first poll, 1 after a successful one, or the error code of
+  // the last poll if it failed.
+  int poll_state_ = 0;
+  uv_stat_t stat_ {};
+  // Whether a poll of this watcher is running in the threadpool.
+  bool polling_ = false;
+  // The position of this watcher in StatPollScheduler::Group::slots.
+  size_t slot_ = 0;
+  size_t slot_index_ = 0;
 };
 
 }  // namespace node
@@ -0,0 +1,150 @@
+#include "node_threadpool.h"
+#include "env-inl.h"
+#include "node_internals.h"
+#include "node_options.h"
+#include "threadpoolwork-inl.h"
+#include "util-inl.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace node {
+
+const char* ThreadPoolWorkClassName(ThreadPoolWorkClass cls) {
+  switch (cls) {
+#define V(kind, name)                                                         \
+    case ThreadPoolWorkClass::kind: return name;
+    THREADPOOL_WORK_CLASSES(V)
+#undef V
+    default:
+      UNREACHABLE();
+  }
+}
+
+bool ParseThreadPoolClassSetting(const std::string& setting,
+                                 ThreadPoolWorkClass* cls,
+                                 uint64_t* value) {
+  size_t eq = setting.find('=');
+  if (eq == std::string::npos || eq + 1 == setting.size()) return false;
+
+  std::string name = setting.substr(0, eq);
+  bool found = false;
+  for (size_t i = 0; i < kThreadPoolWorkClassCount; i++) {
+    ThreadPoolWorkClass candidate = static_cast<ThreadPoolWorkClass>(i);
+    if (name == ThreadPoolWorkClassName(candidate)) {
+      *cls = candidate;
+      found = true;
+      break;
+    }
+  }
+  if (!found) return false;
+
+  const char* digits = setting.c_str() + eq + 1;
+  if (*digits < '0' || *digits > '9') return false;
+  char* end;
+  *value = std::strtoull(digits, &end, 10);
+  return *end == '\0';
+}
+
+ThreadPoolWork::~ThreadPoolWork() {
+  // Work that is destroyed while it is still held back, e.g. during
+  // Environment teardown, must never be submitted.
+  env_->threadpool_scheduler()->Remove(this, work_class_);
+}
+
+void ThreadPoolScheduler::Configure(const EnvironmentOptions& options) {
+  budget_ = options.threadpool_concurrency;
+
+  ThreadPoolWorkClass cls;
+  uint64_t value;
+  for (const std::string& setting : options.threadpool_class_concurrency) {
+    // Malformed settings have already been rejected by CheckOptions().
+    if (ParseThreadPoolClassSetting(setting, &cls, &value))
+      lanes_[static_cast<size_t>(cls)].cap = value;
+  }
+  for (const std::string& setting : options.threadpool_class_weight) {
+    if (ParseThreadPoolClassSetting(setting, &cls, &value) && value > 0)
+      lanes_[static_cast<size_t>(cls)].weight = static_cast<int64_t>(value);
+  }
+}
+
+bool ThreadPoolScheduler::CanStart(const Lane& lane) const {
+  if (lane.cap != 0 && lane.active >= lane.cap) return false;
+  return budget_ == 0 || total_active_ < budget_;
+}
+
+bool ThreadPoolScheduler::Enqueue(ThreadPoolWork* work,
+                                  ThreadPoolWorkClass cls) {
+  Lane& lane = lanes_[static_cast<size_t>(cls)];
+  // Queued work of any class is ahead of this request in line.
+  if (total_queued_ == 0 && CanStart(lane)) {
+    lane.active++;
+    total_active_++;
+    return true;
+  }
+  lane.queue.push_back(work);
+  total_queued_++;
+  return false;
+}
+
+bool ThreadPoolScheduler::Remove(ThreadPoolWork* work,
+                                 ThreadPoolWorkClass cls) {
+  std::deque<ThreadPoolWork*>& queue = lanes_[static_cast<size_t>(cls)].queue;
+  auto it = std::find(queue.begin(), queue.end(), work);
+  if (it == queue.end()) return false;
+  queue.erase(it);
+  total_queued_--;
+  return true;
+}
+
+void ThreadPoolScheduler::Started(ThreadPoolWorkClass cls) {
+  lanes_[static_cast<size_t>(cls)].active++;
+  total_active_++;
+}
+
+void ThreadPoolScheduler::Finished(ThreadPoolWorkClass cls) {
+  Lane& lane = lanes_[static_cast<size_t>(cls)];
+  CHECK_GT(lane.active, 0);
+  lane.active--;
+  total_active_--;
+
+  ThreadPoolWorkClass next_class;
+  while (total_queued_ > 0) {
+    ThreadPoolWork* next = PickNext(&next_class);
+    if (next == nullptr) break;
+    lanes_[static_cast<size_t>(next_class)].active++;
+    total_active_++;
+    next->QueueWork();
+  }
+}
+
+// Smooth weighted round-robin over the lanes that have work and room to run
+// it: every eligible lane earns its weight, the richest one wins and pays
+// back the sum of the weights. Over time each lane gets a share of the freed
+// slots proportional to its weight, without bursts.
+ThreadPoolWork* ThreadPoolScheduler::PickNext(ThreadPoolWorkClass* cls) {
+  Lane* best = nullptr;
+  size_t best_index = 0;
+  int64_t total_weight = 0;
+
+  for (size_t i = 0; i < kThreadPoolWorkClassCount; i++) {
+    Lane& lane = lanes_[i];
+    if (lane.queue.empty() || !CanStart(lane)) continue;
+    lane.current += lane.weight;
+    total_weight += lane.weight;
+    if (best == nullptr || lane.current > best->current) {
+      best = &lane;
+      best_index = i;
+    }
+  }
+  if (best == nullptr) return nullptr;
+
+  best->current -= total_weight;
+  ThreadPoolWork* work = best->queue.front();
+  best->queue.pop_front();
+  total_queued_--;
+  *cls = static_cast<ThreadPoolWorkClass>(best_index);
+  return work;
+}
+
+}  // namespace node
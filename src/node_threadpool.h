@@ -0,0 +1,110 @@
+#ifndef SRC_NODE_THREADPOOL_H_
+#define SRC_NODE_THREADPOOL_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace node {
+
+class EnvironmentOptions;
+class ThreadPoolWork;
+
+// The kinds of work an Environment hands to the libuv threadpool. Each class
+// is a separate lane in the ThreadPoolScheduler below.
+#define THREADPOOL_WORK_CLASSES(V)                                            \
+  V(kFs, "fs")                                                                \
+  V(kCrypto, "crypto")                                                        \
+  V(kCompression, "compression")                                              \
+  V(kDns, "dns")                                                              \
+  V(kUser, "user")
+
+enum class ThreadPoolWorkClass : uint8_t {
+#define V(kind, _) kind,
+  THREADPOOL_WORK_CLASSES(V)
+#undef V
+  kCount
+};
+
+constexpr size_t kThreadPoolWorkClassCount =
+    static_cast<size_t>(ThreadPoolWorkClass::kCount);
+
+const char* ThreadPoolWorkClassName(ThreadPoolWorkClass cls);
+
+// Parses a `class=value` pair as accepted by --threadpool-class-concurrency
+// and --threadpool-class-weight. Returns false on malformed input.
+bool ParseThreadPoolClassSetting(const std::string& setting,
+                                 ThreadPoolWorkClass* cls,
+                                 uint64_t* value);
+
+// Per-Environment admission control in front of the libuv threadpool.
+//
+// Every request that an Environment sends to the threadpool is accounted
+// against its class. Work that goes through ThreadPoolWork (crypto,
+// compression, user/addon work, ...) may additionally be held back here when
+// its class is at its concurrency cap or when the Environment-wide budget is
+// exhausted. Held-back work is released in smooth weighted round-robin order
+// across classes as earlier requests complete, so that a flood of one kind of
+// work cannot starve the others of threadpool slots.
+//
+// fs and dns requests are submitted to libuv directly rather than through
+// ThreadPoolWork, so they are counted towards the budget but never delayed.
+//
+// With the default options (no caps, no budget) nothing is ever held back.
+class ThreadPoolScheduler {
+ public:
+  ThreadPoolScheduler() = default;
+  ThreadPoolScheduler(const ThreadPoolScheduler&) = delete;
+  ThreadPoolScheduler& operator=(const ThreadPoolScheduler&) = delete;
+
+  void Configure(const EnvironmentOptions& options);
+
+  // Returns true if `work` may be submitted to libuv right away, otherwise
+  // it is queued and will be submitted by a later call to Finished().
+  bool Enqueue(ThreadPoolWork* work, ThreadPoolWorkClass cls);
+  // Removes queued (not yet submitted) work. Returns false if `work` was not
+  // queued here.
+  bool Remove(ThreadPoolWork* work, ThreadPoolWorkClass cls);
+
+  // Accounts for requests that are submitted to libuv without going
+  // through Enqueue().
+  void Started(ThreadPoolWorkClass cls);
+  // Must be called once for every request that was started, either
+  // explicitly or through Enqueue(). Submits queued work that has become
+  // eligible.
+  void Finished(ThreadPoolWorkClass cls);
+
+  size_t queued(ThreadPoolWorkClass cls) const {
+    return lanes_[static_cast<size_t>(cls)].queue.size();
+  }
+  size_t active(ThreadPoolWorkClass cls) const {
+    return lanes_[static_cast<size_t>(cls)].active;
+  }
+
+ private:
+  struct Lane {
+    std::deque<ThreadPoolWork*> queue;
+    size_t active = 0;
+    uint64_t cap = 0;  // 0 means unlimited.
+    int64_t weight = 1;
+    int64_t current = 0;  // Smooth weighted round-robin state.
+  };
+
+  bool CanStart(const Lane& lane) const;
+  ThreadPoolWork* PickNext(ThreadPoolWorkClass* cls);
+
+  Lane lanes_[kThreadPoolWorkClassCount];
+  size_t total_active_ = 0;
+  size_t total_queued_ = 0;
+  uint64_t budget_ = 0;  // 0 means unlimited.
+};
+
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_THREADPOOL_H_
@@ -144,6 +144,7 @@ class WorkerThreadData {
     }
     loop_init_failed_ = false;
     uv_loop_configure(&loop_, UV_METRICS_IDLE_TIME);
+    ConfigureBusyPoll(&loop_);
 
     std::shared_ptr<ArrayBufferAllocator> allocator =
         ArrayBufferAllocator::Create();
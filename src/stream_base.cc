@@ -8,6 +8,7 @@
 #include "node_buffer.h"
 #include "node_errors.h"
 #include "node_external_reference.h"
+#include "simdutf.h"
 #include "string_bytes.h"
 #include "util-inl.h"
 #include "v8.h"
@@ -79,6 +80,49 @@ void StreamBase::SetWriteResult(const StreamWriteResult& res) {
   env_->stream_base_state()[kLastWriteWasAsync] = res.async;
 }
 
+namespace {
+
+// Returns true and points `buf` at the contents of `string` if they are
+// stored outside of the V8 heap, where they don't move, and are exactly the
+// bytes that writing the string with `encoding` would produce.
+bool GetExternalStringData(Local<String> string,
+                           enum encoding encoding,
+                           uv_buf_t* buf) {
+  if (string->IsExternalOneByte()) {
+    const String::ExternalOneByteStringResource* resource =
+        string->GetExternalOneByteStringResource();
+    const char* data = resource->data();
+    const size_t length = resource->length();
+    switch (encoding) {
+      case ASCII:
+      case LATIN1:
+        break;
+      case BUFFER:
+      case UTF8:
+        // Latin-1 characters above U+007F take two bytes in UTF-8.
+        if (!simdutf::validate_ascii(data, length)) return false;
+        break;
+      default:
+        return false;
+    }
+    *buf = uv_buf_init(const_cast<char*>(data), length);
+    return true;
+  }
+
+  if (string->IsExternalTwoByte() && encoding == UCS2 && IsLittleEndian()) {
+    const String::ExternalStringResource* resource =
+        string->GetExternalStringResource();
+    *buf = uv_buf_init(
+        reinterpret_cast<char*>(const_cast<uint16_t*>(resource->data())),
+        resource->length() * sizeof(uint16_t));
+    return true;
+  }
+
+  return false;
+}
+
+}  // anonymous namespace
+
 int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
   Isolate* isolate = env->isolate();
@@ -98,6 +142,9 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
     count = chunks->Length() >> 1;
 
   MaybeStackBuffer<uv_buf_t, 16> bufs(count);
+  // Whether bufs[i] has been filled in by the first pass below, and the chunk
+  // does not need to be copied.
+  MaybeStackBuffer<bool, 16> in_place(count);
 
   size_t storage_size = 0;
   size_t offset;
@@ -105,6 +152,7 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
   if (!all_buffers) {
     // Determine storage size first
     for (size_t i = 0; i < count; i++) {
+      in_place[i] = false;
       Local<Value> chunk;
       if (!chunks->Get(context, i * 2).ToLocal(&chunk))
         return -1;
@@ -121,6 +169,14 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
       if (!chunks->Get(context, i * 2 + 1).ToLocal(&next_chunk))
         return -1;
       enum encoding encoding = ParseEncoding(isolate, next_chunk);
+
+      // External strings are written from where they are, like Buffers.
+      // writevGeneric() keeps the chunks alive until the write completes.
+      if (GetExternalStringData(string, encoding, &bufs[i])) {
+        in_place[i] = true;
+        continue;
+      }
+
       size_t chunk_size;
       if ((encoding == UTF8 &&
              string->Length() > 65535 &&
@@ -164,6 +220,9 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
         continue;
       }
 
+      if (in_place[i])
+        continue;
+
       // Write string
       CHECK_LE(offset, storage_size);
       char* str_storage =
@@ -298,6 +298,8 @@ class StreamResource {
   uint64_t bytes_written_ = 0;
 
   friend class StreamListener;
+  // Moves data between streams without reading it, but still counts it.
+  friend class StreamPipe;
 };
 
 
@@ -1,8 +1,16 @@
 #include "stream_pipe.h"
 #include "stream_base-inl.h"
 #include "node_buffer.h"
+#include "node_file.h"
+#include "stream_wrap.h"
+#include "threadpoolwork-inl.h"
 #include "util-inl.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 namespace node {
 
 using v8::BackingStore;
@@ -11,6 +19,7 @@ using v8::Function;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::HandleScope;
+using v8::Integer;
 using v8::Isolate;
 using v8::Just;
 using v8::Local;
@@ -58,6 +67,8 @@ void StreamPipe::Unpipe(bool is_in_deletion) {
 
   is_closed_ = true;
   is_reading_ = false;
+  StopSendfile();
+  StopSplice();
   source()->RemoveStreamListener(&readable_listener_);
   if (pending_writes_ == 0)
     sink()->RemoveStreamListener(&writable_listener_);
@@ -76,8 +87,10 @@ void StreamPipe::Unpipe(bool is_in_deletion) {
     Local<Value> onunpipe;
     if (!object->Get(env->context(), env->onunpipe_string()).ToLocal(&onunpipe))
       return;
+    Local<Value> argv[] = {Integer::New(env->isolate(), write_error_)};
     if (onunpipe->IsFunction() &&
-        MakeCallback(onunpipe.As<Function>(), 0, nullptr).IsEmpty()) {
+        MakeCallback(onunpipe.As<Function>(), arraysize(argv), argv)
+            .IsEmpty()) {
       return;
     }
 
@@ -129,7 +142,8 @@ void StreamPipe::ReadableListener::OnStreamRead(ssize_t nread,
     // If we’re not writing, close now. Otherwise, we’ll do that in
     // `OnStreamAfterWrite()`.
     if (pipe->pending_writes_ == 0) {
-      sink->Shutdown();
+      if (pipe->shutdown_on_eof_)
+        sink->Shutdown();
       pipe->Unpipe();
     }
     return;
@@ -157,6 +171,12 @@ void StreamPipe::ProcessData(size_t nread,
 void StreamPipe::WritableListener::OnStreamAfterWrite(WriteWrap* w,
                                                       int status) {
   StreamPipe* pipe = ContainerOf(&StreamPipe::writable_listener_, this);
+  // With sendfile() and splice(), the pipe doesn't write to the sink itself.
+  if (pipe->uses_sendfile_ || pipe->uses_splice_) {
+    CHECK_NOT_NULL(previous_listener_);
+    return previous_listener_->OnStreamAfterWrite(w, status);
+  }
+
   pipe->pending_writes_--;
   if (pipe->is_closed_) {
     if (pipe->pending_writes_ == 0) {
@@ -174,7 +194,8 @@ void StreamPipe::WritableListener::OnStreamAfterWrite(WriteWrap* w,
     HandleScope handle_scope(pipe->env()->isolate());
     InternalCallbackScope callback_scope(pipe,
         InternalCallbackScope::kSkipTaskQueues);
-    pipe->sink()->Shutdown();
+    if (pipe->shutdown_on_eof_)
+      pipe->sink()->Shutdown();
     pipe->Unpipe();
     return;
   }
@@ -182,8 +203,11 @@ void StreamPipe::WritableListener::OnStreamAfterWrite(WriteWrap* w,
   if (status != 0) {
     CHECK_NOT_NULL(previous_listener_);
     StreamListener* prev = previous_listener_;
+    pipe->write_error_ = status;
     pipe->Unpipe();
-    prev->OnStreamAfterWrite(w, status);
+    // Writes that failed synchronously have no WriteWrap.
+    if (w != nullptr)
+      prev->OnStreamAfterWrite(w, status);
     return;
   }
 
@@ -229,6 +253,356 @@ void StreamPipe::WritableListener::OnStreamWantsWrite(size_t suggested_size) {
   pipe->source()->ReadStart();
 }
 
+// Keep one job from holding on to a threadpool thread for too long when the
+// peer reads as fast as the file can be sent.
+static constexpr int64_t kSendfileJobSize = 4 * 1024 * 1024;
+
+#ifndef _WIN32
+// Returns a duplicate of `fd` that isn't inherited by child processes.
+static int DupFD(int fd) {
+  return fcntl(fd, F_DUPFD_CLOEXEC, 0);
+}
+#endif
+
+static void CloseFD(int* fd) {
+  if (*fd < 0) return;
+  uv_fs_t req;
+  uv_fs_close(nullptr, &req, *fd, nullptr);
+  uv_fs_req_cleanup(&req);
+  *fd = -1;
+}
+
+class StreamPipe::SendfileJob final : public ThreadPoolWork {
+ public:
+  SendfileJob(StreamPipe* pipe, int64_t offset, int64_t length)
+      : ThreadPoolWork(pipe->env(), "sendfile", ThreadPoolWorkClass::kFs),
+        pipe_(pipe),
+        in_fd_(pipe->sendfile_in_fd_),
+        out_fd_(pipe->sendfile_out_fd_),
+        offset_(offset),
+        length_(length) {}
+
+  void DoThreadPoolWork() override {
+    while (nsent_ < length_) {
+      uv_fs_t req;
+      int nsent = uv_fs_sendfile(nullptr,
+                                 &req,
+                                 out_fd_,
+                                 in_fd_,
+                                 offset_ + nsent_,
+                                 static_cast<size_t>(length_ - nsent_),
+                                 nullptr);
+      uv_fs_req_cleanup(&req);
+      if (nsent <= 0) {
+        // The socket is non-blocking, so this is UV_EAGAIN once it is full.
+        status_ = nsent == 0 ? UV_EOF : nsent;
+        return;
+      }
+      nsent_ += nsent;
+    }
+  }
+
+  void AfterThreadPoolWork(int status) override {
+    std::unique_ptr<SendfileJob> self(this);
+    pipe_->OnSendfileDone(nsent_, status == 0 ? status_ : status);
+  }
+
+ private:
+  BaseObjectPtr<StreamPipe> pipe_;
+  int in_fd_;
+  int out_fd_;
+  int64_t offset_;
+  int64_t length_;
+  int64_t nsent_ = 0;
+  int status_ = 0;
+};
+
+bool StreamPipe::CanUseSendfile() {
+#ifdef __linux__
+  // sendfile() needs an explicit offset, and must be the only one that writes
+  // to a plain fd.
+  if (source()->GetAsyncWrap()->provider_type() != PROVIDER_FILEHANDLE ||
+      static_cast<fs::FileHandle*>(source())->read_offset() < 0) {
+    return false;
+  }
+  switch (sink()->GetAsyncWrap()->provider_type()) {
+    case PROVIDER_TCPWRAP:
+      return true;
+    case PROVIDER_PIPEWRAP:
+      return !static_cast<LibuvStreamWrap*>(sink())->is_named_pipe_ipc();
+    default:
+      // E.g. TLS, where the data needs to be encrypted in userland.
+      return false;
+  }
+#else
+  return false;
+#endif
+}
+
+bool StreamPipe::StartSendfile() {
+#ifdef __linux__
+  // Data that the sink still has queued needs to go out first.
+  LibuvStreamWrap* sink = static_cast<LibuvStreamWrap*>(this->sink());
+  sink->FlushCorkedWrites();
+  if (sink->write_queue_size() > 0) return false;
+
+  sendfile_in_fd_ = DupFD(source()->GetFD());
+  sendfile_out_fd_ = DupFD(sink->GetFD());
+  if (sendfile_in_fd_ < 0 || sendfile_out_fd_ < 0) {
+    StopSendfile();
+    return false;
+  }
+
+  uses_sendfile_ = true;
+  ScheduleSendfile();
+  return true;
+#else
+  return false;
+#endif
+}
+
+void StreamPipe::ScheduleSendfile() {
+  fs::FileHandle* file = static_cast<fs::FileHandle*>(source());
+  int64_t length = kSendfileJobSize;
+  if (file->read_length() >= 0)
+    length = std::min(length, file->read_length());
+  pending_writes_++;
+  sendfile_running_ = true;
+  (new SendfileJob(this, file->read_offset(), length))->ScheduleWork();
+}
+
+void StreamPipe::OnSendfileDone(int64_t nsent, int status) {
+  Environment* env = this->env();
+  sendfile_running_ = false;
+  if (!sink_destroyed_)
+    pending_writes_--;
+
+  if (is_closed_) {
+    StopSendfile();
+    if (pending_writes_ == 0 && !sink_destroyed_) {
+      if (env->can_call_into_js()) {
+        HandleScope handle_scope(env->isolate());
+        Context::Scope context_scope(env->context());
+        if (MakeCallback(env->oncomplete_string(), 0, nullptr).IsEmpty())
+          return;
+      }
+      sink()->RemoveStreamListener(&writable_listener_);
+    }
+    return;
+  }
+
+  fs::FileHandle* file = static_cast<fs::FileHandle*>(source());
+  file->SkipRead(nsent);
+  if (status == 0 && file->read_length() == 0)
+    status = UV_EOF;
+
+  if (status == 0)
+    return ScheduleSendfile();
+
+  if (status == UV_EAGAIN) {
+    if (sendfile_poll_ == nullptr) {
+      sendfile_poll_ = new uv_poll_t();
+      status =
+          uv_poll_init(env->event_loop(), sendfile_poll_, sendfile_out_fd_);
+      if (status != 0) {
+        delete sendfile_poll_;
+        sendfile_poll_ = nullptr;
+      } else {
+        sendfile_poll_->data = this;
+      }
+    }
+    if (status == 0) {
+      CHECK_EQ(0,
+               uv_poll_start(sendfile_poll_, UV_WRITABLE, OnSendfileWritable));
+      return;
+    }
+  }
+
+  if (!env->can_call_into_js()) return;
+  // Like reading from the FileHandle, report EOF and errors to its listener,
+  // then unpipe.
+  HandleScope handle_scope(env->isolate());
+  InternalCallbackScope callback_scope(this);
+  readable_listener_.OnStreamRead(status, uv_buf_init(nullptr, 0));
+}
+
+void StreamPipe::OnSendfileWritable(uv_poll_t* handle,
+                                    int status,
+                                    int events) {
+  StreamPipe* pipe = static_cast<StreamPipe*>(handle->data);
+  CHECK_EQ(0, uv_poll_stop(handle));
+  // Errors are reported by the next sendfile() call.
+  pipe->ScheduleSendfile();
+}
+
+void StreamPipe::StopSendfile() {
+  if (sendfile_poll_ != nullptr) {
+    env()->CloseHandle(sendfile_poll_, [](uv_poll_t* handle) {
+      delete handle;
+    });
+    sendfile_poll_ = nullptr;
+  }
+  // A running job still uses the fds, OnSendfileDone() gets back here.
+  if (sendfile_running_) return;
+  CloseFD(&sendfile_in_fd_);
+  CloseFD(&sendfile_out_fd_);
+}
+
+// The default size of a pipe is 64 KiB. A larger one lets each splice() call
+// move more data, if the system allows it.
+static constexpr int kSplicePipeSize = 1024 * 1024;
+// Move at most this much data before going back to the event loop, so that
+// one busy connection can't starve the others.
+static constexpr size_t kSpliceBudget = 4 * 1024 * 1024;
+
+bool StreamPipe::CanUseSplice() {
+#ifdef __linux__
+  for (StreamBase* stream : {source(), sink()}) {
+    switch (stream->GetAsyncWrap()->provider_type()) {
+      case PROVIDER_TCPWRAP:
+        break;
+      case PROVIDER_PIPEWRAP:
+        // Handles that are sent along with the data would be lost.
+        if (static_cast<LibuvStreamWrap*>(stream)->is_named_pipe_ipc())
+          return false;
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool StreamPipe::StartSplice() {
+#ifdef __linux__
+  // Data that the sink still has queued needs to go out first.
+  LibuvStreamWrap* sink = static_cast<LibuvStreamWrap*>(this->sink());
+  sink->FlushCorkedWrites();
+  if (sink->write_queue_size() > 0) return false;
+
+  if (pipe2(splice_pipe_, O_CLOEXEC | O_NONBLOCK) != 0) {
+    splice_pipe_[0] = splice_pipe_[1] = -1;
+    return false;
+  }
+  fcntl(splice_pipe_[1], F_SETPIPE_SZ, kSplicePipeSize);
+  // libuv already polls the original fds, and a uv_poll_t needs fds that
+  // aren't registered with the loop yet.
+  splice_in_fd_ = DupFD(source()->GetFD());
+  splice_out_fd_ = DupFD(sink->GetFD());
+  if (splice_in_fd_ < 0 || splice_out_fd_ < 0 ||
+      WaitForSplice(&splice_read_poll_, splice_in_fd_, UV_READABLE) != 0) {
+    StopSplice();
+    return false;
+  }
+
+  source()->ReadStop();
+  uses_splice_ = true;
+  return true;
+#else
+  return false;
+#endif
+}
+
+void StreamPipe::Splice() {
+#ifdef __linux__
+  constexpr unsigned int kFlags = SPLICE_F_MOVE | SPLICE_F_NONBLOCK;
+  size_t budget = kSpliceBudget;
+  for (;;) {
+    ssize_t n;
+    if (splice_buffered_ > 0) {
+      do {
+        n = splice(splice_pipe_[0], nullptr, splice_out_fd_, nullptr,
+                   splice_buffered_, kFlags);
+      } while (n == -1 && errno == EINTR);
+      if (n == -1) {
+        int err = errno == EAGAIN ? WaitForSplice(&splice_write_poll_,
+                                                  splice_out_fd_,
+                                                  UV_WRITABLE)
+                                  : uv_translate_sys_error(errno);
+        if (err != 0) {
+          write_error_ = err;
+          Unpipe();
+        }
+        return;
+      }
+      splice_buffered_ -= n;
+      sink()->bytes_written_ += n;
+      continue;
+    }
+
+    if (budget == 0) {
+      // Polling is level-triggered, so this continues in the next loop
+      // iteration if more data is available.
+      int err = WaitForSplice(&splice_read_poll_, splice_in_fd_, UV_READABLE);
+      if (err != 0) OnSpliceReadDone(err);
+      return;
+    }
+    do {
+      n = splice(splice_in_fd_, nullptr, splice_pipe_[1], nullptr,
+                 std::min<size_t>(budget, kSplicePipeSize), kFlags);
+    } while (n == -1 && errno == EINTR);
+    if (n <= 0) {
+      int err = UV_EOF;
+      if (n == -1 && errno == EAGAIN) {
+        err = WaitForSplice(&splice_read_poll_, splice_in_fd_, UV_READABLE);
+      } else if (n == -1) {
+        err = uv_translate_sys_error(errno);
+      }
+      if (err != 0) OnSpliceReadDone(err);
+      return;
+    }
+    splice_buffered_ = n;
+    budget -= std::min<size_t>(budget, n);
+    source()->bytes_read_ += n;
+  }
+#endif
+}
+
+int StreamPipe::WaitForSplice(uv_poll_t** poll, int fd, int events) {
+  if (*poll == nullptr) {
+    std::unique_ptr<uv_poll_t> handle = std::make_unique<uv_poll_t>();
+    int err = uv_poll_init(env()->event_loop(), handle.get(), fd);
+    if (err != 0) return err;
+    handle->data = this;
+    *poll = handle.release();
+  }
+  return uv_poll_start(*poll, events, OnSpliceReady);
+}
+
+void StreamPipe::OnSpliceReady(uv_poll_t* handle, int status, int events) {
+  StreamPipe* pipe = static_cast<StreamPipe*>(handle->data);
+  CHECK_EQ(0, uv_poll_stop(handle));
+  // Errors are reported by the next splice() call.
+  pipe->Splice();
+}
+
+void StreamPipe::OnSpliceReadDone(int status) {
+  Environment* env = this->env();
+  if (!env->can_call_into_js()) return;
+  // Like reading from the source, report EOF and errors to its listener,
+  // then unpipe.
+  HandleScope handle_scope(env->isolate());
+  InternalCallbackScope callback_scope(this);
+  readable_listener_.OnStreamRead(status, uv_buf_init(nullptr, 0));
+}
+
+void StreamPipe::StopSplice() {
+  for (uv_poll_t** poll : {&splice_read_poll_, &splice_write_poll_}) {
+    if (*poll == nullptr) continue;
+    env()->CloseHandle(*poll, [](uv_poll_t* handle) { delete handle; });
+    *poll = nullptr;
+  }
+  // Data that is still in the kernel pipe is dropped along with it.
+  for (int* fd : {&splice_in_fd_, &splice_out_fd_,
+                  &splice_pipe_[0], &splice_pipe_[1]}) {
+    CloseFD(fd);
+  }
+  splice_buffered_ = 0;
+}
+
 uv_buf_t StreamPipe::WritableListener::OnStreamAlloc(size_t suggested_size) {
   CHECK_NOT_NULL(previous_listener_);
   return previous_listener_->OnStreamAlloc(suggested_size);
@@ -279,13 +653,21 @@ void StreamPipe::New(const FunctionCallbackInfo<Value>& args) {
   StreamBase* source = StreamBase::FromObject(args[0].As<Object>());
   StreamBase* sink = StreamBase::FromObject(args[1].As<Object>());
 
-  if (StreamPipe::New(source, sink, args.This()).IsNothing()) return;
+  StreamPipe* pipe;
+  if (!StreamPipe::New(source, sink, args.This()).To(&pipe)) return;
+  // new StreamPipe(source, sink[, shutdownOnEOF])
+  if (args[2]->IsFalse())
+    pipe->shutdown_on_eof_ = false;
 }
 
 void StreamPipe::Start(const FunctionCallbackInfo<Value>& args) {
   StreamPipe* pipe;
   ASSIGN_OR_RETURN_UNWRAP(&pipe, args.Holder());
   pipe->is_closed_ = false;
+  if (pipe->CanUseSendfile() && pipe->StartSendfile())
+    return;
+  if (pipe->CanUseSplice() && pipe->StartSplice())
+    return;
   pipe->writable_listener_.OnStreamWantsWrite(65536);
 }
 
@@ -307,6 +689,18 @@ void StreamPipe::PendingWrites(const FunctionCallbackInfo<Value>& args) {
   args.GetReturnValue().Set(pipe->pending_writes_);
 }
 
+void StreamPipe::UsesSendfile(const FunctionCallbackInfo<Value>& args) {
+  StreamPipe* pipe;
+  ASSIGN_OR_RETURN_UNWRAP(&pipe, args.Holder());
+  args.GetReturnValue().Set(pipe->uses_sendfile_);
+}
+
+void StreamPipe::UsesSplice(const FunctionCallbackInfo<Value>& args) {
+  StreamPipe* pipe;
+  ASSIGN_OR_RETURN_UNWRAP(&pipe, args.Holder());
+  args.GetReturnValue().Set(pipe->uses_splice_);
+}
+
 namespace {
 
 void InitializeStreamPipe(Local<Object> target,
@@ -322,6 +716,8 @@ void InitializeStreamPipe(Local<Object> target,
   SetProtoMethod(isolate, pipe, "start", StreamPipe::Start);
   SetProtoMethod(isolate, pipe, "isClosed", StreamPipe::IsClosed);
   SetProtoMethod(isolate, pipe, "pendingWrites", StreamPipe::PendingWrites);
+  SetProtoMethod(isolate, pipe, "usesSendfile", StreamPipe::UsesSendfile);
+  SetProtoMethod(isolate, pipe, "usesSplice", StreamPipe::UsesSplice);
   pipe->Inherit(AsyncWrap::GetConstructorTemplate(env));
   pipe->InstanceTemplate()->SetInternalFieldCount(
       StreamPipe::kInternalFieldCount);
@@ -21,6 +21,8 @@ class StreamPipe : public AsyncWrap {
   static void Unpipe(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void IsClosed(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void PendingWrites(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void UsesSendfile(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void UsesSplice(const v8::FunctionCallbackInfo<v8::Value>& args);
 
   SET_NO_MEMORY_INFO()
   SET_MEMORY_INFO_NAME(StreamPipe)
@@ -39,6 +41,10 @@ class StreamPipe : public AsyncWrap {
   bool sink_destroyed_ = false;
   bool source_destroyed_ = false;
   bool uses_wants_write_ = false;
+  // Whether to shut down the sink once the source ends.
+  bool shutdown_on_eof_ = true;
+  // The first error from writing to the sink, passed to `onunpipe`.
+  int write_error_ = 0;
 
   // Set a default value so that when we’re coming from Start(), we know
   // that we don’t want to read just yet.
@@ -48,6 +54,49 @@ class StreamPipe : public AsyncWrap {
 
   void ProcessData(size_t nread, std::unique_ptr<v8::BackingStore> bs);
 
+  // When the source is a FileHandle and the sink a TCP socket or a pipe, the
+  // data is sent with sendfile() on the threadpool rather than read into
+  // memory and written out again. Each SendfileJob sends until the socket is
+  // full, then sendfile_poll_ waits for it to become writable again. Both use
+  // duplicates of the two fds, so that closing the source or the sink while a
+  // job is running cannot make it write to some other fd that reused the
+  // number.
+  class SendfileJob;
+  bool CanUseSendfile();
+  bool StartSendfile();
+  void ScheduleSendfile();
+  void OnSendfileDone(int64_t nsent, int status);
+  static void OnSendfileWritable(uv_poll_t* handle, int status, int events);
+  void StopSendfile();
+
+  bool uses_sendfile_ = false;
+  bool sendfile_running_ = false;
+  int sendfile_in_fd_ = -1;
+  int sendfile_out_fd_ = -1;
+  uv_poll_t* sendfile_poll_ = nullptr;
+
+  // When both ends are TCP sockets or pipes, the data is moved with splice()
+  // through a kernel pipe on the loop thread, and never copied to userspace.
+  // splice_read_poll_ waits for the source to become readable while the
+  // kernel pipe is empty, and splice_write_poll_ waits for the sink to become
+  // writable while it is not, so a slow sink stops reading from the source.
+  bool CanUseSplice();
+  bool StartSplice();
+  void Splice();
+  int WaitForSplice(uv_poll_t** poll, int fd, int events);
+  static void OnSpliceReady(uv_poll_t* handle, int status, int events);
+  void OnSpliceReadDone(int status);
+  void StopSplice();
+
+  bool uses_splice_ = false;
+  int splice_in_fd_ = -1;
+  int splice_out_fd_ = -1;
+  int splice_pipe_[2] = {-1, -1};
+  // Bytes that are in the kernel pipe.
+  size_t splice_buffered_ = 0;
+  uv_poll_t* splice_read_poll_ = nullptr;
+  uv_poll_t* splice_write_poll_ = nullptr;
+
   class ReadableListener : public StreamListener {
    public:
     uv_buf_t OnStreamAlloc(size_t suggested_size) override;
@@ -58,6 +58,10 @@ using v8::ReadOnly;
 using v8::Signature;
 using v8::Value;
 
+// Small writes are copied while they are corked, up to this many bytes for
+// each flush.
+constexpr size_t kMaxCorkedCopySize = 64 * 1024;
+
 void IsConstructCallCallback(const FunctionCallbackInfo<Value>& args) {
   CHECK(args.IsConstructCall());
   StreamReq::ResetObject(args.This());
@@ -116,6 +120,9 @@ void LibuvStreamWrap::RegisterExternalReferences(
   registry->Register(IsConstructCallCallback);
   registry->Register(GetWriteQueueSize);
   registry->Register(SetBlocking);
+  registry->Register(SetAutoCork);
+  registry->Register(GetCorkedWriteCount);
+  registry->Register(GetCorkedFlushCount);
   StreamBase::RegisterExternalReferences(registry);
 }
 
@@ -153,7 +160,28 @@ Local<FunctionTemplate> LibuvStreamWrap::GetConstructorTemplate(
         get_write_queue_size,
         Local<FunctionTemplate>(),
         static_cast<PropertyAttribute>(ReadOnly | DontDelete));
+    Local<FunctionTemplate> get_corked_writes =
+        FunctionTemplate::New(isolate,
+                              GetCorkedWriteCount,
+                              Local<Value>(),
+                              Signature::New(isolate, tmpl));
+    tmpl->PrototypeTemplate()->SetAccessorProperty(
+        FIXED_ONE_BYTE_STRING(isolate, "corkedWrites"),
+        get_corked_writes,
+        Local<FunctionTemplate>(),
+        static_cast<PropertyAttribute>(ReadOnly | DontDelete));
+    Local<FunctionTemplate> get_corked_flushes =
+        FunctionTemplate::New(isolate,
+                              GetCorkedFlushCount,
+                              Local<Value>(),
+                              Signature::New(isolate, tmpl));
+    tmpl->PrototypeTemplate()->SetAccessorProperty(
+        FIXED_ONE_BYTE_STRING(isolate, "corkedFlushes"),
+        get_corked_flushes,
+        Local<FunctionTemplate>(),
+        static_cast<PropertyAttribute>(ReadOnly | DontDelete));
     SetProtoMethod(isolate, tmpl, "setBlocking", SetBlocking);
+    SetProtoMethod(isolate, tmpl, "setAutoCork", SetAutoCork);
     StreamBase::AddMethods(env, tmpl);
     env->set_libuv_stream_wrap_ctor_template(tmpl);
   }
@@ -199,6 +227,15 @@ bool LibuvStreamWrap::IsIPCPipe() {
   return is_named_pipe_ipc();
 }
 
+
+void LibuvStreamWrap::Close(Local<Value> close_callback) {
+  // Start the corked writes first, so that they are written, or cancelled,
+  // like any other write that is pending when the handle is closed.
+  if (!IsHandleClosing())
+    FlushCorkedWrites();
+  HandleWrap::Close(close_callback);
+}
+
 int LibuvStreamWrap::ReadStart() {
   return uv_read_start(
       stream(),
@@ -304,7 +341,7 @@ void LibuvStreamWrap::GetWriteQueueSize(
     return;
   }
 
-  uint32_t write_queue_size = wrap->stream()->write_queue_size;
+  uint32_t write_queue_size = wrap->write_queue_size();
   info.GetReturnValue().Set(write_queue_size);
 }
 
@@ -321,6 +358,38 @@ void LibuvStreamWrap::SetBlocking(const FunctionCallbackInfo<Value>& args) {
   args.GetReturnValue().Set(uv_stream_set_blocking(wrap->stream(), enable));
 }
 
+
+void LibuvStreamWrap::SetAutoCork(const FunctionCallbackInfo<Value>& args) {
+  LibuvStreamWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
+
+  CHECK_GT(args.Length(), 0);
+  // Handles that are sent over IPC pipes can't be attached to corked writes.
+  if (!wrap->IsAlive() || wrap->is_named_pipe_ipc())
+    return args.GetReturnValue().Set(UV_EINVAL);
+
+  wrap->auto_cork_ = args[0]->IsTrue();
+  if (!wrap->auto_cork_)
+    wrap->FlushCorkedWrites();
+  args.GetReturnValue().Set(0);
+}
+
+
+void LibuvStreamWrap::GetCorkedWriteCount(
+    const FunctionCallbackInfo<Value>& info) {
+  LibuvStreamWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap, info.This());
+  info.GetReturnValue().Set(static_cast<double>(wrap->corked_writes_));
+}
+
+
+void LibuvStreamWrap::GetCorkedFlushCount(
+    const FunctionCallbackInfo<Value>& info) {
+  LibuvStreamWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap, info.This());
+  info.GetReturnValue().Set(static_cast<double>(wrap->corked_flushes_));
+}
+
 typedef SimpleShutdownWrap<ReqWrap<uv_shutdown_t>> LibuvShutdownWrap;
 typedef SimpleWriteWrap<ReqWrap<uv_write_t>> LibuvWriteWrap;
 
@@ -335,6 +404,8 @@ WriteWrap* LibuvStreamWrap::CreateWriteWrap(Local<Object> object) {
 
 int LibuvStreamWrap::DoShutdown(ShutdownWrap* req_wrap_) {
   LibuvShutdownWrap* req_wrap = static_cast<LibuvShutdownWrap*>(req_wrap_);
+  // uv_shutdown() waits for the writes that have been started.
+  FlushCorkedWrites();
   return req_wrap->Dispatch(uv_shutdown, stream(), AfterUvShutdown);
 }
 
@@ -359,6 +430,14 @@ int LibuvStreamWrap::DoTryWrite(uv_buf_t** bufs, size_t* count) {
   uv_buf_t* vbufs = *bufs;
   size_t vcount = *count;
 
+  if (auto_cork_) {
+    if (corked_error_ != 0)
+      return corked_error_;
+    if (CorkCopy(vbufs, vcount))
+      *count = 0;
+    return 0;
+  }
+
   err = uv_try_write(stream(), vbufs, vcount);
   if (err == UV_ENOSYS || err == UV_EAGAIN)
     return 0;
@@ -393,6 +472,21 @@ int LibuvStreamWrap::DoWrite(WriteWrap* req_wrap,
                              uv_buf_t* bufs,
                              size_t count,
                              uv_stream_t* send_handle) {
+  if (auto_cork_) {
+    CHECK_NULL(send_handle);
+    if (corked_error_ != 0)
+      return corked_error_;
+    CorkedWrites* corked = Cork();
+    // The request and the data that it references are kept alive until the
+    // write is done, like for requests that are started right away.
+    corked->writes.emplace_back(req_wrap->GetAsyncWrap());
+    for (size_t i = 0; i < count; i++) {
+      corked->bufs.push_back(bufs[i]);
+      corked_bytes_ += bufs[i].len;
+    }
+    return 0;
+  }
+
   LibuvWriteWrap* w = static_cast<LibuvWriteWrap*>(req_wrap);
   return w->Dispatch(uv_write2,
                      stream(),
@@ -413,6 +507,113 @@ void LibuvStreamWrap::AfterUvWrite(uv_write_t* req, int status) {
   req_wrap->Done(status);
 }
 
+
+LibuvStreamWrap::CorkedWrites* LibuvStreamWrap::Cork() {
+  if (!corked_) {
+    corked_ = std::make_unique<CorkedWrites>();
+    corked_->stream = this;
+  }
+  corked_writes_++;
+
+  if (!cork_flush_scheduled_) {
+    cork_flush_scheduled_ = true;
+    BaseObjectPtr<LibuvStreamWrap> strong_ref{this};
+    env()->SetImmediate([strong_ref](Environment* env) {
+      strong_ref->cork_flush_scheduled_ = false;
+      strong_ref->FlushCorkedWrites();
+    });
+  }
+  return corked_.get();
+}
+
+
+bool LibuvStreamWrap::CorkCopy(const uv_buf_t* bufs, size_t count) {
+  // Like uv_try_write(), only finish writes right away while the kernel
+  // takes all data, so that backpressure still reaches the caller.
+  if (stream()->write_queue_size > 0)
+    return false;
+
+  size_t size = 0;
+  for (size_t i = 0; i < count; i++)
+    size += bufs[i].len;
+  // Empty writes finish after the writes before them, which is used to wait
+  // for data to be written before handing the stream to a StreamPipe.
+  if (size == 0)
+    return !corked_;
+  if ((corked_ ? corked_->data_size : 0) + size > kMaxCorkedCopySize)
+    return false;
+
+  CorkedWrites* corked = Cork();
+  if (!corked->data)
+    corked->data.reset(new char[kMaxCorkedCopySize]);
+  char* base = corked->data.get() + corked->data_size;
+  size_t offset = 0;
+  for (size_t i = 0; i < count; i++) {
+    memcpy(base + offset, bufs[i].base, bufs[i].len);
+    offset += bufs[i].len;
+  }
+  corked->data_size += size;
+  corked_bytes_ += size;
+
+  // Copies that directly follow each other are written as one buffer.
+  if (!corked->bufs.empty() &&
+      corked->bufs.back().base + corked->bufs.back().len == base) {
+    corked->bufs.back().len += size;
+  } else {
+    corked->bufs.push_back(uv_buf_init(base, size));
+  }
+  return true;
+}
+
+
+void LibuvStreamWrap::FlushCorkedWrites() {
+  if (!corked_)
+    return;
+
+  std::unique_ptr<CorkedWrites> corked = std::move(corked_);
+  corked_bytes_ = 0;
+  corked_flushes_++;
+
+  corked->req.data = corked.get();
+  int err = uv_write(&corked->req,
+                     stream(),
+                     corked->bufs.data(),
+                     corked->bufs.size(),
+                     AfterCorkedWrite);
+  if (err != 0) {
+    // The writes were already reported as started, so they fail
+    // asynchronously, like a uv_write() that fails later on.
+    BaseObjectPtr<LibuvStreamWrap> strong_ref{this};
+    env()->SetImmediate(
+        [strong_ref, corked = std::move(corked), err](Environment* env) {
+          FinishCorkedWrites(corked.get(), err);
+        });
+    return;
+  }
+
+  env()->IncreaseWaitingRequestCounter();
+  USE(corked.release());
+}
+
+
+void LibuvStreamWrap::AfterCorkedWrite(uv_write_t* req, int status) {
+  std::unique_ptr<CorkedWrites> corked{static_cast<CorkedWrites*>(req->data)};
+  corked->stream->env()->DecreaseWaitingRequestCounter();
+  FinishCorkedWrites(corked.get(), status);
+}
+
+
+void LibuvStreamWrap::FinishCorkedWrites(CorkedWrites* corked, int status) {
+  if (status < 0 && corked->stream->corked_error_ == 0)
+    corked->stream->corked_error_ = status;
+
+  Environment* env = corked->stream->env();
+  HandleScope scope(env->isolate());
+  Context::Scope context_scope(env->context());
+  for (const BaseObjectPtr<AsyncWrap>& write : corked->writes)
+    WriteWrap::FromObject(write)->Done(status);
+}
+
 }  // namespace node
 
 NODE_BINDING_CONTEXT_AWARE_INTERNAL(stream_wrap,
@@ -28,6 +28,9 @@
 #include "handle_wrap.h"
 #include "v8.h"
 
+#include <memory>
+#include <vector>
+
 namespace node {
 
 class Environment;
@@ -74,6 +77,17 @@ class LibuvStreamWrap : public HandleWrap, public StreamBase {
     return stream()->type == UV_TCP;
   }
 
+  // The number of bytes waiting to be written, including corked writes.
+  inline size_t write_queue_size() const {
+    return stream()->write_queue_size + corked_bytes_;
+  }
+
+  void Close(
+      v8::Local<v8::Value> close_callback = v8::Local<v8::Value>()) override;
+
+  // Start writing the writes that are corked right away.
+  void FlushCorkedWrites();
+
   ShutdownWrap* CreateShutdownWrap(v8::Local<v8::Object> object) override;
   WriteWrap* CreateWriteWrap(v8::Local<v8::Object> object) override;
 
@@ -102,6 +116,11 @@ class LibuvStreamWrap : public HandleWrap, public StreamBase {
   static void GetWriteQueueSize(
       const v8::FunctionCallbackInfo<v8::Value>& info);
   static void SetBlocking(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SetAutoCork(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void GetCorkedWriteCount(
+      const v8::FunctionCallbackInfo<v8::Value>& info);
+  static void GetCorkedFlushCount(
+      const v8::FunctionCallbackInfo<v8::Value>& info);
 
   // Callbacks for libuv
   void OnUvAlloc(size_t suggested_size, uv_buf_t* buf);
@@ -110,8 +129,39 @@ class LibuvStreamWrap : public HandleWrap, public StreamBase {
   static void AfterUvWrite(uv_write_t* req, int status);
   static void AfterUvShutdown(uv_shutdown_t* req, int status);
 
+  // With auto-corking enabled, writes are not started right away. They are
+  // collected until the current turn of the event loop is done, and then
+  // written with a single uv_write() call, i.e. usually one writev().
+  // Small writes are copied and reported as done right away, like writes
+  // that uv_try_write() finishes. Others finish when the uv_write() does.
+  struct CorkedWrites {
+    uv_write_t req;
+    LibuvStreamWrap* stream;
+    std::vector<BaseObjectPtr<AsyncWrap>> writes;
+    std::vector<uv_buf_t> bufs;
+    std::unique_ptr<char[]> data;
+    size_t data_size = 0;
+  };
+
+  CorkedWrites* Cork();
+  bool CorkCopy(const uv_buf_t* bufs, size_t count);
+  static void AfterCorkedWrite(uv_write_t* req, int status);
+  static void FinishCorkedWrites(CorkedWrites* corked, int status);
+
   uv_stream_t* const stream_;
 
+  bool auto_cork_ = false;
+  bool cork_flush_scheduled_ = false;
+  std::unique_ptr<CorkedWrites> corked_;
+  size_t corked_bytes_ = 0;
+  // The first error of a flush. Copied writes have already been reported as
+  // done, so it is returned for the next write instead.
+  int corked_error_ = 0;
+  // Writes that went through the cork, and the uv_write() calls that were
+  // made for them. The difference is the number of write calls saved.
+  uint64_t corked_writes_ = 0;
+  uint64_t corked_flushes_ = 0;
+
 #ifdef _WIN32
   // We don't always have an FD that we could look up on the stream_
   // object itself on Windows. However, for some cases, we open handles
@@ -34,6 +34,11 @@
 
 #include <cstdlib>
 
+#ifdef __linux__
+#include <linux/filter.h>
+#include <sys/socket.h>
+#endif
+
 
 namespace node {
 
@@ -104,6 +109,10 @@ void TCPWrap::Initialize(Local<Object> target,
   SetProtoMethod(isolate, t, "setNoDelay", SetNoDelay);
   SetProtoMethod(isolate, t, "setKeepAlive", SetKeepAlive);
   SetProtoMethod(isolate, t, "reset", Reset);
+  SetProtoMethod(isolate,
+                 t,
+                 "attachReusePortCpuSteering",
+                 AttachReusePortCpuSteering);
 
 #ifdef _WIN32
   SetProtoMethod(isolate, t, "setSimultaneousAccepts", SetSimultaneousAccepts);
@@ -123,6 +132,7 @@ void TCPWrap::Initialize(Local<Object> target,
   NODE_DEFINE_CONSTANT(constants, SOCKET);
   NODE_DEFINE_CONSTANT(constants, SERVER);
   NODE_DEFINE_CONSTANT(constants, UV_TCP_IPV6ONLY);
+  NODE_DEFINE_CONSTANT(constants, UV_TCP_REUSEPORT);
   target->Set(context,
               env->constants_string(),
               constants).Check();
@@ -142,6 +152,7 @@ void TCPWrap::RegisterExternalReferences(ExternalReferenceRegistry* registry) {
   registry->Register(SetNoDelay);
   registry->Register(SetKeepAlive);
   registry->Register(Reset);
+  registry->Register(AttachReusePortCpuSteering);
 #ifdef _WIN32
   registry->Register(SetSimultaneousAccepts);
 #endif
@@ -207,6 +218,40 @@ void TCPWrap::SetKeepAlive(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Attaches a classic BPF program to the SO_REUSEPORT group of a bound socket
+// that hands each connection to the group's N-th socket, where N is the CPU
+// that processed the connection's packets. The kernel falls back to its
+// usual hash when there are fewer sockets than CPUs.
+void TCPWrap::AttachReusePortCpuSteering(
+    const FunctionCallbackInfo<Value>& args) {
+  TCPWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap,
+                          args.Holder(),
+                          args.GetReturnValue().Set(UV_EBADF));
+  int err = UV_ENOTSUP;
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+  uv_os_fd_t fd;
+  err = uv_fileno(reinterpret_cast<uv_handle_t*>(&wrap->handle_), &fd);
+  if (err == 0) {
+    sock_filter code[] = {
+        {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+         static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+        {BPF_RET | BPF_A, 0, 0, 0},
+    };
+    sock_fprog prog = {static_cast<uint16_t>(arraysize(code)), code};
+    if (setsockopt(fd,
+                   SOL_SOCKET,
+                   SO_ATTACH_REUSEPORT_CBPF,
+                   &prog,
+                   sizeof(prog)) == -1) {
+      err = uv_translate_sys_error(errno);
+    }
+  }
+#endif
+  args.GetReturnValue().Set(err);
+}
+
+
 #ifdef _WIN32
 void TCPWrap::SetSimultaneousAccepts(const FunctionCallbackInfo<Value>& args) {
   TCPWrap* wrap;
@@ -251,10 +296,7 @@ void TCPWrap::Bind(
   int port;
   unsigned int flags = 0;
   if (!args[1]->Int32Value(env->context()).To(&port)) return;
-  if (family == AF_INET6 &&
-      !args[2]->Uint32Value(env->context()).To(&flags)) {
-    return;
-  }
+  if (!args[2]->Uint32Value(env->context()).To(&flags)) return;
 
   T addr;
   int err = uv_ip_addr(*ip_address, port, &addr);
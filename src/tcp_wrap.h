@@ -89,6 +89,8 @@ class TCPWrap : public ConnectionWrap<TCPWrap, uv_tcp_t> {
       int family,
       std::function<int(const char* ip_address, int port, T* addr)> uv_ip_addr);
   static void Reset(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void AttachReusePortCpuSteering(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
   int Reset(v8::Local<v8::Value> close_callback = v8::Local<v8::Value>());
 
 #ifdef _WIN32
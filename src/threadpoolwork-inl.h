@@ -24,6 +24,7 @@
 
 #if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
 
+#include "env-inl.h"
 #include "node_internals.h"
 #include "tracing/trace_event.h"
 #include "util-inl.h"
@@ -34,6 +35,13 @@ void ThreadPoolWork::ScheduleWork() {
   env_->IncreaseWaitingRequestCounter();
   TRACE_EVENT_NESTABLE_ASYNC_BEGIN0(
       TRACING_CATEGORY_NODE2(threadpoolwork, async), type_, this);
+  // Otherwise the scheduler calls QueueWork() once the work's class has
+  // room for it.
+  if (env_->threadpool_scheduler()->Enqueue(this, work_class_))
+    QueueWork();
+}
+
+void ThreadPoolWork::QueueWork() {
   int status = uv_queue_work(
       env_->event_loop(),
       &work_req_,
@@ -54,12 +62,30 @@ void ThreadPoolWork::ScheduleWork() {
             self,
             "result",
             status);
+        // Release the slot first, `self` may be gone after the callback.
+        self->env_->threadpool_scheduler()->Finished(self->work_class_);
+        self->env_->performance_state()->RecordThreadPoolWork(
+            self->work_class_, reinterpret_cast<uv_req_t*>(req));
         self->AfterThreadPoolWork(status);
       });
   CHECK_EQ(status, 0);
 }
 
 int ThreadPoolWork::CancelWork() {
+  if (env_->threadpool_scheduler()->Remove(this, work_class_)) {
+    // The work never reached libuv; complete it the way uv_cancel() would.
+    env_->SetImmediate([this](Environment* env) {
+      env->DecreaseWaitingRequestCounter();
+      TRACE_EVENT_NESTABLE_ASYNC_END1(
+          TRACING_CATEGORY_NODE2(threadpoolwork, async),
+          type_,
+          this,
+          "result",
+          UV_ECANCELED);
+      AfterThreadPoolWork(UV_ECANCELED);
+    });
+    return 0;
+  }
   return uv_cancel(reinterpret_cast<uv_req_t*>(&work_req_));
 }
 
@@ -28,6 +28,15 @@
 #include "req_wrap-inl.h"
 #include "util-inl.h"
 
+#ifdef __linux__
+#include <netinet/udp.h>
+#include <sys/socket.h>
+
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#endif
+
 namespace node {
 
 using errors::TryCatchScope;
@@ -44,11 +53,14 @@ using v8::Integer;
 using v8::Isolate;
 using v8::Local;
 using v8::MaybeLocal;
+using v8::Number;
 using v8::Object;
 using v8::PropertyAttribute;
 using v8::ReadOnly;
 using v8::Signature;
+using v8::String;
 using v8::Uint32;
+using v8::Uint32Array;
 using v8::Undefined;
 using v8::Value;
 
@@ -79,6 +91,28 @@ bool SendWrap::have_callback() const {
   return have_callback_;
 }
 
+// A request for the datagrams of a sendBatch() call that could not be sent
+// right away. Each of them is queued with its own uv_udp_send_t, and the
+// callback is called once all of them are done.
+class SendBatchWrap final : public SendWrap {
+ public:
+  SendBatchWrap(Environment* env,
+                Local<Object> req_wrap_obj,
+                bool have_callback,
+                size_t count)
+      : SendWrap(env, req_wrap_obj, have_callback),
+        reqs(new uv_udp_send_t[count]) {}
+
+  std::unique_ptr<uv_udp_send_t[]> reqs;
+  size_t pending = 0;
+  size_t sent = 0;
+  int status = 0;
+
+  SET_NO_MEMORY_INFO()
+  SET_MEMORY_INFO_NAME(SendBatchWrap)
+  SET_SELF_SIZE(SendBatchWrap)
+};
+
 UDPListener::~UDPListener() {
   if (wrap_ != nullptr)
     wrap_->set_listener(nullptr);
@@ -114,7 +148,7 @@ void UDPWrapBase::AddMethods(Environment* env, Local<FunctionTemplate> t) {
   SetProtoMethod(env->isolate(), t, "recvStop", RecvStop);
 }
 
-UDPWrap::UDPWrap(Environment* env, Local<Object> object)
+UDPWrap::UDPWrap(Environment* env, Local<Object> object, bool recvmmsg)
     : HandleWrap(env,
                  object,
                  reinterpret_cast<uv_handle_t*>(&handle_),
@@ -122,7 +156,10 @@ UDPWrap::UDPWrap(Environment* env, Local<Object> object)
   object->SetAlignedPointerInInternalField(
       UDPWrapBase::kUDPWrapBaseField, static_cast<UDPWrapBase*>(this));
 
-  int r = uv_udp_init(env->event_loop(), &handle_);
+  // libuv falls back to recvmsg() where recvmmsg() is not available.
+  int r = uv_udp_init_ex(env->event_loop(),
+                         &handle_,
+                         AF_UNSPEC | (recvmmsg ? UV_UDP_RECVMMSG : 0));
   CHECK_EQ(r, 0);  // can't fail anyway
 
   set_listener(this);
@@ -161,6 +198,8 @@ void UDPWrap::Initialize(Local<Object> target,
   SetProtoMethod(isolate, t, "bind6", Bind6);
   SetProtoMethod(isolate, t, "connect6", Connect6);
   SetProtoMethod(isolate, t, "send6", Send6);
+  SetProtoMethod(isolate, t, "sendBatch", SendBatch);
+  SetProtoMethod(isolate, t, "sendBatch6", SendBatch6);
   SetProtoMethod(isolate, t, "disconnect", Disconnect);
   SetProtoMethod(isolate,
                  t,
@@ -185,6 +224,7 @@ void UDPWrap::Initialize(Local<Object> target,
   SetProtoMethodNoSideEffect(isolate, t, "getSendQueueSize", GetSendQueueSize);
   SetProtoMethodNoSideEffect(
       isolate, t, "getSendQueueCount", GetSendQueueCount);
+  SetProtoMethod(isolate, t, "enableRecvBatch", EnableRecvBatch);
 
   t->Inherit(HandleWrap::GetConstructorTemplate(env));
 
@@ -206,10 +246,30 @@ void UDPWrap::Initialize(Local<Object> target,
 }
 
 
+// new UDP(recvmmsg)
 void UDPWrap::New(const FunctionCallbackInfo<Value>& args) {
   CHECK(args.IsConstructCall());
   Environment* env = Environment::GetCurrent(args);
-  new UDPWrap(env, args.This());
+  new UDPWrap(env, args.This(), args[0]->IsTrue());
+}
+
+// Switches to receiving datagrams in batches, and returns the Uint32Array
+// that their fields are written to. Must be called before recvStart().
+void UDPWrap::EnableRecvBatch(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  UDPWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
+
+  constexpr size_t kRecordsLength = kRecvBatchSize * kRecvBatchFieldCount;
+  if (!wrap->recv_batch_) {
+    wrap->recv_batch_ = true;
+    wrap->recv_batch_entries_.reserve(kRecvBatchSize);
+    wrap->recv_batch_records_ = ArrayBuffer::NewBackingStore(
+        env->isolate(), kRecordsLength * sizeof(uint32_t));
+  }
+  Local<ArrayBuffer> ab =
+      ArrayBuffer::New(env->isolate(), wrap->recv_batch_records_);
+  args.GetReturnValue().Set(Uint32Array::New(ab, 0, kRecordsLength));
 }
 
 
@@ -611,6 +671,287 @@ ssize_t UDPWrap::Send(uv_buf_t* bufs_ptr,
 }
 
 
+void UDPWrap::DoSendBatch(const FunctionCallbackInfo<Value>& args,
+                          int family) {
+  Environment* env = Environment::GetCurrent(args);
+
+  UDPWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap,
+                          args.Holder(),
+                          args.GetReturnValue().Set(UV_EBADF));
+
+  // sendBatch(req, list, list.length, ports, addresses, segment, hasCallback)
+  // `ports` and `addresses` are undefined for connected sockets.
+  CHECK_EQ(args.Length(), 7);
+  CHECK(args[0]->IsObject());
+  CHECK(args[1]->IsArray());
+  CHECK(args[2]->IsUint32());
+  CHECK(args[5]->IsBoolean());
+  CHECK(args[6]->IsBoolean());
+
+  Local<Context> context = env->context();
+  Local<Array> chunks = args[1].As<Array>();
+  size_t count = args[2].As<Uint32>()->Value();
+  bool sendto = args[3]->IsArray();
+  if (sendto) CHECK(args[4]->IsArray());
+
+  MaybeStackBuffer<uv_buf_t, 16> bufs(count);
+  MaybeStackBuffer<sockaddr_storage, 16> addrs(sendto ? count : 0);
+  Local<Value> last_address;
+  uint32_t last_port = 0;
+  for (size_t i = 0; i < count; i++) {
+    Local<Value> chunk;
+    if (!chunks->Get(context, i).ToLocal(&chunk)) return;
+    bufs[i] = uv_buf_init(Buffer::Data(chunk), Buffer::Length(chunk));
+
+    if (!sendto) continue;
+    Local<Value> port;
+    Local<Value> address;
+    if (!args[3].As<Array>()->Get(context, i).ToLocal(&port) ||
+        !args[4].As<Array>()->Get(context, i).ToLocal(&address)) {
+      return;
+    }
+    CHECK(port->IsUint32());
+    CHECK(address->IsString());
+    // Batches are often sent to a single destination, so its address is
+    // only parsed once.
+    if (i > 0 && port.As<Uint32>()->Value() == last_port &&
+        address->StrictEquals(last_address)) {
+      addrs[i] = addrs[i - 1];
+      continue;
+    }
+    last_port = port.As<Uint32>()->Value();
+    last_address = address;
+    node::Utf8Value address_string(env->isolate(), address);
+    int err = sockaddr_for_family(
+        family, address_string.out(), last_port, &addrs[i]);
+    if (err != 0) return args.GetReturnValue().Set(err);
+  }
+
+  wrap->current_send_req_wrap_ = args[0].As<Object>();
+  wrap->current_send_has_callback_ = args[6]->IsTrue();
+
+  size_t sent = 0;
+  ssize_t err = wrap->SendBatch(
+      *bufs, sendto ? *addrs : nullptr, count, args[5]->IsTrue(), &sent);
+
+  wrap->current_send_req_wrap_.Clear();
+  wrap->current_send_has_callback_ = false;
+
+  // The callback gets the error along with the number of datagrams that were
+  // sent before it, like it does when a queued datagram fails.
+  if (err < 0 &&
+      args[0]
+          .As<Object>()
+          ->Set(context,
+                env->sent_string(),
+                Number::New(env->isolate(), static_cast<double>(sent)))
+          .IsNothing()) {
+    return;
+  }
+
+  args.GetReturnValue().Set(static_cast<double>(err));
+}
+
+#ifdef __linux__
+int UDPWrap::TrySendBatch(uv_buf_t* bufs,
+                          const sockaddr_storage* addrs,
+                          size_t count,
+                          bool segment,
+                          size_t* sent) {
+  // The kernel splits a message with UDP_SEGMENT into at most 64 datagrams,
+  // and the message must still fit into one IP packet.
+  static constexpr size_t kMaxMessages = 64;
+  static constexpr size_t kMaxSegments = 64;
+  static constexpr size_t kMaxSegmentBytes = 65507;
+
+  uv_os_fd_t fd;
+  int err = uv_fileno(reinterpret_cast<uv_handle_t*>(&handle_), &fd);
+  if (err != 0) return err;
+
+  auto same_destination = [&](size_t a, size_t b) {
+    if (addrs == nullptr) return true;
+    if (addrs[a].ss_family != addrs[b].ss_family) return false;
+    // sockaddr_for_family() zeroes the parts of the address that are unused.
+    return memcmp(&addrs[a],
+                  &addrs[b],
+                  addrs[a].ss_family == AF_INET6 ? sizeof(sockaddr_in6)
+                                                 : sizeof(sockaddr_in)) == 0;
+  };
+
+  mmsghdr msgs[kMaxMessages];
+  size_t ends[kMaxMessages];
+  union {
+    char buf[CMSG_SPACE(sizeof(uint16_t))];
+    cmsghdr align;
+  } control[kMaxMessages];
+
+  // Datagrams before this index are sent one by one, after the kernel
+  // rejected them as segments of a larger message.
+  size_t unsegmented = 0;
+  size_t i = 0;
+  while (i < count) {
+    size_t n = 0;
+    for (size_t start = i; n < kMaxMessages && start < count; n++) {
+      // A run of datagrams to the same destination is sent as one message if
+      // all of them but the last one have the same size.
+      size_t end = start + 1;
+      size_t segment_size = bufs[start].len;
+      if (segment && start >= unsegmented && segment_size > 0) {
+        size_t total = segment_size;
+        while (end < count && end - start < kMaxSegments &&
+               bufs[end].len > 0 && bufs[end].len <= segment_size &&
+               total + bufs[end].len <= kMaxSegmentBytes &&
+               same_destination(start, end)) {
+          total += bufs[end].len;
+          if (bufs[end++].len < segment_size) break;
+        }
+      }
+
+      msghdr* hdr = &msgs[n].msg_hdr;
+      memset(hdr, 0, sizeof(*hdr));
+      if (addrs != nullptr) {
+        hdr->msg_name = const_cast<sockaddr_storage*>(&addrs[start]);
+        hdr->msg_namelen = addrs[start].ss_family == AF_INET6
+                               ? sizeof(sockaddr_in6)
+                               : sizeof(sockaddr_in);
+      }
+      // uv_buf_t has the same layout as struct iovec.
+      hdr->msg_iov = reinterpret_cast<iovec*>(&bufs[start]);
+      hdr->msg_iovlen = end - start;
+      if (end - start > 1) {
+        hdr->msg_control = control[n].buf;
+        hdr->msg_controllen = sizeof(control[n].buf);
+        cmsghdr* cmsg = CMSG_FIRSTHDR(hdr);
+        cmsg->cmsg_level = SOL_UDP;
+        cmsg->cmsg_type = UDP_SEGMENT;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+        uint16_t size = static_cast<uint16_t>(segment_size);
+        memcpy(CMSG_DATA(cmsg), &size, sizeof(size));
+      }
+      ends[n] = end;
+      start = end;
+    }
+
+    int r;
+    do {
+      r = sendmmsg(fd, msgs, n, 0);
+    } while (r == -1 && errno == EINTR);
+
+    if (r == -1) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) break;
+      // Kernels without UDP GSO, and devices that can't offload checksums,
+      // reject segmented messages. So do segments that exceed the MTU.
+      if (ends[0] - i > 1 &&
+          (errno == EINVAL || errno == EIO || errno == ENOPROTOOPT)) {
+        unsegmented = ends[0];
+        continue;
+      }
+      *sent = i;
+      return uv_translate_sys_error(errno);
+    }
+    i = ends[r - 1];
+  }
+
+  *sent = i;
+  return 0;
+}
+#else
+int UDPWrap::TrySendBatch(uv_buf_t* bufs,
+                          const sockaddr_storage* addrs,
+                          size_t count,
+                          bool segment,
+                          size_t* sent) {
+  size_t i = 0;
+  for (; i < count; i++) {
+    int err = uv_udp_try_send(
+        &handle_,
+        &bufs[i],
+        1,
+        addrs != nullptr ? reinterpret_cast<const sockaddr*>(&addrs[i])
+                         : nullptr);
+    if (err == UV_ENOSYS || err == UV_EAGAIN) break;
+    if (err < 0) {
+      *sent = i;
+      return err;
+    }
+  }
+  *sent = i;
+  return 0;
+}
+#endif  // __linux__
+
+ssize_t UDPWrap::SendBatch(uv_buf_t* bufs,
+                           const sockaddr_storage* addrs,
+                           size_t count,
+                           bool segment,
+                           size_t* sent_out) {
+  *sent_out = 0;
+  if (IsHandleClosing()) return UV_EBADF;
+
+  // Datagrams that are already in the libuv send queue have to be sent first.
+  size_t sent = 0;
+  if (handle_.send_queue_count == 0 &&
+      !UNLIKELY(env()->options()->test_udp_no_try_send)) {
+    int err = TrySendBatch(bufs, addrs, count, segment, &sent);
+    if (err != 0) {
+      *sent_out = sent;
+      return err;
+    }
+    if (sent == count) return count + 1;
+  }
+
+  AsyncHooks::DefaultTriggerAsyncIdScope trigger_scope(this);
+  SendBatchWrap* req_wrap = new SendBatchWrap(env(),
+                                              current_send_req_wrap_,
+                                              current_send_has_callback_,
+                                              count - sent);
+  req_wrap->sent = sent;
+  int err = 0;
+  for (size_t i = sent; i < count; i++) {
+    uv_udp_send_t* req = &req_wrap->reqs[req_wrap->pending];
+    req->data = req_wrap;
+    err = uv_udp_send(
+        req,
+        &handle_,
+        &bufs[i],
+        1,
+        addrs != nullptr ? reinterpret_cast<const sockaddr*>(&addrs[i])
+                         : nullptr,
+        [](uv_udp_send_t* req, int status) {
+          UDPWrap* self = ContainerOf(&UDPWrap::handle_, req->handle);
+          SendBatchWrap* req_wrap = static_cast<SendBatchWrap*>(req->data);
+          if (status < 0) {
+            if (req_wrap->status == 0) req_wrap->status = status;
+          } else {
+            req_wrap->sent++;
+          }
+          if (--req_wrap->pending == 0) self->OnSendBatchDone(req_wrap);
+        });
+    if (err) break;
+    req_wrap->pending++;
+  }
+
+  if (req_wrap->pending == 0) {
+    delete req_wrap;
+    *sent_out = sent;
+    return err;
+  }
+  req_wrap->status = err;
+  req_wrap->ClearWeak();
+  env()->IncreaseWaitingRequestCounter();
+  return 0;
+}
+
+void UDPWrap::SendBatch(const FunctionCallbackInfo<Value>& args) {
+  DoSendBatch(args, AF_INET);
+}
+
+void UDPWrap::SendBatch6(const FunctionCallbackInfo<Value>& args) {
+  DoSendBatch(args, AF_INET6);
+}
+
+
 ReqWrap<uv_udp_send_t>* UDPWrap::CreateSendWrap(size_t msg_size) {
   SendWrap* req_wrap = new SendWrap(env(),
                                     current_send_req_wrap_,
@@ -683,6 +1024,22 @@ void UDPWrap::OnSendDone(ReqWrap<uv_udp_send_t>* req, int status) {
 }
 
 
+void UDPWrap::OnSendBatchDone(SendBatchWrap* req) {
+  BaseObjectPtr<SendBatchWrap> req_wrap{req};
+  req_wrap->Detach();
+  env()->DecreaseWaitingRequestCounter();
+  if (req_wrap->have_callback()) {
+    HandleScope handle_scope(env()->isolate());
+    Context::Scope context_scope(env()->context());
+    Local<Value> arg[] = {
+      Integer::New(env()->isolate(), req_wrap->status),
+      Number::New(env()->isolate(), static_cast<double>(req_wrap->sent)),
+    };
+    req_wrap->MakeCallback(env()->oncomplete_string(), arraysize(arg), arg);
+  }
+}
+
+
 void UDPWrap::OnAlloc(uv_handle_t* handle,
                       size_t suggested_size,
                       uv_buf_t* buf) {
@@ -692,6 +1049,10 @@ void UDPWrap::OnAlloc(uv_handle_t* handle,
 }
 
 uv_buf_t UDPWrap::OnAlloc(size_t suggested_size) {
+  if (recv_batch_) {
+    if (!recv_slab_) recv_slab_.reset(new char[kRecvSlabSize]);
+    return uv_buf_init(recv_slab_.get(), kRecvSlabSize);
+  }
   return env()->allocate_managed_buffer(suggested_size);
 }
 
@@ -708,6 +1069,12 @@ void UDPWrap::OnRecv(ssize_t nread,
                      const uv_buf_t& buf_,
                      const sockaddr* addr,
                      unsigned int flags) {
+  // Buffers from before the switch to batches are passed on one by one.
+  if (recv_slab_ && buf_.base >= recv_slab_.get() &&
+      buf_.base < recv_slab_.get() + kRecvSlabSize) {
+    return OnRecvBatch(nread, buf_, addr, flags);
+  }
+
   Environment* env = this->env();
   Isolate* isolate = env->isolate();
   std::unique_ptr<BackingStore> bs = env->release_managed_buffer(buf_);
@@ -776,6 +1143,164 @@ void UDPWrap::OnRecv(ssize_t nread,
   MakeCallback(env->onmessage_string(), arraysize(argv), argv);
 }
 
+void UDPWrap::OnRecvBatch(ssize_t nread,
+                          const uv_buf_t& buf,
+                          const sockaddr* addr,
+                          unsigned int flags) {
+  if (nread > 0 || (nread == 0 && addr != nullptr)) {
+    RecvBatchEntry entry;
+    entry.offset = buf.base - recv_slab_.get();
+    entry.length = nread;
+    entry.flags = flags;
+    memcpy(&entry.address,
+           addr,
+           addr->sa_family == AF_INET6 ? sizeof(sockaddr_in6)
+                                       : sizeof(sockaddr_in));
+    recv_batch_entries_.push_back(entry);
+    // Without recvmmsg(), each datagram is read on its own.
+    if (!(flags & UV_UDP_MMSG_CHUNK)) FlushRecvBatch();
+    return;
+  }
+
+  // Sent after all datagrams that recvmmsg() read.
+  if (flags & UV_UDP_MMSG_FREE) return FlushRecvBatch();
+
+  // Nothing to read.
+  if (nread == 0) return;
+
+  Environment* env = this->env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+  Local<Value> argv[] = {
+      Integer::New(env->isolate(), static_cast<int32_t>(nread)),
+      object(),
+      Undefined(env->isolate()),
+      Undefined(env->isolate())};
+  MakeCallback(env->onmessage_string(), arraysize(argv), argv);
+}
+
+namespace {
+
+// Formats the address like AddressToJS() does.
+Local<String> AddressToString(Isolate* isolate, const sockaddr* addr) {
+  char ip[INET6_ADDRSTRLEN + UV_IF_NAMESIZE];
+  if (addr->sa_family == AF_INET6) {
+    const sockaddr_in6* a6 = reinterpret_cast<const sockaddr_in6*>(addr);
+    uv_inet_ntop(AF_INET6, &a6->sin6_addr, ip, sizeof ip);
+    // Add an interface identifier to a link local address.
+    if (IN6_IS_ADDR_LINKLOCAL(&a6->sin6_addr) && a6->sin6_scope_id > 0) {
+      const size_t addrlen = strlen(ip);
+      size_t scopeidlen = sizeof(ip) - addrlen - 1;
+      ip[addrlen] = '%';
+      if (uv_if_indextoiid(a6->sin6_scope_id,
+                           ip + addrlen + 1,
+                           &scopeidlen) != 0) {
+        ip[addrlen] = '\0';
+      }
+    }
+  } else {
+    const sockaddr_in* a4 = reinterpret_cast<const sockaddr_in*>(addr);
+    uv_inet_ntop(AF_INET, &a4->sin_addr, ip, sizeof ip);
+  }
+  return OneByteString(isolate, ip);
+}
+
+bool SameAddress(const sockaddr_storage& a, const sockaddr_storage& b) {
+  if (a.ss_family != b.ss_family) return false;
+  if (a.ss_family == AF_INET6) {
+    const sockaddr_in6& a6 = reinterpret_cast<const sockaddr_in6&>(a);
+    const sockaddr_in6& b6 = reinterpret_cast<const sockaddr_in6&>(b);
+    return memcmp(&a6.sin6_addr, &b6.sin6_addr, sizeof(a6.sin6_addr)) == 0 &&
+           a6.sin6_scope_id == b6.sin6_scope_id;
+  }
+  const sockaddr_in& a4 = reinterpret_cast<const sockaddr_in&>(a);
+  const sockaddr_in& b4 = reinterpret_cast<const sockaddr_in&>(b);
+  return a4.sin_addr.s_addr == b4.sin_addr.s_addr;
+}
+
+}  // anonymous namespace
+
+void UDPWrap::FlushRecvBatch() {
+  if (recv_batch_entries_.empty()) return;
+  std::vector<RecvBatchEntry> entries;
+  entries.swap(recv_batch_entries_);
+  recv_batch_entries_.reserve(kRecvBatchSize);
+
+  Environment* env = this->env();
+  Isolate* isolate = env->isolate();
+  HandleScope handle_scope(isolate);
+  Context::Scope context_scope(env->context());
+
+  // Copy the datagrams out of the slab, which is reused for the next batch,
+  // into one Buffer that is exactly as large as they are.
+  size_t total = 0;
+  for (const RecvBatchEntry& entry : entries) total += entry.length;
+  std::unique_ptr<BackingStore> bs;
+  {
+    NoArrayBufferZeroFillScope no_zero_fill_scope(env->isolate_data());
+    bs = ArrayBuffer::NewBackingStore(isolate, total);
+  }
+
+  // Datagrams from the same sender share one address string.
+  std::vector<Local<Value>> addresses;
+  std::vector<size_t> address_entries;
+  uint32_t* records = static_cast<uint32_t*>(recv_batch_records_->Data());
+  size_t offset = 0;
+  for (size_t i = 0; i < entries.size(); i++) {
+    const RecvBatchEntry& entry = entries[i];
+    if (entry.length > 0) {
+      memcpy(static_cast<char*>(bs->Data()) + offset,
+             recv_slab_.get() + entry.offset,
+             entry.length);
+    }
+
+    size_t address = 0;
+    while (address < addresses.size() &&
+           !SameAddress(entries[address_entries[address]].address,
+                        entry.address)) {
+      address++;
+    }
+    if (address == addresses.size()) {
+      addresses.push_back(AddressToString(
+          isolate, reinterpret_cast<const sockaddr*>(&entry.address)));
+      address_entries.push_back(i);
+    }
+
+    const bool ipv6 = entry.address.ss_family == AF_INET6;
+    uint32_t* record = records + i * kRecvBatchFieldCount;
+    record[kRecvBatchOffset] = offset;
+    record[kRecvBatchLength] = entry.length;
+    record[kRecvBatchPort] = ntohs(
+        ipv6 ? reinterpret_cast<const sockaddr_in6&>(entry.address).sin6_port
+             : reinterpret_cast<const sockaddr_in&>(entry.address).sin_port);
+    record[kRecvBatchFamily] = ipv6 ? 6 : 4;
+    record[kRecvBatchFlags] = entry.flags & UV_UDP_PARTIAL;
+    record[kRecvBatchAddress] = address;
+    offset += entry.length;
+  }
+
+  Local<ArrayBuffer> ab = ArrayBuffer::New(isolate, std::move(bs));
+  Local<Value> argv[] = {
+      Integer::NewFromUnsigned(isolate, entries.size()),
+      Undefined(isolate),
+      Array::New(isolate, addresses.data(), addresses.size()),
+  };
+  Local<Value> error;
+  {
+    TryCatchScope try_catch(env);
+    if (!Buffer::New(env, ab, 0, total).ToLocal(&argv[1])) {
+      DCHECK(try_catch.HasCaught() && !try_catch.HasTerminated());
+      error = try_catch.Exception();
+    }
+  }
+  if (!error.IsEmpty()) {
+    Local<Value> error_argv[] = {Integer::New(isolate, 0), object(), error};
+    MakeCallback(env->onerror_string(), arraysize(error_argv), error_argv);
+    return;
+  }
+  MakeCallback(env->onbatch_string(), arraysize(argv), argv);
+}
+
 MaybeLocal<Object> UDPWrap::Instantiate(Environment* env,
                                         AsyncWrap* parent,
                                         UDPWrap::SocketType type) {
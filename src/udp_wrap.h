@@ -30,8 +30,12 @@
 #include "uv.h"
 #include "v8.h"
 
+#include <memory>
+#include <vector>
+
 namespace node {
 
+class SendBatchWrap;
 class UDPWrapBase;
 
 // A listener that can be attached to an `UDPWrapBase` object and generally
@@ -135,6 +139,8 @@ class UDPWrap final : public HandleWrap,
   static void Bind6(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Connect6(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Send6(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SendBatch(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SendBatch6(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Disconnect(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void AddMembership(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void DropMembership(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -153,6 +159,26 @@ class UDPWrap final : public HandleWrap,
   static void GetSendQueueSize(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void GetSendQueueCount(
       const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void EnableRecvBatch(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  // Datagrams that are received together are passed to JS at once, when
+  // receiving in batches. libuv's recvmmsg() reads at most this many at a
+  // time, each into a slot of the largest possible datagram size.
+  static constexpr size_t kRecvBatchSize = 20;
+  static constexpr size_t kMaxDatagramSize = 64 * 1024;
+  static constexpr size_t kRecvSlabSize = kRecvBatchSize * kMaxDatagramSize;
+
+  // Fields of each datagram in the records array returned by
+  // enableRecvBatch(). Keep in sync with lib/internal/dgram.js.
+  enum RecvBatchField {
+    kRecvBatchOffset,
+    kRecvBatchLength,
+    kRecvBatchPort,
+    kRecvBatchFamily,
+    kRecvBatchFlags,
+    kRecvBatchAddress,
+    kRecvBatchFieldCount
+  };
 
   // UDPListener implementation
   uv_buf_t OnAlloc(size_t suggested_size) override;
@@ -175,6 +201,17 @@ class UDPWrap final : public HandleWrap,
 
   AsyncWrap* GetAsyncWrap() override;
 
+  // Sends `count` datagrams, each with a single buffer, to `addrs` or to the
+  // connected peer if it is nullptr. Returns `count + 1` if all of them were
+  // sent synchronously, 0 if some were queued, and an error code otherwise,
+  // in which case `sent` is set to the number of datagrams sent before the
+  // error.
+  ssize_t SendBatch(uv_buf_t* bufs,
+                    const sockaddr_storage* addrs,
+                    size_t count,
+                    bool segment,
+                    size_t* sent);
+
   static v8::MaybeLocal<v8::Object> Instantiate(Environment* env,
                                                 AsyncWrap* parent,
                                                 SocketType type);
@@ -189,7 +226,7 @@ class UDPWrap final : public HandleWrap,
             int (*F)(const typename T::HandleType*, sockaddr*, int*)>
   friend void GetSockOrPeerName(const v8::FunctionCallbackInfo<v8::Value>&);
 
-  UDPWrap(Environment* env, v8::Local<v8::Object> object);
+  UDPWrap(Environment* env, v8::Local<v8::Object> object, bool recvmmsg);
 
   static void DoBind(const v8::FunctionCallbackInfo<v8::Value>& args,
                      int family);
@@ -197,6 +234,8 @@ class UDPWrap final : public HandleWrap,
                      int family);
   static void DoSend(const v8::FunctionCallbackInfo<v8::Value>& args,
                      int family);
+  static void DoSendBatch(const v8::FunctionCallbackInfo<v8::Value>& args,
+                          int family);
   static void SetMembership(const v8::FunctionCallbackInfo<v8::Value>& args,
                             uv_membership membership);
   static void SetSourceMembership(
@@ -212,8 +251,39 @@ class UDPWrap final : public HandleWrap,
                      const struct sockaddr* addr,
                      unsigned int flags);
 
+  void OnRecvBatch(ssize_t nread,
+                   const uv_buf_t& buf,
+                   const sockaddr* addr,
+                   unsigned int flags);
+  void FlushRecvBatch();
+
+  // Sends datagrams from the start of `bufs` until the socket buffer is full,
+  // without going through the libuv send queue. Stores how many were sent in
+  // `sent`, and returns an error code if sending one of them failed.
+  int TrySendBatch(uv_buf_t* bufs,
+                   const sockaddr_storage* addrs,
+                   size_t count,
+                   bool segment,
+                   size_t* sent);
+  void OnSendBatchDone(SendBatchWrap* req_wrap);
+
   uv_udp_t handle_;
 
+  struct RecvBatchEntry {
+    size_t offset;  // In recv_slab_.
+    size_t length;
+    unsigned int flags;
+    sockaddr_storage address;
+  };
+
+  // Set by enableRecvBatch(). Datagrams are then read into recv_slab_, which
+  // is reused, and are passed to `onbatch(count, buffer, addresses)` together,
+  // with the fields of each one in recv_batch_records_.
+  bool recv_batch_ = false;
+  std::unique_ptr<char[]> recv_slab_;
+  std::vector<RecvBatchEntry> recv_batch_entries_;
+  std::shared_ptr<v8::BackingStore> recv_batch_records_;
+
   bool current_send_has_callback_;
   v8::Local<v8::Object> current_send_req_wrap_;
 };
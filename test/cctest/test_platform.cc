@@ -1,6 +1,7 @@
 #include "node_internals.h"
 #include "libplatform/libplatform.h"
 
+#include <atomic>
 #include <string>
 #include "gtest/gtest.h"
 #include "node_test_fixture.h"
@@ -123,3 +124,54 @@ TEST_F(PlatformTest, TracingControllerNullptr) {
   node::SetTracingController(orig_controller);
   EXPECT_EQ(node::GetTracingController(), orig_controller);
 }
+
+// This task increments the given counter, and posts another task to the
+// worker threads from a worker thread until the repost counter reaches zero.
+class WorkerRepostingTask : public v8::Task {
+ public:
+  WorkerRepostingTask(int repost_count,
+                      std::atomic<int>* run_count,
+                      node::NodePlatform* platform)
+      : repost_count_(repost_count),
+        run_count_(run_count),
+        platform_(platform) {}
+
+  void Run() final {
+    ++*run_count_;
+    if (repost_count_ > 0) {
+      platform_->CallOnWorkerThread(std::make_unique<WorkerRepostingTask>(
+          repost_count_ - 1, run_count_, platform_));
+    }
+  }
+
+ private:
+  int repost_count_;
+  std::atomic<int>* run_count_;
+  node::NodePlatform* platform_;
+};
+
+TEST_F(PlatformTest, WorkerTaskStatistics) {
+  // More tasks than fit into the bounded per-thread queues at once.
+  constexpr int kTasks = 4096;
+  constexpr int kReposts = 16;
+  std::atomic<int> run_count{0};
+
+  node::WorkerTaskStatistics before = platform->GetWorkerTaskStatistics();
+  for (int i = 0; i < kTasks; i++) {
+    platform->CallOnWorkerThread(
+        std::make_unique<WorkerRepostingTask>(0, &run_count, platform.get()));
+  }
+  platform->CallOnWorkerThread(std::make_unique<WorkerRepostingTask>(
+      kReposts, &run_count, platform.get()));
+  platform->DrainTasks(isolate_);
+
+  EXPECT_EQ(kTasks + kReposts + 1, run_count);
+  node::WorkerTaskStatistics after = platform->GetWorkerTaskStatistics();
+  EXPECT_EQ(after.posted - before.posted,
+            static_cast<uint64_t>(kTasks + kReposts + 1));
+  EXPECT_EQ(after.started - before.started,
+            static_cast<uint64_t>(kTasks + kReposts + 1));
+  EXPECT_LE(after.stolen - before.stolen, after.started - before.started);
+  EXPECT_GE(after.total_wait_ns, before.total_wait_ns);
+  EXPECT_LE(after.max_wait_ns, after.total_wait_ns);
+}
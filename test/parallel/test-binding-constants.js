@@ -7,7 +7,12 @@ const constants = internalBinding('constants');
 const assert = require('assert');
 
 assert.deepStrictEqual(
-  Object.keys(constants).sort(), ['crypto', 'fs', 'os', 'trace', 'zlib']
+  Object.keys(constants).sort(),
+  ['crypto', 'fs', 'os', 'threadpool', 'trace', 'zlib']
+);
+
+assert.deepStrictEqual(
+  constants.threadpool.classes, ['fs', 'crypto', 'compression', 'dns', 'user']
 );
 
 assert.deepStrictEqual(
@@ -28,6 +33,7 @@ function test(obj) {
 }
 
 [
-  constants, constants.crypto, constants.fs, constants.os, constants.trace,
-  constants.zlib, constants.os.dlopen, constants.os.errno, constants.os.signals,
+  constants, constants.crypto, constants.fs, constants.os, constants.threadpool,
+  constants.trace, constants.zlib, constants.os.dlopen, constants.os.errno,
+  constants.os.signals,
 ].forEach(test);
@@ -0,0 +1,72 @@
+'use strict';
+
+// Sockets created with `receiveBatch` emit the datagrams that were read at
+// once as a 'messages' batch, and still emit 'message' for each of them.
+
+const common = require('../common');
+const assert = require('assert');
+const dgram = require('dgram');
+
+const payloads = [
+  Buffer.from('first'),
+  Buffer.alloc(0),
+  Buffer.alloc(1500, 'x'),
+  Buffer.from('last'),
+];
+
+const server = dgram.createSocket({ type: 'udp4', receiveBatch: true });
+const client = dgram.createSocket('udp4');
+
+const batched = [];
+const single = [];
+
+server.on('messages', common.mustCallAtLeast((batch) => {
+  assert.ok(batch.length > 0);
+  let offset = 0;
+  for (let i = 0; i < batch.length; i++) {
+    assert.strictEqual(batch.offset(i), offset);
+    offset += batch.size(i);
+    assert.strictEqual(batch.message(i).length, batch.size(i));
+    assert.strictEqual(batch.message(i).buffer, batch.buffer.buffer);
+    assert.strictEqual(batch.truncated(i), false);
+    assert.deepStrictEqual(batch.rinfo(i), {
+      address: '127.0.0.1',
+      family: 'IPv4',
+      port: client.address().port,
+      size: batch.size(i),
+    });
+    batched.push(batch.message(i));
+  }
+  assert.strictEqual(batch.buffer.length, offset);
+
+  assert.throws(() => batch.message(batch.length), {
+    code: 'ERR_OUT_OF_RANGE',
+  });
+  assert.throws(() => batch.address(-1), { code: 'ERR_OUT_OF_RANGE' });
+}));
+
+server.on('message', (msg, rinfo) => {
+  assert.strictEqual(rinfo.size, msg.length);
+  single.push(msg);
+  if (single.length < payloads.length)
+    return;
+  // Datagrams sent over the loopback interface are not reordered.
+  assert.deepStrictEqual(batched, payloads);
+  assert.deepStrictEqual(single, payloads);
+  server.close();
+  client.close();
+});
+
+server.bind(0, '127.0.0.1', common.mustCall(() => {
+  client.bind(0, '127.0.0.1', common.mustCall(() => {
+    const { port } = server.address();
+    for (const payload of payloads)
+      client.send(payload, port, '127.0.0.1');
+  }));
+}));
+
+for (const receiveBatch of [1, 'true', null]) {
+  assert.throws(() => dgram.createSocket({ type: 'udp4', receiveBatch }), {
+    code: 'ERR_INVALID_ARG_TYPE',
+  });
+}
@@ -0,0 +1,39 @@
+'use strict';
+
+// When a datagram in the middle of a batch can't be sent, the callback gets
+// the error together with the number of datagrams that were sent before it.
+
+const common = require('../common');
+if (common.isWindows)
+  common.skip('broadcasts without SO_BROADCAST are not rejected synchronously');
+const assert = require('assert');
+const dgram = require('dgram');
+
+const server = dgram.createSocket('udp4');
+server.bind(0, '127.0.0.1', common.mustCall(() => {
+  const { port } = server.address();
+  const client = dgram.createSocket('udp4');
+
+  const received = [];
+  server.on('message', common.mustCall((msg) => {
+    received.push(String(msg));
+    if (received.length < 2)
+      return;
+    assert.deepStrictEqual(received, ['a', 'b']);
+    client.close();
+    server.close();
+  }, 2));
+
+  // Sending to the broadcast address fails with EACCES, as SO_BROADCAST is
+  // not set.
+  client.sendBatch([
+    { msg: 'a', port },
+    { msg: 'b', port },
+    { msg: 'c', port, address: '255.255.255.255' },
+    { msg: 'd', port },
+  ], common.mustCall((err, sent) => {
+    assert.strictEqual(err.code, 'EACCES');
+    assert.strictEqual(err.syscall, 'send');
+    assert.strictEqual(sent, 2);
+  }));
+}));
@@ -0,0 +1,33 @@
+// Flags: --test-udp-no-try-send
+'use strict';
+
+// Batches that can't be sent right away are queued in libuv, and the
+// callback is still called once for the whole batch.
+
+const common = require('../common');
+const assert = require('assert');
+const dgram = require('dgram');
+
+const server = dgram.createSocket('udp4');
+const client = dgram.createSocket('udp4');
+
+server.bind(0, common.mustCall(() => {
+  client.connect(server.address().port, common.mustCall(() => {
+    const received = [];
+    server.on('message', (msg) => {
+      received.push(String(msg));
+      if (received.length < 4)
+        return;
+      assert.deepStrictEqual(received, ['first', 'a', 'b', 'c']);
+      client.close();
+      server.close();
+    });
+
+    client.send('first');
+    client.sendBatch([{ msg: 'a' }, { msg: 'b' }, { msg: 'c' }],
+                     common.mustSucceed((sent) => {
+                       assert.strictEqual(sent, 3);
+                     }));
+    assert.strictEqual(client.getSendQueueCount(), 4);
+  }));
+}));
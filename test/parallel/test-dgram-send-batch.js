@@ -0,0 +1,110 @@
+'use strict';
+
+// socket.sendBatch() sends all datagrams of a batch in order, with and
+// without segmentation offload, and calls the callback once.
+
+const common = require('../common');
+const assert = require('assert');
+const dgram = require('dgram');
+
+// Runs of equally sized datagrams, which are sent as one message each with
+// `segment`, followed by sizes that end or can't be part of a run.
+const payloads = [];
+for (const [size, count] of [[1200, 5], [800, 1], [0, 2], [5, 4], [100, 1]]) {
+  for (let i = 0; i < count; i++)
+    payloads.push(Buffer.alloc(size, payloads.length % 256));
+}
+
+function receive(server, count, callback) {
+  const received = [];
+  server.on('message', function onMessage(msg) {
+    received.push(msg);
+    if (received.length === count) {
+      server.removeListener('message', onMessage);
+      callback(received);
+    }
+  });
+}
+
+const server = dgram.createSocket('udp4');
+server.bind(0, '127.0.0.1', common.mustCall(() => {
+  const { port } = server.address();
+  const client = dgram.createSocket('udp4');
+  const messages = payloads.map((msg) => ({ msg, port, address: '127.0.0.1' }));
+
+  // The client is bound implicitly.
+  receive(server, payloads.length, common.mustCall((received) => {
+    assert.deepStrictEqual(received, payloads);
+
+    receive(server, payloads.length, common.mustCall((received) => {
+      assert.deepStrictEqual(received, payloads);
+
+      // Strings and the default address.
+      receive(server, 2, common.mustCall((received) => {
+        assert.deepStrictEqual(received.map(String), ['a', 'b']);
+        client.close();
+        server.close();
+      }));
+      client.sendBatch([{ msg: 'a', port }, { msg: 'b', port }]);
+    }));
+    client.sendBatch(messages, { segment: true },
+                     common.mustSucceed((sent) => {
+                       assert.strictEqual(sent, payloads.length);
+                     }));
+  }));
+  client.sendBatch(messages, common.mustSucceed((sent) => {
+    assert.strictEqual(sent, payloads.length);
+  }));
+}));
+
+{
+  // Connected sockets send to their peer.
+  const server = dgram.createSocket('udp4');
+  server.bind(0, '127.0.0.1', common.mustCall(() => {
+    const client = dgram.createSocket('udp4');
+    client.connect(server.address().port, '127.0.0.1', common.mustCall(() => {
+      assert.throws(() => {
+        client.sendBatch([{ msg: 'x', port: server.address().port }]);
+      }, { code: 'ERR_SOCKET_DGRAM_IS_CONNECTED' });
+
+      receive(server, 3, common.mustCall((received) => {
+        assert.deepStrictEqual(received.map(String), ['1', '2', '3']);
+        client.close();
+        server.close();
+      }));
+      client.sendBatch([{ msg: '1' }, { msg: '2' }, { msg: '3' }],
+                       { segment: true },
+                       common.mustSucceed((sent) => {
+                         assert.strictEqual(sent, 3);
+                       }));
+    }));
+  }));
+}
+
+{
+  const socket = dgram.createSocket('udp4');
+  for (const messages of [null, {}, 'x']) {
+    assert.throws(() => socket.sendBatch(messages), {
+      code: 'ERR_INVALID_ARG_TYPE',
+    });
+  }
+  for (const message of [null, { msg: 1, port: 1 }, { msg: 'x', port: 1,
+                                                      address: 1 }]) {
+    assert.throws(() => socket.sendBatch([message]), {
+      code: 'ERR_INVALID_ARG_TYPE',
+    });
+  }
+  assert.throws(() => socket.sendBatch([{ msg: 'x' }]), {
+    code: 'ERR_SOCKET_BAD_PORT',
+  });
+  assert.throws(() => {
+    socket.sendBatch([{ msg: 'x', port: 1, address: 'localhost' }]);
+  }, { code: 'ERR_INVALID_IP_ADDRESS' });
+  assert.throws(() => socket.sendBatch([], { segment: 1 }), {
+    code: 'ERR_INVALID_ARG_TYPE',
+  });
+  assert.throws(() => socket.sendBatch([], {}, 'callback'), {
+    code: 'ERR_INVALID_ARG_TYPE',
+  });
+  socket.close();
+}
@@ -0,0 +1,53 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const { spawnSync } = require('child_process');
+
+// Timers, I/O and workers keep working when the event loop busy polls.
+const script = `
+  const assert = require('assert');
+  const net = require('net');
+  const { Worker } = require('worker_threads');
+
+  const start = process.hrtime.bigint();
+  setTimeout(() => {
+    assert(process.hrtime.bigint() - start >= 19_000_000n);
+    const server = net.createServer((socket) => socket.pipe(socket));
+    server.listen(0, () => {
+      const socket = net.connect(server.address().port);
+      socket.end('ping');
+      socket.on('data', (data) => {
+        assert.strictEqual(data.toString(), 'ping');
+        server.close();
+      });
+    });
+    new Worker('setTimeout(() => {}, 20)', { eval: true });
+  }, 20);
+`;
+
+for (const flags of [
+  ['--event-loop-busy-poll=1000'],
+  ['--event-loop-busy-poll=50', '--socket-busy-poll=50'],
+]) {
+  const child = spawnSync(process.execPath, [...flags, '-e', script],
+                          { encoding: 'utf8' });
+  if (common.isLinux) {
+    assert.strictEqual(child.stderr, '');
+    assert.strictEqual(child.status, 0);
+  } else {
+    assert.match(child.stderr, /only supported on Linux/);
+    assert.notStrictEqual(child.status, 0);
+  }
+}
+
+for (const flag of [
+  '--event-loop-busy-poll=-1',
+  '--event-loop-busy-poll=1000001',
+  '--socket-busy-poll=-1',
+]) {
+  const child = spawnSync(process.execPath, [flag, '-e', '0'],
+                          { encoding: 'utf8' });
+  assert.notStrictEqual(child.status, 0);
+  assert.match(child.stderr, /must be between 0 and 1000000/);
+}
@@ -0,0 +1,93 @@
+'use strict';
+
+require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+const file = path.join(tmpdir.path, 'mmap.bin');
+const contents = Buffer.alloc(3 * 65536 + 123);
+for (let i = 0; i < contents.length; i++)
+  contents[i] = (i * 31) & 0xff;
+fs.writeFileSync(file, contents);
+
+{
+  const mapped = fs.mmapSync(file);
+  assert.ok(Buffer.isBuffer(mapped));
+  assert.deepStrictEqual(mapped, fs.readFileSync(file));
+}
+
+// Windows of the file, including offsets that are not page aligned and
+// lengths that extend past the end of the file.
+for (const [offset, length] of [
+  [0, 1],
+  [1, 100],
+  [4095, 2],
+  [65536, 65536],
+  [65537, 4096],
+  [contents.length - 10, 100],
+]) {
+  const mapped = fs.mmapSync(file, { offset, length });
+  assert.deepStrictEqual(mapped, contents.subarray(offset, offset + length));
+}
+
+{
+  // Writes to the mapping are private.
+  const mapped = fs.mmapSync(file, { offset: 10 });
+  mapped.fill(0);
+  assert.deepStrictEqual(fs.readFileSync(file), contents);
+  assert.deepStrictEqual(fs.mmapSync(file, { offset: 10 }),
+                         contents.subarray(10));
+}
+
+{
+  // Mapping past the end of the file, or an empty file, returns an empty
+  // Buffer.
+  assert.strictEqual(fs.mmapSync(file, { offset: contents.length }).length, 0);
+  assert.strictEqual(fs.mmapSync(file, { length: 0 }).length, 0);
+  const empty = path.join(tmpdir.path, 'empty.bin');
+  fs.writeFileSync(empty, '');
+  assert.strictEqual(fs.mmapSync(empty).length, 0);
+}
+
+{
+  // File descriptors are accepted and left open.
+  const fd = fs.openSync(file, 'r');
+  const mapped = fs.mmapSync(fd, { offset: 100, length: 100 });
+  assert.deepStrictEqual(mapped, contents.subarray(100, 200));
+  fs.fstatSync(fd);
+  fs.closeSync(fd);
+  // The mapping outlives the file descriptor.
+  assert.deepStrictEqual(mapped, contents.subarray(100, 200));
+}
+
+for (const advice of ['normal', 'sequential', 'random', 'willneed',
+                      'hugepage', ['sequential', 'willneed'], []]) {
+  assert.deepStrictEqual(fs.mmapSync(file, { advice }), contents);
+}
+
+assert.throws(() => fs.mmapSync(file, { advice: 'dontneed' }), {
+  code: 'ERR_INVALID_ARG_VALUE',
+});
+assert.throws(() => fs.mmapSync(file, { advice: ['random', 1] }), {
+  code: 'ERR_INVALID_ARG_VALUE',
+});
+for (const offset of [-1, 1.5, '1']) {
+  assert.throws(() => fs.mmapSync(file, { offset }), {
+    code: /ERR_INVALID_ARG_TYPE|ERR_OUT_OF_RANGE/,
+  });
+}
+assert.throws(() => fs.mmapSync(file, { length: -1 }), {
+  code: 'ERR_OUT_OF_RANGE',
+});
+assert.throws(() => fs.mmapSync(file, null), {
+  code: 'ERR_INVALID_ARG_TYPE',
+});
+
+assert.throws(() => fs.mmapSync(path.join(tmpdir.path, 'missing')), {
+  code: 'ENOENT',
+  syscall: 'open',
+});
@@ -0,0 +1,168 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const { openFileWriter } = fs.promises;
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+let fileCount = 0;
+function nextFile() {
+  return path.join(tmpdir.path, `writer-${fileCount++}.txt`);
+}
+
+(async () => {
+  // Small writes are collected and written by flush().
+  const file = nextFile();
+  const writer = await openFileWriter(file, { flushInterval: 60000 });
+  let expected = '';
+  for (let i = 0; i < 1000; i++) {
+    const record = `record ${i}\n`;
+    writer.write(i % 2 ? record : Buffer.from(record));
+    expected += record;
+  }
+  writer.write('ff00', 'hex');
+  expected += '\xff\x00';
+  assert.strictEqual(writer.bytesWritten, 0);
+  assert.strictEqual(writer.bytesBuffered, Buffer.byteLength(expected, 'latin1'));
+
+  await writer.flush();
+  assert.strictEqual(writer.bytesBuffered, 0);
+  assert.strictEqual(writer.bytesWritten, Buffer.byteLength(expected, 'latin1'));
+  assert.strictEqual(fs.readFileSync(file, 'latin1'), expected);
+  // Without `sync`, nothing is reported as synced.
+  assert.strictEqual(writer.bytesSynced, 0);
+  await writer.close();
+  assert.throws(() => writer.write('x'), { code: 'ERR_INVALID_STATE' });
+})().then(common.mustCall());
+
+(async () => {
+  // Data is written once highWaterMark bytes are buffered, or when the
+  // flushInterval has passed.
+  const file = nextFile();
+  const writer = await openFileWriter(file, {
+    highWaterMark: 16,
+    flushInterval: 60000,
+  });
+  writer.write('0123456789abcdef');
+  writer.write('tail');
+  while (writer.bytesWritten < 16)
+    await new Promise((resolve) => setImmediate(resolve));
+  assert.strictEqual(fs.readFileSync(file, 'utf8').slice(0, 16),
+                     '0123456789abcdef');
+  await writer.close();
+  assert.strictEqual(fs.readFileSync(file, 'utf8'), '0123456789abcdeftail');
+
+  const timed = await openFileWriter(nextFile(), { flushInterval: 1 });
+  timed.write('timed');
+  while (timed.bytesWritten < 5)
+    await new Promise((resolve) => setTimeout(resolve, 1));
+  await timed.close();
+})().then(common.mustCall());
+
+(async () => {
+  // write() returns false once more than highWaterMark bytes are not written
+  // yet, and true again after flush().
+  const file = nextFile();
+  const writer = await openFileWriter(file, {
+    highWaterMark: 16,
+    flushInterval: 60000,
+  });
+  assert.strictEqual(writer.write('01234567'), true);
+  assert.strictEqual(writer.write('89abcdef'), true);
+  assert.strictEqual(writer.write('x'), false);
+  assert.strictEqual(writer.write(Buffer.from('y')), false);
+  await writer.flush();
+  assert.strictEqual(writer.bytesBuffered, 0);
+  assert.strictEqual(writer.write('z'), true);
+  await writer.close();
+  assert.strictEqual(fs.readFileSync(file, 'utf8'), '0123456789abcdefxyz');
+})().then(common.mustCall());
+
+(async () => {
+  // With `sync`, flush() waits for the data to be synced.
+  const file = nextFile();
+  const writer = await openFileWriter(file, { sync: true });
+  const flushes = [];
+  for (let i = 0; i < 10; i++) {
+    writer.write(`${i}`);
+    flushes.push(writer.flush());
+  }
+  await Promise.all(flushes);
+  assert.strictEqual(writer.bytesSynced, 10);
+  assert.strictEqual(writer.bytesWritten, 10);
+  await writer.close();
+  assert.strictEqual(fs.readFileSync(file, 'utf8'), '0123456789');
+})().then(common.mustCall());
+
+(async () => {
+  // `start` writes at a position of an existing file.
+  const file = nextFile();
+  fs.writeFileSync(file, 'xxxxxxxxxx');
+  const writer = await openFileWriter(file, { flags: 'r+', start: 2 });
+  writer.write('ab');
+  await writer.flush();
+  writer.write('cd');
+  await writer.close();
+  assert.strictEqual(fs.readFileSync(file, 'utf8'), 'xxabcdxxxx');
+})().then(common.mustCall());
+
+(async () => {
+  // Errors reject pending and later flushes, and are thrown by write().
+  const file = nextFile();
+  fs.writeFileSync(file, '');
+  const writer = await openFileWriter(file, { flags: 'r' });
+  writer.write('data');
+  await assert.rejects(writer.flush(), { code: 'EBADF', syscall: 'write' });
+  assert.throws(() => writer.write('more'), { code: 'EBADF' });
+  await assert.rejects(writer.close(), { code: 'EBADF' });
+})().then(common.mustCall());
+
+if (common.isLinux) {
+  (async () => {
+    // Direct writes are padded to whole blocks and the file is truncated to
+    // the real size after each of them.
+    const file = nextFile();
+    let writer;
+    try {
+      writer = await openFileWriter(file, { direct: true, blockSize: 4096 });
+    } catch (err) {
+      // Not every file system supports O_DIRECT.
+      assert.strictEqual(err.code, 'EINVAL');
+      return;
+    }
+    const chunk = Buffer.alloc(3000, 'a');
+    const expected = [];
+    for (let i = 0; i < 5; i++) {
+      chunk.fill(97 + i);
+      writer.write(chunk);
+      expected.push(Buffer.from(chunk));
+      await writer.flush();
+      assert.strictEqual(fs.statSync(file).size, 3000 * (i + 1));
+    }
+    await writer.close();
+    assert.deepStrictEqual(fs.readFileSync(file), Buffer.concat(expected));
+  })().then(common.mustCall());
+}
+
+(async () => {
+  const file = nextFile();
+  for (const [options, code] of [
+    [null, 'ERR_INVALID_ARG_TYPE'],
+    [{ highWaterMark: 0 }, 'ERR_OUT_OF_RANGE'],
+    [{ flushInterval: -1 }, 'ERR_OUT_OF_RANGE'],
+    [{ blockSize: 1000 }, 'ERR_INVALID_ARG_VALUE'],
+    [{ start: -1 }, 'ERR_OUT_OF_RANGE'],
+    [{ sync: 1 }, 'ERR_INVALID_ARG_TYPE'],
+    [{ direct: 'yes' }, 'ERR_INVALID_ARG_TYPE'],
+  ]) {
+    await assert.rejects(openFileWriter(file, options), { code });
+  }
+
+  const writer = await openFileWriter(file);
+  assert.throws(() => writer.write(1), { code: 'ERR_INVALID_ARG_TYPE' });
+  await writer.close();
+})().then(common.mustCall());
@@ -0,0 +1,113 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../common/tmpdir');
+
+// This test ensures that fs.readdir() with `recursive: true` lists a whole
+// directory tree, and that `include` and `exclude` filter its entries.
+
+tmpdir.refresh();
+
+const root = path.join(tmpdir.path, 'tree');
+const files = [
+  'a.js',
+  'b.txt',
+  path.join('dir1', 'c.js'),
+  path.join('dir1', 'dir2', 'd.js'),
+  path.join('dir1', 'dir2', 'e.txt'),
+  path.join('node_modules', 'pkg', 'index.js'),
+];
+const dirs = ['dir1', path.join('dir1', 'dir2'), 'node_modules',
+              path.join('node_modules', 'pkg'), 'empty'];
+for (const dir of dirs)
+  fs.mkdirSync(path.join(root, dir), { recursive: true });
+for (const file of files)
+  fs.writeFileSync(path.join(root, file), '');
+// Enough entries for several batches and jobs.
+const wide = 'wide';
+for (let i = 0; i < 20; i++) {
+  const dir = path.join(wide, `${i}`);
+  fs.mkdirSync(path.join(root, dir), { recursive: true });
+  dirs.push(dir);
+  for (let j = 0; j < 300; j++) {
+    const file = path.join(dir, `${j}.txt`);
+    fs.writeFileSync(path.join(root, file), '');
+    files.push(file);
+  }
+}
+dirs.push(wide);
+
+const all = [...files, ...dirs];
+const sorted = (entries) => entries.map(String).sort();
+
+function check(options, expected, getEntries = (entries) => entries) {
+  const callback = common.mustSucceed((entries) => {
+    assert.deepStrictEqual(sorted(getEntries(entries)), sorted(expected));
+  });
+  callback(null, fs.readdirSync(root, { recursive: true, ...options }));
+  fs.readdir(root, { recursive: true, ...options }, callback);
+  fs.promises.readdir(root, { recursive: true, ...options }).then(callback);
+}
+
+check({}, all);
+check({ encoding: 'buffer' }, all, (entries) => {
+  assert(entries.every(Buffer.isBuffer));
+  return entries;
+});
+check({ include: ['*.js'] }, files.filter((f) => f.endsWith('.js')));
+check({ exclude: ['node_modules', 'wide'] },
+      all.filter((f) => !f.startsWith('node_modules') &&
+                        !f.startsWith('wide')));
+check({ include: ['?.*'], exclude: ['dir2'] },
+      ['a.js', 'b.txt', path.join('dir1', 'c.js')]);
+
+check({ withFileTypes: true }, all, (entries) => {
+  return entries.map((dirent) => {
+    assert(dirent instanceof fs.Dirent);
+    const file = path.relative(root, path.join(dirent.path, dirent.name));
+    assert.strictEqual(dirent.isDirectory(), dirs.includes(file));
+    assert.strictEqual(dirent.isFile(), files.includes(file));
+    return file;
+  });
+});
+
+// Dirents that are not read recursively don't have a path.
+assert(fs.readdirSync(root, { withFileTypes: true })
+  .every((dirent) => !('path' in dirent)));
+
+{
+  // Symbolic links are listed, but not followed.
+  const linkRoot = path.join(tmpdir.path, 'links');
+  fs.mkdirSync(linkRoot);
+  fs.writeFileSync(path.join(linkRoot, 'file'), '');
+  try {
+    fs.symlinkSync(linkRoot, path.join(linkRoot, 'loop'), 'dir');
+  } catch (err) {
+    if (err.code !== 'EPERM') throw err;
+    fs.writeFileSync(path.join(linkRoot, 'loop'), '');
+  }
+  assert.deepStrictEqual(
+    fs.readdirSync(linkRoot, { recursive: true }).sort(), ['file', 'loop']);
+}
+
+{
+  const missing = path.join(tmpdir.path, 'missing');
+  const expected = { code: 'ENOENT', syscall: 'scandir', path: missing };
+  assert.throws(() => fs.readdirSync(missing, { recursive: true }), expected);
+  fs.readdir(missing, { recursive: true }, common.expectsError(expected));
+  assert.rejects(fs.promises.readdir(missing, { recursive: true }), expected)
+    .then(common.mustCall());
+
+  const file = path.join(root, 'a.js');
+  assert.throws(() => fs.readdirSync(file, { recursive: true }), {
+    code: 'ENOTDIR',
+    path: file,
+  });
+
+  assert.throws(() => fs.readdirSync(root, { recursive: true, include: '*' }), {
+    code: 'ERR_INVALID_ARG_TYPE',
+  });
+}
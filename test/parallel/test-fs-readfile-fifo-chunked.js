@@ -0,0 +1,60 @@
+'use strict';
+
+// fs.readFile() reads files of unknown size one chunk per threadpool job, so
+// a FIFO whose writer is slow does not hold the only threadpool thread until
+// EOF, and an fs.stat() queued after it still completes in the meantime.
+
+const common = require('../common');
+if (common.isWindows)
+  common.skip('no mkfifo on Windows');
+const assert = require('assert');
+const child_process = require('child_process');
+const fs = require('fs');
+const path = require('path');
+
+if (process.argv[2] === 'child') {
+  const fifo = process.argv[3];
+  // Writes 'hello', then 'world' and EOF once the parent writes to stdin.
+  const writer = child_process.spawn(process.execPath, [
+    '-e',
+    `const fs = require('fs');
+     const fd = fs.openSync(${JSON.stringify(fifo)}, 'w');
+     fs.writeSync(fd, 'hello');
+     process.stdin.on('end', () => {
+       fs.writeSync(fd, 'world');
+       fs.closeSync(fd);
+     }).resume();`,
+  ], { stdio: ['pipe', 'inherit', 'inherit'] });
+
+  let statted = false;
+  fs.readFile(fifo, 'utf8', common.mustSucceed((data) => {
+    assert.strictEqual(data, 'helloworld');
+    assert(statted);
+  }));
+  fs.stat(__filename, common.mustSucceed(() => {
+    statted = true;
+    writer.stdin.end();
+  }));
+  return;
+}
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+const fifo = path.join(tmpdir.path, 'fifo');
+const mkfifo = child_process.spawnSync('mkfifo', [fifo]);
+if (mkfifo.error && mkfifo.error.code === 'ENOENT') {
+  common.skip('missing mkfifo');
+}
+
+const child = child_process.spawnSync(
+  process.execPath,
+  [__filename, 'child', fifo],
+  {
+    env: { ...process.env, UV_THREADPOOL_SIZE: '1' },
+    encoding: 'utf8',
+    timeout: common.platformTimeout(30_000),
+  });
+assert.strictEqual(child.stderr, '');
+assert.strictEqual(child.signal, null);
+assert.strictEqual(child.status, 0);
@@ -0,0 +1,77 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../common/tmpdir');
+
+// This test ensures that fs.readFile() and fs.readFileSync() decode files
+// read by the native implementation the same way Buffer#toString() does.
+
+tmpdir.refresh();
+
+const contents = [
+  Buffer.from('plain ascii\n'.repeat(10000)),
+  Buffer.from('naïve café ☕ 𝌆\n'.repeat(10000)),
+  // Lone surrogate, truncated sequence and overlong encoding.
+  Buffer.concat([Buffer.from('abc'),
+                 Buffer.from([0xed, 0xa0, 0x80, 0xe2, 0x82, 0xc0, 0x80])]),
+  Buffer.alloc(0),
+];
+
+contents.forEach((buffer, i) => {
+  const file = path.join(tmpdir.path, `native-${i}.txt`);
+  fs.writeFileSync(file, buffer);
+
+  assert.deepStrictEqual(fs.readFileSync(file), buffer);
+  for (const encoding of ['utf8', 'utf-8', 'latin1', 'hex', 'utf16le']) {
+    assert.strictEqual(fs.readFileSync(file, encoding),
+                       buffer.toString(encoding));
+    fs.readFile(file, encoding, common.mustSucceed((data) => {
+      assert.strictEqual(data, buffer.toString(encoding));
+    }));
+  }
+  fs.readFile(file, common.mustSucceed((data) => {
+    assert.deepStrictEqual(data, buffer);
+  }));
+});
+
+{
+  // File descriptors are read from their current position and left open.
+  const file = path.join(tmpdir.path, 'native-fd.txt');
+  fs.writeFileSync(file, 'skip this, read that');
+  const fd = fs.openSync(file, 'r');
+  fs.readSync(fd, Buffer.alloc(11));
+  assert.strictEqual(fs.readFileSync(fd, 'utf8'), 'read that');
+  assert.strictEqual(fs.readFileSync(fd, 'utf8'), '');
+  fs.closeSync(fd);
+
+  fs.open(file, 'r', common.mustSucceed((fd) => {
+    fs.readFile(fd, 'utf8', common.mustSucceed((data) => {
+      assert.strictEqual(data, 'skip this, read that');
+      fs.closeSync(fd);
+    }));
+  }));
+}
+
+{
+  const file = path.join(tmpdir.path, 'does-not-exist.txt');
+  const expected = {
+    code: 'ENOENT',
+    syscall: 'open',
+    path: file,
+  };
+  assert.throws(() => fs.readFileSync(file), expected);
+  fs.readFile(file, 'utf8', common.expectsError(expected));
+}
+
+if (common.isLinux) {
+  // Files that report a size of 0 are read until EOF.
+  const status = fs.readFileSync('/proc/self/status', 'utf8');
+  assert.match(status, /^Name:/);
+
+  const expected = { code: 'EISDIR', syscall: 'read' };
+  assert.throws(() => fs.readFileSync(tmpdir.path), expected);
+  fs.readFile(tmpdir.path, common.expectsError(expected));
+}
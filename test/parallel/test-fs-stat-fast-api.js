@@ -0,0 +1,39 @@
+'use strict';
+
+// This test ensures that fs.statSync(), fs.existsSync() and the CommonJS
+// loader keep working once V8 calls into the fast API versions of their
+// bindings, including for paths with non-ASCII Latin-1 characters.
+
+require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../common/tmpdir');
+
+tmpdir.refresh();
+
+// Only flat one-byte strings take the fast path.
+function flatten(str) {
+  return Buffer.from(str, 'latin1').toString('latin1');
+}
+
+const file = flatten(path.join(tmpdir.path, 'café.js'));
+const missing = flatten(path.join(tmpdir.path, 'missingé'));
+fs.writeFileSync(file, 'module.exports = 42;');
+
+for (let i = 0; i < 1e4; i++) {
+  assert.strictEqual(fs.statSync(file).size, 20);
+  assert.strictEqual(fs.statSync(file, { bigint: true }).size, 20n);
+  assert.strictEqual(fs.statSync(missing, { throwIfNoEntry: false }),
+                     undefined);
+  assert.strictEqual(fs.existsSync(file), true);
+  assert.strictEqual(fs.existsSync(missing), false);
+}
+
+assert.throws(() => fs.statSync(missing), {
+  code: 'ENOENT',
+  syscall: 'stat',
+  path: missing,
+});
+assert.ok(fs.statSync(tmpdir.path).isDirectory());
+assert.strictEqual(require(file), 42);
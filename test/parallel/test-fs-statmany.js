@@ -0,0 +1,99 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const { pathToFileURL } = require('url');
+const { getSystemErrorName, promisify } = require('util');
+const tmpdir = require('../common/tmpdir');
+
+// This test ensures that fs.statMany() reports the same results as
+// fs.statSync(), fs.lstatSync() and fs.accessSync() for every path.
+
+tmpdir.refresh();
+const file = path.join(tmpdir.path, 'file');
+const missing = path.join(tmpdir.path, 'missing');
+fs.writeFileSync(file, 'hello');
+const paths = [file, tmpdir.path, missing, Buffer.from(file),
+               pathToFileURL(file)];
+
+function assertStats(actual, expected) {
+  for (const key of ['dev', 'mode', 'ino', 'size', 'mtimeMs'])
+    assert.strictEqual(actual[key], expected[key], key);
+}
+
+fs.statMany(paths, common.mustSucceed((errors, stats) => {
+  assert(errors instanceof Int32Array);
+  assert.strictEqual(errors.length, paths.length);
+  assert.strictEqual(stats.length, paths.length);
+  for (let i = 0; i < paths.length; i++) {
+    if (paths[i] === missing) {
+      assert.strictEqual(getSystemErrorName(errors[i]), 'ENOENT');
+      assert.strictEqual(stats[i], undefined);
+    } else {
+      assert.strictEqual(errors[i], 0);
+      assert(stats[i] instanceof fs.Stats);
+      assertStats(stats[i], fs.statSync(paths[i]));
+    }
+  }
+}));
+
+fs.statMany([file, missing], { bigint: true },
+            common.mustSucceed((errors, stats) => {
+              assert.strictEqual(errors[0], 0);
+              assert.strictEqual(stats[0].size, 5n);
+              assertStats(stats[0], fs.statSync(file, { bigint: true }));
+              assert.strictEqual(getSystemErrorName(errors[1]), 'ENOENT');
+            }));
+
+fs.statMany([], common.mustSucceed((errors, stats) => {
+  assert.ok(errors instanceof Int32Array);
+  assert.strictEqual(errors.length, 0);
+  assert.deepStrictEqual(stats, []);
+}));
+
+fs.statMany([], { syscall: 'access' }, common.mustSucceed((errors, stats) => {
+  assert.strictEqual(errors.length, 0);
+  assert.strictEqual(stats, undefined);
+}));
+
+fs.statMany([file, missing], { syscall: 'access', mode: fs.constants.R_OK },
+            common.mustSucceed((errors, stats) => {
+              assert.strictEqual(errors[0], 0);
+              assert.strictEqual(getSystemErrorName(errors[1]), 'ENOENT');
+              assert.strictEqual(stats, undefined);
+            }));
+
+if (!common.isWindows) {
+  const link = path.join(tmpdir.path, 'link');
+  fs.symlinkSync(missing, link);
+  fs.statMany([link], { syscall: 'lstat' },
+              common.mustSucceed((errors, stats) => {
+                assert.strictEqual(errors[0], 0);
+                assert(stats[0].isSymbolicLink());
+              }));
+}
+
+promisify(fs.statMany)([file]).then(common.mustCall(({ errors, stats }) => {
+  assert.strictEqual(errors[0], 0);
+  assert.strictEqual(stats[0].size, 5);
+}));
+
+assert.throws(() => fs.statMany(file, common.mustNotCall()), {
+  code: 'ERR_INVALID_ARG_TYPE',
+});
+assert.throws(() => fs.statMany([file, 1], common.mustNotCall()), {
+  code: 'ERR_INVALID_ARG_TYPE',
+  message: /paths\[1\]/,
+});
+assert.throws(() => fs.statMany([file], { syscall: 'open' },
+                                common.mustNotCall()), {
+  code: 'ERR_INVALID_ARG_VALUE',
+});
+assert.throws(() => fs.statMany([file], { bigint: 1 }, common.mustNotCall()), {
+  code: 'ERR_INVALID_ARG_TYPE',
+});
+assert.throws(() => fs.statMany([file]), {
+  code: 'ERR_INVALID_ARG_TYPE',
+});
@@ -1,4 +1,3 @@
-// Flags: --expose-internals
 // Copyright Joyent, Inc. and other Node contributors.
 //
 // Permission is hereby granted, free of charge, to any person obtaining a
@@ -24,10 +23,8 @@
 require('../common');
 const assert = require('assert');
 const fs = require('fs');
-const { internalBinding } = require('internal/test/binding');
-const { UV_EBADF } = internalBinding('uv');
 
-// Ensure that (read|write|append)FileSync() closes the file descriptor
+// Ensure that (write|append)FileSync() closes the file descriptor
 fs.openSync = function() {
   return 42;
 };
@@ -35,22 +32,11 @@ fs.closeSync = function(fd) {
   assert.strictEqual(fd, 42);
   close_called++;
 };
-fs.readSync = function() {
-  throw new Error('BAM');
-};
 fs.writeSync = function() {
   throw new Error('BAM');
 };
 
-internalBinding('fs').fstat = function(fd, bigint, _, ctx) {
-  ctx.errno = UV_EBADF;
-  ctx.syscall = 'fstat';
-};
-
 let close_called = 0;
-ensureThrows(function() {
-  fs.readFileSync('dummy');
-}, 'EBADF: bad file descriptor, fstat');
 ensureThrows(function() {
   fs.writeFileSync('dummy', 'xxx');
 }, 'BAM');
@@ -0,0 +1,130 @@
+'use strict';
+
+const common = require('../common');
+const { setTimeout } = require('timers/promises');
+
+if (!common.isLinux)
+  common.skip('the inotify based recursive watcher is only used on Linux');
+
+const assert = require('assert');
+const path = require('path');
+const fs = require('fs');
+
+const tmpdir = require('../common/tmpdir');
+const testDir = tmpdir.path;
+tmpdir.refresh();
+
+function waitFor(watcher, expected) {
+  return new Promise((resolve) => {
+    const seen = [];
+    watcher.on('change', function listener(event, filename) {
+      seen.push(filename);
+      if (filename === expected) {
+        watcher.off('change', listener);
+        resolve(seen);
+      }
+    });
+  });
+}
+
+(async () => {
+  // Events in directories that existed before the watch was started are
+  // reported with paths relative to the watched directory.
+  const rootDirectory = fs.mkdtempSync(testDir + path.sep);
+  const deepDirectory = path.join(rootDirectory, 'a', 'b', 'c');
+  fs.mkdirSync(deepDirectory, { recursive: true });
+
+  const watcher = fs.watch(rootDirectory, { recursive: true });
+  const expected = path.join('a', 'b', 'c', 'deep.txt');
+  const seen = waitFor(watcher, expected);
+  fs.writeFileSync(path.join(rootDirectory, expected), 'deep');
+  await seen;
+  watcher.close();
+})().then(common.mustCall());
+
+(async () => {
+  // Directories created while watching are watched too, including entries
+  // that were created in them before their own watch was added.
+  const rootDirectory = fs.mkdtempSync(testDir + path.sep);
+
+  const watcher = fs.watch(rootDirectory, { recursive: true });
+  const expected = path.join('x', 'y', 'z', 'new.txt');
+  const seen = waitFor(watcher, expected);
+  fs.mkdirSync(path.join(rootDirectory, 'x', 'y', 'z'), { recursive: true });
+  fs.writeFileSync(path.join(rootDirectory, expected), 'new');
+  const filenames = await seen;
+  assert.ok(filenames.includes('x'));
+  assert.ok(filenames.includes(path.join('x', 'y')));
+  assert.ok(filenames.includes(path.join('x', 'y', 'z')));
+  watcher.close();
+})().then(common.mustCall());
+
+(async () => {
+  // A directory that is moved out of the tree is not watched anymore.
+  const rootDirectory = fs.mkdtempSync(testDir + path.sep);
+  const outside = fs.mkdtempSync(testDir + path.sep);
+  fs.mkdirSync(path.join(rootDirectory, 'leaving'));
+
+  const watcher = fs.watch(rootDirectory, { recursive: true });
+  watcher.on('change', common.mustCallAtLeast((event, filename) => {
+    assert.ok(!filename.startsWith(path.join('leaving', '')),
+              `Received ${filename}`);
+  }));
+
+  const moved = path.join(outside, 'left');
+  const seen = waitFor(watcher, 'done.txt');
+  fs.renameSync(path.join(rootDirectory, 'leaving'), moved);
+  await setTimeout(common.platformTimeout(100));
+  fs.writeFileSync(path.join(moved, 'ignored.txt'), 'ignored');
+  await setTimeout(common.platformTimeout(100));
+  fs.writeFileSync(path.join(rootDirectory, 'done.txt'), 'done');
+  await seen;
+  watcher.close();
+})().then(common.mustCall());
+
+(async () => {
+  // With a coalescing window, events for the same file are reported once.
+  const rootDirectory = fs.mkdtempSync(testDir + path.sep);
+  const filePath = path.join(rootDirectory, 'burst.txt');
+
+  const watcher = fs.watch(rootDirectory, {
+    recursive: true,
+    coalesceWindow: common.platformTimeout(200),
+  });
+  const events = [];
+  watcher.on('change', (event, filename) => events.push([event, filename]));
+
+  const fd = fs.openSync(filePath, 'w');
+  for (let i = 0; i < 10; i++)
+    fs.writeSync(fd, 'burst');
+  fs.closeSync(fd);
+
+  await setTimeout(common.platformTimeout(500));
+  assert.deepStrictEqual(events, [['rename', 'burst.txt']]);
+  watcher.close();
+})().then(common.mustCall());
+
+(async () => {
+  // The same applies to fs.promises.watch().
+  const rootDirectory = fs.mkdtempSync(testDir + path.sep);
+  fs.mkdirSync(path.join(rootDirectory, 'sub'));
+  const watcher = fs.promises.watch(rootDirectory, { recursive: true });
+
+  const expected = path.join('sub', 'promise.txt');
+  setImmediate(() => {
+    fs.writeFileSync(path.join(rootDirectory, expected), 'promise');
+  });
+  for await (const { filename } of watcher) {
+    if (filename === expected)
+      break;
+  }
+})().then(common.mustCall());
+
+{
+  const rootDirectory = fs.mkdtempSync(testDir + path.sep);
+  for (const coalesceWindow of [-1, 1.5, '10']) {
+    assert.throws(() => {
+      fs.watch(rootDirectory, { recursive: true, coalesceWindow });
+    }, { code: /ERR_INVALID_ARG_TYPE|ERR_OUT_OF_RANGE/ });
+  }
+}
@@ -0,0 +1,58 @@
+'use strict';
+
+// All StatWatchers of an environment share one poll scheduler, which stat()s
+// them in batches. Check that every watcher still sees its own changes with
+// different intervals mixed, and that a watcher can be stopped from the
+// listener of another one that is polled at the same time.
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+function createFile(name) {
+  const file = path.join(tmpdir.path, name);
+  fs.writeFileSync(file, 'a');
+  return file;
+}
+
+{
+  const intervals = [10, 20, 50];
+  const files = [];
+  for (let i = 0; i < 100; i++) {
+    const file = createFile(`many-${i}.txt`);
+    files.push(file);
+    fs.watchFile(file, {
+      interval: intervals[i % intervals.length],
+    }, common.mustCall((curr, prev) => {
+      assert.strictEqual(prev.size, 1);
+      assert.strictEqual(curr.size, 2);
+      fs.unwatchFile(file);
+    }));
+  }
+
+  // Change the files only after the initial stats have been taken.
+  setTimeout(common.mustCall(() => {
+    for (const file of files)
+      fs.appendFileSync(file, 'b');
+  }), common.platformTimeout(200));
+}
+
+{
+  const first = createFile('first.txt');
+  const second = createFile('second.txt');
+  const listener = common.mustCall(() => {
+    fs.unwatchFile(first);
+    fs.unwatchFile(second);
+  });
+  fs.watchFile(first, { interval: 10 }, listener);
+  fs.watchFile(second, { interval: 10 }, listener);
+
+  setTimeout(common.mustCall(() => {
+    fs.appendFileSync(first, 'b');
+    fs.appendFileSync(second, 'b');
+  }), common.platformTimeout(200));
+}
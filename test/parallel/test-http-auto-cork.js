@@ -0,0 +1,47 @@
+'use strict';
+
+// HTTP servers and agents turn on auto-corking for their sockets, unless
+// `autoCork: false` is passed.
+
+const common = require('../common');
+const assert = require('assert');
+const http = require('http');
+
+for (const autoCork of [undefined, false]) {
+  const server = http.createServer({ autoCork }, common.mustCall((req, res) => {
+    const { socket } = res;
+    res.write('a');
+    res.write('b');
+    res.end('c', common.mustCall(() => {
+      const { writes } = socket.autoCorkStats;
+      if (autoCork === false)
+        assert.strictEqual(writes, 0);
+      else
+        assert.ok(writes > 0);
+    }));
+  }));
+
+  server.listen(0, common.mustCall(() => {
+    const agent = new http.Agent({ autoCork });
+    http.get({
+      port: server.address().port,
+      agent,
+    }, common.mustCall((res) => {
+      let body = '';
+      res.setEncoding('utf8');
+      res.on('data', (data) => body += data);
+      res.on('end', common.mustCall(() => {
+        assert.strictEqual(body, 'abc');
+        const { writes, flushes } = res.socket.autoCorkStats;
+        if (autoCork === false) {
+          assert.strictEqual(writes, 0);
+        } else {
+          assert.ok(writes > 0);
+          assert.ok(flushes > 0 && flushes <= writes);
+        }
+        agent.destroy();
+        server.close();
+      }));
+    }));
+  }));
+}
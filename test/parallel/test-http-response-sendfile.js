@@ -0,0 +1,115 @@
+// Flags: --expose-internals
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const http = require('http');
+const path = require('path');
+const tmpdir = require('../common/tmpdir');
+const { internalBinding } = require('internal/test/binding');
+const { StreamPipe } = internalBinding('stream_pipe');
+
+// This test ensures that response.sendFile() sends (parts of) files and
+// leaves the connection usable for the next response.
+
+tmpdir.refresh();
+
+// Larger than the socket buffers, so that sending has to wait for the client.
+const data = Buffer.alloc(4 * 1024 * 1024);
+for (let i = 0; i < data.length; i++)
+  data[i] = i % 251;
+const file = path.join(tmpdir.path, 'sendfile.bin');
+fs.writeFileSync(file, data);
+const fd = fs.openSync(file, 'r');
+
+const usedSendfile = [];
+const start = StreamPipe.prototype.start;
+StreamPipe.prototype.start = function() {
+  start.call(this);
+  usedSendfile.push(this.usesSendfile());
+};
+
+const server = http.createServer(common.mustCall((req, res) => {
+  switch (req.url) {
+    case '/all':
+      res.setHeader('Content-Type', 'application/octet-stream');
+      assert.strictEqual(res.sendFile(fd, common.mustSucceed()), res);
+      break;
+    case '/range':
+      res.sendFile(fd, { offset: 1000, length: 70000 }, common.mustSucceed());
+      break;
+    case '/empty':
+      res.sendFile(fd, { offset: data.length + 1 }, common.mustSucceed());
+      break;
+    case '/head':
+      res.sendFile(fd, common.mustSucceed());
+      break;
+    case '/sent':
+      res.writeHead(200);
+      assert.throws(() => res.sendFile(fd), {
+        code: 'ERR_HTTP_HEADERS_SENT',
+      });
+      res.end();
+      break;
+  }
+}, 5));
+
+{
+  const res = new http.ServerResponse({ method: 'GET' });
+  assert.throws(() => res.sendFile('1'), { code: 'ERR_INVALID_ARG_TYPE' });
+  assert.throws(() => res.sendFile(fd, { offset: -1 }), {
+    code: 'ERR_OUT_OF_RANGE',
+  });
+}
+
+const tests = [
+  ['GET', '/all', data],
+  ['GET', '/range', data.subarray(1000, 71000)],
+  ['GET', '/empty', Buffer.alloc(0)],
+  ['HEAD', '/head', Buffer.alloc(0), data.length],
+  ['GET', '/sent', Buffer.alloc(0)],
+];
+
+server.listen(0, common.mustCall(() => {
+  const agent = new http.Agent({ keepAlive: true, maxSockets: 1 });
+  let socket;
+
+  function next() {
+    const test = tests.shift();
+    if (test === undefined) {
+      agent.destroy();
+      server.close();
+      return;
+    }
+    const [method, url, expected, length = expected.length] = test;
+    http.request({
+      agent,
+      method,
+      path: url,
+      port: server.address().port,
+    }, common.mustCall((res) => {
+      // All responses are sent on the same connection.
+      socket ??= res.socket;
+      assert.strictEqual(res.socket, socket);
+      if (url !== '/sent')
+        assert.strictEqual(res.headers['content-length'], `${length}`);
+
+      const chunks = [];
+      res.on('data', (chunk) => chunks.push(chunk));
+      res.on('end', common.mustCall(() => {
+        assert.deepStrictEqual(Buffer.concat(chunks), expected);
+        setImmediate(next);
+      }));
+    })).end();
+  }
+  next();
+}));
+
+process.on('exit', () => {
+  fs.closeSync(fd);
+  // Only the ranges that are not empty are piped.
+  assert.strictEqual(usedSendfile.length, 2);
+  if (common.isLinux)
+    assert.deepStrictEqual(usedSendfile, [true, true]);
+});
@@ -35,3 +35,34 @@ const { strictEqual } = require('assert');
   strictEqual(string, readFileSync(filename, 'utf8'));
   strictEqual(containsKeys, true);
 }
+
+{
+  const { internalModuleReadPackageJSON } = internalBinding('fs');
+  const { deepStrictEqual } = require('assert');
+  const path = require('path');
+  const tmpdir = require('../common/tmpdir');
+  tmpdir.refresh();
+
+  const read = (json) => {
+    const filename = path.join(tmpdir.path, 'package.json');
+    require('fs').writeFileSync(filename, json);
+    return internalModuleReadPackageJSON(filename);
+  };
+
+  strictEqual(internalModuleReadPackageJSON('nosuchfile'), undefined);
+
+  // Only the JSON texts of the fields used by the module loaders are
+  // returned, as written. The last of duplicate keys wins.
+  deepStrictEqual(
+    read('\ufeff{"name": "pkg", "version": "1.0.0", "type": "module",' +
+         '"exports": {".": "./a.js"}, "dependencies": {"main": "b"},' +
+         '"m\\u0061in": "./a.js", "main" : "./b.js"}'),
+    [undefined, true, '"pkg"', '"./b.js"', '"module"',
+     '{".": "./a.js"}', undefined]);
+  deepStrictEqual(read('[]'), [undefined, false, ...Array(5).fill()]);
+
+  // Files that are not valid JSON are returned whole for JSON.parse().
+  const invalid = '{"main": "./a.js",}';
+  deepStrictEqual(read(invalid), [invalid, true, ...Array(5).fill()]);
+  deepStrictEqual(read(''), ['', false, ...Array(5).fill()]);
+}
@@ -0,0 +1,56 @@
+'use strict';
+
+// This test ensures that --experimental-package-json-cache persists the
+// package.json fields used by the module loaders, and that entries are not
+// used anymore once the package.json changes.
+
+require('../common');
+const assert = require('assert');
+const { execFileSync } = require('child_process');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../common/tmpdir');
+
+tmpdir.refresh();
+
+const cache = path.join(tmpdir.path, 'package-json.cache');
+const modules = path.join(tmpdir.path, 'node_modules');
+const cjs = path.join(modules, 'cjs');
+const esm = path.join(modules, 'esm');
+fs.mkdirSync(cjs, { recursive: true });
+fs.mkdirSync(esm, { recursive: true });
+fs.writeFileSync(path.join(cjs, 'package.json'), '{"main": "./one.js"}');
+fs.writeFileSync(path.join(cjs, 'one.js'), 'module.exports = "cjs one";');
+fs.writeFileSync(path.join(cjs, 'two.js'), 'module.exports = "cjs two";');
+fs.writeFileSync(path.join(esm, 'package.json'), JSON.stringify({
+  name: 'esm',
+  type: 'module',
+  exports: { '.': { import: './index.js' } },
+}));
+fs.writeFileSync(path.join(esm, 'index.js'), 'export default "esm";');
+
+const entry = path.join(tmpdir.path, 'entry.mjs');
+fs.writeFileSync(entry, `
+  import cjs from 'cjs';
+  import esm from 'esm';
+  console.log(cjs, esm);
+`);
+
+function run() {
+  return execFileSync(process.execPath, [
+    `--experimental-package-json-cache=${cache}`,
+    entry,
+  ], { cwd: tmpdir.path, encoding: 'utf8' }).trim();
+}
+
+assert.strictEqual(run(), 'cjs one esm');
+assert(fs.statSync(cache).size > 0);
+assert.strictEqual(run(), 'cjs one esm');
+
+fs.writeFileSync(path.join(cjs, 'package.json'), '{"main": "./two.js"}');
+assert.strictEqual(run(), 'cjs two esm');
+
+// Cache files that can't be read are ignored and replaced.
+fs.writeFileSync(cache, 'garbage');
+assert.strictEqual(run(), 'cjs two esm');
+assert.notStrictEqual(fs.readFileSync(cache, 'latin1'), 'garbage');
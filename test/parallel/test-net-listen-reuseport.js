@@ -0,0 +1,67 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+
+// This test ensures that several servers can listen on the same port when
+// the `reusePort` option is passed to `net.Server.listen()`.
+
+for (const reusePort of [1, 'true', null]) {
+  assert.throws(() => net.createServer().listen({ port: 0, reusePort }), {
+    code: 'ERR_INVALID_ARG_TYPE',
+  });
+}
+
+assert.throws(() => net.createServer().listen({
+  port: 0,
+  reusePort: true,
+  reusePortSteering: 'hash',
+}), { code: 'ERR_INVALID_ARG_VALUE' });
+
+assert.throws(() => net.createServer().listen({
+  port: 0,
+  reusePortSteering: 'cpu',
+}), { code: 'ERR_INVALID_ARG_VALUE' });
+
+if (!common.isLinux && !common.isFreeBSD) {
+  net.createServer().listen({ port: 0, reusePort: true })
+    .on('error', common.mustCall((err) => {
+      assert.strictEqual(err.code, 'ENOTSUP');
+    }));
+  return;
+}
+
+const first = net.createServer(common.mustNotCall());
+first.listen({
+  host: common.localhostIPv4,
+  port: 0,
+  reusePort: true,
+}, common.mustCall(() => {
+  const { port } = first.address();
+
+  // Without reusePort the port is still taken.
+  net.createServer().listen({ host: common.localhostIPv4, port })
+    .on('error', common.mustCall((err) => {
+      assert.strictEqual(err.code, 'EADDRINUSE');
+    }));
+
+  // Only Linux supports steering, other platforms fail with ENOTSUP.
+  const second = net.createServer();
+  second.listen({
+    host: common.localhostIPv4,
+    port,
+    reusePort: true,
+    reusePortSteering: common.isLinux ? 'cpu' : undefined,
+  }, common.mustCall(() => {
+    assert.strictEqual(second.address().port, port);
+    // Closing the first server leaves the second one accepting connections.
+    first.close(common.mustCall(() => {
+      second.once('connection', common.mustCall((socket) => {
+        socket.end();
+        second.close();
+      }));
+      net.connect(port, common.localhostIPv4).resume();
+    }));
+  }));
+}));
@@ -0,0 +1,67 @@
+'use strict';
+
+// With `autoCork`, the writes that a socket makes in one turn of the event
+// loop are written together. Small writes are done right away, larger ones
+// when the data has been written.
+
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+
+const chunks = [];
+for (let i = 0; i < 100; i++)
+  chunks.push(`chunk ${i}\n`);
+const large = 'x'.repeat(100 * 1024);
+const expected = chunks.join('') + large + 'end';
+
+const server = net.createServer({ autoCork: true }, common.mustCall((socket) => {
+  for (const chunk of chunks)
+    socket.write(chunk, common.mustCall());
+  assert.strictEqual(socket.writableLength, 0);
+  assert.deepStrictEqual(socket.autoCorkStats, { writes: 100, flushes: 0 });
+
+  socket.write(large, common.mustCall(() => {
+    assert.deepStrictEqual(socket.autoCorkStats, { writes: 101, flushes: 1 });
+    socket.end('end');
+  }));
+  assert.strictEqual(socket.writableLength, large.length);
+
+  socket.on('close', common.mustCall(() => {
+    // The shutdown writes the rest without waiting for the next turn.
+    assert.deepStrictEqual(socket.autoCorkStats, { writes: 102, flushes: 2 });
+  }));
+}));
+
+server.listen(0, common.mustCall(() => {
+  const socket = net.connect(server.address().port);
+  let received = '';
+  socket.setEncoding('utf8');
+  socket.on('data', (data) => received += data);
+  socket.on('end', common.mustCall(() => {
+    assert.strictEqual(received, expected);
+    assert.deepStrictEqual(socket.autoCorkStats, { writes: 0, flushes: 0 });
+    server.close();
+  }));
+}));
+
+{
+  // Auto-corking can be turned off again, which writes what is corked.
+  const server = net.createServer(common.mustCall((socket) => {
+    socket.setAutoCork();
+    socket.write('corked', common.mustCall());
+    socket.setAutoCork(false);
+    socket.end('direct');
+    assert.deepStrictEqual(socket.autoCorkStats, { writes: 1, flushes: 1 });
+  }));
+
+  server.listen(0, common.mustCall(() => {
+    const socket = net.connect(server.address().port);
+    let received = '';
+    socket.setEncoding('utf8');
+    socket.on('data', (data) => received += data);
+    socket.on('end', common.mustCall(() => {
+      assert.strictEqual(received, 'corkeddirect');
+      server.close();
+    }));
+  }));
+}
@@ -0,0 +1,94 @@
+// Flags: --expose-internals
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+const { internalBinding } = require('internal/test/binding');
+const { StreamPipe } = internalBinding('stream_pipe');
+
+// This test ensures that socket.forward() passes all data to the destination
+// in order, including data that was read before, waits for a slow
+// destination, and counts the forwarded bytes.
+
+const usedSplice = [];
+const start = StreamPipe.prototype.start;
+StreamPipe.prototype.start = function() {
+  start.call(this);
+  usedSplice.push(this.usesSplice());
+};
+
+// Larger than the socket buffers, so that forwarding has to wait.
+const data = Buffer.alloc(8 * 1024 * 1024);
+for (let i = 0; i < data.length; i++)
+  data[i] = i % 251;
+const head = Buffer.from('head');
+const expected = Buffer.concat([head, data]);
+
+const upstream = net.createServer(common.mustCall((socket) => {
+  const received = [];
+  // Stop reading for a while, so that the proxy has to stop reading from the
+  // client too.
+  socket.pause();
+  setTimeout(() => socket.resume(), 100);
+  socket.on('data', (chunk) => received.push(chunk));
+  socket.on('end', common.mustCall(() => {
+    assert.deepStrictEqual(Buffer.concat(received), expected);
+    socket.end('bye');
+  }));
+}));
+
+// The proxy forwards the end of each direction on its own.
+const proxy = net.createServer({ allowHalfOpen: true }, common.mustCall((client) => {
+  // Data that arrives before forwarding starts is buffered in JS.
+  client.once('readable', common.mustCall(() => {
+    const server = net.connect({
+      port: upstream.address().port,
+      allowHalfOpen: true,
+    });
+    client.forward(server, common.mustSucceed(() => {
+      assert.strictEqual(client.bytesRead, expected.length);
+      assert.strictEqual(server.bytesWritten, expected.length);
+    }));
+    server.forward(client, common.mustSucceed(() => {
+      assert.strictEqual(server.bytesRead, 3);
+    }));
+    assert.throws(() => client.forward(server), {
+      code: 'ERR_INVALID_STATE',
+    });
+  }));
+}));
+
+upstream.listen(0, common.mustCall(() => {
+  proxy.listen(0, common.mustCall(() => {
+    const socket = net.connect(proxy.address().port);
+    socket.write(head);
+    setTimeout(() => socket.end(data), 50);
+    let response = '';
+    socket.setEncoding('utf8');
+    socket.on('data', (chunk) => response += chunk);
+    socket.on('end', common.mustCall(() => {
+      assert.strictEqual(response, 'bye');
+      assert.strictEqual(socket.bytesWritten, expected.length);
+      if (common.isLinux)
+        assert.deepStrictEqual(usedSplice, [true, true]);
+      proxy.close();
+      upstream.close();
+    }));
+  }));
+}));
+
+{
+  const socket = new net.Socket();
+  for (const destination of [null, {}, 'socket']) {
+    assert.throws(() => socket.forward(destination), {
+      code: 'ERR_INVALID_ARG_TYPE',
+    });
+  }
+  assert.throws(() => socket.forward(new net.Socket(), { end: 1 }), {
+    code: 'ERR_INVALID_ARG_TYPE',
+  });
+  assert.throws(() => socket.forward(new net.Socket(), {}, 'callback'), {
+    code: 'ERR_INVALID_ARG_TYPE',
+  });
+}
@@ -0,0 +1,52 @@
+'use strict';
+
+// Strings that are stored outside of the V8 heap are written by writev()
+// without being copied when their bytes don't change in the requested
+// encoding. Check that every combination still sends the right bytes.
+
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+
+// Buffer#toString() returns external strings for data larger than this.
+const kExternalLength = 0xFBEE9 + 1;
+
+const ascii = Buffer.alloc(kExternalLength, 'a');
+const latin1 = Buffer.alloc(kExternalLength, 0xe9);
+const ucs2 = Buffer.alloc(kExternalLength * 2, 'ab', 'ucs2');
+
+const chunks = [
+  // Written in place.
+  [ascii.toString('latin1'), 'latin1'],
+  [ascii.toString('latin1'), 'utf8'],
+  [latin1.toString('latin1'), 'latin1'],
+  [latin1.toString('latin1'), 'ascii'],
+  [ucs2.toString('ucs2'), 'ucs2'],
+  // Transcoded, because the string is not ASCII.
+  [latin1.toString('latin1'), 'utf8'],
+  // Copied, as the string is in the V8 heap.
+  ['header\r\n', 'latin1'],
+  ['ü'.repeat(10), 'utf8'],
+];
+const expected = Buffer.concat(chunks.map(([string, encoding]) => {
+  return Buffer.from(string, encoding);
+}));
+
+const server = net.createServer(common.mustCall((socket) => {
+  const received = [];
+  socket.on('data', (data) => received.push(data));
+  socket.on('end', common.mustCall(() => {
+    assert.ok(Buffer.concat(received).equals(expected));
+    server.close();
+  }));
+}));
+
+server.listen(0, common.mustCall(() => {
+  const socket = net.connect(server.address().port, common.mustCall(() => {
+    socket.cork();
+    for (const [string, encoding] of chunks)
+      socket.write(string, encoding);
+    socket.uncork();
+    socket.end();
+  }));
+}));
@@ -0,0 +1,70 @@
+'use strict';
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+const dns = require('dns');
+const fs = require('fs');
+const zlib = require('zlib');
+const { monitorThreadpool } = require('perf_hooks');
+
+const classes = ['fs', 'crypto', 'compression', 'dns', 'user'];
+
+{
+  const monitor = monitorThreadpool();
+  assert.deepStrictEqual(Object.keys(monitor), classes);
+  for (const name of classes)
+    assert.deepStrictEqual(Object.keys(monitor[name]), ['wait', 'run']);
+  assert(monitor.enable());
+  assert(!monitor.enable());
+  monitor.reset();
+  assert(monitor.disable());
+  assert(!monitor.disable());
+  for (const name of classes) {
+    assert.strictEqual(monitor[name].wait.count, 0);
+    assert.strictEqual(monitor[name].run.count, 0);
+  }
+}
+
+{
+  const monitor = monitorThreadpool();
+  const idle = monitorThreadpool();
+  monitor.enable();
+
+  const done = common.mustCall(() => {
+    monitor.disable();
+    for (const name of ['fs', 'crypto', 'compression', 'dns']) {
+      assert(monitor[name].wait.count > 0, name);
+      assert(monitor[name].run.count > 0, name);
+      assert(monitor[name].run.min >= 1, name);
+    }
+    assert.strictEqual(monitor.user.run.count, 0);
+
+    // A monitor that was never enabled records nothing.
+    for (const name of classes)
+      assert.strictEqual(idle[name].run.count, 0);
+
+    monitor.reset();
+    assert.strictEqual(monitor.fs.wait.count, 0);
+    fs.stat(__filename, common.mustSucceed(() => {
+      // Disabled monitors stop recording.
+      assert.strictEqual(monitor.fs.wait.count, 0);
+    }));
+  });
+
+  let pending = 4;
+  const next = () => { if (--pending === 0) done(); };
+  fs.stat(__filename, common.mustSucceed(next));
+  crypto.pbkdf2('secret', 'salt', 1000, 32, 'sha256', common.mustSucceed(next));
+  zlib.gzip('hello', common.mustSucceed(next));
+  dns.lookup('localhost', common.mustSucceed(next));
+}
+
+{
+  assert.throws(() => monitorThreadpool().enable.call({}), {
+    code: 'ERR_INVALID_THIS',
+  });
+}
@@ -0,0 +1,55 @@
+// Flags: --threadpool-class-concurrency=crypto=1
+'use strict';
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const { spawnSync } = require('child_process');
+const crypto = require('crypto');
+const fs = require('fs');
+
+const classes = ['fs', 'crypto', 'compression', 'dns', 'user'];
+
+{
+  const usage = process.threadpoolUsage();
+  assert.deepStrictEqual(Object.keys(usage), classes);
+  for (const name of classes)
+    assert.deepStrictEqual(usage[name], { active: 0, queued: 0 });
+}
+
+{
+  // Only one crypto job is handed to the threadpool at a time, the others
+  // wait in their lane and still complete.
+  const jobs = 4;
+  const onDone = common.mustSucceed(() => {
+    assert.ok(process.threadpoolUsage().crypto.active <= 1);
+  }, jobs);
+  for (let i = 0; i < jobs; i++)
+    crypto.pbkdf2('secret', 'salt', 1, 32, 'sha256', onDone);
+
+  assert.deepStrictEqual(process.threadpoolUsage().crypto,
+                         { active: 1, queued: jobs - 1 });
+
+  // File system requests are counted but never held back.
+  fs.stat(__filename, common.mustSucceed());
+  assert.deepStrictEqual(process.threadpoolUsage().fs,
+                         { active: 1, queued: 0 });
+}
+
+for (const [flag, value] of [
+  ['--threadpool-class-concurrency', 'cpu=1'],
+  ['--threadpool-class-concurrency', 'crypto='],
+  ['--threadpool-class-concurrency', 'fs=1'],
+  ['--threadpool-class-concurrency', 'dns=1'],
+  ['--threadpool-class-weight', 'crypto=0'],
+  ['--threadpool-class-weight', 'crypto=1001'],
+  ['--threadpool-class-weight', 'dns=2'],
+]) {
+  const child = spawnSync(process.execPath,
+                          [`${flag}=${value}`, '-e', '0'],
+                          { encoding: 'utf8' });
+  assert.notStrictEqual(child.status, 0);
+  assert.match(child.stderr, new RegExp(`${flag}.*${value}`));
+}
@@ -76,6 +76,9 @@ tests['fs.sync.open'] = 'fs.writeFileSync("fs16.txt", "123", "utf8");' +
 tests['fs.sync.read'] = 'fs.writeFileSync("fs17.txt", "123", "utf8");' +
                         'fs.readFileSync("fs17.txt");' +
                         'fs.unlinkSync("fs17.txt")';
+tests['fs.sync.readFile'] = 'fs.writeFileSync("fs31.txt", "123", "utf8");' +
+                            'fs.readFileSync("fs31.txt", "utf8");' +
+                            'fs.unlinkSync("fs31.txt")';
 tests['fs.sync.readdir'] = 'fs.readdirSync("./")';
 tests['fs.sync.realpath'] = 'fs.writeFileSync("fs18.txt", "123", "utf8");' +
                             'fs.linkSync("fs18.txt", "fs19.txt");' +
@@ -0,0 +1,31 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+
+const { MessageChannel } = require('worker_threads');
+
+// Make sure that a port with a long queue of messages does not keep other
+// ports from receiving theirs: all ports share a budget of messages per event
+// loop iteration and take turns.
+
+const busy = new MessageChannel();
+const idle = new MessageChannel();
+const kMessages = 5000;
+
+let received = 0;
+busy.port1.on('message', common.mustCall((i) => {
+  // Messages are still delivered in order.
+  assert.strictEqual(i, received++);
+  if (received === kMessages)
+    busy.port1.close();
+}, kMessages));
+
+idle.port1.on('message', common.mustCall(() => {
+  assert(received > 0);
+  assert(received < kMessages, `${received} messages were received first`);
+  idle.port1.close();
+}));
+
+for (let i = 0; i < kMessages; i++)
+  busy.port2.postMessage(i);
+idle.port2.postMessage('hello');
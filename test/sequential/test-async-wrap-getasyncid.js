@@ -66,6 +66,8 @@ const { getSystemErrorName } = require('util');
     delete providers.FIXEDSIZEBLOBCOPY;
     delete providers.RANDOMPRIMEREQUEST;
     delete providers.CHECKPRIMEREQUEST;
+    if (!common.isLinux)
+      delete providers.RECURSIVEFSEVENTWRAP;
 
     const objKeys = Object.keys(providers);
     if (objKeys.length > 0)
@@ -112,6 +114,11 @@ function testInitialized(req, ctor_name) {
   testInitialized(new FSEvent(), 'FSEvent');
 }
 
+if (common.isLinux) {
+  const { RecursiveFSEvent } = internalBinding('fs_event_wrap');
+  testInitialized(new RecursiveFSEvent(), 'RecursiveFSEvent');
+}
+
 
 {
   const JSStream = internalBinding('js_stream').JSStream;
@@ -161,6 +168,20 @@ if (common.hasCrypto) { // eslint-disable-line node-core/crypto-check
   testInitialized(req, 'FSReqCallback');
   binding.access(path.toNamespacedPath('../'), fs.F_OK, req);
 
+  const job = new binding.FSStatManyJob([__filename], 'stat', fs.F_OK, false);
+  job.oncomplete = () => { };
+  testInitialized(job, 'FSStatManyJob');
+  job.run();
+
+  const readFileJob = new binding.FSReadFileJob(__filename, fs.O_RDONLY, false);
+  readFileJob.oncomplete = () => { };
+  testInitialized(readFileJob, 'FSReadFileJob');
+  readFileJob.run();
+
+  const fileWriter = new binding.FileWriter(1, -1, 1, 0, 1, false, false);
+  testInitialized(fileWriter, 'FileWriter');
+  fileWriter.close();
+
   const StatWatcher = binding.StatWatcher;
   testInitialized(new StatWatcher(), 'StatWatcher');
 }
@@ -327,4 +348,10 @@ if (process.features.inspector && common.isMainThread) {
   const dirBinding = internalBinding('fs_dir');
   const handle = dirBinding.opendir('./', 'utf8', undefined, {});
   testInitialized(handle, 'DirHandle');
+
+  const walker = new dirBinding.DirWalker(__dirname, 'utf8');
+  walker.onbatch = () => { };
+  walker.oncomplete = () => { };
+  testInitialized(walker, 'DirWalker');
+  walker.start();
 }
@@ -0,0 +1,50 @@
+'use strict';
+
+// When more events happen than inotify can queue, the recursive watcher
+// reports the watched directory itself as renamed and watches the
+// directories that were created while events were being lost.
+
+const common = require('../common');
+
+if (!common.isLinux)
+  common.skip('the inotify based recursive watcher is only used on Linux');
+
+const fs = require('fs');
+const path = require('path');
+
+let maxQueuedEvents;
+try {
+  maxQueuedEvents =
+    Number(fs.readFileSync('/proc/sys/fs/inotify/max_queued_events', 'utf8'));
+} catch {
+  common.skip('fs.inotify.max_queued_events is not readable');
+}
+if (!(maxQueuedEvents <= 65536))
+  common.skip('fs.inotify.max_queued_events is too large to overflow');
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+const rootDirectory = fs.mkdtempSync(tmpdir.path + path.sep);
+fs.mkdirSync(path.join(rootDirectory, 'files'));
+const expected = path.join('late', 'after.txt');
+
+const watcher = fs.watch(rootDirectory, { recursive: true });
+watcher.on('change', function onChange(event, filename) {
+  if (filename !== path.basename(rootDirectory))
+    return;
+  // Only seen if the watch on 'late' was added by the rescan, as the event
+  // for its creation was lost.
+  watcher.off('change', onChange);
+  watcher.on('change', (event, filename) => {
+    if (filename === expected)
+      watcher.close();
+  });
+  fs.writeFileSync(path.join(rootDirectory, expected), 'after');
+});
+watcher.on('close', common.mustCall());
+
+// Nothing is read from the inotify instance until this returns.
+for (let i = 0; i <= maxQueuedEvents; i++)
+  fs.closeSync(fs.openSync(path.join(rootDirectory, 'files', `${i}`), 'w'));
+fs.mkdirSync(path.join(rootDirectory, 'late'));
@@ -0,0 +1,63 @@
+// Flags: --expose-internals
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const { monitorEventLoopPhases } = require('perf_hooks');
+const { sleep } = require('internal/util');
+
+const phases = ['timers', 'pending', 'idle', 'prepare', 'poll', 'check',
+                'close'];
+
+{
+  const monitor = monitorEventLoopPhases();
+  assert.deepStrictEqual(Object.keys(monitor), phases);
+  assert(monitor.enable());
+  assert(!monitor.enable());
+  monitor.reset();
+  assert(monitor.disable());
+  assert(!monitor.disable());
+  for (const phase of phases)
+    assert.strictEqual(monitor[phase].count, 0);
+}
+
+{
+  const monitor = monitorEventLoopPhases();
+  const idle = monitorEventLoopPhases();
+  monitor.enable();
+
+  setTimeout(common.mustCall(() => {
+    sleep(50);
+    setImmediate(common.mustCall(() => {
+      sleep(50);
+      setTimeout(common.mustCall(check), 10);
+    }));
+  }), 10);
+
+  function check() {
+    monitor.disable();
+
+    for (const phase of phases)
+      assert(monitor[phase].count > 0, phase);
+    // Durations are in nanoseconds.
+    assert(monitor.timers.max >= 50e6, `${monitor.timers.max}`);
+    assert(monitor.check.max >= 50e6, `${monitor.check.max}`);
+
+    // A monitor that was never enabled records nothing.
+    for (const phase of phases)
+      assert.strictEqual(idle[phase].count, 0);
+
+    const { count } = monitor.timers;
+    setTimeout(common.mustCall(() => {
+      assert.strictEqual(monitor.timers.count, count);
+      monitor.reset();
+      assert.strictEqual(monitor.timers.count, 0);
+    }), 10);
+  }
+}
+
+{
+  assert.throws(() => monitorEventLoopPhases().enable.call({}), {
+    code: 'ERR_INVALID_THIS',
+  });
+}
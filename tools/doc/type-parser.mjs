@@ -106,6 +106,7 @@ const customTypesMap = {
   'Ed448Params': 'webcrypto.html#class-ed448params',
 
   'dgram.Socket': 'dgram.html#class-dgramsocket',
+  'MessageBatch': 'dgram.html#class-messagebatch',
 
   'Channel': 'diagnostics_channel.html#class-channel',
 
@@ -122,6 +123,7 @@ const customTypesMap = {
   'EventListener': 'events.html#event-listener',
 
   'FileHandle': 'fs.html#class-filehandle',
+  'FileWriter': 'fs.html#class-filewriter',
   'fs.Dir': 'fs.html#class-fsdir',
   'fs.Dirent': 'fs.html#class-fsdirent',
   'fs.FSWatcher': 'fs.html#class-fsfswatcher',
@@ -171,11 +173,14 @@ const customTypesMap = {
 
   'os.constants.dlopen': 'os.html#dlopen-constants',
 
+  'EventLoopPhasesMonitor':
+     'perf_hooks.html#perf_hooksmonitoreventloopphases',
   'Histogram': 'perf_hooks.html#class-histogram',
   'IntervalHistogram':
      'perf_hooks.html#class-intervalhistogram-extends-histogram',
   'RecordableHistogram':
      'perf_hooks.html#class-recordablehistogram-extends-histogram',
+  'ThreadpoolMonitor': 'perf_hooks.html#perf_hooksmonitorthreadpool',
   'PerformanceEntry': 'perf_hooks.html#class-performanceentry',
   'PerformanceNodeTiming':
     'perf_hooks.html#class-performancenodetiming',
@@ -73,6 +73,8 @@ declare namespace InternalFSBinding {
   function copyFile(src: StringOrBuffer, dest: StringOrBuffer, mode: number, req: undefined, ctx: FSSyncContext): void;
   function copyFile(src: StringOrBuffer, dest: StringOrBuffer, mode: number, usePromises: typeof kUsePromises): Promise<void>;
 
+  function existsSync(path: StringOrBuffer): boolean;
+
   function fchmod(fd: number, mode: number, req: FSReqCallback): void;
   function fchmod(fd: number, mode: number, req: undefined, ctx: FSSyncContext): void;
   function fchmod(fd: number, mode: number, usePromises: typeof kUsePromises): Promise<void>;
@@ -108,6 +110,7 @@ declare namespace InternalFSBinding {
   function futimes(fd: number, atime: number, mtime: number, usePromises: typeof kUsePromises): Promise<void>;
 
   function internalModuleReadJSON(path: string): [] | [string, boolean];
+  function internalModuleReadPackageJSON(path: string): undefined | [string | undefined, boolean, ...(string | undefined)[]];
   function internalModuleStat(path: string): number;
   
   function lchown(path: string, uid: number, gid: number, req: FSReqCallback): void;
@@ -146,6 +149,8 @@ declare namespace InternalFSBinding {
   function mkdir(path: string, mode: number, recursive: true, usePromises: typeof kUsePromises): Promise<string>;
   function mkdir(path: string, mode: number, recursive: false, usePromises: typeof kUsePromises): Promise<void>;
 
+  function mmapSync(pathOrFd: StringOrBuffer | number, offset: number, length: number, advice: number, ctx: FSSyncContext): Buffer | undefined;
+
   function open(path: StringOrBuffer, flags: number, mode: number, req: FSReqCallback<number>): void;
   function open(path: StringOrBuffer, flags: number, mode: number, req: undefined, ctx: FSSyncContext): number;
 
@@ -169,6 +174,8 @@ declare namespace InternalFSBinding {
   function readdir(path: StringOrBuffer, encoding: unknown, withFileTypes: true, usePromises: typeof kUsePromises): Promise<[string[], number[]]>;
   function readdir(path: StringOrBuffer, encoding: unknown, withFileTypes: false, usePromises: typeof kUsePromises): Promise<string[]>;
 
+  function readFileSync(pathOrFd: StringOrBuffer | number, flags: number | undefined, utf8: boolean, ctx: FSSyncContext): string | Buffer | undefined;
+
   function readlink(path: StringOrBuffer, encoding: unknown, req: FSReqCallback<string | Buffer>): void;
   function readlink(path: StringOrBuffer, encoding: unknown, req: undefined, ctx: FSSyncContext): string | Buffer;
   function readlink(path: StringOrBuffer, encoding: unknown, usePromises: typeof kUsePromises): Promise<string | Buffer>;
@@ -195,6 +202,8 @@ declare namespace InternalFSBinding {
   function stat(path: StringOrBuffer, useBigint: true, usePromises: typeof kUsePromises): Promise<BigUint64Array>;
   function stat(path: StringOrBuffer, useBigint: false, usePromises: typeof kUsePromises): Promise<Float64Array>;
 
+  function statSync(path: StringOrBuffer, useBigint: boolean): number;
+
   function symlink(target: StringOrBuffer, path: StringOrBuffer, type: number, req: FSReqCallback): void;
   function symlink(target: StringOrBuffer, path: StringOrBuffer, type: number, req: undefined, ctx: FSSyncContext): void;
   function symlink(target: StringOrBuffer, path: StringOrBuffer, type: number, usePromises: typeof kUsePromises): Promise<void>;
@@ -238,6 +247,7 @@ declare function InternalBinding(binding: 'fs'): {
   chown: typeof InternalFSBinding.chown;
   close: typeof InternalFSBinding.close;
   copyFile: typeof InternalFSBinding.copyFile;
+  existsSync: typeof InternalFSBinding.existsSync;
   fchmod: typeof InternalFSBinding.fchmod;
   fchown: typeof InternalFSBinding.fchown;
   fdatasync: typeof InternalFSBinding.fdatasync;
@@ -246,6 +256,7 @@ declare function InternalBinding(binding: 'fs'): {
   ftruncate: typeof InternalFSBinding.ftruncate;
   futimes: typeof InternalFSBinding.futimes;
   internalModuleReadJSON: typeof InternalFSBinding.internalModuleReadJSON;
+  internalModuleReadPackageJSON: typeof InternalFSBinding.internalModuleReadPackageJSON;
   internalModuleStat: typeof InternalFSBinding.internalModuleStat;
   lchown: typeof InternalFSBinding.lchown;
   link: typeof InternalFSBinding.link;
@@ -258,11 +269,14 @@ declare function InternalBinding(binding: 'fs'): {
   read: typeof InternalFSBinding.read;
   readBuffers: typeof InternalFSBinding.readBuffers;
   readdir: typeof InternalFSBinding.readdir;
+  readFileSync: typeof InternalFSBinding.readFileSync;
+  mmapSync: typeof InternalFSBinding.mmapSync;
   readlink: typeof InternalFSBinding.readlink;
   realpath: typeof InternalFSBinding.realpath;
   rename: typeof InternalFSBinding.rename;
   rmdir: typeof InternalFSBinding.rmdir;
   stat: typeof InternalFSBinding.stat;
+  statSync: typeof InternalFSBinding.statSync;
   symlink: typeof InternalFSBinding.symlink;
   unlink: typeof InternalFSBinding.unlink;
   utimes: typeof InternalFSBinding.utimes;